@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <vector>
+
+#include <stdlib.h>
+
+#include <dali/public-api/dali-core.h>
+#include <dali-test-suite-utils.h>
+
+// Internal headers are allowed here
+
+#include <dali/internal/event/images/atlas-packer.h>
+
+using namespace Dali;
+using Internal::AtlasPacker;
+
+void utc_dali_internal_atlas_packer_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_atlas_packer_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const unsigned int ATLAS_SIZE( 1024u );
+
+struct Block
+{
+  unsigned int x;
+  unsigned int y;
+  unsigned int width;
+  unsigned int height;
+};
+
+bool Overlap( const Block& first, const Block& second )
+{
+  return first.x < second.x + second.width && second.x < first.x + first.width &&
+         first.y < second.y + second.height && second.y < first.y + first.height;
+}
+
+bool CheckBlocks( const std::vector< Block >& blocks )
+{
+  for( unsigned int i = 0; i < blocks.size(); ++i )
+  {
+    if( blocks[i].x + blocks[i].width > ATLAS_SIZE || blocks[i].y + blocks[i].height > ATLAS_SIZE )
+    {
+      return false;
+    }
+    for( unsigned int j = i + 1u; j < blocks.size(); ++j )
+    {
+      if( Overlap( blocks[i], blocks[j] ) )
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * The icons of a typical application, from 16x16 to 96x96
+ */
+void GetIconSize( unsigned int& width, unsigned int& height )
+{
+  const unsigned int SIZES[] = { 16u, 24u, 32u, 48u, 64u, 96u };
+  width = SIZES[ rand() % 6 ];
+  height = ( rand() % 4 == 0 ) ? SIZES[ rand() % 6 ] : width;
+}
+
+/**
+ * Rows of blocks from left to right, as the ad hoc packers of the components do
+ */
+class ShelfPacker
+{
+public:
+  ShelfPacker() : mX( 0u ), mY( 0u ), mShelfHeight( 0u ) {}
+
+  bool Pack( unsigned int width, unsigned int height )
+  {
+    if( mX + width > ATLAS_SIZE )
+    {
+      mX = 0u;
+      mY += mShelfHeight;
+      mShelfHeight = 0u;
+    }
+    if( mY + height > ATLAS_SIZE )
+    {
+      return false;
+    }
+    mX += width;
+    mShelfHeight = std::max( mShelfHeight, height );
+    return true;
+  }
+
+private:
+  unsigned int mX;
+  unsigned int mY;
+  unsigned int mShelfHeight;
+};
+
+} // unnamed namespace
+
+int UtcDaliAtlasPackerPack(void)
+{
+  TestApplication application;
+  tet_infoline("Test that the blocks are allocated without overlap until the atlas is full, and the whole area is reused");
+
+  AtlasPacker packer( ATLAS_SIZE, ATLAS_SIZE );
+  DALI_TEST_EQUALS( packer.GetAvailableArea(), ATLAS_SIZE * ATLAS_SIZE, TEST_LOCATION );
+
+  // Exactly full with blocks of the same size
+  std::vector< Block > blocks;
+  Block block = { 0u, 0u, 128u, 64u };
+  while( packer.Pack( block.width, block.height, block.x, block.y ) )
+  {
+    blocks.push_back( block );
+  }
+  DALI_TEST_EQUALS( blocks.size(), 128u, TEST_LOCATION );
+  DALI_TEST_EQUALS( packer.GetAvailableArea(), 0u, TEST_LOCATION );
+  DALI_TEST_CHECK( CheckBlocks( blocks ) );
+
+  // Deleting all the blocks merges the free area back into one rectangle
+  for( unsigned int i = 0; i < blocks.size(); ++i )
+  {
+    packer.DeleteBlock( blocks[i].x, blocks[i].y, blocks[i].width, blocks[i].height );
+  }
+  DALI_TEST_EQUALS( packer.GetAvailableArea(), ATLAS_SIZE * ATLAS_SIZE, TEST_LOCATION );
+  DALI_TEST_EQUALS( packer.GetFreeRectangleCount(), 1u, TEST_LOCATION );
+  DALI_TEST_CHECK( packer.Pack( ATLAS_SIZE, ATLAS_SIZE, block.x, block.y ) );
+
+  // Too large, or empty
+  packer.Reset();
+  DALI_TEST_CHECK( !packer.Pack( ATLAS_SIZE + 1u, 1u, block.x, block.y ) );
+  DALI_TEST_CHECK( !packer.Pack( 0u, 1u, block.x, block.y ) );
+
+  END_TEST;
+}
+
+int UtcDaliAtlasPackerIcons(void)
+{
+  TestApplication application;
+  tet_infoline("Compare the occupancy of an atlas of icons with the shelf packing, then with icons released and loaded");
+
+  srand( 3 );
+  std::vector< Block > icons;
+  for( unsigned int i = 0; i < 2000u; ++i )
+  {
+    Block icon = { 0u, 0u, 0u, 0u };
+    GetIconSize( icon.width, icon.height );
+    icons.push_back( icon );
+  }
+
+  // Until the first failure, as a page would then be started
+  AtlasPacker packer( ATLAS_SIZE, ATLAS_SIZE );
+  std::vector< Block > blocks;
+  unsigned int packedArea( 0u );
+  for( unsigned int i = 0; i < icons.size(); ++i )
+  {
+    Block block( icons[i] );
+    if( !packer.Pack( block.width, block.height, block.x, block.y ) )
+    {
+      break;
+    }
+    blocks.push_back( block );
+    packedArea += block.width * block.height;
+  }
+  DALI_TEST_CHECK( CheckBlocks( blocks ) );
+  DALI_TEST_EQUALS( packer.GetAvailableArea(), ATLAS_SIZE * ATLAS_SIZE - packedArea, TEST_LOCATION );
+
+  ShelfPacker shelfPacker;
+  unsigned int shelfArea( 0u );
+  for( unsigned int i = 0; i < icons.size() && shelfPacker.Pack( icons[i].width, icons[i].height ); ++i )
+  {
+    shelfArea += icons[i].width * icons[i].height;
+  }
+
+  tet_printf( "%u icons: guillotine occupancy %.1f%%, shelf occupancy %.1f%%\n", static_cast<unsigned int>( blocks.size() ),
+              100.0f * packedArea / ( ATLAS_SIZE * ATLAS_SIZE ), 100.0f * shelfArea / ( ATLAS_SIZE * ATLAS_SIZE ) );
+  DALI_TEST_CHECK( packedArea >= shelfArea );
+
+  // Release every other icon, then load new ones in the free areas
+  std::vector< Block > remaining;
+  for( unsigned int i = 0; i < blocks.size(); ++i )
+  {
+    if( i % 2u )
+    {
+      packer.DeleteBlock( blocks[i].x, blocks[i].y, blocks[i].width, blocks[i].height );
+      packedArea -= blocks[i].width * blocks[i].height;
+    }
+    else
+    {
+      remaining.push_back( blocks[i] );
+    }
+  }
+  const unsigned int releasedArea = ATLAS_SIZE * ATLAS_SIZE - packedArea;
+  unsigned int reloadedArea( 0u );
+  for( unsigned int i = blocks.size(); i < icons.size(); ++i )
+  {
+    Block block( icons[i] );
+    if( packer.Pack( block.width, block.height, block.x, block.y ) )
+    {
+      remaining.push_back( block );
+      reloadedArea += block.width * block.height;
+    }
+  }
+  DALI_TEST_CHECK( CheckBlocks( remaining ) );
+  tet_printf( "Reused %.1f%% of the area released, with %u free rectangles left\n", 100.0f * reloadedArea / releasedArea, packer.GetFreeRectangleCount() );
+  DALI_TEST_CHECK( reloadedArea * 2u > releasedArea );
+
+  END_TEST;
+}
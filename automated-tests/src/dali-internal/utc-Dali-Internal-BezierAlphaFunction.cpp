@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cmath>
+#include <vector>
+
+#include <stdlib.h>
+
+#include <dali/public-api/dali-core.h>
+#include <dali-test-suite-utils.h>
+
+// Internal headers are allowed here
+
+#include <dali/internal/update/animation/scene-graph-bezier-alpha-function.h>
+
+using namespace Dali;
+using Internal::SceneGraph::BezierAlphaFunction;
+using Internal::SceneGraph::BezierAlphaFunctionPtr;
+
+void utc_dali_internal_bezier_alpha_function_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_bezier_alpha_function_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const unsigned int ANIMATOR_COUNT( 10000u );
+const unsigned int FRAME_COUNT( 60u );
+
+// The curves of a typical motion specification
+const float CURVES[][4] =
+{
+  { 0.25f, 0.1f, 0.25f, 1.0f },   // ease
+  { 0.42f, 0.0f, 1.0f, 1.0f },    // ease-in
+  { 0.0f, 0.0f, 0.58f, 1.0f },    // ease-out
+  { 0.42f, 0.0f, 0.58f, 1.0f },   // ease-in-out
+  { 0.4f, 0.0f, 0.2f, 1.0f },     // standard
+  { 0.0f, 0.0f, 0.2f, 1.0f },     // decelerate
+  { 0.4f, 0.0f, 1.0f, 1.0f },     // accelerate
+  { 0.68f, -0.55f, 0.265f, 1.55f } // back
+};
+const unsigned int CURVE_COUNT( sizeof( CURVES ) / sizeof( CURVES[0] ) );
+
+Vector4 GetControlPoints( unsigned int curve )
+{
+  return Vector4( CURVES[curve][0], CURVES[curve][1], CURVES[curve][2], CURVES[curve][3] );
+}
+
+double EvaluateCubicBezier( double p0, double p1, double t )
+{
+  return 3.0 * ( 1.0 - t ) * ( 1.0 - t ) * t * p0 + 3.0 * ( 1.0 - t ) * t * t * p1 + t * t * t;
+}
+
+/**
+ * The curve evaluated with a precise bisection
+ */
+float EvaluateReference( const Vector4& controlPoints, float progress )
+{
+  double lowerBound( 0.0 );
+  double upperBound( 1.0 );
+  for( unsigned int i = 0; i < 60u; ++i )
+  {
+    const double t = ( lowerBound + upperBound ) * 0.5;
+    if( EvaluateCubicBezier( controlPoints.x, controlPoints.z, t ) < progress )
+    {
+      lowerBound = t;
+    }
+    else
+    {
+      upperBound = t;
+    }
+  }
+  return static_cast<float>( EvaluateCubicBezier( controlPoints.y, controlPoints.w, ( lowerBound + upperBound ) * 0.5 ) );
+}
+
+/**
+ * The bisection the animators used to do each frame
+ */
+float EvaluateBisection( const Vector4& controlPoints, float progress )
+{
+  const float tolerance = 0.001f;
+
+  float lowerBound(0.0f);
+  float upperBound(1.0f);
+  float currentT(0.5f);
+  float currentX = static_cast<float>( EvaluateCubicBezier( controlPoints.x, controlPoints.z, currentT ) );
+  while( fabs( progress - currentX ) > tolerance )
+  {
+    if( progress > currentX )
+    {
+      lowerBound = currentT;
+    }
+    else
+    {
+      upperBound = currentT;
+    }
+    currentT = (upperBound+lowerBound)*0.5f;
+    currentX = static_cast<float>( EvaluateCubicBezier( controlPoints.x, controlPoints.z, currentT ) );
+  }
+  return static_cast<float>( EvaluateCubicBezier( controlPoints.y, controlPoints.w, currentT ) );
+}
+
+} // unnamed namespace
+
+int UtcDaliBezierAlphaFunctionShared(void)
+{
+  TestApplication application;
+  tet_infoline("Test that the animators using the same curve share its table");
+
+  std::vector< BezierAlphaFunctionPtr > alphaFunctions;
+  for( unsigned int i = 0; i < ANIMATOR_COUNT; ++i )
+  {
+    alphaFunctions.push_back( BezierAlphaFunction::Get( GetControlPoints( i % CURVE_COUNT ) ) );
+  }
+
+  for( unsigned int i = 0; i < ANIMATOR_COUNT; ++i )
+  {
+    DALI_TEST_CHECK( alphaFunctions[i] == alphaFunctions[ i % CURVE_COUNT ] );
+    DALI_TEST_CHECK( alphaFunctions[i]->GetControlPoints() == GetControlPoints( i % CURVE_COUNT ) );
+  }
+  DALI_TEST_EQUALS( alphaFunctions[0]->ReferenceCount(), static_cast<int>( ANIMATOR_COUNT / CURVE_COUNT + 1u ), TEST_LOCATION );
+
+  DALI_TEST_EQUALS( BezierAlphaFunction::GetSharedCount(), CURVE_COUNT, TEST_LOCATION );
+
+  // The released curves are dropped, and created again when used again
+  alphaFunctions.clear();
+  BezierAlphaFunctionPtr created = BezierAlphaFunction::Get( Vector4( 0.1f, 0.2f, 0.3f, 0.4f ) );
+  DALI_TEST_EQUALS( created->ReferenceCount(), 2, TEST_LOCATION );
+  DALI_TEST_EQUALS( BezierAlphaFunction::GetSharedCount(), 1u, TEST_LOCATION );
+  BezierAlphaFunctionPtr ease = BezierAlphaFunction::Get( GetControlPoints( 0 ) );
+  DALI_TEST_EQUALS( ease->ReferenceCount(), 2, TEST_LOCATION );
+  DALI_TEST_EQUALS( BezierAlphaFunction::GetSharedCount(), 2u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliBezierAlphaFunctionEvaluate(void)
+{
+  TestApplication application;
+  tet_infoline("Test the values of the curves, at the ends and for a linear curve");
+
+  for( unsigned int curve = 0; curve < CURVE_COUNT; ++curve )
+  {
+    BezierAlphaFunctionPtr alphaFunction = BezierAlphaFunction::Get( GetControlPoints( curve ) );
+    DALI_TEST_EQUALS( alphaFunction->Evaluate( 0.0f ), 0.0f, 0.0001f, TEST_LOCATION );
+    DALI_TEST_EQUALS( alphaFunction->Evaluate( 1.0f ), 1.0f, 0.0001f, TEST_LOCATION );
+  }
+
+  BezierAlphaFunctionPtr linear = BezierAlphaFunction::Get( Vector4( 0.3f, 0.3f, 0.7f, 0.7f ) );
+  for( unsigned int i = 0; i <= 100u; ++i )
+  {
+    const float progress = static_cast<float>( i ) * 0.01f;
+    DALI_TEST_EQUALS( linear->Evaluate( progress ), progress, TEST_LOCATION );
+  }
+
+  // x(t) is flat in the middle, where a tiny error of x in float precision is a large error of y
+  const Vector4 flat( 1.0f, 0.0f, 0.0f, 1.0f );
+  BezierAlphaFunctionPtr flatFunction = BezierAlphaFunction::Get( flat );
+  for( unsigned int i = 0; i <= 1000u; ++i )
+  {
+    const float progress = static_cast<float>( i ) * 0.001f;
+    DALI_TEST_EQUALS( flatFunction->Evaluate( progress ), EvaluateReference( flat, progress ), 0.01f, TEST_LOCATION );
+  }
+
+  // The same curve through an animation
+  Actor actor = Actor::New();
+  Stage::GetCurrent().Add( actor );
+  Animation animation = Animation::New( 1.0f );
+  animation.AnimateTo( Property( actor, Actor::Property::POSITION_X ), 100.0f, AlphaFunction( Vector2( 0.42f, 0.0f ), Vector2( 0.58f, 1.0f ) ) );
+  animation.Play();
+
+  application.SendNotification();
+  application.Render( 0 );
+  application.Render( 250 );
+  DALI_TEST_EQUALS( actor.GetCurrentPosition().x, 100.0f * EvaluateReference( GetControlPoints( 3 ), 0.25f ), 0.01f, TEST_LOCATION );
+  application.Render( 500 );
+  DALI_TEST_EQUALS( actor.GetCurrentPosition().x, 100.0f * EvaluateReference( GetControlPoints( 3 ), 0.75f ), 0.01f, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliBezierAlphaFunctionManyAnimators(void)
+{
+  TestApplication application;
+  tet_infoline("Compare the sampled curves with the bisection, for many animators using a few curves");
+
+  srand( 42 );
+
+  std::vector< Vector4 > controlPoints;
+  std::vector< BezierAlphaFunctionPtr > alphaFunctions;
+  std::vector< float > offsets;
+  for( unsigned int i = 0; i < ANIMATOR_COUNT; ++i )
+  {
+    const unsigned int curve = rand() % CURVE_COUNT;
+    controlPoints.push_back( GetControlPoints( curve ) );
+    alphaFunctions.push_back( BezierAlphaFunction::Get( controlPoints.back() ) );
+    offsets.push_back( static_cast<float>( rand() % 1000 ) * 0.001f );
+  }
+
+  // The progress of each animator in each frame
+  std::vector< float > progress( ANIMATOR_COUNT * FRAME_COUNT );
+  for( unsigned int frame = 0; frame < FRAME_COUNT; ++frame )
+  {
+    for( unsigned int i = 0; i < ANIMATOR_COUNT; ++i )
+    {
+      progress[ frame * ANIMATOR_COUNT + i ] = fmodf( offsets[i] + static_cast<float>( frame ) / FRAME_COUNT, 1.0f );
+    }
+  }
+
+  std::vector< float > bisectionResults( progress.size() );
+  std::vector< float > sampledResults( progress.size() );
+
+  double start = GetTimeMilliseconds();
+  for( unsigned int frame = 0; frame < FRAME_COUNT; ++frame )
+  {
+    for( unsigned int i = 0; i < ANIMATOR_COUNT; ++i )
+    {
+      const unsigned int index = frame * ANIMATOR_COUNT + i;
+      bisectionResults[index] = EvaluateBisection( controlPoints[i], progress[index] );
+    }
+  }
+  const double bisectionTime = GetTimeMilliseconds() - start;
+
+  start = GetTimeMilliseconds();
+  for( unsigned int frame = 0; frame < FRAME_COUNT; ++frame )
+  {
+    for( unsigned int i = 0; i < ANIMATOR_COUNT; ++i )
+    {
+      const unsigned int index = frame * ANIMATOR_COUNT + i;
+      sampledResults[index] = alphaFunctions[i]->Evaluate( progress[index] );
+    }
+  }
+  const double sampledTime = GetTimeMilliseconds() - start;
+
+  float bisectionMaxError( 0.0f );
+  float sampledMaxError( 0.0f );
+  for( unsigned int frame = 0; frame < FRAME_COUNT; ++frame )
+  {
+    for( unsigned int i = 0; i < ANIMATOR_COUNT; ++i )
+    {
+      const unsigned int index = frame * ANIMATOR_COUNT + i;
+      const float reference = EvaluateReference( controlPoints[i], progress[index] );
+      bisectionMaxError = std::max( bisectionMaxError, fabsf( bisectionResults[index] - reference ) );
+      sampledMaxError = std::max( sampledMaxError, fabsf( sampledResults[index] - reference ) );
+    }
+  }
+
+  tet_printf( "%u animators, %u frames: bisection %.3f ms, max error %f\n", ANIMATOR_COUNT, FRAME_COUNT, bisectionTime, bisectionMaxError );
+  tet_printf( "%u animators, %u frames: sampled %.3f ms, max error %f\n", ANIMATOR_COUNT, FRAME_COUNT, sampledTime, sampledMaxError );
+
+  DALI_TEST_CHECK( sampledMaxError < 0.0001f );
+  DALI_TEST_CHECK( sampledMaxError <= bisectionMaxError );
+
+  END_TEST;
+}
@@ -26,6 +26,9 @@
 #include <dali-test-suite-utils.h>
 #include <mesh-builder.h>
 
+// Internal headers are allowed here
+#include <dali/internal/common/math.h>
+
 using namespace Dali;
 
 #define MAKE_SHADER(A)#A
@@ -431,3 +434,84 @@ int UtcFrustumCullDisabledP(void)
 
   END_TEST;
 }
+
+int UtcFrustumCullManyActorsP(void)
+{
+  TestApplication application;
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  TraceCallStack& drawTrace = glAbstraction.GetDrawTrace();
+  drawTrace.Enable( true );
+
+  // More actors than fit in a SIMD batch, every other one outside of the stage
+  const unsigned int actorCount = 11u;
+  unsigned int visibleCount = 0u;
+  for( unsigned int i = 0; i < actorCount; ++i )
+  {
+    const bool visible = ( i % 2u ) == 0u;
+    Actor meshActor = CreateMeshActorToStage( application, Vector3( visible ? 0.5f : 7.0f, 0.5f, 0.5f ) );
+    meshActor.SetSize( Vector3( 10.0f, 10.0f, 0.1f ) );
+    visibleCount += visible ? 1u : 0u;
+  }
+
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render( 16 );
+
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawElements" ), static_cast<int>( visibleCount ), TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcFrustumCullSpheresP(void)
+{
+  TestApplication application;
+  tet_infoline("Test that the batch culling gives the same result as testing the spheres one by one");
+
+  using Internal::Vec4;
+
+  // An axis aligned box from -100 to 100, planes facing inwards
+  Vec4 planes[ 6 ] =
+  {
+    {  1.0f,  0.0f,  0.0f, 100.0f }, { -1.0f,  0.0f,  0.0f, 100.0f },
+    {  0.0f,  1.0f,  0.0f, 100.0f }, {  0.0f, -1.0f,  0.0f, 100.0f },
+    {  0.0f,  0.0f,  1.0f, 100.0f }, {  0.0f,  0.0f, -1.0f, 100.0f }
+  };
+  const float minRadius = Math::MACHINE_EPSILON_1000;
+
+  srand( 42 );
+  const unsigned int sphereCount = 103u; // Not a multiple of four, to test the remainder
+  std::vector< float > spheres( sphereCount * 4u );
+  for( unsigned int i = 0; i < sphereCount; ++i )
+  {
+    spheres[ i * 4u + 0u ] = static_cast<float>( rand() % 300 - 150 );
+    spheres[ i * 4u + 1u ] = static_cast<float>( rand() % 300 - 150 );
+    spheres[ i * 4u + 2u ] = static_cast<float>( rand() % 300 - 150 );
+    spheres[ i * 4u + 3u ] = static_cast<float>( rand() % 60 );
+  }
+
+  std::vector< uint32_t > visibility( ( sphereCount + 31u ) / 32u, 0xffffffffu );
+  Internal::CullSpheres( &visibility[0], reinterpret_cast<const Vec4*>( &spheres[0] ), sphereCount, planes, minRadius );
+
+  unsigned int visibleCount = 0u;
+  bool same = true;
+  for( unsigned int i = 0; i < sphereCount; ++i )
+  {
+    const float* sphere = &spheres[ i * 4u ];
+    bool expected = sphere[3] > minRadius;
+    for( unsigned int j = 0; expected && j < 6u; ++j )
+    {
+      expected = ( planes[j][3] + ( planes[j][0] * sphere[0] + planes[j][1] * sphere[1] + planes[j][2] * sphere[2] ) ) >= -sphere[3];
+    }
+    const bool visible = ( visibility[ i / 32u ] & ( 1u << ( i % 32u ) ) ) != 0u;
+    same = same && ( visible == expected );
+    visibleCount += visible ? 1u : 0u;
+  }
+
+  DALI_TEST_CHECK( same );
+  DALI_TEST_CHECK( visibleCount > 0u && visibleCount < sphereCount );
+
+  // The bits after the last sphere are cleared
+  DALI_TEST_EQUALS( visibility.back() >> ( sphereCount % 32u ), 0u, TEST_LOCATION );
+
+  END_TEST;
+}
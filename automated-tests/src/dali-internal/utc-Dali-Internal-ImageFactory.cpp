@@ -619,3 +619,189 @@ int UtcDaliImageFactoryReload06(void)
   DALI_TEST_CHECK( ticket->GetId() != ticket2->GetId() ); // different resources
   END_TEST;
 }
+
+namespace
+{
+
+const unsigned int CACHE_IMAGE_SIZE( 80u );
+const std::size_t CACHE_IMAGE_BYTES( CACHE_IMAGE_SIZE * CACHE_IMAGE_SIZE * 4u );
+
+/**
+ * Load an image with the default attributes, and emulate the loading by the platform if needed
+ */
+Image LoadImage( TestApplication& application, const std::string& url )
+{
+  application.GetPlatform().SetClosestImageSize( Vector2( CACHE_IMAGE_SIZE, CACHE_IMAGE_SIZE ) );
+  application.GetPlatform().ResetTrace();
+
+  Image image = ResourceImage::New( url );
+  application.SendNotification();
+  application.Render();
+  if( application.GetPlatform().WasCalled( TestPlatformAbstraction::LoadResourceFunc ) )
+  {
+    EmulateImageLoaded( application, CACHE_IMAGE_SIZE, CACHE_IMAGE_SIZE );
+  }
+  return image;
+}
+
+/**
+ * Release an image, and flush the queue of released resources
+ */
+void ReleaseImage( TestApplication& application, Image& image )
+{
+  image.Reset();
+  application.SendNotification();
+  application.Render();
+}
+
+} // anonymous namespace
+
+int UtcDaliImageFactoryCacheReleasedResource(void)
+{
+  TestApplication application;
+  tet_infoline( "UtcDaliImageFactoryCacheReleasedResource - A released image is found in the cache" );
+
+  ImageFactory& imageFactory  = Internal::ThreadLocalStorage::Get().GetImageFactory();
+  application.GetCore().SetImageCacheBudget( 4u * CACHE_IMAGE_BYTES );
+
+  Image image = LoadImage( application, gTestImageFilename );
+  DALI_TEST_EQUALS( application.GetCore().GetImageCacheMissCount(), 1u, TEST_LOCATION );
+  ReleaseImage( application, image );
+  DALI_TEST_EQUALS( imageFactory.GetCachedResourceCount(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( application.GetCore().GetImageCacheBytes(), CACHE_IMAGE_BYTES, TEST_LOCATION );
+
+  // Not loaded from the file system again
+  application.GetPlatform().ResetTrace();
+  image = ResourceImage::New( gTestImageFilename );
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_CHECK( !application.GetPlatform().WasCalled( TestPlatformAbstraction::LoadResourceFunc ) );
+  DALI_TEST_EQUALS( application.GetCore().GetImageCacheHitCount(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( imageFactory.GetCachedResourceCount(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( application.GetCore().GetImageCacheBytes(), 0u, TEST_LOCATION );
+
+  // An image released while off-stage is found again when it is put back on-stage
+  Image unused = ResourceImage::New( gTestImageFilename, ResourceImage::IMMEDIATE, Image::UNUSED );
+  Actor actor = CreateRenderableActor( unused );
+  Stage::GetCurrent().Add( actor );
+  application.SendNotification();
+  application.Render();
+  image.Reset();
+  Stage::GetCurrent().Remove( actor );
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( imageFactory.GetCachedResourceCount(), 1u, TEST_LOCATION );
+
+  application.GetPlatform().ResetTrace();
+  Stage::GetCurrent().Add( actor );
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_CHECK( !application.GetPlatform().WasCalled( TestPlatformAbstraction::LoadResourceFunc ) );
+  DALI_TEST_EQUALS( imageFactory.GetCachedResourceCount(), 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliImageFactoryCacheSharedResource(void)
+{
+  TestApplication application;
+  tet_infoline( "UtcDaliImageFactoryCacheSharedResource - A resource is only cached when released by its last image" );
+
+  ImageFactory& imageFactory  = Internal::ThreadLocalStorage::Get().GetImageFactory();
+  application.GetCore().SetImageCacheBudget( 4u * CACHE_IMAGE_BYTES );
+
+  Image image = LoadImage( application, gTestImageFilename );
+  Image sharing = LoadImage( application, gTestImageFilename );
+  DALI_TEST_CHECK( !application.GetPlatform().WasCalled( TestPlatformAbstraction::LoadResourceFunc ) );
+
+  // Still used by the other image
+  ReleaseImage( application, image );
+  DALI_TEST_EQUALS( imageFactory.GetCachedResourceCount(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( application.GetCore().GetImageCacheBytes(), 0u, TEST_LOCATION );
+
+  ReleaseImage( application, sharing );
+  DALI_TEST_EQUALS( imageFactory.GetCachedResourceCount(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( application.GetCore().GetImageCacheBytes(), CACHE_IMAGE_BYTES, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliImageFactoryCacheEviction(void)
+{
+  TestApplication application;
+  tet_infoline( "UtcDaliImageFactoryCacheEviction - The least recently used images are evicted, and the cache is trimmed" );
+
+  ImageFactory& imageFactory  = Internal::ThreadLocalStorage::Get().GetImageFactory();
+  application.GetCore().SetImageCacheBudget( 2u * CACHE_IMAGE_BYTES );
+
+  const char* urls[] = { "image1.png", "image2.png", "image3.png" };
+  for( unsigned int i = 0; i < 3u; ++i )
+  {
+    Image image = LoadImage( application, urls[i] );
+    ReleaseImage( application, image );
+  }
+  DALI_TEST_EQUALS( application.GetCore().GetImageCacheEvictionCount(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( imageFactory.GetCachedResourceCount(), 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( application.GetCore().GetImageCacheBytes(), 2u * CACHE_IMAGE_BYTES, TEST_LOCATION );
+
+  // The first one was evicted
+  Image image = LoadImage( application, urls[0] );
+  DALI_TEST_CHECK( application.GetPlatform().WasCalled( TestPlatformAbstraction::LoadResourceFunc ) );
+  DALI_TEST_EQUALS( application.GetCore().GetImageCacheMissCount(), 4u, TEST_LOCATION );
+  Image image3 = LoadImage( application, urls[2] );
+  DALI_TEST_CHECK( !application.GetPlatform().WasCalled( TestPlatformAbstraction::LoadResourceFunc ) );
+  DALI_TEST_EQUALS( application.GetCore().GetImageCacheHitCount(), 1u, TEST_LOCATION );
+
+  // Trimmed on low memory
+  application.GetCore().TrimImageCache( 0u );
+  DALI_TEST_EQUALS( imageFactory.GetCachedResourceCount(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( application.GetCore().GetImageCacheEvictionCount(), 2u, TEST_LOCATION );
+
+  // Without a budget, nothing is cached
+  application.GetCore().SetImageCacheBudget( 0u );
+  ReleaseImage( application, image );
+  DALI_TEST_EQUALS( imageFactory.GetCachedResourceCount(), 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliImageFactoryCacheNavigation(void)
+{
+  TestApplication application;
+  tet_infoline( "UtcDaliImageFactoryCacheNavigation - Count the loads when navigating between two pages of images, with and without a cache" );
+
+  const unsigned int IMAGES_PER_PAGE( 20u );
+  const unsigned int NAVIGATION_COUNT( 6u );
+
+  for( unsigned int pass = 0u; pass < 2u; ++pass )
+  {
+    application.GetCore().SetImageCacheBudget( pass == 0u ? 0u : 2u * IMAGES_PER_PAGE * CACHE_IMAGE_BYTES );
+    const unsigned int hitCount = application.GetCore().GetImageCacheHitCount();
+
+    unsigned int loadCount( 0u );
+    for( unsigned int navigation = 0u; navigation < NAVIGATION_COUNT; ++navigation )
+    {
+      // Show a page, then release it when navigating to the other one
+      std::vector< Image > page;
+      for( unsigned int i = 0u; i < IMAGES_PER_PAGE; ++i )
+      {
+        std::stringstream url;
+        url << "page" << ( navigation % 2u ) << "-image" << i << ".png";
+        page.push_back( LoadImage( application, url.str() ) );
+        loadCount += application.GetPlatform().WasCalled( TestPlatformAbstraction::LoadResourceFunc ) ? 1u : 0u;
+      }
+      page.clear();
+      application.SendNotification();
+      application.Render();
+    }
+
+    tet_printf( "%u navigations between pages of %u images, cache budget %u bytes: %u loads, %u cache hits\n",
+                NAVIGATION_COUNT, IMAGES_PER_PAGE, static_cast<unsigned int>( pass == 0u ? 0u : 2u * IMAGES_PER_PAGE * CACHE_IMAGE_BYTES ),
+                loadCount, application.GetCore().GetImageCacheHitCount() - hitCount );
+
+    DALI_TEST_EQUALS( loadCount, ( pass == 0u ? NAVIGATION_COUNT : 2u ) * IMAGES_PER_PAGE, TEST_LOCATION );
+    application.GetCore().TrimImageCache( 0u );
+  }
+
+  END_TEST;
+}
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <vector>
+
+#include <stdlib.h>
+
+#include <dali/public-api/dali-core.h>
+#include <dali-test-suite-utils.h>
+
+// Internal headers are allowed here
+
+#include <dali/internal/event/animation/key-frame-channel.h>
+
+using namespace Dali;
+using Internal::KeyFrameChannelBase;
+using Internal::KeyFrameChannelNumber;
+
+void utc_dali_internal_key_frame_channel_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_key_frame_channel_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const unsigned int KEY_FRAME_COUNT( 500u );
+const unsigned int FRAME_COUNT( 20000u );
+
+/**
+ * A track exported from a motion tool, with a few key frames at the same progress
+ */
+void CreateTrack( KeyFrameChannelNumber& channel, std::vector< float >& progress, std::vector< float >& values )
+{
+  srand( 7 );
+  for( unsigned int i = 0; i < KEY_FRAME_COUNT; ++i )
+  {
+    const float keyProgress = ( i % 50u == 10u ) ? progress.back() : 0.1f + 0.8f * static_cast<float>( i ) / KEY_FRAME_COUNT;
+    const float value = static_cast<float>( rand() % 1000 );
+    channel.AddKeyFrame( keyProgress, value );
+    progress.push_back( keyProgress );
+    values.push_back( value );
+  }
+}
+
+/**
+ * The linear search the channel used to do, with linear interpolation
+ */
+float GetValueLinearSearch( const std::vector< float >& progress, const std::vector< float >& values, float currentProgress )
+{
+  if( currentProgress >= progress.back() )
+  {
+    return values.back();
+  }
+
+  unsigned int next = 0u;
+  while( next < progress.size() && progress[next] <= currentProgress )
+  {
+    ++next;
+  }
+  if( next == 0u )
+  {
+    return values.front();
+  }
+
+  const unsigned int start = next - 1u;
+  const float frameProgress = ( currentProgress - progress[start] ) / ( progress[next] - progress[start] );
+  return values[start] + ( values[next] - values[start] ) * frameProgress;
+}
+
+} // unnamed namespace
+
+int UtcDaliKeyFrameChannelFindInterval(void)
+{
+  TestApplication application;
+  tet_infoline("Test that the binary search and the cached interval find the values of the linear search");
+
+  KeyFrameChannelNumber channel( KeyFrameChannelBase::Translate );
+  std::vector< float > progress;
+  std::vector< float > values;
+  CreateTrack( channel, progress, values );
+
+  DALI_TEST_EQUALS( channel.GetNumberOfKeyFrames(), KEY_FRAME_COUNT, TEST_LOCATION );
+  DALI_TEST_CHECK( !channel.IsActive( 0.05f ) );
+  DALI_TEST_CHECK( channel.IsActive( 0.1f ) );
+
+  // Forwards, backwards and at random
+  std::vector< float > sequence;
+  for( unsigned int i = 0; i <= 2000u; ++i )
+  {
+    sequence.push_back( static_cast<float>( i ) / 2000.0f );
+  }
+  for( unsigned int i = 0; i <= 2000u; ++i )
+  {
+    sequence.push_back( 1.0f - static_cast<float>( i ) / 2000.0f );
+  }
+  for( unsigned int i = 0; i < 2000u; ++i )
+  {
+    sequence.push_back( static_cast<float>( rand() % 10000 ) / 10000.0f );
+  }
+  for( unsigned int i = 0; i < KEY_FRAME_COUNT; ++i )
+  {
+    sequence.push_back( progress[i] );
+  }
+
+  unsigned int interval = KeyFrameChannelBase::INVALID_INTERVAL;
+  for( std::vector< float >::const_iterator iter = sequence.begin(); iter != sequence.end(); ++iter )
+  {
+    const float expected = GetValueLinearSearch( progress, values, *iter );
+    DALI_TEST_EQUALS( channel.GetValue( *iter, Dali::Animation::Linear ), expected, 0.001f, TEST_LOCATION );
+    DALI_TEST_EQUALS( channel.GetValue( *iter, Dali::Animation::Linear, interval ), expected, 0.001f, TEST_LOCATION );
+  }
+
+  // A single key frame
+  KeyFrameChannelNumber single( KeyFrameChannelBase::Translate );
+  single.AddKeyFrame( 0.5f, 3.0f );
+  interval = KeyFrameChannelBase::INVALID_INTERVAL;
+  DALI_TEST_EQUALS( single.GetValue( 0.2f, Dali::Animation::Cubic, interval ), 3.0f, TEST_LOCATION );
+  DALI_TEST_EQUALS( single.GetValue( 0.7f, Dali::Animation::Cubic, interval ), 3.0f, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliKeyFrameChannelLongTrack(void)
+{
+  TestApplication application;
+  tet_infoline("Compare the lookups in a long track, played with a monotonic progress");
+
+  KeyFrameChannelNumber channel( KeyFrameChannelBase::Translate );
+  std::vector< float > progress;
+  std::vector< float > values;
+  CreateTrack( channel, progress, values );
+
+  std::vector< float > linearResults( FRAME_COUNT );
+  std::vector< float > binaryResults( FRAME_COUNT );
+  std::vector< float > cachedResults( FRAME_COUNT );
+
+  double start = GetTimeMilliseconds();
+  for( unsigned int i = 0; i < FRAME_COUNT; ++i )
+  {
+    linearResults[i] = GetValueLinearSearch( progress, values, static_cast<float>( i ) / FRAME_COUNT );
+  }
+  const double linearTime = GetTimeMilliseconds() - start;
+
+  start = GetTimeMilliseconds();
+  for( unsigned int i = 0; i < FRAME_COUNT; ++i )
+  {
+    binaryResults[i] = channel.GetValue( static_cast<float>( i ) / FRAME_COUNT, Dali::Animation::Linear );
+  }
+  const double binaryTime = GetTimeMilliseconds() - start;
+
+  unsigned int interval = KeyFrameChannelBase::INVALID_INTERVAL;
+  start = GetTimeMilliseconds();
+  for( unsigned int i = 0; i < FRAME_COUNT; ++i )
+  {
+    cachedResults[i] = channel.GetValue( static_cast<float>( i ) / FRAME_COUNT, Dali::Animation::Linear, interval );
+  }
+  const double cachedTime = GetTimeMilliseconds() - start;
+
+  tet_printf( "%u key frames, %u frames: linear search %.3f ms, binary search %.3f ms, cached interval %.3f ms\n",
+              KEY_FRAME_COUNT, FRAME_COUNT, linearTime, binaryTime, cachedTime );
+
+  bool same = true;
+  for( unsigned int i = 0; i < FRAME_COUNT; ++i )
+  {
+    same = same && ( fabsf( linearResults[i] - binaryResults[i] ) < 0.001f ) && ( fabsf( linearResults[i] - cachedResults[i] ) < 0.001f );
+  }
+  DALI_TEST_CHECK( same );
+
+  END_TEST;
+}
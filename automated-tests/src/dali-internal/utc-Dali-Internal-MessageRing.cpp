@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <pthread.h>
+
+#include <dali/public-api/dali-core.h>
+#include <dali-test-suite-utils.h>
+
+// Internal headers are allowed here
+
+#include <dali/internal/common/message-ring.h>
+
+using namespace Dali;
+
+void utc_dali_internal_message_ring_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_message_ring_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const std::size_t SMALL_SEGMENT_SIZE( 256u );
+const unsigned int THREADED_MESSAGE_COUNT( 200000u );
+const unsigned int MESSAGES_PER_FLUSH( 100u );
+
+/**
+ * Writes a message of the given number of words, each word holding the value
+ */
+unsigned int* WriteMessage( Internal::MessageRing& ring, unsigned int words, unsigned int value )
+{
+  unsigned int* slot = ring.ReserveMessageSlot( words * sizeof( unsigned int ) );
+  for( unsigned int i = 0; i < words; ++i )
+  {
+    slot[i] = value;
+  }
+  return slot;
+}
+
+/**
+ * Checks the words of a message all hold the value
+ */
+bool CheckMessage( const unsigned int* slot, unsigned int words, unsigned int value )
+{
+  for( unsigned int i = 0; i < words; ++i )
+  {
+    if( slot[i] != value )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Sends numbered messages of various sizes from another thread
+ */
+void* ProduceMessages( void* data )
+{
+  Internal::MessageRing& ring = *static_cast< Internal::MessageRing* >( data );
+  for( unsigned int i = 0; i < THREADED_MESSAGE_COUNT; ++i )
+  {
+    WriteMessage( ring, 1u + i % 7u, i );
+    if( ( i + 1u ) % MESSAGES_PER_FLUSH == 0u )
+    {
+      ring.Publish();
+    }
+  }
+  ring.Publish();
+  return NULL;
+}
+
+} // namespace
+
+int UtcDaliMessageRingReadInOrder(void)
+{
+  TestApplication application;
+  tet_infoline("Test that the published messages are read in order");
+
+  Internal::MessageRing ring( SMALL_SEGMENT_SIZE );
+
+  DALI_TEST_CHECK( !ring.Publish() );
+  DALI_TEST_CHECK( !ring.AcquireMessages() );
+
+  // Enough messages to use several segments
+  for( unsigned int i = 0; i < 100u; ++i )
+  {
+    WriteMessage( ring, 1u + i % 5u, i );
+  }
+  DALI_TEST_CHECK( ring.Publish() );
+
+  // Not visible until published
+  WriteMessage( ring, 1u, 100u );
+
+  DALI_TEST_CHECK( ring.AcquireMessages() );
+  bool inOrder( true );
+  for( unsigned int i = 0; i < 100u; ++i )
+  {
+    unsigned int* slot = ring.ReadMessage();
+    inOrder = inOrder && slot && CheckMessage( slot, 1u + i % 5u, i );
+  }
+  DALI_TEST_CHECK( inOrder );
+  DALI_TEST_CHECK( ring.ReadMessage() == NULL );
+  ring.ReleaseMessages();
+
+  DALI_TEST_CHECK( ring.Publish() );
+  DALI_TEST_CHECK( ring.AcquireMessages() );
+  unsigned int* slot = ring.ReadMessage();
+  DALI_TEST_CHECK( slot && CheckMessage( slot, 1u, 100u ) );
+  DALI_TEST_CHECK( ring.ReadMessage() == NULL );
+  ring.ReleaseMessages();
+
+  END_TEST;
+}
+
+int UtcDaliMessageRingMessagesNotMoved(void)
+{
+  TestApplication application;
+  tet_infoline("Test that the messages are not moved while the consumer is behind");
+
+  Internal::MessageRing ring( SMALL_SEGMENT_SIZE );
+
+  std::vector< unsigned int* > slots;
+  for( unsigned int i = 0; i < 20u; ++i )
+  {
+    slots.push_back( WriteMessage( ring, 4u, i ) );
+  }
+  ring.Publish();
+
+  // Read half of the messages, then write many more and a message larger than a segment
+  DALI_TEST_CHECK( ring.AcquireMessages() );
+  for( unsigned int i = 0; i < 10u; ++i )
+  {
+    DALI_TEST_CHECK( ring.ReadMessage() == slots[i] );
+  }
+  ring.ReleaseMessages();
+
+  for( unsigned int i = 20u; i < 200u; ++i )
+  {
+    slots.push_back( WriteMessage( ring, 4u, i ) );
+  }
+  const unsigned int largeWords = SMALL_SEGMENT_SIZE;
+  unsigned int* large = WriteMessage( ring, largeWords, 200u );
+  ring.Publish();
+
+  bool unchanged( true );
+  for( unsigned int i = 10u; i < 200u; ++i )
+  {
+    unchanged = unchanged && CheckMessage( slots[i], 4u, i );
+  }
+  DALI_TEST_CHECK( unchanged );
+
+  DALI_TEST_CHECK( ring.AcquireMessages() );
+  bool samePlace( true );
+  for( unsigned int i = 10u; i < 200u; ++i )
+  {
+    samePlace = samePlace && ( ring.ReadMessage() == slots[i] );
+  }
+  DALI_TEST_CHECK( samePlace );
+  DALI_TEST_CHECK( ring.ReadMessage() == large );
+  DALI_TEST_CHECK( CheckMessage( large, largeWords, 200u ) );
+  DALI_TEST_CHECK( ring.ReadMessage() == NULL );
+  ring.ReleaseMessages();
+
+  END_TEST;
+}
+
+int UtcDaliMessageRingThreaded(void)
+{
+  TestApplication application;
+  tet_infoline("Test that the messages sent from another thread are all read in order");
+
+  Internal::MessageRing ring( SMALL_SEGMENT_SIZE );
+
+  pthread_t producer;
+  DALI_TEST_EQUALS( pthread_create( &producer, NULL, ProduceMessages, &ring ), 0, TEST_LOCATION );
+
+  unsigned int next( 0u );
+  bool inOrder( true );
+  while( next < THREADED_MESSAGE_COUNT && inOrder )
+  {
+    if( ring.AcquireMessages() )
+    {
+      while( unsigned int* slot = ring.ReadMessage() )
+      {
+        inOrder = inOrder && CheckMessage( slot, 1u + next % 7u, next );
+        ++next;
+      }
+      ring.ReleaseMessages();
+    }
+  }
+
+  pthread_join( producer, NULL );
+
+  DALI_TEST_CHECK( inOrder );
+  DALI_TEST_EQUALS( next, THREADED_MESSAGE_COUNT, TEST_LOCATION );
+
+  END_TEST;
+}
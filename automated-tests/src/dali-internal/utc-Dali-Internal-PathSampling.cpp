@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <stdlib.h>
+
+#include <dali/public-api/dali-core.h>
+#include <dali/devel-api/animation/path-constant-speed.h>
+#include <dali/devel-api/animation/path-constrainer.h>
+#include <dali-test-suite-utils.h>
+
+// Internal headers are allowed here
+
+#include <dali/internal/event/animation/path-impl.h>
+
+using namespace Dali;
+using Internal::PathPtr;
+
+void utc_dali_internal_path_sampling_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_path_sampling_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const unsigned int SAMPLE_COUNT( 10000u );
+const unsigned int FRAME_COUNT( 60u );
+
+/**
+ * A smooth path with a short segment, a long one, and control points spaced unevenly
+ */
+void SetupPath( Internal::Path& path )
+{
+  path.AddPoint( Vector3(   0.0f,   0.0f, 0.0f ) );
+  path.AddPoint( Vector3(  10.0f,  10.0f, 0.0f ) );
+  path.AddPoint( Vector3( 400.0f,  50.0f, 20.0f ) );
+  path.AddPoint( Vector3( 420.0f, 300.0f, -10.0f ) );
+
+  path.AddControlPoint( Vector3(   1.0f,   5.0f, 0.0f ) );
+  path.AddControlPoint( Vector3(   8.0f,  10.0f, 0.0f ) );
+  path.AddControlPoint( Vector3( 350.0f,  10.0f, 5.0f ) );
+  path.AddControlPoint( Vector3( 395.0f,  45.0f, 20.0f ) );
+  path.AddControlPoint( Vector3( 420.0f,  70.0f, 20.0f ) );
+  path.AddControlPoint( Vector3( 421.0f, 100.0f, -10.0f ) );
+}
+
+/**
+ * The sampling the path used to do, with the bezier basis matrix, and each segment taking the same share of the progress
+ */
+void SampleReference( const Internal::Path& path, float t, Vector3& position, Vector3& tangent )
+{
+  const float basis[] = { -1.0f,  3.0f, -3.0f, 1.0f,
+                           3.0f, -6.0f,  3.0f, 0.0f,
+                          -3.0f,  3.0f,  0.0f, 0.0f,
+                           1.0f,  0.0f,  0.0f, 0.0f };
+  const Matrix bezierBasis( basis );
+
+  const Dali::Vector<Vector3>& points = path.GetPoints();
+  const Dali::Vector<Vector3>& controlPoints = path.GetControlPoints();
+  const unsigned int segmentCount = points.Count() - 1u;
+
+  unsigned int segment = std::min( static_cast<unsigned int>( t * segmentCount ), segmentCount - 1u );
+  const float tLocal = t * segmentCount - static_cast<float>( segment );
+
+  const Vector4 sVect( tLocal * tLocal * tLocal, tLocal * tLocal, tLocal, 1.0f );
+  const Vector3 sVectDerivative( 3.0f * tLocal * tLocal, 2.0f * tLocal, 1.0f );
+  for( unsigned int axis = 0; axis < 3u; ++axis )
+  {
+    const Vector4 cVect( points[segment][axis], controlPoints[2 * segment][axis], controlPoints[2 * segment + 1][axis], points[segment + 1][axis] );
+    const Vector4 a = bezierBasis * cVect;
+    position[axis] = sVect.Dot4( a );
+    tangent[axis] = sVectDerivative.Dot( Vector3( a ) );
+  }
+  tangent.Normalize();
+}
+
+} // unnamed namespace
+
+int UtcDaliPathSamplingUniform(void)
+{
+  TestApplication application;
+  tet_infoline("Test that the precomputed coefficients give the values of the bezier basis");
+
+  PathPtr path( Internal::Path::New() );
+  SetupPath( *path );
+
+  std::vector< float > progress;
+  for( unsigned int i = 0; i <= 300u; ++i )
+  {
+    progress.push_back( static_cast<float>( i ) / 300.0f );
+  }
+
+  for( unsigned int i = 0; i < progress.size(); ++i )
+  {
+    Vector3 expectedPosition, expectedTangent;
+    SampleReference( *path, progress[i], expectedPosition, expectedTangent );
+
+    Vector3 position, tangent;
+    DALI_TEST_CHECK( path->SampleAt( progress[i], position, tangent ) );
+    DALI_TEST_EQUALS( position, expectedPosition, 0.01f, TEST_LOCATION );
+    DALI_TEST_EQUALS( tangent, expectedTangent, 0.001f, TEST_LOCATION );
+  }
+
+  // The coefficients follow the changes of the points
+  path->GetPoint( 3 ) = Vector3( 500.0f, 500.0f, 0.0f );
+  Vector3 position;
+  DALI_TEST_CHECK( path->SamplePosition( 1.0f, position ) );
+  DALI_TEST_EQUALS( position, Vector3( 500.0f, 500.0f, 0.0f ), TEST_LOCATION );
+
+  // An incomplete path is not sampled
+  path->ClearControlPoints();
+  DALI_TEST_CHECK( !path->SamplePosition( 0.5f, position ) );
+  DALI_TEST_EQUALS( path->GetLength(), 0.0f, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliPathSamplingConstantSpeed(void)
+{
+  TestApplication application;
+  tet_infoline("Test that the arc-length table moves along equal lengths of the path for equal increments of progress");
+
+  PathPtr path( Internal::Path::New() );
+  SetupPath( *path );
+  DALI_TEST_CHECK( !path->GetConstantSpeed() );
+  const float length = path->GetLength();
+  DALI_TEST_CHECK( length > 400.0f );
+
+  const unsigned int STEP_COUNT = 500u;
+  float uniformMinStep( length ), uniformMaxStep( 0.0f );
+  float constantMinStep( length ), constantMaxStep( 0.0f );
+  Vector3 uniformPrevious, constantPrevious;
+  for( unsigned int i = 0; i <= STEP_COUNT; ++i )
+  {
+    const float t = static_cast<float>( i ) / STEP_COUNT;
+
+    Vector3 uniform, constant;
+    path->SetConstantSpeed( false );
+    DALI_TEST_CHECK( path->SamplePosition( t, uniform ) );
+    path->SetConstantSpeed( true );
+    DALI_TEST_CHECK( path->SamplePosition( t, constant ) );
+
+    if( i > 0u )
+    {
+      const float uniformStep = ( uniform - uniformPrevious ).Length();
+      const float constantStep = ( constant - constantPrevious ).Length();
+      uniformMinStep = std::min( uniformMinStep, uniformStep );
+      uniformMaxStep = std::max( uniformMaxStep, uniformStep );
+      constantMinStep = std::min( constantMinStep, constantStep );
+      constantMaxStep = std::max( constantMaxStep, constantStep );
+    }
+    uniformPrevious = uniform;
+    constantPrevious = constant;
+  }
+
+  tet_printf( "Step length: uniform progress %f to %f, constant speed %f to %f, expected %f\n",
+              uniformMinStep, uniformMaxStep, constantMinStep, constantMaxStep, length / STEP_COUNT );
+
+  // The steps are within 1% of each other, and of the length of the path divided in equal parts
+  DALI_TEST_EQUALS( constantMinStep, length / STEP_COUNT, length / STEP_COUNT * 0.01f, TEST_LOCATION );
+  DALI_TEST_EQUALS( constantMaxStep, length / STEP_COUNT, length / STEP_COUNT * 0.01f, TEST_LOCATION );
+  DALI_TEST_CHECK( uniformMaxStep > uniformMinStep * 10.0f );
+
+  // The ends of the path are exact
+  Vector3 position, tangent;
+  DALI_TEST_CHECK( path->SampleAt( 0.0f, position, tangent ) );
+  DALI_TEST_EQUALS( position, path->GetPoints()[0], TEST_LOCATION );
+  DALI_TEST_CHECK( path->SampleAt( 1.0f, position, tangent ) );
+  DALI_TEST_EQUALS( position, path->GetPoints()[3], TEST_LOCATION );
+
+  // A copy keeps the mapping
+  PathPtr clone( Internal::Path::Clone( *path ) );
+  DALI_TEST_CHECK( clone->GetConstantSpeed() );
+  DALI_TEST_EQUALS( clone->GetLength(), length, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliPathSamplingConstantSpeedAnimation(void)
+{
+  TestApplication application;
+  tet_infoline("Test an animation and a constraint along a path with a constant speed");
+
+  Dali::Path path = Dali::Path::New();
+  SetupPath( GetImplementation( path ) );
+  PathSetConstantSpeed( path, true );
+  DALI_TEST_CHECK( PathGetConstantSpeed( path ) );
+
+  Vector3 expected, tangent;
+  GetImplementation( path ).Sample( 0.25f, expected, tangent );
+
+  Actor actor = Actor::New();
+  Stage::GetCurrent().Add( actor );
+  Animation animation = Animation::New( 1.0f );
+  animation.Animate( actor, path, Vector3::XAXIS );
+  animation.Play();
+
+  application.SendNotification();
+  application.Render( 0 );
+  application.Render( 250 );
+  DALI_TEST_EQUALS( actor.GetCurrentPosition(), expected, 0.01f, TEST_LOCATION );
+
+  // The same mapping through a path constrainer
+  Dali::PathConstrainer pathConstrainer = Dali::PathConstrainer::New();
+  pathConstrainer.SetProperty( Dali::PathConstrainer::Property::POINTS, path.GetProperty( Dali::Path::Property::POINTS ) );
+  pathConstrainer.SetProperty( Dali::PathConstrainer::Property::CONTROL_POINTS, path.GetProperty( Dali::Path::Property::CONTROL_POINTS ) );
+  DALI_TEST_EQUALS( pathConstrainer.GetProperty< bool >( Dali::PathConstrainer::Property::CONSTANT_SPEED ), false, TEST_LOCATION );
+  pathConstrainer.SetProperty( Dali::PathConstrainer::Property::CONSTANT_SPEED, true );
+  DALI_TEST_EQUALS( pathConstrainer.GetProperty< bool >( Dali::PathConstrainer::Property::CONSTANT_SPEED ), true, TEST_LOCATION );
+
+  Actor constrained = Actor::New();
+  Property::Index index = constrained.RegisterProperty( "t", 0.25f );
+  Stage::GetCurrent().Add( constrained );
+  pathConstrainer.Apply( Property( constrained, Actor::Property::POSITION ), Property( constrained, index ), Vector2( 0.0f, 1.0f ) );
+
+  application.SendNotification();
+  application.Render( 16 );
+  DALI_TEST_EQUALS( constrained.GetCurrentPosition(), expected, 0.01f, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliPathSamplingManyActors(void)
+{
+  TestApplication application;
+  tet_infoline("Compare the sampling of many positions along a path, with the basis matrix and with the precomputed coefficients");
+
+  PathPtr path( Internal::Path::New() );
+  SetupPath( *path );
+
+  srand( 11 );
+  std::vector< float > offsets;
+  for( unsigned int i = 0; i < SAMPLE_COUNT; ++i )
+  {
+    offsets.push_back( static_cast<float>( rand() % 1000 ) * 0.001f );
+  }
+
+  std::vector< float > progress( SAMPLE_COUNT );
+  std::vector< Vector3 > referencePositions( SAMPLE_COUNT );
+  std::vector< Vector3 > singlePositions( SAMPLE_COUNT );
+
+  double referenceTime( 0.0 ), singleTime( 0.0 );
+  float maxError( 0.0f );
+  for( unsigned int frame = 0; frame < FRAME_COUNT; ++frame )
+  {
+    for( unsigned int i = 0; i < SAMPLE_COUNT; ++i )
+    {
+      progress[i] = fmodf( offsets[i] + static_cast<float>( frame ) / FRAME_COUNT, 1.0f );
+    }
+
+    double start = GetTimeMilliseconds();
+    for( unsigned int i = 0; i < SAMPLE_COUNT; ++i )
+    {
+      Vector3 tangent;
+      SampleReference( *path, progress[i], referencePositions[i], tangent );
+    }
+    referenceTime += GetTimeMilliseconds() - start;
+
+    start = GetTimeMilliseconds();
+    for( unsigned int i = 0; i < SAMPLE_COUNT; ++i )
+    {
+      path->SamplePosition( progress[i], singlePositions[i] );
+    }
+    singleTime += GetTimeMilliseconds() - start;
+
+    for( unsigned int i = 0; i < SAMPLE_COUNT; ++i )
+    {
+      maxError = std::max( maxError, ( singlePositions[i] - referencePositions[i] ).Length() );
+    }
+  }
+
+  tet_printf( "%u samples, %u frames: basis matrix %.3f ms, coefficients %.3f ms, max error %f\n",
+              SAMPLE_COUNT, FRAME_COUNT, referenceTime, singleTime, maxError );
+
+  DALI_TEST_CHECK( maxError < 0.01f );
+
+  END_TEST;
+}
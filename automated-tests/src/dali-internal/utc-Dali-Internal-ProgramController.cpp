@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <sstream>
+
+#include <dali/public-api/dali-core.h>
+#include <dali-test-suite-utils.h>
+#include <test-gl-abstraction.h>
+
+// Internal headers are allowed here
+
+#include <dali/devel-api/common/hash.h>
+#include <dali/internal/common/shader-data.h>
+#include <dali/internal/render/shaders/program.h>
+#include <dali/internal/render/shaders/program-controller.h>
+
+using namespace Dali;
+
+void utc_dali_internal_program_controller_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_program_controller_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const unsigned int PROGRAM_COUNT( 500u );
+const unsigned int UNIFORM_COUNT( 64u );
+const unsigned int LOOKUP_ROUNDS( 10u );
+
+std::string GetUniformName( unsigned int index )
+{
+  std::ostringstream name;
+  name << "uCustomUniform" << index;
+  return name.str();
+}
+
+Internal::Program* CreateProgram( Internal::ProgramCache& cache, size_t hash )
+{
+  Internal::ShaderDataPtr shaderData = new Internal::ShaderData( "vertex", "fragment", Dali::Shader::Hint::NONE );
+  shaderData->SetHashValue( hash );
+  return Internal::Program::New( cache, shaderData, false );
+}
+
+} // namespace
+
+int UtcDaliProgramControllerGetProgram(void)
+{
+  TestApplication application;
+  tet_infoline("Test that the programs are found by shader hash");
+
+  TestGlAbstraction glAbstraction;
+  Internal::ProgramController controller( glAbstraction );
+  Internal::ProgramCache& cache = controller;
+
+  Internal::Program* first = CreateProgram( cache, 1u );
+  Internal::Program* second = CreateProgram( cache, 2u );
+
+  DALI_TEST_CHECK( first != second );
+  DALI_TEST_CHECK( cache.GetProgram( 1u ) == first );
+  DALI_TEST_CHECK( cache.GetProgram( 2u ) == second );
+  DALI_TEST_CHECK( cache.GetProgram( 3u ) == NULL );
+
+  // The same shader hash gives the same program
+  DALI_TEST_CHECK( CreateProgram( cache, 2u ) == second );
+
+  END_TEST;
+}
+
+int UtcDaliProgramRegisterUniform(void)
+{
+  TestApplication application;
+  tet_infoline("Test that the uniform names are registered once and found by name");
+
+  TestGlAbstraction glAbstraction;
+  Internal::ProgramController controller( glAbstraction );
+  Internal::Program* program = CreateProgram( controller, 1u );
+
+  // The standard uniforms are registered first
+  DALI_TEST_EQUALS( program->RegisterUniform( "uMvpMatrix" ), static_cast<unsigned int>( Internal::Program::UNIFORM_MVP_MATRIX ), TEST_LOCATION );
+  DALI_TEST_EQUALS( program->RegisterUniform( "uSize" ), static_cast<unsigned int>( Internal::Program::UNIFORM_SIZE ), TEST_LOCATION );
+
+  const unsigned int first = program->RegisterUniform( "uFirst" );
+  const unsigned int second = program->RegisterUniform( "uSecond", CalculateHash( "uSecond" ) );
+  DALI_TEST_CHECK( first != second );
+  DALI_TEST_EQUALS( program->RegisterUniform( "uFirst", CalculateHash( "uFirst" ) ), first, TEST_LOCATION );
+  DALI_TEST_EQUALS( program->RegisterUniform( "uSecond" ), second, TEST_LOCATION );
+
+  // Different names with the same hash are told apart
+  const unsigned int third = program->RegisterUniform( "uThird", 1234u );
+  const unsigned int fourth = program->RegisterUniform( "uFourth", 1234u );
+  DALI_TEST_CHECK( third != fourth );
+  DALI_TEST_EQUALS( program->RegisterUniform( "uThird", 1234u ), third, TEST_LOCATION );
+  DALI_TEST_EQUALS( program->RegisterUniform( "uFourth", 1234u ), fourth, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliProgramControllerLookupBenchmark(void)
+{
+  TestApplication application;
+  tet_infoline("Measure the program and uniform lookups with 500 programs of 64 uniforms");
+
+  TestGlAbstraction glAbstraction;
+  Internal::ProgramController controller( glAbstraction );
+  Internal::ProgramCache& cache = controller;
+
+  std::vector< Internal::Program* > programs;
+  for( unsigned int i = 0; i < PROGRAM_COUNT; ++i )
+  {
+    programs.push_back( CreateProgram( cache, i + 1u ) );
+  }
+
+  std::vector< std::string > names;
+  std::vector< std::size_t > hashes;
+  std::vector< unsigned int > indices;
+  for( unsigned int i = 0; i < UNIFORM_COUNT; ++i )
+  {
+    names.push_back( GetUniformName( i ) );
+    hashes.push_back( CalculateHash( names.back() ) );
+  }
+  for( unsigned int i = 0; i < UNIFORM_COUNT; ++i )
+  {
+    indices.push_back( programs[0]->RegisterUniform( names[i], hashes[i] ) );
+    for( unsigned int j = 1; j < PROGRAM_COUNT; ++j )
+    {
+      programs[j]->RegisterUniform( names[i], hashes[i] );
+    }
+  }
+
+  // Program lookup, as done for every renderer when its shader changes
+  bool programsFound( true );
+  double start = GetTimeMilliseconds();
+  for( unsigned int round = 0; round < LOOKUP_ROUNDS; ++round )
+  {
+    for( unsigned int i = 0; i < PROGRAM_COUNT; ++i )
+    {
+      programsFound = ( cache.GetProgram( i + 1u ) == programs[i] ) && programsFound;
+    }
+  }
+  const double programTime = GetTimeMilliseconds() - start;
+  DALI_TEST_CHECK( programsFound );
+
+  // Uniform lookup, as done for every renderer when its uniform map changes
+  bool uniformsFound( true );
+  start = GetTimeMilliseconds();
+  for( unsigned int round = 0; round < LOOKUP_ROUNDS; ++round )
+  {
+    for( unsigned int i = 0; i < PROGRAM_COUNT; ++i )
+    {
+      for( unsigned int j = 0; j < UNIFORM_COUNT; ++j )
+      {
+        uniformsFound = ( programs[i]->RegisterUniform( names[j], hashes[j] ) == indices[j] ) && uniformsFound;
+      }
+    }
+  }
+  const double uniformTime = GetTimeMilliseconds() - start;
+  DALI_TEST_CHECK( uniformsFound );
+
+  tet_printf( "%u program lookups: %.3f ms\n", PROGRAM_COUNT * LOOKUP_ROUNDS, programTime );
+  tet_printf( "%u uniform lookups: %.3f ms\n", PROGRAM_COUNT * UNIFORM_COUNT * LOOKUP_ROUNDS, uniformTime );
+
+  END_TEST;
+}
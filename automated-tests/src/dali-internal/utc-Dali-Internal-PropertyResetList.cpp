@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali/public-api/dali-core.h>
+#include <dali-test-suite-utils.h>
+
+// Internal headers are allowed here
+
+#include <dali/internal/update/common/animatable-property.h>
+#include <dali/internal/update/common/property-owner.h>
+#include <dali/internal/update/common/property-reset-list.h>
+
+using namespace Dali;
+using namespace Dali::Internal::SceneGraph;
+
+void utc_dali_internal_property_reset_list_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_property_reset_list_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const float BASE_VALUE = 1.0f;
+
+/**
+ * Creates an owner with one animatable float property
+ */
+PropertyOwner* CreateOwner( AnimatableProperty<float>*& property )
+{
+  PropertyOwner* owner = PropertyOwner::New();
+  property = new AnimatableProperty<float>( BASE_VALUE );
+  owner->InstallCustomProperty( property );
+  return owner;
+}
+
+} // namespace
+
+int UtcDaliPropertyResetListResetWrittenOwnersP(void)
+{
+  TestApplication application;
+  tet_infoline("Test that only the owners written in the last two updates are reset");
+
+  PropertyResetList resetList;
+
+  AnimatableProperty<float>* property1( NULL );
+  AnimatableProperty<float>* property2( NULL );
+  PropertyOwner* owner1 = CreateOwner( property1 );
+  PropertyOwner* owner2 = CreateOwner( property2 );
+
+  // The initial values are reset in both buffers
+  owner1->SetResetList( resetList );
+  owner2->SetResetList( resetList );
+  DALI_TEST_EQUALS( resetList.Count(), 2u, TEST_LOCATION );
+  resetList.ResetToBaseValues( 0 );
+  DALI_TEST_EQUALS( resetList.Count(), 2u, TEST_LOCATION );
+  resetList.ResetToBaseValues( 1 );
+  DALI_TEST_EQUALS( resetList.Count(), 0u, TEST_LOCATION );
+
+  // Animate the first property only
+  property1->Set( 0, 5.0f );
+  owner1->RequestReset();
+  DALI_TEST_EQUALS( resetList.Count(), 1u, TEST_LOCATION );
+
+  // Writing again in the same update does not add the owner twice
+  property1->Set( 0, 6.0f );
+  owner1->RequestReset();
+  DALI_TEST_EQUALS( resetList.Count(), 1u, TEST_LOCATION );
+
+  resetList.ResetToBaseValues( 1 );
+  DALI_TEST_EQUALS( property1->Get( 0 ), 6.0f, TEST_LOCATION );
+  DALI_TEST_EQUALS( resetList.Count(), 1u, TEST_LOCATION );
+
+  resetList.ResetToBaseValues( 0 );
+  DALI_TEST_EQUALS( property1->Get( 0 ), BASE_VALUE, TEST_LOCATION );
+  DALI_TEST_EQUALS( property2->Get( 0 ), BASE_VALUE, TEST_LOCATION );
+  DALI_TEST_EQUALS( resetList.Count(), 0u, TEST_LOCATION );
+
+  delete owner1;
+  delete owner2;
+  END_TEST;
+}
+
+int UtcDaliPropertyResetListDestroyedOwnerP(void)
+{
+  TestApplication application;
+  tet_infoline("Test that a destroyed owner is removed from the list, and that the list can be destroyed first");
+
+  PropertyResetList* resetList = new PropertyResetList();
+
+  const unsigned int OWNER_COUNT = 10u;
+  PropertyOwner* owners[ OWNER_COUNT ];
+  AnimatableProperty<float>* properties[ OWNER_COUNT ];
+  for( unsigned int i = 0; i < OWNER_COUNT; ++i )
+  {
+    owners[i] = CreateOwner( properties[i] );
+    owners[i]->SetResetList( *resetList );
+  }
+  DALI_TEST_EQUALS( resetList->Count(), OWNER_COUNT, TEST_LOCATION );
+
+  // Remove from the middle and the end
+  delete owners[3];
+  owners[3] = NULL;
+  delete owners[ OWNER_COUNT - 1u ];
+  owners[ OWNER_COUNT - 1u ] = NULL;
+  DALI_TEST_EQUALS( resetList->Count(), OWNER_COUNT - 2u, TEST_LOCATION );
+
+  // The remaining owners are still reset
+  for( unsigned int i = 0; i < OWNER_COUNT; ++i )
+  {
+    if( owners[i] )
+    {
+      properties[i]->Set( 1, 10.0f );
+    }
+  }
+  resetList->ResetToBaseValues( 1 );
+  for( unsigned int i = 0; i < OWNER_COUNT; ++i )
+  {
+    if( owners[i] )
+    {
+      DALI_TEST_EQUALS( properties[i]->Get( 1 ), BASE_VALUE, TEST_LOCATION );
+    }
+  }
+
+  // Destroying the list first detaches the owners
+  delete resetList;
+  for( unsigned int i = 0; i < OWNER_COUNT; ++i )
+  {
+    delete owners[i];
+  }
+
+  DALI_TEST_CHECK( true );
+  END_TEST;
+}
@@ -0,0 +1,448 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include <dali/public-api/dali-core.h>
+#include <dali-test-suite-utils.h>
+
+// Internal headers are allowed here
+
+#include <dali/internal/event/size-negotiation/relayout-controller-impl.h>
+
+using namespace Dali;
+using Internal::RelayoutController;
+
+void utc_dali_internal_relayout_controller_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_relayout_controller_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+unsigned int gRelayoutCount( 0u ); ///< The number of actors negotiated in the relayouts
+
+void OnRelayout( Actor actor )
+{
+  ++gRelayoutCount;
+}
+
+/**
+ * Creates items of a list view, each of them the root of its own dirty sub tree
+ */
+void CreateItems( Actor parent, std::vector< Actor >& items, unsigned int count )
+{
+  for( unsigned int i = 0; i < count; ++i )
+  {
+    Actor item = Actor::New();
+    item.SetResizePolicy( ResizePolicy::FIXED, Dimension::ALL_DIMENSIONS );
+    item.SetSize( 100.0f, 20.0f );
+    item.OnRelayoutSignal().Connect( &OnRelayout );
+    parent.Add( item );
+    items.push_back( item );
+  }
+}
+
+unsigned int gMeasureCount( 0u ); ///< The number of calls to the measurement functions of the text items
+
+/**
+ * An item measuring its height from its width, like a label wrapping its text
+ */
+class TextItemImpl : public CustomActorImpl
+{
+public:
+
+  TextItemImpl()
+  : CustomActorImpl( ACTOR_BEHAVIOUR_NONE ),
+    mTextLength( 0u )
+  {
+  }
+
+  void SetTextLength( unsigned int textLength )
+  {
+    mTextLength = textLength;
+    RelayoutRequest();
+  }
+
+  virtual Vector3 GetNaturalSize()
+  {
+    ++gMeasureCount;
+    return Vector3( mTextLength * CHARACTER_WIDTH, LINE_HEIGHT, 0.0f );
+  }
+
+  virtual float GetHeightForWidth( float width )
+  {
+    ++gMeasureCount;
+    const unsigned int charactersPerLine = std::max( 1u, static_cast<unsigned int>( width / CHARACTER_WIDTH ) );
+    return ( ( mTextLength + charactersPerLine - 1u ) / charactersPerLine ) * LINE_HEIGHT;
+  }
+
+  virtual float GetWidthForHeight( float height )
+  {
+    return GetWidthForHeightBase( height );
+  }
+
+  virtual float CalculateChildSize( const Dali::Actor& child, Dimension::Type dimension )
+  {
+    return CalculateChildSizeBase( child, dimension );
+  }
+
+  virtual bool RelayoutDependentOnChildren( Dimension::Type dimension )
+  {
+    return RelayoutDependentOnChildrenBase( dimension );
+  }
+
+  virtual void OnStageConnection( int depth ) {}
+  virtual void OnStageDisconnection() {}
+  virtual void OnChildAdd( Actor& child ) {}
+  virtual void OnChildRemove( Actor& child ) {}
+  virtual void OnSizeSet( const Vector3& targetSize ) {}
+  virtual void OnSizeAnimation( Animation& animation, const Vector3& targetSize ) {}
+  virtual bool OnTouchEvent( const TouchEvent& event ) { return false; }
+  virtual bool OnHoverEvent( const HoverEvent& event ) { return false; }
+  virtual bool OnKeyEvent( const KeyEvent& event ) { return false; }
+  virtual bool OnWheelEvent( const WheelEvent& event ) { return false; }
+  virtual void OnRelayout( const Vector2& size, RelayoutContainer& container ) {}
+  virtual void OnSetResizePolicy( ResizePolicy::Type policy, Dimension::Type dimension ) {}
+  virtual void OnCalculateRelayoutSize( Dimension::Type dimension ) {}
+  virtual void OnLayoutNegotiated( float size, Dimension::Type dimension ) {}
+
+  static const float CHARACTER_WIDTH;
+  static const float LINE_HEIGHT;
+
+private:
+
+  unsigned int mTextLength;
+};
+
+const float TextItemImpl::CHARACTER_WIDTH( 10.0f );
+const float TextItemImpl::LINE_HEIGHT( 20.0f );
+
+/**
+ * Creates text items filling the width of the list view, their height depending on their width
+ */
+void CreateTextItems( Actor parent, std::vector< CustomActor >& items, unsigned int count )
+{
+  for( unsigned int i = 0; i < count; ++i )
+  {
+    CustomActor item( *new TextItemImpl() );
+    item.SetResizePolicy( ResizePolicy::FILL_TO_PARENT, Dimension::WIDTH );
+    item.SetResizePolicy( ResizePolicy::DIMENSION_DEPENDENCY, Dimension::HEIGHT );
+    static_cast< TextItemImpl& >( item.GetImplementation() ).SetTextLength( 10u + i % 50u );
+    parent.Add( item );
+    items.push_back( item );
+  }
+}
+
+} // unnamed namespace
+
+int UtcDaliRelayoutControllerDirtySubTrees(void)
+{
+  TestApplication application;
+  tet_infoline("Test the roots of the dirty sub trees are added once, and removed when destroyed");
+
+  RelayoutController* controller = RelayoutController::Get();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( controller->GetDirtySubTreeCount(), 0u, TEST_LOCATION );
+
+  const unsigned int ITEM_COUNT = 100u;
+  gRelayoutCount = 0u;
+  std::vector< Actor > items;
+  CreateItems( Stage::GetCurrent().GetRootLayer(), items, ITEM_COUNT );
+  DALI_TEST_EQUALS( controller->GetDirtySubTreeCount(), ITEM_COUNT, TEST_LOCATION );
+
+  // Requesting again does not add the items twice
+  for( unsigned int i = 0; i < ITEM_COUNT; ++i )
+  {
+    items[i].SetSize( 100.0f, 30.0f );
+  }
+  DALI_TEST_EQUALS( controller->GetDirtySubTreeCount(), ITEM_COUNT, TEST_LOCATION );
+
+  // Destroy every third item, from the start, the middle and the end of the list
+  unsigned int destroyed = 0u;
+  for( unsigned int i = 0; i < ITEM_COUNT; i += 3u )
+  {
+    Stage::GetCurrent().Remove( items[i] );
+    items[i].Reset();
+    ++destroyed;
+  }
+  DALI_TEST_EQUALS( controller->GetDirtySubTreeCount(), ITEM_COUNT - destroyed, TEST_LOCATION );
+
+  // The remaining items are negotiated
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( gRelayoutCount, ITEM_COUNT - destroyed, TEST_LOCATION );
+  DALI_TEST_EQUALS( controller->GetDirtySubTreeCount(), 0u, TEST_LOCATION );
+
+  // A destroyed item is not in the list any more once negotiated
+  items[1].SetSize( 10.0f, 10.0f );
+  DALI_TEST_EQUALS( controller->GetDirtySubTreeCount(), 1u, TEST_LOCATION );
+  Stage::GetCurrent().Remove( items[1] );
+  items[1].Reset();
+  DALI_TEST_EQUALS( controller->GetDirtySubTreeCount(), 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliRelayoutControllerActorOutlivesCore(void)
+{
+  tet_infoline("Test an actor waiting for a relayout can be destroyed after the core");
+
+  Actor actor;
+  {
+    TestApplication application;
+    const unsigned int count = RelayoutController::Get()->GetDirtySubTreeCount();
+    actor = Actor::New();
+    actor.SetResizePolicy( ResizePolicy::FIXED, Dimension::ALL_DIMENSIONS );
+    Stage::GetCurrent().Add( actor );
+    DALI_TEST_EQUALS( RelayoutController::Get()->GetDirtySubTreeCount(), count + 1u, TEST_LOCATION );
+  }
+
+  // The actor does not reach the controller of a new core
+  TestApplication application;
+  const unsigned int count = RelayoutController::Get()->GetDirtySubTreeCount();
+  actor.Reset();
+  DALI_TEST_EQUALS( RelayoutController::Get()->GetDirtySubTreeCount(), count, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliRelayoutControllerManyDirtySubTrees(void)
+{
+  TestApplication application;
+  tet_infoline("Rebuild a list view of many items, for an increasing number of items");
+
+  application.SendNotification();
+  application.Render();
+
+  const unsigned int ITEM_COUNTS[] = { 500u, 1000u, 2000u, 4000u };
+  for( unsigned int test = 0; test < sizeof( ITEM_COUNTS ) / sizeof( ITEM_COUNTS[0] ); ++test )
+  {
+    const unsigned int itemCount = ITEM_COUNTS[test];
+    gRelayoutCount = 0u;
+
+    Actor listView = Actor::New();
+    Stage::GetCurrent().Add( listView );
+
+    // Build the list and relayout it
+    double start = GetTimeMilliseconds();
+    std::vector< Actor > items;
+    CreateItems( listView, items, itemCount );
+    application.SendNotification();
+    application.Render();
+    const double buildTime = GetTimeMilliseconds() - start;
+
+    // Resize all the items, each becoming the root of a dirty sub tree
+    start = GetTimeMilliseconds();
+    for( unsigned int i = 0; i < itemCount; ++i )
+    {
+      items[i].SetSize( 100.0f, 40.0f );
+    }
+    const double dirtyTime = GetTimeMilliseconds() - start;
+    DALI_TEST_CHECK( RelayoutController::Get()->GetDirtySubTreeCount() >= itemCount );
+
+    // Destroy the list view and its items before the relayout
+    start = GetTimeMilliseconds();
+    Stage::GetCurrent().Remove( listView );
+    listView.Reset();
+    items.clear();
+    const double destroyTime = GetTimeMilliseconds() - start;
+    DALI_TEST_EQUALS( RelayoutController::Get()->GetDirtySubTreeCount(), 0u, TEST_LOCATION );
+
+    // Rebuild the list
+    start = GetTimeMilliseconds();
+    listView = Actor::New();
+    Stage::GetCurrent().Add( listView );
+    CreateItems( listView, items, itemCount );
+    application.SendNotification();
+    application.Render();
+    const double rebuildTime = GetTimeMilliseconds() - start;
+
+    tet_printf( "%u items: build %.3f ms, dirty %.3f ms, destroy %.3f ms, rebuild %.3f ms\n", itemCount, buildTime, dirtyTime, destroyTime, rebuildTime );
+
+    DALI_TEST_EQUALS( gRelayoutCount, 2u * itemCount, TEST_LOCATION );
+    DALI_TEST_EQUALS( RelayoutController::Get()->GetDirtySubTreeCount(), 0u, TEST_LOCATION );
+
+    Stage::GetCurrent().Remove( listView );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliRelayoutControllerMeasurementCache(void)
+{
+  TestApplication application;
+  tet_infoline("Test the measurements are reused until the actor or its inputs change");
+
+  RelayoutController* controller = RelayoutController::Get();
+
+  Actor listView = Actor::New();
+  listView.SetResizePolicy( ResizePolicy::FIXED, Dimension::ALL_DIMENSIONS );
+  listView.SetSize( 100.0f, 800.0f );
+  Stage::GetCurrent().Add( listView );
+
+  const unsigned int ITEM_COUNT = 10u;
+  std::vector< CustomActor > items;
+  CreateTextItems( listView, items, ITEM_COUNT );
+
+  gMeasureCount = 0u;
+  unsigned int hits = controller->GetMeasurementCacheHits();
+  unsigned int misses = controller->GetMeasurementCacheMisses();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( gMeasureCount, ITEM_COUNT, TEST_LOCATION );
+  DALI_TEST_EQUALS( controller->GetMeasurementCacheMisses() - misses, ITEM_COUNT, TEST_LOCATION );
+  DALI_TEST_EQUALS( controller->GetMeasurementCacheHits() - hits, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( items[5].GetTargetSize().height, 2.0f * TextItemImpl::LINE_HEIGHT, TEST_LOCATION );
+
+  // The items are connected to the stage again, and negotiated with the same width; their heights are reused
+  gMeasureCount = 0u;
+  hits = controller->GetMeasurementCacheHits();
+  misses = controller->GetMeasurementCacheMisses();
+  for( unsigned int i = 0; i < ITEM_COUNT; ++i )
+  {
+    listView.Remove( items[i] );
+    listView.Add( items[i] );
+  }
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( gMeasureCount, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( controller->GetMeasurementCacheHits() - hits, ITEM_COUNT, TEST_LOCATION );
+  DALI_TEST_EQUALS( controller->GetMeasurementCacheMisses() - misses, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( items[5].GetTargetSize().height, 2.0f * TextItemImpl::LINE_HEIGHT, TEST_LOCATION );
+
+  // An item requesting a relayout is measured again
+  gMeasureCount = 0u;
+  static_cast< TextItemImpl& >( items[5].GetImplementation() ).SetTextLength( 45u );
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( gMeasureCount, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( items[5].GetTargetSize().height, 5.0f * TextItemImpl::LINE_HEIGHT, TEST_LOCATION );
+
+  // A new width is a new input
+  Actor narrowListView = Actor::New();
+  narrowListView.SetResizePolicy( ResizePolicy::FIXED, Dimension::ALL_DIMENSIONS );
+  narrowListView.SetSize( 50.0f, 800.0f );
+  Stage::GetCurrent().Add( narrowListView );
+
+  gMeasureCount = 0u;
+  for( unsigned int i = 0; i < ITEM_COUNT; ++i )
+  {
+    narrowListView.Add( items[i] );
+  }
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( gMeasureCount, ITEM_COUNT, TEST_LOCATION );
+  DALI_TEST_EQUALS( items[5].GetTargetSize().height, 9.0f * TextItemImpl::LINE_HEIGHT, TEST_LOCATION );
+
+  // A new policy is measured again
+  gMeasureCount = 0u;
+  items[5].SetResizePolicy( ResizePolicy::USE_NATURAL_SIZE, Dimension::ALL_DIMENSIONS );
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( gMeasureCount, 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( items[5].GetTargetSize(), Vector3( 450.0f, TextItemImpl::LINE_HEIGHT, 0.0f ), TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliRelayoutControllerMeasurementCacheChildren(void)
+{
+  TestApplication application;
+  tet_infoline("Test the natural size of a parent is measured again when a child changes");
+
+  // The natural size of a text item does not depend on its children, but it could
+  CustomActor parent( *new TextItemImpl() );
+  parent.SetResizePolicy( ResizePolicy::USE_NATURAL_SIZE, Dimension::ALL_DIMENSIONS );
+  static_cast< TextItemImpl& >( parent.GetImplementation() ).SetTextLength( 5u );
+  Stage::GetCurrent().Add( parent );
+
+  Actor child = Actor::New();
+  child.SetResizePolicy( ResizePolicy::FIXED, Dimension::ALL_DIMENSIONS );
+  child.SetSize( 10.0f, 10.0f );
+  parent.Add( child );
+
+  application.SendNotification();
+  application.Render();
+
+  gMeasureCount = 0u;
+  child.SetSize( 20.0f, 20.0f );
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( gMeasureCount, 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( parent.GetTargetSize(), Vector3( 50.0f, TextItemImpl::LINE_HEIGHT, 0.0f ), TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliRelayoutControllerManyMeasurements(void)
+{
+  TestApplication application;
+  tet_infoline("Move many text items to a list view of the same width, then to a narrower one");
+
+  const unsigned int ITEM_COUNT = 2000u;
+  const float WIDTHS[] = { 400.0f, 400.0f, 300.0f };
+
+  RelayoutController* controller = RelayoutController::Get();
+  std::vector< CustomActor > items;
+  for( unsigned int test = 0; test < sizeof( WIDTHS ) / sizeof( WIDTHS[0] ); ++test )
+  {
+    Actor listView = Actor::New();
+    listView.SetResizePolicy( ResizePolicy::FIXED, Dimension::ALL_DIMENSIONS );
+    listView.SetSize( WIDTHS[test], 800.0f );
+    Stage::GetCurrent().Add( listView );
+
+    const unsigned int hits = controller->GetMeasurementCacheHits();
+    const unsigned int misses = controller->GetMeasurementCacheMisses();
+    gMeasureCount = 0u;
+
+    const double start = GetTimeMilliseconds();
+    if( items.empty() )
+    {
+      CreateTextItems( listView, items, ITEM_COUNT );
+    }
+    else
+    {
+      for( unsigned int i = 0; i < ITEM_COUNT; ++i )
+      {
+        listView.Add( items[i] );
+      }
+    }
+    application.SendNotification();
+    application.Render();
+    const double time = GetTimeMilliseconds() - start;
+
+    tet_printf( "%u items, width %.0f: %.3f ms, %u hits, %u misses\n", ITEM_COUNT, WIDTHS[test], time,
+                controller->GetMeasurementCacheHits() - hits, controller->GetMeasurementCacheMisses() - misses );
+
+    // Only the first list view and the narrower one need measurements
+    const unsigned int expectedMeasurements = ( test == 1u ) ? 0u : ITEM_COUNT;
+    DALI_TEST_EQUALS( gMeasureCount, expectedMeasurements, TEST_LOCATION );
+    DALI_TEST_EQUALS( controller->GetMeasurementCacheMisses() - misses, expectedMeasurements, TEST_LOCATION );
+    DALI_TEST_EQUALS( controller->GetMeasurementCacheHits() - hits, ITEM_COUNT - expectedMeasurements, TEST_LOCATION );
+  }
+
+  END_TEST;
+}
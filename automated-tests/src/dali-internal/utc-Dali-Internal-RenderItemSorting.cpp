@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#include <dali/public-api/dali-core.h>
+#include <dali-test-suite-utils.h>
+
+// Internal headers are allowed here
+
+#include <dali/internal/render/common/render-item.h>
+#include <dali/internal/update/manager/prepare-render-instructions.h>
+
+using namespace Dali;
+using Internal::SceneGraph::RenderItem;
+using Internal::SceneGraph::RendererWithSortAttributes;
+using Internal::SceneGraph::RenderItemSortKey;
+using Internal::SceneGraph::RenderItemSortKeyContainer;
+
+void utc_dali_internal_render_item_sorting_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_render_item_sorting_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const unsigned int ITEM_COUNT = 5000u;
+
+/**
+ * The comparison used to sort the items of a 2D layer before the radix sort
+ */
+bool CompareItems( const RendererWithSortAttributes& lhs, const RendererWithSortAttributes& rhs )
+{
+  if( lhs.renderItem->mDepthIndex == rhs.renderItem->mDepthIndex )
+  {
+    if( lhs.shader == rhs.shader )
+    {
+      if( lhs.textureResourceId == rhs.textureResourceId )
+      {
+        return lhs.geometry < rhs.geometry;
+      }
+      return lhs.textureResourceId < rhs.textureResourceId;
+    }
+    return lhs.shader < rhs.shader;
+  }
+  return lhs.renderItem->mDepthIndex < rhs.renderItem->mDepthIndex;
+}
+
+/**
+ * The comparison used to sort the items of a 3D layer before the radix sort
+ */
+bool CompareItems3D( const RendererWithSortAttributes& lhs, const RendererWithSortAttributes& rhs )
+{
+  bool lhsIsOpaque = lhs.renderItem->mIsOpaque;
+  if( lhsIsOpaque == rhs.renderItem->mIsOpaque )
+  {
+    if( lhsIsOpaque || Equals( lhs.zValue, rhs.zValue ) )
+    {
+      if( lhs.shader == rhs.shader )
+      {
+        if( lhs.textureResourceId == rhs.textureResourceId )
+        {
+          return lhs.geometry < rhs.geometry;
+        }
+        return lhs.textureResourceId < rhs.textureResourceId;
+      }
+      return lhs.shader < rhs.shader;
+    }
+    return lhs.zValue > rhs.zValue;
+  }
+  return lhsIsOpaque;
+}
+
+/**
+ * Creates items sharing a few shaders, textures and geometries, as in a real scene.
+ * The z values are far enough apart to be ordered the same way with or without an epsilon.
+ */
+void CreateItems( std::vector< RenderItem* >& items, std::vector< RendererWithSortAttributes >& attributes )
+{
+  srand( 42 );
+
+  // Pointers in the range of a 64 bit heap, if the platform allows it
+  const uintptr_t base = ( sizeof( uintptr_t ) > 4u ) ? static_cast< uintptr_t >( 0x7f3a12340000ull ) : 0x12340000u;
+
+  for( unsigned int i = 0; i < ITEM_COUNT; ++i )
+  {
+    RenderItem* item = RenderItem::New();
+    item->mDepthIndex = ( rand() % 21 ) - 10;
+    item->mIsOpaque = ( rand() % 2 ) == 0;
+    items.push_back( item );
+
+    RendererWithSortAttributes itemAttributes;
+    itemAttributes.renderItem = item;
+    itemAttributes.shader = reinterpret_cast< const Internal::SceneGraph::Shader* >( base + ( rand() % 7 ) * 0x1040u );
+    itemAttributes.textureResourceId = rand() % 50;
+    itemAttributes.geometry = reinterpret_cast< const Internal::Render::Geometry* >( base + 0x100000u + ( rand() % 5 ) * 0x30u );
+    itemAttributes.zValue = ( rand() % 200 - 100 ) * 0.25f;
+    attributes.push_back( itemAttributes );
+  }
+}
+
+void DeleteItems( std::vector< RenderItem* >& items )
+{
+  for( std::vector< RenderItem* >::iterator iter = items.begin(); iter != items.end(); ++iter )
+  {
+    delete *iter;
+  }
+}
+
+/**
+ * Sorts the items with the radix sort, then checks the order is the same as the one of the comparison
+ */
+bool SortsLikeComparison( std::vector< RendererWithSortAttributes >& attributes, bool layer3D )
+{
+  RenderItemSortKeyContainer keys( attributes.size() );
+  RenderItemSortKeyContainer buffer( attributes.size() );
+  for( size_t i = 0; i < attributes.size(); ++i )
+  {
+    Internal::SceneGraph::SetSortKey( attributes[i], layer3D, keys[i] );
+  }
+  Internal::SceneGraph::SortRenderItemKeys( keys, buffer );
+
+  std::stable_sort( attributes.begin(), attributes.end(), layer3D ? CompareItems3D : CompareItems );
+
+  bool same( keys.size() == attributes.size() );
+  for( size_t i = 0; same && i < keys.size(); ++i )
+  {
+    same = ( keys[i].renderItem == attributes[i].renderItem );
+  }
+  return same;
+}
+
+} // unnamed namespace
+
+int UtcDaliRenderItemSorting2D(void)
+{
+  TestApplication application;
+  tet_infoline("Test that the radix sort orders the items of a 2D layer as the comparison did");
+
+  std::vector< RenderItem* > items;
+  std::vector< RendererWithSortAttributes > attributes;
+  CreateItems( items, attributes );
+
+  DALI_TEST_CHECK( SortsLikeComparison( attributes, false ) );
+
+  DeleteItems( items );
+  END_TEST;
+}
+
+int UtcDaliRenderItemSorting3D(void)
+{
+  TestApplication application;
+  tet_infoline("Test that the radix sort orders the items of a 3D layer as the comparison did");
+
+  std::vector< RenderItem* > items;
+  std::vector< RendererWithSortAttributes > attributes;
+  CreateItems( items, attributes );
+
+  DALI_TEST_CHECK( SortsLikeComparison( attributes, true ) );
+
+  DeleteItems( items );
+  END_TEST;
+}
+
+int UtcDaliRenderItemSortingStable(void)
+{
+  TestApplication application;
+  tet_infoline("Test that the items with the same key keep their order, and that small lists are handled");
+
+  std::vector< RenderItem* > items;
+  std::vector< RendererWithSortAttributes > attributes;
+  CreateItems( items, attributes );
+
+  // Every item has the same key
+  for( size_t i = 0; i < attributes.size(); ++i )
+  {
+    attributes[i].renderItem->mDepthIndex = 3;
+    attributes[i].shader = attributes[0].shader;
+    attributes[i].textureResourceId = attributes[0].textureResourceId;
+    attributes[i].geometry = attributes[0].geometry;
+  }
+  DALI_TEST_CHECK( SortsLikeComparison( attributes, false ) );
+
+  // Negative and positive depth indices and z values around zero
+  attributes.resize( 4u );
+  attributes[0].renderItem->mDepthIndex = 1;
+  attributes[1].renderItem->mDepthIndex = -1;
+  attributes[2].renderItem->mDepthIndex = 0;
+  attributes[3].renderItem->mDepthIndex = -1000;
+  DALI_TEST_CHECK( SortsLikeComparison( attributes, false ) );
+
+  for( size_t i = 0; i < attributes.size(); ++i )
+  {
+    attributes[i].renderItem->mIsOpaque = false;
+  }
+  attributes[0].zValue = -0.5f;
+  attributes[1].zValue = 2.0f;
+  attributes[2].zValue = -100.0f;
+  attributes[3].zValue = 0.25f;
+  DALI_TEST_CHECK( SortsLikeComparison( attributes, true ) );
+
+  attributes.resize( 1u );
+  DALI_TEST_CHECK( SortsLikeComparison( attributes, true ) );
+
+  DeleteItems( items );
+  END_TEST;
+}
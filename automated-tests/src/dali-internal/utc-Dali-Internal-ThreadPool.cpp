@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <dali/public-api/dali-core.h>
+#include <dali-test-suite-utils.h>
+
+// Internal headers are allowed here
+
+#include <dali/internal/common/thread-pool.h>
+
+using namespace Dali;
+
+void utc_dali_internal_thread_pool_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_thread_pool_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+/**
+ * Counts how many times each item has been processed
+ */
+class CountingTask : public Internal::ThreadPool::Task
+{
+public:
+
+  CountingTask( unsigned int count )
+  : mCounts( count, 0u )
+  {
+  }
+
+  virtual void Process( unsigned int begin, unsigned int end )
+  {
+    for( unsigned int i(begin); i<end; ++i )
+    {
+      // Items are disjoint, no need to synchronize
+      ++mCounts[i];
+    }
+  }
+
+  bool EachItemProcessedOnce() const
+  {
+    for( unsigned int i(0); i<mCounts.size(); ++i )
+    {
+      if( mCounts[i] != 1u )
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+private:
+
+  std::vector<unsigned int> mCounts;
+};
+
+} // namespace
+
+int UtcDaliThreadPoolProcessWithoutWorkers(void)
+{
+  TestApplication application;
+  tet_infoline("Test that a thread pool without workers processes every item on the calling thread");
+
+  Internal::ThreadPool pool( 0u );
+  DALI_TEST_EQUALS( pool.GetWorkerCount(), 0u, TEST_LOCATION );
+
+  CountingTask task( 1000u );
+  pool.Process( task, 1000u, 16u );
+  DALI_TEST_CHECK( task.EachItemProcessedOnce() );
+
+  END_TEST;
+}
+
+int UtcDaliThreadPoolProcessEachItemOnce(void)
+{
+  TestApplication application;
+  tet_infoline("Test that every item is processed exactly once by the threads of the pool");
+
+  Internal::ThreadPool pool( 3u );
+  DALI_TEST_EQUALS( pool.GetWorkerCount(), 3u, TEST_LOCATION );
+
+  const unsigned int counts[] = { 0u, 1u, 31u, 64u, 1000u, 10007u };
+  const unsigned int chunkSizes[] = { 0u, 1u, 7u, 32u };
+  for( unsigned int i(0); i<sizeof(counts)/sizeof(counts[0]); ++i )
+  {
+    for( unsigned int j(0); j<sizeof(chunkSizes)/sizeof(chunkSizes[0]); ++j )
+    {
+      // Run several times to re-use the workers
+      for( unsigned int k(0); k<3u; ++k )
+      {
+        CountingTask task( counts[i] );
+        pool.Process( task, counts[i], chunkSizes[j] );
+        DALI_TEST_CHECK( task.EachItemProcessedOnce() );
+      }
+    }
+  }
+
+  END_TEST;
+}
@@ -0,0 +1,363 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali/public-api/dali-core.h>
+#include <dali-test-suite-utils.h>
+
+// Internal headers are allowed here
+
+#include <dali/internal/common/math.h>
+#include <dali/internal/common/thread-pool.h>
+#include <dali/internal/update/manager/transform-manager.h>
+
+using namespace Dali;
+using namespace Dali::Internal::SceneGraph;
+
+void utc_dali_internal_transform_manager_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_transform_manager_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+/**
+ * Runs one frame the same way UpdateManager does
+ */
+void UpdateFrame( TransformManager& manager )
+{
+  manager.ResetToBaseValue();
+  manager.Update();
+}
+
+} // namespace
+
+int UtcDaliTransformManagerSkipCleanSubTrees(void)
+{
+  TestApplication application;
+  tet_infoline("Test that TransformManager only recomputes the world matrices of dirty sub-trees");
+
+  TransformManager manager;
+  TransformId root = manager.CreateTransform();
+  TransformId parentA = manager.CreateTransform();
+  TransformId childA = manager.CreateTransform();
+  TransformId parentB = manager.CreateTransform();
+  TransformId childB = manager.CreateTransform();
+
+  manager.SetParent( parentA, root );
+  manager.SetParent( childA, parentA );
+  manager.SetParent( parentB, root );
+  manager.SetParent( childB, parentB );
+
+  manager.BakeVector3PropertyValue( parentA, TRANSFORM_PROPERTY_POSITION, Vector3( 10.0f, 0.0f, 0.0f ) );
+  manager.BakeVector3PropertyValue( childA, TRANSFORM_PROPERTY_POSITION, Vector3( 1.0f, 2.0f, 3.0f ) );
+  manager.BakeVector3PropertyValue( parentB, TRANSFORM_PROPERTY_POSITION, Vector3( 0.0f, 20.0f, 0.0f ) );
+
+  // First frame, everything is computed
+  UpdateFrame( manager );
+  DALI_TEST_EQUALS( manager.GetSkippedMatrixCount(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GetWorldMatrix( childA ).GetTranslation3(), Vector3( 11.0f, 2.0f, 3.0f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GetWorldMatrix( childB ).GetTranslation3(), Vector3( 0.0f, 20.0f, 0.0f ), TEST_LOCATION );
+
+  // Nothing changed, everything is skipped
+  UpdateFrame( manager );
+  DALI_TEST_EQUALS( manager.GetSkippedMatrixCount(), 5u, TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GetWorldMatrix( childA ).GetTranslation3(), Vector3( 11.0f, 2.0f, 3.0f ), TEST_LOCATION );
+
+  // Change parentB, only parentB and childB are recomputed
+  manager.SetVector3PropertyValue( parentB, TRANSFORM_PROPERTY_POSITION, Vector3( 0.0f, 30.0f, 0.0f ) );
+  manager.Update();
+  DALI_TEST_EQUALS( manager.GetSkippedMatrixCount(), 3u, TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GetWorldMatrix( childB ).GetTranslation3(), Vector3( 0.0f, 30.0f, 0.0f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GetBoundingSphere( childB ), Vector4( 0.0f, 30.0f, 0.0f, 0.0f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GetWorldMatrix( childA ).GetTranslation3(), Vector3( 11.0f, 2.0f, 3.0f ), TEST_LOCATION );
+
+  // Resetting to the base value restores the previous transform
+  UpdateFrame( manager );
+  DALI_TEST_EQUALS( manager.GetSkippedMatrixCount(), 3u, TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GetWorldMatrix( childB ).GetTranslation3(), Vector3( 0.0f, 20.0f, 0.0f ), TEST_LOCATION );
+
+  // Change the root, everything is recomputed
+  manager.BakeVector3PropertyValue( root, TRANSFORM_PROPERTY_POSITION, Vector3( 5.0f, 5.0f, 5.0f ) );
+  UpdateFrame( manager );
+  DALI_TEST_EQUALS( manager.GetSkippedMatrixCount(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GetWorldMatrix( childA ).GetTranslation3(), Vector3( 16.0f, 7.0f, 8.0f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GetWorldMatrix( childB ).GetTranslation3(), Vector3( 5.0f, 25.0f, 5.0f ), TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliTransformManagerSkipAfterReparent(void)
+{
+  TestApplication application;
+  tet_infoline("Test that TransformManager recomputes the world matrices of re-parented sub-trees");
+
+  TransformManager manager;
+  TransformId root = manager.CreateTransform();
+  TransformId parentA = manager.CreateTransform();
+  TransformId parentB = manager.CreateTransform();
+  TransformId child = manager.CreateTransform();
+
+  manager.SetParent( parentA, root );
+  manager.SetParent( parentB, root );
+  manager.SetParent( child, parentA );
+
+  manager.BakeVector3PropertyValue( parentA, TRANSFORM_PROPERTY_POSITION, Vector3( 10.0f, 0.0f, 0.0f ) );
+  manager.BakeVector3PropertyValue( parentB, TRANSFORM_PROPERTY_POSITION, Vector3( 0.0f, 10.0f, 0.0f ) );
+  UpdateFrame( manager );
+  DALI_TEST_EQUALS( manager.GetWorldMatrix( child ).GetTranslation3(), Vector3( 10.0f, 0.0f, 0.0f ), TEST_LOCATION );
+
+  manager.SetParent( child, parentB );
+  UpdateFrame( manager );
+  DALI_TEST_EQUALS( manager.GetSkippedMatrixCount(), 3u, TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GetWorldMatrix( child ).GetTranslation3(), Vector3( 0.0f, 10.0f, 0.0f ), TEST_LOCATION );
+
+  manager.RemoveTransform( parentA );
+  UpdateFrame( manager );
+  DALI_TEST_EQUALS( manager.GetSkippedMatrixCount(), 3u, TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GetWorldMatrix( parentB ).GetTranslation3(), Vector3( 0.0f, 10.0f, 0.0f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( manager.GetWorldMatrix( child ).GetTranslation3(), Vector3( 0.0f, 10.0f, 0.0f ), TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliTransformManagerComposeTransformsMatchesMatrix(void)
+{
+  TestApplication application;
+  tet_infoline("Test that the batched composition of transforms gives the same result as Matrix::SetTransformComponents");
+
+  const unsigned int count( 11u );
+  float components[count * 10u];
+  unsigned int indices[count];
+  Matrix results[count];
+
+  for( unsigned int i(0); i<count; ++i )
+  {
+    Vector3 scale( 1.0f + i, 2.0f - i * 0.5f, 0.25f * i );
+    Quaternion orientation( i % 3 ? Quaternion( Radian( 0.3f * i ), Vector3( i * 0.1f, 1.0f, i * 0.2f ) ) : Quaternion::IDENTITY );
+    Vector3 translation( i * 10.0f, -3.0f * i, i * 0.125f );
+
+    memcpy( &components[i * 10u], scale.AsFloat(), sizeof( Vector3 ) );
+    memcpy( &components[i * 10u + 3u], orientation.mVector.AsFloat(), sizeof( Vector4 ) );
+    memcpy( &components[i * 10u + 7u], translation.AsFloat(), sizeof( Vector3 ) );
+
+    // Write the results in reverse order
+    indices[i] = count - 1u - i;
+  }
+
+  Internal::ComposeTransforms( reinterpret_cast<Internal::Mat4*>( &results[0] ), indices, components, count );
+
+  for( unsigned int i(0); i<count; ++i )
+  {
+    Vector3 scale( &components[i * 10u] );
+    Quaternion orientation( Vector4( &components[i * 10u + 3u] ) );
+    Vector3 translation( &components[i * 10u + 7u] );
+
+    Matrix expected( false );
+    expected.SetTransformComponents( scale, orientation, translation );
+    DALI_TEST_CHECK( memcmp( expected.AsFloat(), results[ indices[i] ].AsFloat(), sizeof( Matrix ) ) == 0 );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliTransformManagerMultiplyMatricesMatchesMatrix(void)
+{
+  TestApplication application;
+  tet_infoline("Test that the vectorised matrix multiplication gives the same result as Matrix::Multiply");
+
+  Matrix lhs( false );
+  Matrix rhs( false );
+  lhs.SetTransformComponents( Vector3( 1.5f, 0.5f, 2.0f ), Quaternion( Radian( 0.7f ), Vector3( 0.3f, 1.0f, 0.2f ) ), Vector3( 10.0f, 20.0f, 30.0f ) );
+  rhs.SetTransformComponents( Vector3( 0.3f, 1.7f, 1.1f ), Quaternion( Radian( -1.3f ), Vector3( 1.0f, 0.1f, 0.5f ) ), Vector3( -5.0f, 0.25f, 7.0f ) );
+
+  Matrix expected( false );
+  Matrix result( false );
+  Matrix::Multiply( expected, lhs, rhs );
+  Internal::MultiplyMatrices( result.AsFloat(), lhs.AsFloat(), rhs.AsFloat() );
+  DALI_TEST_CHECK( memcmp( expected.AsFloat(), result.AsFloat(), sizeof( Matrix ) ) == 0 );
+
+  END_TEST;
+}
+
+int UtcDaliTransformManagerThreadPoolMatchesSingleThread(void)
+{
+  TestApplication application;
+  tet_infoline("Test that TransformManager computes the same world matrices with a thread pool");
+
+  Internal::ThreadPool threadPool( 3u );
+  TransformManager singleThreaded;
+  TransformManager multiThreaded;
+  multiThreaded.SetThreadPool( &threadPool );
+
+  // A wide tree, so each depth is split across the threads of the pool
+  const unsigned int childCount( 1000u );
+  std::vector<TransformId> ids;
+  for( unsigned int i(0); i<childCount * 2u + 1u; ++i )
+  {
+    TransformId id = singleThreaded.CreateTransform();
+    DALI_TEST_EQUALS( multiThreaded.CreateTransform(), id, TEST_LOCATION );
+    ids.push_back( id );
+  }
+
+  for( unsigned int i(0); i<childCount; ++i )
+  {
+    // Children of the root, then one grand-child per child
+    TransformId child = ids[i + 1u];
+    TransformId grandChild = ids[i + 1u + childCount];
+
+    TransformManager* managers[] = { &singleThreaded, &multiThreaded };
+    for( unsigned int m(0); m<2u; ++m )
+    {
+      managers[m]->SetParent( child, ids[0] );
+      managers[m]->SetParent( grandChild, child );
+      managers[m]->BakeVector3PropertyValue( child, TRANSFORM_PROPERTY_POSITION, Vector3( i * 1.0f, i * 2.0f, 0.0f ) );
+      managers[m]->BakeVector3PropertyValue( grandChild, TRANSFORM_PROPERTY_SCALE, Vector3( 1.0f + i * 0.01f, 1.0f, 1.0f ) );
+      managers[m]->BakeQuaternionPropertyValue( grandChild, Quaternion( Radian( i * 0.01f ), Vector3::ZAXIS ) );
+      managers[m]->SetVector3PropertyValue( grandChild, TRANSFORM_PROPERTY_SIZE, Vector3( 10.0f, 20.0f, 0.0f ) );
+    }
+  }
+
+  // Rotate the root in the second frame, every world matrix is recomputed
+  for( unsigned int frame(0); frame<2u; ++frame )
+  {
+    UpdateFrame( singleThreaded );
+    UpdateFrame( multiThreaded );
+    DALI_TEST_EQUALS( multiThreaded.GetSkippedMatrixCount(), singleThreaded.GetSkippedMatrixCount(), TEST_LOCATION );
+
+    bool identical( true );
+    for( unsigned int i(0); i<ids.size(); ++i )
+    {
+      identical = identical &&
+                  memcmp( singleThreaded.GetWorldMatrix( ids[i] ).AsFloat(), multiThreaded.GetWorldMatrix( ids[i] ).AsFloat(), sizeof( Matrix ) ) == 0 &&
+                  singleThreaded.GetBoundingSphere( ids[i] ) == multiThreaded.GetBoundingSphere( ids[i] );
+    }
+    DALI_TEST_CHECK( identical );
+
+    singleThreaded.BakeQuaternionPropertyValue( ids[0], Quaternion( Radian( 0.5f ), Vector3::YAXIS ) );
+    multiThreaded.BakeQuaternionPropertyValue( ids[0], Quaternion( Radian( 0.5f ), Vector3::YAXIS ) );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliTransformManagerSubtreeBoundingSphere(void)
+{
+  TestApplication application;
+  tet_infoline("Test that the sub-tree bounding spheres contain the rectangles of all the descendants");
+
+  TransformManager manager;
+  TransformId root = manager.CreateTransform();
+  TransformId childA = manager.CreateTransform();
+  TransformId childB = manager.CreateTransform();
+  TransformId grandChild = manager.CreateTransform();
+
+  manager.SetParent( childA, root );
+  manager.SetParent( childB, root );
+  manager.SetParent( grandChild, childB );
+
+  manager.BakeVector3PropertyValue( childA, TRANSFORM_PROPERTY_SIZE, Vector3( 10.0f, 10.0f, 0.0f ) );
+  manager.BakeVector3PropertyValue( grandChild, TRANSFORM_PROPERTY_SIZE, Vector3( 10.0f, 10.0f, 0.0f ) );
+  manager.BakeVector3PropertyValue( childA, TRANSFORM_PROPERTY_POSITION, Vector3( -100.0f, 0.0f, 0.0f ) );
+  manager.BakeVector3PropertyValue( grandChild, TRANSFORM_PROPERTY_POSITION, Vector3( 100.0f, 0.0f, 0.0f ) );
+  manager.BakeVector3PropertyValue( grandChild, TRANSFORM_PROPERTY_SCALE, Vector3( 1.0f, 4.0f, 1.0f ) );
+  UpdateFrame( manager );
+
+  // The rectangle of the grand child is 10x40 around (100,0,0), its sphere contains the corners
+  Vector4 sphere( manager.GetSubtreeBoundingSphere( grandChild ) );
+  DALI_TEST_EQUALS( Vector3( sphere ), Vector3( 100.0f, 0.0f, 0.0f ), TEST_LOCATION );
+  DALI_TEST_CHECK( sphere.w >= Vector2( 5.0f, 20.0f ).Length() );
+
+  // childB has no size, its sub-tree sphere is the grand child's one
+  DALI_TEST_EQUALS( manager.GetSubtreeBoundingSphere( childB ), sphere, TEST_LOCATION );
+
+  // The root sphere contains both children
+  sphere = manager.GetSubtreeBoundingSphere( root );
+  DALI_TEST_CHECK( ( Vector3( sphere ) - Vector3( -100.0f, 0.0f, 0.0f ) ).Length() + Vector2( 5.0f, 5.0f ).Length() <= sphere.w + Math::MACHINE_EPSILON_100 );
+  DALI_TEST_CHECK( ( Vector3( sphere ) - Vector3( 100.0f, 0.0f, 0.0f ) ).Length() + Vector2( 5.0f, 20.0f ).Length() <= sphere.w + Math::MACHINE_EPSILON_100 );
+
+  // Moving the grand child updates the spheres of its ancestors
+  manager.BakeVector3PropertyValue( grandChild, TRANSFORM_PROPERTY_POSITION, Vector3( 200.0f, 0.0f, 0.0f ) );
+  UpdateFrame( manager );
+  sphere = manager.GetSubtreeBoundingSphere( root );
+  DALI_TEST_CHECK( ( Vector3( sphere ) - Vector3( 200.0f, 0.0f, 0.0f ) ).Length() + Vector2( 5.0f, 20.0f ).Length() <= sphere.w + Math::MACHINE_EPSILON_100 );
+
+  // An unbounded sub-tree makes all its ancestors unbounded, without any transform change
+  manager.SetUnbounded( grandChild, true );
+  UpdateFrame( manager );
+  DALI_TEST_CHECK( manager.GetSubtreeBoundingSphere( root ).w < 0.0f );
+  DALI_TEST_CHECK( manager.GetSubtreeBoundingSphere( childB ).w < 0.0f );
+  DALI_TEST_CHECK( manager.GetSubtreeBoundingSphere( childA ).w > 0.0f );
+
+  manager.SetUnbounded( grandChild, false );
+  UpdateFrame( manager );
+  DALI_TEST_CHECK( manager.GetSubtreeBoundingSphere( root ).w > 0.0f );
+
+  END_TEST;
+}
+
+int UtcDaliTransformManagerPublishedSubtreeBoundingSphere(void)
+{
+  TestApplication application;
+  tet_infoline("Test that the sub-tree bounding spheres are refitted incrementally and published per buffer");
+
+  TransformManager manager;
+  TransformId root = manager.CreateTransform();
+  TransformId childA = manager.CreateTransform();
+  TransformId childB = manager.CreateTransform();
+
+  manager.SetParent( childA, root );
+  manager.SetParent( childB, root );
+  manager.BakeVector3PropertyValue( childA, TRANSFORM_PROPERTY_SIZE, Vector3( 10.0f, 10.0f, 0.0f ) );
+  manager.BakeVector3PropertyValue( childB, TRANSFORM_PROPERTY_SIZE, Vector3( 10.0f, 10.0f, 0.0f ) );
+  manager.BakeVector3PropertyValue( childA, TRANSFORM_PROPERTY_POSITION, Vector3( -100.0f, 0.0f, 0.0f ) );
+  manager.BakeVector3PropertyValue( childB, TRANSFORM_PROPERTY_POSITION, Vector3( 100.0f, 0.0f, 0.0f ) );
+
+  // Nothing is published before the first update
+  DALI_TEST_CHECK( manager.GetSubtreeBoundingSphere( root, 0u ).w < 0.0f );
+
+  UpdateFrame( manager );
+  manager.PublishSubtreeBoundingSpheres( 0u );
+  const Vector4 sphereA( manager.GetSubtreeBoundingSphere( childA ) );
+  DALI_TEST_EQUALS( manager.GetSubtreeBoundingSphere( root, 0u ), manager.GetSubtreeBoundingSphere( root ), TEST_LOCATION );
+  DALI_TEST_CHECK( manager.GetSubtreeBoundingSphere( root, 1u ).w < 0.0f );
+
+  // Moving childB refits its sphere and the root's one, childA keeps its sphere
+  manager.BakeVector3PropertyValue( childB, TRANSFORM_PROPERTY_POSITION, Vector3( 300.0f, 0.0f, 0.0f ) );
+  UpdateFrame( manager );
+  manager.PublishSubtreeBoundingSpheres( 1u );
+  DALI_TEST_EQUALS( manager.GetSubtreeBoundingSphere( childA ), sphereA, TEST_LOCATION );
+  DALI_TEST_EQUALS( Vector3( manager.GetSubtreeBoundingSphere( childB ) ), Vector3( 300.0f, 0.0f, 0.0f ), TEST_LOCATION );
+  const Vector4 sphere( manager.GetSubtreeBoundingSphere( root ) );
+  DALI_TEST_CHECK( ( Vector3( sphere ) - Vector3( 300.0f, 0.0f, 0.0f ) ).Length() + Vector2( 5.0f, 5.0f ).Length() <= sphere.w + Math::MACHINE_EPSILON_100 );
+  DALI_TEST_CHECK( ( Vector3( sphere ) - Vector3( -100.0f, 0.0f, 0.0f ) ).Length() + Vector2( 5.0f, 5.0f ).Length() <= sphere.w + Math::MACHINE_EPSILON_100 );
+
+  // The buffer read by the event thread keeps the previous sphere until it is published again
+  DALI_TEST_EQUALS( manager.GetSubtreeBoundingSphere( root, 1u ), sphere, TEST_LOCATION );
+  DALI_TEST_CHECK( manager.GetSubtreeBoundingSphere( root, 0u ) != sphere );
+
+  UpdateFrame( manager );
+  manager.PublishSubtreeBoundingSpheres( 0u );
+  DALI_TEST_EQUALS( manager.GetSubtreeBoundingSphere( root, 0u ), sphere, TEST_LOCATION );
+
+  END_TEST;
+}
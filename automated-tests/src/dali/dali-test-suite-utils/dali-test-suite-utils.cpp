@@ -19,6 +19,7 @@
 #include "dali-test-suite-utils.h"
 
 // EXTERNAL INCLUDES
+#include <ctime>
 #include <ostream>
 
 // INTERNAL INCLUDES
@@ -337,3 +338,10 @@ BufferImage CreateBufferImage()
 {
   return CreateBufferImage(4, 4, Color::WHITE);
 }
+
+double GetTimeMilliseconds()
+{
+  timespec time;
+  clock_gettime( CLOCK_MONOTONIC, &time );
+  return time.tv_sec * 1e3 + time.tv_nsec * 1e-6;
+}
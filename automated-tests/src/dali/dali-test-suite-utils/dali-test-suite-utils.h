@@ -499,4 +499,10 @@ struct DefaultFunctionCoverage
 BufferImage CreateBufferImage();
 BufferImage CreateBufferImage(int width, int height, const Vector4& color);
 
+/**
+ * Retrieve the time of a monotonic clock, to measure how long the code under test takes
+ * @return The time in milliseconds
+ */
+double GetTimeMilliseconds();
+
 #endif // __DALI_TEST_SUITE_UTILS_H__
@@ -199,6 +199,11 @@ bool TestApplication::GetRenderNeedsUpdate()
   return mRenderStatus.NeedsUpdate();
 }
 
+const Integration::RenderStatus& TestApplication::GetRenderStatus() const
+{
+  return mRenderStatus;
+}
+
 bool TestApplication::RenderOnly( )
 {
   // Update Time values
@@ -79,6 +79,7 @@ public:
   bool RenderOnly( );
   void ResetContext();
   bool GetRenderNeedsUpdate();
+  const Integration::RenderStatus& GetRenderStatus() const;
 
 private:
   void DoUpdate( unsigned int intervalMilliseconds, const char* location=NULL );
@@ -67,11 +67,13 @@ void TestGlAbstraction::Initialize()
   mLastBlendFuncSrcAlpha  = 0;
   mLastBlendFuncDstAlpha  = 0;
   mLastAutoTextureIdUsed = 0;
+  mLastVertexArrayIdUsed = 0;
   mLastShaderIdUsed = 0;
   mLastProgramIdUsed = 0;
   mLastUniformIdUsed = 0;
 
   mUniforms.clear();
+  mCustomAttribLocations.clear();
   mProgramUniforms1i.clear();
   mProgramUniforms1f.clear();
   mProgramUniforms2f.clear();
@@ -84,6 +86,7 @@ void TestGlAbstraction::Initialize()
   mTextureTrace.Reset();
   mTexParamaterTrace.Reset();
   mDrawTrace.Reset();
+  mVertexArrayTrace.Reset();
 
   for( unsigned int i=0; i<MAX_ATTRIBUTE_CACHE_SIZE; ++i )
   {
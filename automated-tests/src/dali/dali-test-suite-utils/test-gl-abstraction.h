@@ -691,6 +691,12 @@ public:
   {
     std::string attribName(name);
 
+    std::map<std::string, int>::const_iterator iter = mCustomAttribLocations.find( attribName );
+    if( iter != mCustomAttribLocations.end() )
+    {
+      return iter->second;
+    }
+
     for( unsigned int i = 0; i < ATTRIB_TYPE_LAST; ++i )
     {
       if( mStdAttribs[i] == attribName )
@@ -1339,10 +1345,29 @@ public:
 
   inline void VertexAttrib4fv(GLuint indx, const GLfloat* values)
   {
+    std::stringstream out;
+    out << indx << ", " << values[0] << ", " << values[1] << ", " << values[2] << ", " << values[3];
+
+    TraceCallStack::NamedParams namedParams;
+    namedParams["index"] = ToString(indx);
+    namedParams["x"] = ToString(values[0]);
+    namedParams["y"] = ToString(values[1]);
+    namedParams["z"] = ToString(values[2]);
+    namedParams["w"] = ToString(values[3]);
+
+    mVertexArrayTrace.PushCall("VertexAttrib4fv", out.str(), namedParams);
   }
 
   inline void VertexAttribPointer(GLuint indx, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* ptr)
   {
+    std::stringstream out;
+    out << indx << ", " << size;
+
+    TraceCallStack::NamedParams namedParams;
+    namedParams["index"] = ToString(indx);
+    namedParams["size"] = ToString(size);
+
+    mVertexArrayTrace.PushCall("VertexAttribPointer", out.str(), namedParams);
   }
 
   inline void Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
@@ -1468,14 +1493,49 @@ public:
 
   inline void BindVertexArray(GLuint array)
   {
+    std::stringstream out;
+    out << array;
+
+    TraceCallStack::NamedParams namedParams;
+    namedParams["array"] = ToString(array);
+
+    mVertexArrayTrace.PushCall("BindVertexArray", out.str(), namedParams);
   }
 
   inline void DeleteVertexArrays(GLsizei n, const GLuint* arrays)
   {
+    std::stringstream out;
+    out << n;
+
+    TraceCallStack::NamedParams namedParams;
+    namedParams["n"] = ToString(n);
+    for(GLsizei i=0; i<n; i++)
+    {
+      std::ostringstream oss;
+      oss<<"arrays["<<i<<"]";
+      namedParams[oss.str()] = ToString(arrays[i]);
+    }
+
+    mVertexArrayTrace.PushCall("DeleteVertexArrays", out.str(), namedParams);
   }
 
   inline void GenVertexArrays(GLsizei n, GLuint* arrays)
   {
+    std::stringstream out;
+    for(GLsizei i=0; i<n; i++)
+    {
+      arrays[i] = ++mLastVertexArrayIdUsed;
+      out << arrays[i];
+      if(i<n-1)
+      {
+        out << ", ";
+      }
+    }
+
+    TraceCallStack::NamedParams namedParams;
+    namedParams["n"] = ToString(n);
+
+    mVertexArrayTrace.PushCall("GenVertexArrays", out.str(), namedParams);
   }
 
   inline GLboolean IsVertexArray(GLuint array)
@@ -1632,10 +1692,26 @@ public:
 
   inline void DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instanceCount)
   {
+    std::stringstream out;
+    out << mode << ", " << first << ", " << count << ", " << instanceCount;
+    TraceCallStack::NamedParams namedParams;
+    namedParams["mode"] = ToString(mode);
+    namedParams["first"] = ToString(first);
+    namedParams["count"] = ToString(count);
+    namedParams["instanceCount"] = ToString(instanceCount);
+    mDrawTrace.PushCall("DrawArraysInstanced", out.str(), namedParams);
   }
 
   inline void DrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const GLvoid* indices, GLsizei instanceCount)
   {
+    std::stringstream out;
+    out << mode << ", " << count << ", " << type << ", indices, " << instanceCount;
+    TraceCallStack::NamedParams namedParams;
+    namedParams["mode"] = ToString(mode);
+    namedParams["count"] = ToString(count);
+    namedParams["type"] = ToString(type);
+    namedParams["instanceCount"] = ToString(instanceCount);
+    mDrawTrace.PushCall("DrawElementsInstanced", out.str(), namedParams);
   }
 
   inline GLsync FenceSync(GLenum condition, GLbitfield flags)
@@ -1784,6 +1860,7 @@ public: // TEST FUNCTIONS
   inline void SetCompileStatus( GLuint value ) { mCompileStatus = value; }
   inline void SetLinkStatus( GLuint value ) { mLinkStatus = value; }
   inline void SetGetAttribLocationResult(  int result) { mGetAttribLocationResult = result; }
+  inline void SetAttribLocation( const std::string& name, int location ) { mCustomAttribLocations[name] = location; }
   inline void SetGetErrorResult(  GLenum result) { mGetErrorResult = result; }
   inline void SetGetStringResult(  GLubyte* result) { mGetStringResult = result; }
   inline void SetIsBufferResult(  GLboolean result) { mIsBufferResult = result; }
@@ -1850,6 +1927,11 @@ public: // TEST FUNCTIONS
   inline void ResetStencilFunctionCallStack() { mStencilFunctionTrace.Reset(); }
   inline TraceCallStack& GetStencilFunctionTrace() { return mStencilFunctionTrace; }
 
+  //Methods for Vertex array verification
+  inline void EnableVertexArrayCallTrace(bool enable) { mVertexArrayTrace.Enable(enable); }
+  inline void ResetVertexArrayCallStack() { mVertexArrayTrace.Reset(); }
+  inline TraceCallStack& GetVertexArrayTrace() { return mVertexArrayTrace; }
+
   template <typename T>
   inline bool GetUniformValue( const char* name, T& value ) const
   {
@@ -2024,6 +2106,7 @@ private:
   GLuint     mLinkStatus;
   GLint      mNumberOfActiveUniforms;
   GLint      mGetAttribLocationResult;
+  std::map<std::string, int> mCustomAttribLocations;
   GLenum     mGetErrorResult;
   GLubyte*   mGetStringResult;
   GLboolean  mIsBufferResult;
@@ -2065,6 +2148,9 @@ private:
   std::vector<GLuint> mDeletedTextureIds;
   std::vector<GLuint> mBoundTextures;
 
+  // Data for the IDs returned by GenVertexArrays
+  GLuint mLastVertexArrayIdUsed;
+
   struct ActiveTextureType
   {
     std::vector<GLuint> mBoundTextures;
@@ -2080,6 +2166,7 @@ private:
   TraceCallStack mDrawTrace;
   TraceCallStack mDepthFunctionTrace;
   TraceCallStack mStencilFunctionTrace;
+  TraceCallStack mVertexArrayTrace;
 
   // Shaders & Uniforms
   GLuint mLastShaderIdUsed;
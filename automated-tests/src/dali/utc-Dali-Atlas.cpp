@@ -292,3 +292,131 @@ int UtcDaliAtlasUploadN(void)
 
 
 
+
+// Upload pixel data at the positions allocated by the atlas
+int UtcDaliAtlasUploadPacked01P(void)
+{
+  TestApplication application;
+
+  Atlas atlas = Atlas::New( 64, 64, Pixel::RGBA8888 );
+
+  // Four quadrants, then the atlas is full
+  Vector4 textureRects[4];
+  for( unsigned int i = 0; i < 4; ++i )
+  {
+    DALI_TEST_CHECK( atlas.Upload( CreatePixelData( 32, 32, Pixel::RGBA8888 ), textureRects[i] ) );
+    DALI_TEST_EQUALS( textureRects[i].z - textureRects[i].x, 0.5f, TEST_LOCATION );
+    DALI_TEST_EQUALS( textureRects[i].w - textureRects[i].y, 0.5f, TEST_LOCATION );
+    for( unsigned int j = 0; j < i; ++j )
+    {
+      DALI_TEST_CHECK( textureRects[i] != textureRects[j] );
+    }
+  }
+  Vector4 textureRect;
+  DALI_TEST_CHECK( !atlas.Upload( CreatePixelData( 1, 1, Pixel::RGBA8888 ), textureRect ) );
+
+  TraceCallStack& callStack = application.GetGlAbstraction().GetTextureTrace();
+  callStack.Reset();
+  callStack.Enable(true);
+  application.SendNotification();
+  application.Render(16);
+  application.SendNotification();
+  application.Render(16);
+  callStack.Enable(false);
+
+  for( unsigned int i = 0; i < 4; ++i )
+  {
+    std::stringstream out;
+    out << GL_TEXTURE_2D <<", "<< 0u << ", " << textureRects[i].x * 64 << ", " << textureRects[i].y * 64 << ", " << 32u <<", "<< 32u;
+    DALI_TEST_CHECK( callStack.FindMethodAndParams("TexSubImage2D", out.str().c_str() ) );
+  }
+
+  // The area of a removed image is reused
+  atlas.Remove( textureRects[2] );
+  DALI_TEST_CHECK( atlas.Upload( CreatePixelData( 16, 32, Pixel::RGBA8888 ), textureRect ) );
+  DALI_TEST_EQUALS( textureRect.x, textureRects[2].x, TEST_LOCATION );
+  DALI_TEST_EQUALS( textureRect.y, textureRects[2].y, TEST_LOCATION );
+  DALI_TEST_CHECK( atlas.Upload( CreatePixelData( 16, 32, Pixel::RGBA8888 ), textureRect ) );
+  DALI_TEST_CHECK( !atlas.Upload( CreatePixelData( 16, 32, Pixel::RGBA8888 ), textureRect ) );
+
+  // Clearing the atlas frees the whole area
+  atlas.Clear( Color::TRANSPARENT );
+  DALI_TEST_CHECK( atlas.Upload( CreatePixelData( 64, 64, Pixel::RGBA8888 ), textureRect ) );
+  DALI_TEST_EQUALS( textureRect, Vector4( 0.0f, 0.0f, 1.0f, 1.0f ), TEST_LOCATION );
+
+  END_TEST;
+}
+
+// Upload resource images at the positions allocated by the atlas, and query their areas
+int UtcDaliAtlasUploadPacked02P(void)
+{
+  TestApplication application;
+
+  Atlas atlas = Atlas::New( 32, 32, Pixel::RGBA8888 );
+
+  Vector4 textureRect;
+  DALI_TEST_CHECK( !atlas.GetTextureRect( gTestImageFilename, textureRect ) );
+
+  PrepareResourceImage( application, 16, 16, Pixel::RGBA8888 );
+  DALI_TEST_CHECK( atlas.Upload( gTestImageFilename, textureRect ) );
+  DALI_TEST_EQUALS( textureRect.z - textureRect.x, 0.5f, TEST_LOCATION );
+
+  // The same image is shared rather than uploaded again
+  Vector4 sharedRect;
+  DALI_TEST_CHECK( atlas.Upload( gTestImageFilename, sharedRect ) );
+  DALI_TEST_EQUALS( sharedRect, textureRect, TEST_LOCATION );
+
+  TraceCallStack& callStack = application.GetGlAbstraction().GetTextureTrace();
+  callStack.Reset();
+  callStack.Enable(true);
+  application.SendNotification();
+  application.Render(16);
+  application.SendNotification();
+  application.Render(16);
+  callStack.Enable(false);
+  DALI_TEST_EQUALS( callStack.CountMethod("TexSubImage2D"), 1, TEST_LOCATION );
+
+  // Kept until removed as many times as uploaded
+  Vector4 queriedRect;
+  DALI_TEST_CHECK( atlas.GetTextureRect( gTestImageFilename, queriedRect ) );
+  DALI_TEST_EQUALS( queriedRect, textureRect, TEST_LOCATION );
+  atlas.Remove( textureRect );
+  DALI_TEST_CHECK( atlas.GetTextureRect( gTestImageFilename, queriedRect ) );
+  atlas.Remove( textureRect );
+  DALI_TEST_CHECK( !atlas.GetTextureRect( gTestImageFilename, queriedRect ) );
+
+  // The whole area is free again
+  DALI_TEST_CHECK( atlas.Upload( CreatePixelData( 32, 32, Pixel::RGBA8888 ), textureRect ) );
+
+  END_TEST;
+}
+
+int UtcDaliAtlasUploadPacked03P(void)
+{
+  TestApplication application;
+
+  Atlas atlas = Atlas::New( 32, 32, Pixel::RGBA8888 );
+
+  Vector4 rectA;
+  Vector4 rectB;
+  DALI_TEST_CHECK( atlas.Upload( CreatePixelData( 16, 16, Pixel::RGBA8888 ), rectA ) );
+  DALI_TEST_CHECK( atlas.Upload( CreatePixelData( 16, 16, Pixel::RGBA8888 ), rectB ) );
+
+  // Areas which were not allocated, or were already removed, are ignored
+  atlas.Remove( Vector4( 0.0f, 0.0f, 1.0f, 1.0f ) );
+  atlas.Remove( rectA );
+  atlas.Remove( rectA );
+
+  Vector4 textureRect;
+  DALI_TEST_CHECK( !atlas.Upload( CreatePixelData( 32, 32, Pixel::RGBA8888 ), textureRect ) );
+
+  // The area of the image still in the atlas is not reused
+  DALI_TEST_CHECK( atlas.Upload( CreatePixelData( 16, 16, Pixel::RGBA8888 ), textureRect ) );
+  DALI_TEST_CHECK( textureRect != rectB );
+
+  atlas.Remove( textureRect );
+  atlas.Remove( rectB );
+  DALI_TEST_CHECK( atlas.Upload( CreatePixelData( 32, 32, Pixel::RGBA8888 ), textureRect ) );
+
+  END_TEST;
+}
@@ -19,6 +19,8 @@
 
 #include <stdlib.h>
 #include <dali/public-api/dali-core.h>
+#include <dali/devel-api/animation/constraint-skip-unchanged.h>
+#include <dali/integration-api/profiling.h>
 #include <dali-test-suite-utils.h>
 
 using namespace Dali;
@@ -1202,3 +1204,185 @@ int UtcDaliConstraintTestPropertyTypesP(void)
 
 ///////////////////////////////////////////////////////////////////////////////
 
+
+///////////////////////////////////////////////////////////////////////////////
+// ConstraintSetSkipUnchanged
+///////////////////////////////////////////////////////////////////////////////
+namespace UtcDaliConstraintSkipUnchanged
+{
+/**
+ * Sets the current value to the first input, and counts the calls.
+ */
+struct EqualToInputFunctor
+{
+  EqualToInputFunctor( int& callCount ) : mCallCount( callCount ) { }
+
+  void operator()( Vector3& current, const PropertyInputContainer& inputs )
+  {
+    current = inputs[0]->GetVector3();
+    ++mCallCount;
+  }
+
+  int& mCallCount;
+};
+
+/**
+ * Creates a parent and a child whose size is constrained to the size of the parent.
+ * An unrelated animation is played, so that the scene is updated every frame.
+ */
+Constraint CreateConstrainedChild( Actor& parent, Actor& child, Animation& animation, int& callCount, bool skipUnchanged )
+{
+  parent = Actor::New();
+  parent.SetSize( 100.0f, 100.0f );
+  Stage::GetCurrent().Add( parent );
+
+  child = Actor::New();
+  parent.Add( child );
+
+  Constraint constraint = Constraint::New< Vector3 >( child, Actor::Property::SIZE, EqualToInputFunctor( callCount ) );
+  constraint.AddSource( ParentSource( Actor::Property::SIZE ) );
+  ConstraintSetSkipUnchanged( constraint, skipUnchanged );
+  constraint.Apply();
+
+  Actor animated = Actor::New();
+  Stage::GetCurrent().Add( animated );
+  animation = Animation::New( 100.0f );
+  animation.AnimateTo( Property( animated, Actor::Property::POSITION_X ), 100.0f );
+  animation.Play();
+
+  return constraint;
+}
+
+void RenderFrames( TestApplication& application, unsigned int frameCount )
+{
+  for( unsigned int i = 0; i < frameCount; ++i )
+  {
+    application.SendNotification();
+    application.Render( 16 );
+  }
+}
+} // namespace UtcDaliConstraintSkipUnchanged
+
+int UtcDaliConstraintSkipUnchangedP(void)
+{
+  // Ensure that a constraint is not evaluated again until its input or target changes, and that its output is kept
+
+  TestApplication application;
+  using namespace UtcDaliConstraintSkipUnchanged;
+
+  Actor parent, child;
+  Animation animation;
+  int callCount = 0;
+  Constraint constraint = CreateConstrainedChild( parent, child, animation, callCount, true );
+  DALI_TEST_EQUALS( ConstraintGetSkipUnchanged( constraint ), true, TEST_LOCATION );
+
+  // Evaluated a second time, as the target has changed when the first output was baked
+  RenderFrames( application, 10u );
+  DALI_TEST_EQUALS( callCount, 2, TEST_LOCATION );
+  DALI_TEST_EQUALS( child.GetCurrentSize(), Vector3( 100.0f, 100.0f, 0.0f ), TEST_LOCATION );
+
+  // Change the input
+  parent.SetSize( 200.0f, 50.0f );
+  RenderFrames( application, 10u );
+  DALI_TEST_EQUALS( callCount, 4, TEST_LOCATION );
+  DALI_TEST_EQUALS( child.GetCurrentSize(), Vector3( 200.0f, 50.0f, 0.0f ), TEST_LOCATION );
+
+  // Change the target
+  child.SetSize( 10.0f, 10.0f );
+  RenderFrames( application, 10u );
+  DALI_TEST_EQUALS( callCount, 6, TEST_LOCATION );
+  DALI_TEST_EQUALS( child.GetCurrentSize(), Vector3( 200.0f, 50.0f, 0.0f ), TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliConstraintSkipUnchangedAnimatedP(void)
+{
+  // Ensure that a constraint is evaluated every frame while its input is animated
+
+  TestApplication application;
+  using namespace UtcDaliConstraintSkipUnchanged;
+
+  Actor parent, child;
+  Animation animation;
+  int callCount = 0;
+  CreateConstrainedChild( parent, child, animation, callCount, true );
+  RenderFrames( application, 10u );
+  callCount = 0;
+
+  Animation sizeAnimation = Animation::New( 1.0f );
+  sizeAnimation.AnimateTo( Property( parent, Actor::Property::SIZE ), Vector3( 300.0f, 300.0f, 0.0f ) );
+  sizeAnimation.Play();
+
+  RenderFrames( application, 10u );
+  DALI_TEST_CHECK( callCount >= 10 );
+
+  // The animation finishes after 63 frames of 16ms
+  RenderFrames( application, 60u );
+  DALI_TEST_EQUALS( child.GetCurrentSize(), Vector3( 300.0f, 300.0f, 0.0f ), TEST_LOCATION );
+
+  // Not evaluated anymore once the animation has finished
+  const int finishedCallCount = callCount;
+  RenderFrames( application, 10u );
+  DALI_TEST_EQUALS( callCount, finishedCallCount, TEST_LOCATION );
+  DALI_TEST_EQUALS( child.GetCurrentSize(), Vector3( 300.0f, 300.0f, 0.0f ), TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliConstraintSkipUnchangedN(void)
+{
+  // Ensure that a constraint is evaluated every frame by default, or once skipping is disabled again
+
+  TestApplication application;
+  using namespace UtcDaliConstraintSkipUnchanged;
+
+  Actor parent, child;
+  Animation animation;
+  int callCount = 0;
+  Constraint constraint = CreateConstrainedChild( parent, child, animation, callCount, false );
+  DALI_TEST_EQUALS( ConstraintGetSkipUnchanged( constraint ), false, TEST_LOCATION );
+
+  RenderFrames( application, 10u );
+  DALI_TEST_EQUALS( callCount, 10, TEST_LOCATION );
+
+  // Evaluated once more, as the previous values are not known yet; the target is already baked
+  ConstraintSetSkipUnchanged( constraint, true );
+  RenderFrames( application, 10u );
+  DALI_TEST_EQUALS( callCount, 11, TEST_LOCATION );
+
+  ConstraintSetSkipUnchanged( constraint, false );
+  RenderFrames( application, 10u );
+  DALI_TEST_EQUALS( callCount, 21, TEST_LOCATION );
+  DALI_TEST_EQUALS( child.GetCurrentSize(), Vector3( 100.0f, 100.0f, 0.0f ), TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliConstraintSkipUnchangedCounterP(void)
+{
+  // Ensure that the skipped constraints are counted by the performance monitor
+
+  TestApplication application;
+  using namespace UtcDaliConstraintSkipUnchanged;
+
+  Actor parent, child;
+  Animation animation;
+  int callCount = 0;
+  CreateConstrainedChild( parent, child, animation, callCount, true );
+  RenderFrames( application, 10u );
+
+  Integration::EnablePerformanceMonitor( true );
+  RenderFrames( application, 10u );
+
+  Integration::PerformanceStatistics statistics;
+  DALI_TEST_CHECK( Integration::GetPerformanceStatistics( Integration::PERFORMANCE_METRIC_CONSTRAINTS_SKIPPED, statistics ) );
+  DALI_TEST_EQUALS( statistics.minimum, 1.0f, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.average, 1.0f, TEST_LOCATION );
+  DALI_TEST_CHECK( Integration::GetPerformanceStatistics( Integration::PERFORMANCE_METRIC_CONSTRAINTS_APPLIED, statistics ) );
+  DALI_TEST_EQUALS( statistics.average, 0.0f, TEST_LOCATION );
+
+  Integration::EnablePerformanceMonitor( false );
+
+  END_TEST;
+}
@@ -554,3 +554,159 @@ int UtcDaliGeometrySetGetGeometryType02(void)
 
   END_TEST;
 }
+
+int UtcDaliGeometryVertexArrayReused(void)
+{
+  TestApplication application;
+
+  tet_infoline("Test that the vertex array of a geometry is recorded once, then bound for each draw");
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.SetGetStringResult( (GLubyte*)"OpenGL ES 3.0" );
+  TraceCallStack& vertexArrayTrace = gl.GetVertexArrayTrace();
+  vertexArrayTrace.Enable( true );
+
+  PropertyBuffer vertexBuffer = CreateVertexBuffer( "aPosition", "aTexCoord" );
+  Geometry geometry = Geometry::New();
+  geometry.AddVertexBuffer( vertexBuffer );
+  const unsigned short indexData[6] = { 0, 3, 1, 0, 2, 3 };
+  geometry.SetIndexBuffer( indexData, sizeof(indexData)/sizeof(indexData[0]) );
+
+  Shader shader = CreateShader();
+  Renderer renderer = Renderer::New( geometry, shader );
+  Actor actor = Actor::New();
+  actor.SetSize( Vector3::ONE * 100.f );
+  actor.AddRenderer( renderer );
+  Stage::GetCurrent().Add( actor );
+
+  application.SendNotification();
+  application.Render(0);
+
+  DALI_TEST_EQUALS( vertexArrayTrace.CountMethod( "GenVertexArrays" ), 1, TEST_LOCATION );
+  DALI_TEST_EQUALS( vertexArrayTrace.CountMethod( "VertexAttribPointer" ), 2, TEST_LOCATION );
+  DALI_TEST_CHECK( vertexArrayTrace.FindMethodAndParams( "BindVertexArray", "1" ) );
+  DALI_TEST_CHECK( vertexArrayTrace.FindMethodAndParams( "BindVertexArray", "0" ) );
+
+  // The next frames only bind the vertex array
+  vertexArrayTrace.Reset();
+  gl.GetDrawTrace().Enable( true );
+  application.SendNotification();
+  application.Render(16);
+  application.Render(16);
+
+  DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElements" ), 2, TEST_LOCATION );
+  DALI_TEST_EQUALS( vertexArrayTrace.CountMethod( "GenVertexArrays" ), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( vertexArrayTrace.CountMethod( "VertexAttribPointer" ), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( vertexArrayTrace.CountMethod( "BindVertexArray" ), 4, TEST_LOCATION );
+  DALI_TEST_EQUALS( vertexArrayTrace.TestMethodAndParams( 0, "BindVertexArray", "1" ), true, TEST_LOCATION );
+  DALI_TEST_EQUALS( vertexArrayTrace.TestMethodAndParams( 1, "BindVertexArray", "0" ), true, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliGeometryVertexArrayInvalidated(void)
+{
+  TestApplication application;
+
+  tet_infoline("Test that the vertex array of a geometry is recorded again when its buffers change");
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.SetGetStringResult( (GLubyte*)"OpenGL ES 3.1" );
+  TraceCallStack& vertexArrayTrace = gl.GetVertexArrayTrace();
+  vertexArrayTrace.Enable( true );
+
+  PropertyBuffer vertexBuffer1 = CreateVertexBuffer( "aPosition", "aTexCoord" );
+  Geometry geometry = Geometry::New();
+  geometry.AddVertexBuffer( vertexBuffer1 );
+
+  Shader shader = CreateShader();
+  Renderer renderer = Renderer::New( geometry, shader );
+  Actor actor = Actor::New();
+  actor.SetSize( Vector3::ONE * 100.f );
+  actor.AddRenderer( renderer );
+  Stage::GetCurrent().Add( actor );
+
+  application.SendNotification();
+  application.Render(0);
+  DALI_TEST_EQUALS( vertexArrayTrace.CountMethod( "GenVertexArrays" ), 1, TEST_LOCATION );
+  DALI_TEST_EQUALS( vertexArrayTrace.CountMethod( "DeleteVertexArrays" ), 0, TEST_LOCATION );
+
+  // Add a vertex buffer
+  vertexArrayTrace.Reset();
+  PropertyBuffer vertexBuffer2 = CreateVertexBuffer( "aPosition2", "aTexCoord2" );
+  geometry.AddVertexBuffer( vertexBuffer2 );
+  application.SendNotification();
+  application.Render(16);
+
+  DALI_TEST_EQUALS( vertexArrayTrace.CountMethod( "DeleteVertexArrays" ), 1, TEST_LOCATION );
+  DALI_TEST_CHECK( vertexArrayTrace.FindMethodAndParams( "GenVertexArrays", "2" ) );
+  DALI_TEST_EQUALS( vertexArrayTrace.CountMethod( "VertexAttribPointer" ), 4, TEST_LOCATION );
+
+  // Set an index buffer
+  vertexArrayTrace.Reset();
+  const unsigned short indexData[6] = { 0, 3, 1, 0, 2, 3 };
+  geometry.SetIndexBuffer( indexData, sizeof(indexData)/sizeof(indexData[0]) );
+  application.SendNotification();
+  application.Render(16);
+
+  DALI_TEST_EQUALS( vertexArrayTrace.CountMethod( "DeleteVertexArrays" ), 1, TEST_LOCATION );
+  DALI_TEST_CHECK( vertexArrayTrace.FindMethodAndParams( "GenVertexArrays", "3" ) );
+
+  // Updating the indices keeps the vertex array
+  vertexArrayTrace.Reset();
+  const unsigned short indexData2[3] = { 0, 3, 1 };
+  geometry.SetIndexBuffer( indexData2, sizeof(indexData2)/sizeof(indexData2[0]) );
+  application.SendNotification();
+  application.Render(16);
+
+  DALI_TEST_EQUALS( vertexArrayTrace.CountMethod( "DeleteVertexArrays" ), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( vertexArrayTrace.CountMethod( "GenVertexArrays" ), 0, TEST_LOCATION );
+
+  // Destroying the geometry deletes its vertex array
+  vertexArrayTrace.Reset();
+  Stage::GetCurrent().Remove( actor );
+  actor.Reset();
+  renderer.Reset();
+  geometry.Reset();
+  application.SendNotification();
+  application.Render(16);
+  application.SendNotification();
+  application.Render(16);
+
+  DALI_TEST_CHECK( vertexArrayTrace.FindMethodAndParams( "DeleteVertexArrays", "1" ) );
+
+  END_TEST;
+}
+
+int UtcDaliGeometryVertexArrayNotSupported(void)
+{
+  TestApplication application;
+
+  tet_infoline("Test that no vertex array is used with OpenGL ES 2.0");
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.SetGetStringResult( (GLubyte*)"OpenGL ES 2.0" );
+  TraceCallStack& vertexArrayTrace = gl.GetVertexArrayTrace();
+  vertexArrayTrace.Enable( true );
+
+  PropertyBuffer vertexBuffer = CreateVertexBuffer( "aPosition", "aTexCoord" );
+  Geometry geometry = Geometry::New();
+  geometry.AddVertexBuffer( vertexBuffer );
+
+  Shader shader = CreateShader();
+  Renderer renderer = Renderer::New( geometry, shader );
+  Actor actor = Actor::New();
+  actor.SetSize( Vector3::ONE * 100.f );
+  actor.AddRenderer( renderer );
+  Stage::GetCurrent().Add( actor );
+
+  application.SendNotification();
+  application.Render(0);
+  application.Render(16);
+
+  DALI_TEST_EQUALS( vertexArrayTrace.CountMethod( "GenVertexArrays" ), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( vertexArrayTrace.CountMethod( "BindVertexArray" ), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( vertexArrayTrace.CountMethod( "VertexAttribPointer" ), 4, TEST_LOCATION );
+
+  END_TEST;
+}
@@ -103,6 +103,20 @@ bool DefaultIsActorTouchableFunction(Dali::Actor actor, Dali::HitTestAlgorithm::
   return hittable;
 };
 
+unsigned int gCheckActorCount = 0u;
+
+/**
+ * Same as DefaultIsActorTouchableFunction, counting the number of actors checked.
+ */
+bool CountingIsActorTouchableFunction(Dali::Actor actor, Dali::HitTestAlgorithm::TraverseType type)
+{
+  if( type == Dali::HitTestAlgorithm::CHECK_ACTOR )
+  {
+    ++gCheckActorCount;
+  }
+  return DefaultIsActorTouchableFunction( actor, type );
+}
+
 } // anonymous namespace
 
 
@@ -473,3 +487,75 @@ int UtcDaliHitTestAlgorithmOverlay(void)
   DALI_TEST_EQUALS( results.actorCoordinates, actorSize * 0.5f, TEST_LOCATION );
   END_TEST;
 }
+
+int UtcDaliHitTestAlgorithmSkipMissedSubTrees(void)
+{
+  TestApplication application;
+  tet_infoline("Testing Dali::HitTestAlgorithm skips the sub-trees the ray can't hit");
+
+  Stage stage = Stage::GetCurrent();
+  RenderTaskList renderTaskList = stage.GetRenderTaskList();
+  RenderTask defaultRenderTask = renderTaskList.GetTask(0u);
+  Dali::CameraActor cameraActor = defaultRenderTask.GetCameraActor();
+
+  Vector2 stageSize ( stage.GetSize() );
+  cameraActor.SetOrthographicProjection( stageSize );
+  cameraActor.SetPosition(0.0f, 0.0f, 1600.0f);
+
+  // A grid of 4x4 rows, each row with 4 cells
+  const unsigned int gridSize( 4u );
+  Vector2 cellSize( stageSize / static_cast<float>( gridSize ) );
+  Actor cells[gridSize][gridSize];
+  for( unsigned int y(0); y<gridSize; ++y )
+  {
+    // Zero sized rows, only their cells can be hit
+    Actor row = Actor::New();
+    row.SetAnchorPoint( AnchorPoint::TOP_LEFT );
+    row.SetParentOrigin( ParentOrigin::TOP_LEFT );
+    row.SetPosition( 0.0f, cellSize.height * y );
+    stage.Add( row );
+
+    for( unsigned int x(0); x<gridSize; ++x )
+    {
+      cells[x][y] = Actor::New();
+      cells[x][y].SetAnchorPoint( AnchorPoint::TOP_LEFT );
+      cells[x][y].SetParentOrigin( ParentOrigin::TOP_LEFT );
+      cells[x][y].SetPosition( cellSize.width * x, 0.0f );
+      cells[x][y].SetSize( cellSize );
+      row.Add( cells[x][y] );
+    }
+  }
+
+  // Render and notify
+  application.SendNotification();
+  application.Render(0);
+  application.Render(10);
+
+  HitTestAlgorithm::Results results;
+  for( unsigned int y(0); y<gridSize; ++y )
+  {
+    for( unsigned int x(0); x<gridSize; ++x )
+    {
+      gCheckActorCount = 0u;
+      Vector2 screenCoordinates( cellSize.width * ( x + 0.5f ), cellSize.height * ( y + 0.5f ) );
+      HitTest( stage, screenCoordinates, results, &CountingIsActorTouchableFunction );
+      DALI_TEST_CHECK( results.actor == cells[x][y] );
+      DALI_TEST_EQUALS( results.actorCoordinates, cellSize * 0.5f, 0.01f, TEST_LOCATION );
+
+      // The rows far from the touch point are not traversed
+      DALI_TEST_CHECK( gCheckActorCount < gridSize * ( gridSize + 1u ) );
+    }
+  }
+
+  // Scale a cell of the last row up to the first row, the bounding spheres follow after the next update
+  Actor scaled = cells[0][gridSize - 1u];
+  scaled.SetAnchorPoint( AnchorPoint::BOTTOM_LEFT );
+  scaled.SetPosition( 0.0f, cellSize.height );
+  scaled.SetScale( Vector3( 1.0f, 2.0f * gridSize, 1.0f ) );
+  application.SendNotification();
+  application.Render(10);
+
+  HitTest( stage, Vector2( cellSize.width * 0.5f, cellSize.height * 0.5f ), results, &DefaultIsActorTouchableFunction );
+  DALI_TEST_CHECK( results.actor == scaled );
+  END_TEST;
+}
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <iostream>
+
+#include <stdlib.h>
+
+#include <dali/public-api/dali-core.h>
+#include <dali/integration-api/core.h>
+
+#include <dali-test-suite-utils.h>
+
+using namespace Dali;
+
+void utc_dali_message_coalescing_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_message_coalescing_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+/**
+ * Adds an actor to the stage and renders it
+ */
+Actor AddActor( TestApplication& application )
+{
+  Actor actor = Actor::New();
+  Stage::GetCurrent().Add( actor );
+  application.SendNotification();
+  application.Render();
+  return actor;
+}
+
+} // unnamed namespace
+
+int UtcDaliMessageCoalescingDisabled(void)
+{
+  TestApplication application;
+  tet_infoline("Test that no message is elided by default");
+
+  Actor actor = AddActor( application );
+
+  for( int i = 0; i < 10; ++i )
+  {
+    actor.SetPosition( Vector3( i, i, i ) );
+  }
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( actor.GetCurrentPosition(), Vector3( 9.0f, 9.0f, 9.0f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( application.GetCore().GetElidedMessageCount(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( application.GetCore().GetElidedMessageBytes(), 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliMessageCoalescingSameProperty(void)
+{
+  TestApplication application;
+  tet_infoline("Test that only the last message setting a property is processed");
+
+  Integration::Core& core = application.GetCore();
+  core.SetMessageCoalescingEnabled( true );
+
+  Actor actor = AddActor( application );
+  const unsigned int elidedCount = core.GetElidedMessageCount();
+  const std::size_t elidedBytes = core.GetElidedMessageBytes();
+
+  for( int i = 0; i < 10; ++i )
+  {
+    actor.SetPosition( Vector3( i, i, i ) );
+    actor.SetColor( Vector4( 0.1f * i, 0.0f, 0.0f, 1.0f ) );
+  }
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( actor.GetCurrentPosition(), Vector3( 9.0f, 9.0f, 9.0f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( actor.GetCurrentColor(), Vector4( 0.9f, 0.0f, 0.0f, 1.0f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( core.GetElidedMessageCount() - elidedCount, 18u, TEST_LOCATION );
+  DALI_TEST_CHECK( core.GetElidedMessageBytes() > elidedBytes );
+
+  // The messages flushed separately are all processed
+  const unsigned int flushedCount = core.GetElidedMessageCount();
+  actor.SetPosition( Vector3( 1.0f, 2.0f, 3.0f ) );
+  application.SendNotification();
+  actor.SetPosition( Vector3( 4.0f, 5.0f, 6.0f ) );
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( actor.GetCurrentPosition(), Vector3( 4.0f, 5.0f, 6.0f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( core.GetElidedMessageCount(), flushedCount, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliMessageCoalescingComponents(void)
+{
+  TestApplication application;
+  tet_infoline("Test that the messages setting a component only replace the ones setting the same component");
+
+  Integration::Core& core = application.GetCore();
+  core.SetMessageCoalescingEnabled( true );
+
+  Actor actor = AddActor( application );
+  const unsigned int elidedCount = core.GetElidedMessageCount();
+
+  actor.SetX( 1.0f );
+  actor.SetY( 2.0f );
+  actor.SetX( 3.0f );
+  actor.SetOpacity( 0.25f );
+  actor.SetOpacity( 0.5f );
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( actor.GetCurrentPosition(), Vector3( 3.0f, 2.0f, 0.0f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( actor.GetCurrentOpacity(), 0.5f, TEST_LOCATION );
+  DALI_TEST_EQUALS( core.GetElidedMessageCount() - elidedCount, 2u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliMessageCoalescingManyProperties(void)
+{
+  TestApplication application;
+  tet_infoline("Test that the messages are coalesced when more properties are set than the index initially holds");
+
+  Integration::Core& core = application.GetCore();
+  core.SetMessageCoalescingEnabled( true );
+
+  const unsigned int actorCount( 400u );
+  std::vector< Actor > actors;
+  for( unsigned int i = 0u; i < actorCount; ++i )
+  {
+    Actor actor = Actor::New();
+    Stage::GetCurrent().Add( actor );
+    actors.push_back( actor );
+  }
+  application.SendNotification();
+  application.Render();
+
+  const unsigned int elidedCount = core.GetElidedMessageCount();
+  for( unsigned int pass = 0u; pass < 2u; ++pass )
+  {
+    for( unsigned int i = 0u; i < actorCount; ++i )
+    {
+      actors[i].SetPosition( Vector3( i, pass, 0.0f ) );
+    }
+  }
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( core.GetElidedMessageCount() - elidedCount, actorCount, TEST_LOCATION );
+  DALI_TEST_EQUALS( actors[0].GetCurrentPosition(), Vector3( 0.0f, 1.0f, 0.0f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( actors[actorCount - 1u].GetCurrentPosition(), Vector3( actorCount - 1u, 1.0f, 0.0f ), TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliMessageCoalescingRelative(void)
+{
+  TestApplication application;
+  tet_infoline("Test that the messages changing a property by a relative amount are all processed");
+
+  Integration::Core& core = application.GetCore();
+  core.SetMessageCoalescingEnabled( true );
+
+  Actor actor = AddActor( application );
+  const unsigned int elidedCount = core.GetElidedMessageCount();
+
+  actor.SetPosition( Vector3( 1.0f, 1.0f, 1.0f ) );
+  actor.TranslateBy( Vector3( 1.0f, 0.0f, 0.0f ) );
+  actor.TranslateBy( Vector3( 1.0f, 0.0f, 0.0f ) );
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( actor.GetCurrentPosition(), Vector3( 3.0f, 1.0f, 1.0f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( core.GetElidedMessageCount(), elidedCount, TEST_LOCATION );
+
+  // The relative messages are kept in order with the absolute ones
+  actor.SetPosition( Vector3( 5.0f, 5.0f, 5.0f ) );
+  actor.TranslateBy( Vector3( 1.0f, 0.0f, 0.0f ) );
+  actor.SetPosition( Vector3( 2.0f, 2.0f, 2.0f ) );
+  actor.TranslateBy( Vector3( 1.0f, 0.0f, 0.0f ) );
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( actor.GetCurrentPosition(), Vector3( 3.0f, 2.0f, 2.0f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( core.GetElidedMessageCount(), elidedCount, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliMessageCoalescingStructuralMessages(void)
+{
+  TestApplication application;
+  tet_infoline("Test that the property messages keep their order with respect to the other messages");
+
+  Integration::Core& core = application.GetCore();
+  core.SetMessageCoalescingEnabled( true );
+
+  Actor parent = AddActor( application );
+  const unsigned int elidedCount = core.GetElidedMessageCount();
+
+  Actor child = Actor::New();
+  child.SetPosition( Vector3( 1.0f, 1.0f, 1.0f ) );
+  parent.Add( child );
+  child.SetPosition( Vector3( 2.0f, 2.0f, 2.0f ) );
+  parent.Remove( child );
+  child.SetPosition( Vector3( 3.0f, 3.0f, 3.0f ) );
+  parent.Add( child );
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( child.GetCurrentPosition(), Vector3( 3.0f, 3.0f, 3.0f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( core.GetElidedMessageCount(), elidedCount, TEST_LOCATION );
+
+  END_TEST;
+}
@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <iostream>
+
+#include <stdlib.h>
+
+#include <dali/public-api/dali-core.h>
+#include <dali/integration-api/core.h>
+
+#include <dali-test-suite-utils.h>
+#include <test-actor-utils.h>
+
+using namespace Dali;
+
+void utc_dali_partial_update_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_partial_update_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+/**
+ * Renders frames until the scene is static and the back buffer is up to date
+ */
+void RenderUntilStatic( TestApplication& application )
+{
+  for( int i = 0; i < 4; ++i )
+  {
+    application.SendNotification();
+    application.Render();
+  }
+}
+
+/**
+ * Checks whether a rectangle is covered by the damaged rectangles of the last frame
+ */
+bool IsDamaged( TestApplication& application, const Rect<int>& rect )
+{
+  const std::vector< Rect<int> >& damagedRects = application.GetRenderStatus().GetDamagedRects();
+  for( std::vector< Rect<int> >::const_iterator iter = damagedRects.begin(); iter != damagedRects.end(); ++iter )
+  {
+    if( iter->x <= rect.x && iter->y <= rect.y &&
+        iter->x + iter->width >= rect.x + rect.width &&
+        iter->y + iter->height >= rect.y + rect.height )
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+} // unnamed namespace
+
+int UtcDaliPartialUpdateDisabledByDefault(void)
+{
+  TestApplication application;
+
+  Actor actor = CreateRenderableActor();
+  actor.SetSize( 100.0f, 100.0f );
+  Stage::GetCurrent().Add( actor );
+
+  RenderUntilStatic( application );
+  DALI_TEST_CHECK( !application.GetRenderStatus().IsPartialUpdate() );
+  DALI_TEST_CHECK( application.GetRenderStatus().GetDamagedRects().empty() );
+
+  actor.SetPosition( 100.0f, 0.0f );
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_CHECK( !application.GetRenderStatus().IsPartialUpdate() );
+
+  END_TEST;
+}
+
+int UtcDaliPartialUpdateFirstFrameIsFull(void)
+{
+  TestApplication application;
+  application.GetCore().SetPartialUpdateEnabled( true );
+
+  Actor actor = CreateRenderableActor();
+  actor.SetSize( 100.0f, 100.0f );
+  Stage::GetCurrent().Add( actor );
+
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_CHECK( !application.GetRenderStatus().IsPartialUpdate() );
+
+  END_TEST;
+}
+
+int UtcDaliPartialUpdateStaticScene(void)
+{
+  TestApplication application;
+  application.GetCore().SetPartialUpdateEnabled( true );
+
+  Actor actor = CreateRenderableActor();
+  actor.SetSize( 100.0f, 100.0f );
+  Stage::GetCurrent().Add( actor );
+
+  RenderUntilStatic( application );
+
+  TraceCallStack& drawTrace = application.GetGlAbstraction().GetDrawTrace();
+  drawTrace.Enable( true );
+  drawTrace.Reset();
+
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_CHECK( application.GetRenderStatus().IsPartialUpdate() );
+  DALI_TEST_CHECK( application.GetRenderStatus().GetDamagedRects().empty() );
+  DALI_TEST_CHECK( !drawTrace.FindMethod( "DrawElements" ) );
+
+  END_TEST;
+}
+
+int UtcDaliPartialUpdateMovedActor(void)
+{
+  TestApplication application;
+  application.GetCore().SetPartialUpdateEnabled( true );
+
+  Actor actor = CreateRenderableActor();
+  actor.SetParentOrigin( ParentOrigin::CENTER );
+  actor.SetSize( 100.0f, 100.0f );
+  Stage::GetCurrent().Add( actor );
+
+  Actor staticActor = CreateRenderableActor();
+  staticActor.SetParentOrigin( ParentOrigin::CENTER );
+  staticActor.SetSize( 50.0f, 50.0f );
+  staticActor.SetPosition( 0.0f, 300.0f );
+  Stage::GetCurrent().Add( staticActor );
+
+  RenderUntilStatic( application );
+
+  actor.SetPosition( 100.0f, 0.0f );
+  application.SendNotification();
+  application.Render();
+
+  const Integration::RenderStatus& status = application.GetRenderStatus();
+  DALI_TEST_CHECK( status.IsPartialUpdate() );
+  DALI_TEST_CHECK( !status.GetDamagedRects().empty() );
+
+  // The surface is 480x800, the actor moved from the center to 100 pixels to the right
+  DALI_TEST_CHECK( IsDamaged( application, Rect<int>( 190, 350, 100, 100 ) ) );
+  DALI_TEST_CHECK( IsDamaged( application, Rect<int>( 290, 350, 100, 100 ) ) );
+
+  // The actor which did not move is not damaged
+  DALI_TEST_CHECK( !IsDamaged( application, Rect<int>( 215, 75, 50, 50 ) ) );
+
+  // Rendering is scissored to the damaged area
+  const TestGlAbstraction::ScissorParams& scissor = application.GetGlAbstraction().GetScissorParams();
+  DALI_TEST_CHECK( scissor.x <= 190 && scissor.x + scissor.width >= 390 );
+  DALI_TEST_CHECK( scissor.y <= 350 && scissor.y + scissor.height >= 450 );
+  DALI_TEST_CHECK( scissor.width < 480 );
+
+  END_TEST;
+}
+
+int UtcDaliPartialUpdateBufferAge(void)
+{
+  TestApplication application;
+  application.GetCore().SetPartialUpdateEnabled( true );
+
+  Actor actor = CreateRenderableActor();
+  actor.SetSize( 100.0f, 100.0f );
+  Stage::GetCurrent().Add( actor );
+
+  RenderUntilStatic( application );
+
+  actor.SetPosition( 100.0f, 0.0f );
+  application.SendNotification();
+
+  // A back buffer of unknown content has to be fully rendered
+  Integration::UpdateStatus updateStatus;
+  Integration::RenderStatus renderStatus;
+  renderStatus.SetBufferAge( 0u );
+  application.GetCore().Update( 0.016f, 0u, 16u, updateStatus );
+  application.GetCore().Render( renderStatus );
+  DALI_TEST_CHECK( !renderStatus.IsPartialUpdate() );
+
+  // A back buffer two frames old is missing the damage of the previous frame
+  actor.SetPosition( 0.0f, 0.0f );
+  application.SendNotification();
+  renderStatus.SetBufferAge( 2u );
+  application.GetCore().Update( 0.016f, 16u, 32u, updateStatus );
+  application.GetCore().Render( renderStatus );
+  DALI_TEST_CHECK( renderStatus.IsPartialUpdate() );
+
+  const TestGlAbstraction::ScissorParams& scissor = application.GetGlAbstraction().GetScissorParams();
+  DALI_TEST_EQUALS( scissor.width, 480, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliPartialUpdateTransformKeepingRect(void)
+{
+  TestApplication application;
+  application.GetCore().SetPartialUpdateEnabled( true );
+
+  Actor actor = CreateRenderableActor();
+  actor.SetParentOrigin( ParentOrigin::CENTER );
+  actor.SetSize( 100.0f, 100.0f );
+  Stage::GetCurrent().Add( actor );
+
+  RenderUntilStatic( application );
+
+  // A half turn covers the same rectangle, but the actor is drawn differently
+  actor.SetOrientation( Degree( 180.0f ), Vector3::ZAXIS );
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_CHECK( application.GetRenderStatus().IsPartialUpdate() );
+  DALI_TEST_CHECK( IsDamaged( application, Rect<int>( 190, 350, 100, 100 ) ) );
+
+  RenderUntilStatic( application );
+
+  // So does a mirror flip
+  actor.SetScale( Vector3( -1.0f, 1.0f, 1.0f ) );
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_CHECK( IsDamaged( application, Rect<int>( 190, 350, 100, 100 ) ) );
+
+  RenderUntilStatic( application );
+  DALI_TEST_CHECK( application.GetRenderStatus().GetDamagedRects().empty() );
+
+  END_TEST;
+}
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include <dali/public-api/dali-core.h>
+#include <dali/integration-api/profiling.h>
+
+#include <dali-test-suite-utils.h>
+
+using namespace Dali;
+
+void utc_dali_performance_monitor_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_performance_monitor_cleanup(void)
+{
+  Integration::EnablePerformanceMonitor( false );
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const char* const TRACE_FILENAME = "/tmp/dali-performance-trace.json";
+
+/**
+ * Adds an animated actor to the stage and renders some frames
+ */
+void AnimateActor( TestApplication& application, unsigned int frameCount )
+{
+  Actor actor = Actor::New();
+  Stage::GetCurrent().Add( actor );
+
+  Animation animation = Animation::New( 10.0f );
+  animation.AnimateTo( Property( actor, Actor::Property::POSITION ), Vector3( 100.0f, 100.0f, 100.0f ) );
+  animation.Play();
+
+  for( unsigned int i = 0; i < frameCount; ++i )
+  {
+    application.SendNotification();
+    application.Render( 16 );
+  }
+}
+
+} // unnamed namespace
+
+int UtcDaliPerformanceMonitorDisabled(void)
+{
+  TestApplication application;
+  tet_infoline("Test that no statistics are available while the performance monitor is disabled");
+
+  AnimateActor( application, 10u );
+
+  Integration::PerformanceStatistics statistics;
+  DALI_TEST_CHECK( !Integration::GetPerformanceStatistics( Integration::PERFORMANCE_METRIC_UPDATE_NODES, statistics ) );
+  DALI_TEST_EQUALS( statistics.frameCount, 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliPerformanceMonitorStatistics(void)
+{
+  TestApplication application;
+  tet_infoline("Test the statistics of the timed phases and counters");
+
+  Integration::EnablePerformanceMonitor( true );
+  AnimateActor( application, 10u );
+
+  // The first frame is not complete
+  Integration::PerformanceStatistics statistics;
+  DALI_TEST_CHECK( Integration::GetPerformanceStatistics( Integration::PERFORMANCE_METRIC_UPDATE_NODES, statistics ) );
+  DALI_TEST_EQUALS( statistics.frameCount, 9u, TEST_LOCATION );
+  DALI_TEST_CHECK( statistics.minimum <= statistics.average );
+  DALI_TEST_CHECK( statistics.average <= statistics.percentile99 );
+
+  // One animator is applied per frame; the last frame is not complete yet
+  DALI_TEST_CHECK( Integration::GetPerformanceStatistics( Integration::PERFORMANCE_METRIC_ANIMATORS_APPLIED, statistics ) );
+  DALI_TEST_EQUALS( statistics.minimum, 1.0f, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.average, 1.0f, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.percentile99, 1.0f, TEST_LOCATION );
+
+  // Enabling the monitor again keeps the statistics, disabling it stops the sampling
+  Integration::EnablePerformanceMonitor( true );
+  Integration::EnablePerformanceMonitor( false );
+  AnimateActor( application, 5u );
+  DALI_TEST_CHECK( Integration::GetPerformanceStatistics( Integration::PERFORMANCE_METRIC_UPDATE_NODES, statistics ) );
+  DALI_TEST_EQUALS( statistics.frameCount, 9u, TEST_LOCATION );
+
+  // Enabling it after it was disabled clears them
+  Integration::EnablePerformanceMonitor( true );
+  DALI_TEST_CHECK( !Integration::GetPerformanceStatistics( Integration::PERFORMANCE_METRIC_UPDATE_NODES, statistics ) );
+
+  END_TEST;
+}
+
+int UtcDaliPerformanceMonitorHistory(void)
+{
+  TestApplication application;
+  tet_infoline("Test that the statistics are calculated over a bounded number of frames");
+
+  Integration::EnablePerformanceMonitor( true );
+  AnimateActor( application, 300u );
+
+  Integration::PerformanceStatistics statistics;
+  DALI_TEST_CHECK( Integration::GetPerformanceStatistics( Integration::PERFORMANCE_METRIC_FRAME_TIME, statistics ) );
+  DALI_TEST_EQUALS( statistics.frameCount, 128u, TEST_LOCATION );
+  DALI_TEST_CHECK( statistics.minimum <= statistics.average );
+  DALI_TEST_CHECK( statistics.average <= statistics.percentile99 );
+
+  END_TEST;
+}
+
+int UtcDaliPerformanceMonitorTrace(void)
+{
+  TestApplication application;
+  tet_infoline("Test that a trace is written in the Chrome trace event format");
+
+  Integration::EnablePerformanceMonitor( true );
+  Integration::StartPerformanceTrace();
+  AnimateActor( application, 5u );
+  DALI_TEST_CHECK( Integration::StopPerformanceTrace( TRACE_FILENAME ) );
+
+  std::ifstream file( TRACE_FILENAME );
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  const std::string trace = buffer.str();
+  remove( TRACE_FILENAME );
+
+  DALI_TEST_EQUALS( trace.compare( 0, 15, "{\"traceEvents\":" ), 0, TEST_LOCATION );
+  DALI_TEST_CHECK( trace.find( "{\"name\":\"UPDATE_NODES\",\"ph\":\"X\"" ) != std::string::npos );
+  DALI_TEST_CHECK( trace.find( "{\"name\":\"ANIMATORS_APPLIED\",\"ph\":\"C\"" ) != std::string::npos );
+  DALI_TEST_CHECK( trace.find( "\"args\":{\"value\":1}" ) != std::string::npos );
+
+  // Not writable
+  DALI_TEST_CHECK( !Integration::StopPerformanceTrace( "/non-existent-directory/trace.json" ) );
+
+  END_TEST;
+}
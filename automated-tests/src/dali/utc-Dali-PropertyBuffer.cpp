@@ -16,6 +16,7 @@
  */
 
 #include <dali/public-api/dali-core.h>
+#include <dali/devel-api/rendering/property-buffer-update.h>
 #include <dali-test-suite-utils.h>
 
 using namespace Dali;
@@ -28,6 +29,52 @@ void TestConstraintNoBlue( Vector4& current, const PropertyInputContainer& input
 {
   current.b = 0.0f;
 }
+
+struct ParticleVertex { Vector2 position; Vector4 color; };
+
+PropertyBuffer CreateParticleBuffer( std::vector< ParticleVertex >& vertices, unsigned int count )
+{
+  Property::Map particleVertexFormat;
+  particleVertexFormat["aPosition"] = Property::VECTOR2;
+  particleVertexFormat["aColor"] = Property::VECTOR4;
+
+  vertices.resize( count );
+  for( unsigned int i = 0; i < count; ++i )
+  {
+    vertices[i].position = Vector2( static_cast<float>( i ), 0.0f );
+    vertices[i].color = Color::WHITE;
+  }
+
+  PropertyBuffer propertyBuffer = PropertyBuffer::New( particleVertexFormat );
+  propertyBuffer.SetData( &vertices[0], count );
+  return propertyBuffer;
+}
+
+Actor CreateParticleActor( PropertyBuffer propertyBuffer )
+{
+  Geometry geometry = Geometry::New();
+  geometry.AddVertexBuffer( propertyBuffer );
+  geometry.SetType( Geometry::POINTS );
+
+  Shader shader = CreateShader();
+  Renderer renderer = Renderer::New( geometry, shader );
+  Actor actor = Actor::New();
+  actor.SetSize( Vector3::ONE * 100.f );
+  actor.AddRenderer( renderer );
+  Stage::GetCurrent().Add( actor );
+  return actor;
+}
+
+size_t SumCalls( const std::vector< size_t >& calls )
+{
+  size_t sum = 0u;
+  for( std::vector< size_t >::const_iterator iter = calls.begin(); iter != calls.end(); ++iter )
+  {
+    sum += *iter;
+  }
+  return sum;
+}
+
 }
 
 void propertyBuffer_test_startup(void)
@@ -236,3 +283,189 @@ int UtcDaliPropertyBufferSetData02(void)
 
   END_TEST;
 }
+
+int UtcDaliPropertyBufferSetDataRange(void)
+{
+  TestApplication application;
+
+  tet_infoline("Test that only the range of elements set is uploaded");
+
+  std::vector< ParticleVertex > vertices;
+  PropertyBuffer propertyBuffer = CreateParticleBuffer( vertices, 10u );
+  Actor actor = CreateParticleActor( propertyBuffer );
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+
+  application.SendNotification();
+  application.Render(0);
+  DALI_TEST_EQUALS( gl.GetBufferDataCalls().size(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( gl.GetBufferDataCalls()[0], 10u * sizeof( ParticleVertex ), TEST_LOCATION );
+
+  // Update two elements
+  gl.ResetBufferDataCalls();
+  gl.ResetBufferSubDataCalls();
+  vertices[3].color = Color::RED;
+  vertices[4].color = Color::RED;
+  PropertyBufferSetData( propertyBuffer, &vertices[3], 3u, 2u );
+  DALI_TEST_EQUALS( propertyBuffer.GetSize(), 10u, TEST_LOCATION );
+  application.SendNotification();
+  application.Render(16);
+
+  DALI_TEST_EQUALS( gl.GetBufferDataCalls().size(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( gl.GetBufferSubDataCalls().size(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( gl.GetBufferSubDataCalls()[0], 2u * sizeof( ParticleVertex ), TEST_LOCATION );
+
+  // Two ranges set before the same upload are uploaded together
+  gl.ResetBufferSubDataCalls();
+  PropertyBufferSetData( propertyBuffer, &vertices[1], 1u, 1u );
+  PropertyBufferSetData( propertyBuffer, &vertices[6], 6u, 2u );
+  application.SendNotification();
+  application.Render(16);
+
+  DALI_TEST_EQUALS( gl.GetBufferDataCalls().size(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( gl.GetBufferSubDataCalls().size(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( gl.GetBufferSubDataCalls()[0], 7u * sizeof( ParticleVertex ), TEST_LOCATION );
+
+  // Nothing is uploaded when nothing changed
+  gl.ResetBufferSubDataCalls();
+  application.SendNotification();
+  application.Render(16);
+  DALI_TEST_EQUALS( gl.GetBufferDataCalls().size(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( gl.GetBufferSubDataCalls().size(), 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliPropertyBufferSetDataRangeN(void)
+{
+  TestApplication application;
+
+  tet_infoline("Test that a range beyond the elements set asserts");
+
+  std::vector< ParticleVertex > vertices;
+  PropertyBuffer propertyBuffer = CreateParticleBuffer( vertices, 10u );
+
+  try
+  {
+    PropertyBufferSetData( propertyBuffer, &vertices[0], 8u, 3u );
+    tet_result( TET_FAIL );
+  }
+  catch( Dali::DaliException& e )
+  {
+    DALI_TEST_ASSERT( e, "offset + count <= mSize", TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliPropertyBufferUsage(void)
+{
+  TestApplication application;
+
+  tet_infoline("Test that a stream buffer gets a new data store for each update");
+
+  std::vector< ParticleVertex > vertices;
+  PropertyBuffer propertyBuffer = CreateParticleBuffer( vertices, 10u );
+  DALI_TEST_EQUALS( PropertyBufferGetUsage( propertyBuffer ), PropertyBufferUsage::STATIC, TEST_LOCATION );
+
+  PropertyBufferSetUsage( propertyBuffer, PropertyBufferUsage::STREAM );
+  DALI_TEST_EQUALS( PropertyBufferGetUsage( propertyBuffer ), PropertyBufferUsage::STREAM, TEST_LOCATION );
+
+  Actor actor = CreateParticleActor( propertyBuffer );
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  application.SendNotification();
+  application.Render(0);
+  DALI_TEST_EQUALS( gl.GetBufferDataCalls().size(), 1u, TEST_LOCATION );
+
+  // The data is updated every frame
+  gl.ResetBufferDataCalls();
+  gl.ResetBufferSubDataCalls();
+  for( unsigned int frame = 0; frame < 3u; ++frame )
+  {
+    vertices[0].position.y = static_cast<float>( frame );
+    propertyBuffer.SetData( &vertices[0], 10u );
+    application.SendNotification();
+    application.Render(16);
+  }
+  DALI_TEST_EQUALS( gl.GetBufferDataCalls().size(), 3u, TEST_LOCATION );
+  DALI_TEST_EQUALS( gl.GetBufferSubDataCalls().size(), 0u, TEST_LOCATION );
+
+  // A range of a stream buffer is uploaded with the whole data
+  gl.ResetBufferDataCalls();
+  PropertyBufferSetData( propertyBuffer, &vertices[2], 2u, 1u );
+  application.SendNotification();
+  application.Render(16);
+  DALI_TEST_EQUALS( gl.GetBufferDataCalls().size(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( gl.GetBufferDataCalls()[0], 10u * sizeof( ParticleVertex ), TEST_LOCATION );
+  DALI_TEST_EQUALS( gl.GetBufferSubDataCalls().size(), 0u, TEST_LOCATION );
+
+  // Back to a dynamic buffer: the data store is created again, then updated in place
+  gl.ResetBufferDataCalls();
+  PropertyBufferSetUsage( propertyBuffer, PropertyBufferUsage::DYNAMIC );
+  application.SendNotification();
+  application.Render(16);
+  DALI_TEST_EQUALS( gl.GetBufferDataCalls().size(), 1u, TEST_LOCATION );
+
+  gl.ResetBufferDataCalls();
+  propertyBuffer.SetData( &vertices[0], 10u );
+  application.SendNotification();
+  application.Render(16);
+  DALI_TEST_EQUALS( gl.GetBufferDataCalls().size(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( gl.GetBufferSubDataCalls().size(), 1u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliPropertyBufferParticles(void)
+{
+  TestApplication application;
+
+  tet_infoline("Compare the bytes uploaded when a few particles move each frame");
+
+  const unsigned int PARTICLE_COUNT( 10000u );
+  const unsigned int MOVING_COUNT( 100u );
+  const unsigned int FRAME_COUNT( 30u );
+
+  std::vector< ParticleVertex > vertices;
+  PropertyBuffer wholeBuffer = CreateParticleBuffer( vertices, PARTICLE_COUNT );
+  PropertyBuffer rangeBuffer = CreateParticleBuffer( vertices, PARTICLE_COUNT );
+  PropertyBufferSetUsage( rangeBuffer, PropertyBufferUsage::DYNAMIC );
+  Actor wholeActor = CreateParticleActor( wholeBuffer );
+  Actor rangeActor = CreateParticleActor( rangeBuffer );
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  application.SendNotification();
+  application.Render(0);
+
+  size_t wholeBytes = 0u;
+  size_t rangeBytes = 0u;
+  for( unsigned int frame = 0; frame < FRAME_COUNT; ++frame )
+  {
+    const unsigned int first = ( frame * MOVING_COUNT ) % PARTICLE_COUNT;
+    for( unsigned int i = first; i < first + MOVING_COUNT; ++i )
+    {
+      vertices[i].position.y += 1.0f;
+    }
+
+    gl.ResetBufferDataCalls();
+    gl.ResetBufferSubDataCalls();
+    wholeBuffer.SetData( &vertices[0], PARTICLE_COUNT );
+    application.SendNotification();
+    application.Render(16);
+    wholeBytes += SumCalls( gl.GetBufferDataCalls() ) + SumCalls( gl.GetBufferSubDataCalls() );
+
+    gl.ResetBufferDataCalls();
+    gl.ResetBufferSubDataCalls();
+    PropertyBufferSetData( rangeBuffer, &vertices[first], first, MOVING_COUNT );
+    application.SendNotification();
+    application.Render(16);
+    rangeBytes += SumCalls( gl.GetBufferDataCalls() ) + SumCalls( gl.GetBufferSubDataCalls() );
+  }
+
+  tet_printf( "%u particles, %u moving for %u frames: %u bytes uploaded with SetData, %u bytes with ranges\n",
+              PARTICLE_COUNT, MOVING_COUNT, FRAME_COUNT, static_cast<unsigned int>( wholeBytes ), static_cast<unsigned int>( rangeBytes ) );
+
+  DALI_TEST_EQUALS( wholeBytes, FRAME_COUNT * PARTICLE_COUNT * sizeof( ParticleVertex ), TEST_LOCATION );
+  DALI_TEST_EQUALS( rangeBytes, FRAME_COUNT * MOVING_COUNT * sizeof( ParticleVertex ), TEST_LOCATION );
+
+  END_TEST;
+}
@@ -2378,3 +2378,178 @@ int UtcDaliRendererSetWriteToColorBuffer(void)
 
   END_TEST;
 }
+
+namespace
+{
+
+/**
+ * Adds a row of actors sharing the same renderer to the stage
+ */
+void AddActorsWithSharedRenderer( Renderer renderer, unsigned int count, const Vector3& size )
+{
+  for( unsigned int i = 0; i < count; ++i )
+  {
+    Actor actor = Actor::New();
+    actor.AddRenderer( renderer );
+    actor.SetParentOrigin( ParentOrigin::CENTER );
+    actor.SetPosition( size.x * i, 0.0f );
+    actor.SetSize( size );
+    Stage::GetCurrent().Add( actor );
+  }
+}
+
+} // unnamed namespace
+
+int UtcDaliRendererInstancedDraw(void)
+{
+  TestApplication application;
+  tet_infoline("Test that renderers are drawn with one instanced draw call when the shader declares the instance attributes");
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.SetGetStringResult( (GLubyte*)"OpenGL ES 3.0" );
+  gl.SetAttribLocation( "aInstanceModelView", 4 );
+  gl.SetAttribLocation( "aInstanceColor", 8 );
+
+  Geometry geometry = CreateQuadGeometry();
+  Shader shader = CreateShader();
+  TextureSet textureSet = CreateTextureSet();
+  Renderer renderer = Renderer::New( geometry, shader );
+  renderer.SetTextures( textureSet );
+  AddActorsWithSharedRenderer( renderer, 5u, Vector3( 10.0f, 10.0f, 0.0f ) );
+
+  gl.EnableDrawCallTrace( true );
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElementsInstanced" ), 1, TEST_LOCATION );
+  DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElements" ), 0, TEST_LOCATION );
+  TraceCallStack::NamedParams params;
+  params["instanceCount"] = "5";
+  DALI_TEST_CHECK( gl.GetDrawTrace().FindMethodAndParams( "DrawElementsInstanced", params ) );
+  DALI_TEST_EQUALS( application.GetRenderStatus().GetDrawCallsSaved(), 4u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliRendererInstancedDrawDifferentSizes(void)
+{
+  TestApplication application;
+  tet_infoline("Test that only consecutive renderers of the same size are drawn with one instanced draw call");
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.SetGetStringResult( (GLubyte*)"OpenGL ES 3.0" );
+  gl.SetAttribLocation( "aInstanceModelView", 4 );
+  gl.SetAttribLocation( "aInstanceColor", 8 );
+
+  Geometry geometry = CreateQuadGeometry();
+  Shader shader = CreateShader();
+  TextureSet textureSet = CreateTextureSet();
+  Renderer renderer = Renderer::New( geometry, shader );
+  renderer.SetTextures( textureSet );
+  AddActorsWithSharedRenderer( renderer, 3u, Vector3( 10.0f, 10.0f, 0.0f ) );
+  AddActorsWithSharedRenderer( renderer, 3u, Vector3( 20.0f, 20.0f, 0.0f ) );
+
+  gl.EnableDrawCallTrace( true );
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElementsInstanced" ), 2, TEST_LOCATION );
+  DALI_TEST_EQUALS( application.GetRenderStatus().GetDrawCallsSaved(), 4u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliRendererInstancedDrawNotSupported(void)
+{
+  TestApplication application;
+  tet_infoline("Test that renderers are drawn one by one when the shader does not declare the instance attributes");
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+
+  Geometry geometry = CreateQuadGeometry();
+  Shader shader = CreateShader();
+  TextureSet textureSet = CreateTextureSet();
+  Renderer renderer = Renderer::New( geometry, shader );
+  renderer.SetTextures( textureSet );
+  AddActorsWithSharedRenderer( renderer, 5u, Vector3( 10.0f, 10.0f, 0.0f ) );
+
+  gl.EnableDrawCallTrace( true );
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElementsInstanced" ), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElements" ), 5, TEST_LOCATION );
+  DALI_TEST_EQUALS( application.GetRenderStatus().GetDrawCallsSaved(), 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliRendererInstancedDrawSingleActor(void)
+{
+  TestApplication application;
+  tet_infoline("Test that a renderer drawn alone sets the instance attributes as constants");
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.SetAttribLocation( "aInstanceModelView", 4 );
+  gl.SetAttribLocation( "aInstanceColor", 8 );
+
+  Geometry geometry = CreateQuadGeometry();
+  Shader shader = CreateShader();
+  TextureSet textureSet = CreateTextureSet();
+  Renderer renderer = Renderer::New( geometry, shader );
+  renderer.SetTextures( textureSet );
+  Actor actor = Actor::New();
+  actor.AddRenderer( renderer );
+  actor.SetSize( 10.0f, 10.0f );
+  actor.SetColor( Vector4( 1.0f, 0.5f, 0.25f, 1.0f ) );
+  Stage::GetCurrent().Add( actor );
+
+  gl.EnableDrawCallTrace( true );
+  gl.EnableVertexArrayCallTrace( true );
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElementsInstanced" ), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElements" ), 1, TEST_LOCATION );
+
+  // One constant per column of the model-view matrix, and one for the color
+  TraceCallStack& vertexArrayTrace = gl.GetVertexArrayTrace();
+  DALI_TEST_EQUALS( vertexArrayTrace.CountMethod( "VertexAttrib4fv" ), 5, TEST_LOCATION );
+  for( unsigned int column = 0; column < 4u; ++column )
+  {
+    TraceCallStack::NamedParams params;
+    params["index"] = ToString( 4u + column );
+    DALI_TEST_CHECK( vertexArrayTrace.FindMethodAndParams( "VertexAttrib4fv", params ) );
+  }
+  DALI_TEST_CHECK( vertexArrayTrace.FindMethodAndParams( "VertexAttrib4fv", "8, 1, 0.5, 0.25, 1" ) );
+
+  END_TEST;
+}
+
+int UtcDaliRendererInstancedDrawGles2(void)
+{
+  TestApplication application;
+  tet_infoline("Test that renderers are drawn one by one when the context does not support instanced drawing");
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.SetGetStringResult( (GLubyte*)"OpenGL ES 2.0" );
+  gl.SetAttribLocation( "aInstanceModelView", 4 );
+  gl.SetAttribLocation( "aInstanceColor", 8 );
+
+  Geometry geometry = CreateQuadGeometry();
+  Shader shader = CreateShader();
+  TextureSet textureSet = CreateTextureSet();
+  Renderer renderer = Renderer::New( geometry, shader );
+  renderer.SetTextures( textureSet );
+  AddActorsWithSharedRenderer( renderer, 5u, Vector3( 10.0f, 10.0f, 0.0f ) );
+
+  gl.EnableDrawCallTrace( true );
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElementsInstanced" ), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElements" ), 5, TEST_LOCATION );
+  DALI_TEST_EQUALS( application.GetRenderStatus().GetDrawCallsSaved(), 0u, TEST_LOCATION );
+
+  END_TEST;
+}
@@ -520,3 +520,283 @@ int UtcDaliTextureGetHeight(void)
   END_TEST;
 }
 
+
+namespace
+{
+
+Actor CreateTexturedActor( Texture texture )
+{
+  TextureSet textureSet = CreateTextureSet();
+  textureSet.SetTexture( 0u, texture );
+
+  Geometry geometry = CreateQuadGeometry();
+  Shader shader = CreateShader();
+  Renderer renderer = Renderer::New( geometry, shader );
+  renderer.SetTextures( textureSet );
+
+  Actor actor = Actor::New();
+  actor.AddRenderer( renderer );
+  actor.SetParentOrigin( ParentOrigin::CENTER );
+  actor.SetSize( 100.0f, 100.0f );
+  return actor;
+}
+
+PixelData CreatePixelData( unsigned int width, unsigned int height )
+{
+  unsigned int bufferSize( width * height * 4 );
+  unsigned char* buffer = reinterpret_cast<unsigned char*>( malloc( bufferSize ) );
+  return PixelData::New( buffer, bufferSize, width, height, Pixel::RGBA8888, PixelData::FREE );
+}
+
+} // unnamed namespace
+
+int UtcDaliTextureUploadBudget01(void)
+{
+  TestApplication application;
+  tet_infoline("Test that an upload exceeding the budget is split in strips, and that the texture is not drawn until it is complete");
+
+  const unsigned int width( 512u );
+  const unsigned int height( 512u );
+  application.GetCore().SetTextureUploadBudget( 256u * 1024u, 0u );
+
+  Texture texture = Texture::New( TextureType::TEXTURE_2D, Pixel::RGBA8888, width, height );
+  Actor actor = CreateTexturedActor( texture );
+  Stage::GetCurrent().Add( actor );
+  application.SendNotification();
+  application.Render();
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.EnableTextureCallTrace( true );
+  gl.EnableDrawCallTrace( true );
+  TraceCallStack& textureTrace = gl.GetTextureTrace();
+  TraceCallStack& drawTrace = gl.GetDrawTrace();
+
+  texture.Upload( CreatePixelData( width, height ) );
+  application.SendNotification();
+
+  // 128 rows of 2KB per frame
+  for( unsigned int frame = 0u; frame < 4u; ++frame )
+  {
+    textureTrace.Reset();
+    drawTrace.Reset();
+    const bool needsUpdate = application.Render();
+
+    std::stringstream out;
+    out << GL_TEXTURE_2D << ", " << 0u << ", " << 0u << ", " << frame * 128u << ", " << width << ", " << 128u;
+    DALI_TEST_EQUALS( textureTrace.CountMethod( "TexSubImage2D" ), 1, TEST_LOCATION );
+    DALI_TEST_CHECK( textureTrace.FindMethodAndParams( "TexSubImage2D", out.str().c_str() ) );
+    DALI_TEST_CHECK( !textureTrace.FindMethod( "TexImage2D" ) );
+
+    const bool complete = ( frame == 3u );
+    DALI_TEST_EQUALS( application.GetRenderStatus().GetPendingTextureUploads(), complete ? 0u : 1u, TEST_LOCATION );
+    DALI_TEST_EQUALS( drawTrace.FindMethod( "DrawElements" ) || drawTrace.FindMethod( "DrawArrays" ), complete, TEST_LOCATION );
+    DALI_TEST_CHECK( complete || needsUpdate );
+  }
+
+  // Once complete, the next uploads are made as usual within the budget
+  textureTrace.Reset();
+  texture.Upload( CreatePixelData( 64u, 64u ), 0u, 0u, 0u, 0u, 64u, 64u );
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( textureTrace.CountMethod( "TexSubImage2D" ), 1, TEST_LOCATION );
+  DALI_TEST_EQUALS( application.GetRenderStatus().GetPendingTextureUploads(), 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliTextureUploadBudget02(void)
+{
+  TestApplication application;
+  tet_infoline("Test that the uploads of the textures needed to draw are made first");
+
+  const unsigned int size( 64u );
+  application.GetCore().SetTextureUploadBudget( size * size * 4u, 0u );
+
+  Texture hidden1 = Texture::New( TextureType::TEXTURE_2D, Pixel::RGBA8888, size, size );
+  Texture hidden2 = Texture::New( TextureType::TEXTURE_2D, Pixel::RGBA8888, size, size );
+  Texture visible = Texture::New( TextureType::TEXTURE_2D, Pixel::RGBA8888, size, size );
+  Actor actor = CreateTexturedActor( visible );
+  Stage::GetCurrent().Add( actor );
+  application.SendNotification();
+  application.Render();
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.EnableDrawCallTrace( true );
+  TraceCallStack& drawTrace = gl.GetDrawTrace();
+
+  hidden1.Upload( CreatePixelData( size, size ) );
+  hidden2.Upload( CreatePixelData( size, size ) );
+  visible.Upload( CreatePixelData( size, size ) );
+  application.SendNotification();
+
+  // The first upload is made before the renderer requests its texture
+  drawTrace.Reset();
+  application.Render();
+  DALI_TEST_CHECK( !drawTrace.FindMethod( "DrawElements" ) && !drawTrace.FindMethod( "DrawArrays" ) );
+  DALI_TEST_EQUALS( application.GetRenderStatus().GetPendingTextureUploads(), 2u, TEST_LOCATION );
+
+  // Then the upload of the visible texture goes before the second hidden one
+  drawTrace.Reset();
+  application.Render();
+  DALI_TEST_CHECK( drawTrace.FindMethod( "DrawElements" ) || drawTrace.FindMethod( "DrawArrays" ) );
+  DALI_TEST_EQUALS( application.GetRenderStatus().GetPendingTextureUploads(), 1u, TEST_LOCATION );
+
+  application.Render();
+  DALI_TEST_EQUALS( application.GetRenderStatus().GetPendingTextureUploads(), 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliTextureUploadBudget03(void)
+{
+  TestApplication application;
+  tet_infoline("Test the uploads with a time budget, the mipmaps queued after them, and the removal of the budget");
+
+  const unsigned int width( 512u );
+  const unsigned int height( 512u );
+  application.GetCore().SetTextureUploadBudget( 0u, 1u );
+
+  Texture texture = Texture::New( TextureType::TEXTURE_2D, Pixel::RGBA8888, width, height );
+  application.SendNotification();
+  application.Render();
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.EnableTextureCallTrace( true );
+  TraceCallStack& textureTrace = gl.GetTextureTrace();
+
+  texture.Upload( CreatePixelData( width, height ) );
+  texture.GenerateMipmaps();
+  application.SendNotification();
+
+  // At least a strip of 64KB is uploaded each frame
+  textureTrace.Reset();
+  application.Render();
+  {
+    std::stringstream out;
+    out << GL_TEXTURE_2D << ", " << 0u << ", " << 0u << ", " << 0u << ", " << width << ", " << 32u;
+    DALI_TEST_CHECK( textureTrace.FindMethodAndParams( "TexSubImage2D", out.str().c_str() ) );
+  }
+
+  unsigned int frameCount( 1u );
+  while( application.GetRenderStatus().GetPendingTextureUploads() > 0u && frameCount < 32u )
+  {
+    DALI_TEST_CHECK( !textureTrace.FindMethod( "GenerateMipmap" ) );
+    application.Render();
+    ++frameCount;
+  }
+  DALI_TEST_CHECK( textureTrace.FindMethod( "GenerateMipmap" ) );
+  DALI_TEST_CHECK( frameCount <= 17u );
+  tet_printf( "Uploaded %ux%u and generated the mipmaps in %u frames\n", width, height, frameCount );
+
+  // Without a budget, the uploads are immediate
+  application.GetCore().SetTextureUploadBudget( 0u, 0u );
+  application.SendNotification();
+  application.Render();
+  textureTrace.Reset();
+  texture.Upload( CreatePixelData( width, height ) );
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( textureTrace.CountMethod( "TexImage2D" ), 1, TEST_LOCATION );
+  DALI_TEST_EQUALS( textureTrace.CountMethod( "TexSubImage2D" ), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( application.GetRenderStatus().GetPendingTextureUploads(), 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliTextureUploadBudgetEmptyArea(void)
+{
+  TestApplication application;
+  tet_infoline("Test that the uploads of an empty area are not queued");
+
+  application.GetCore().SetTextureUploadBudget( 1024u, 0u );
+
+  Texture texture = Texture::New( TextureType::TEXTURE_2D, Pixel::RGBA8888, 64u, 64u );
+  Actor actor = CreateTexturedActor( texture );
+  Stage::GetCurrent().Add( actor );
+  application.SendNotification();
+  application.Render();
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.EnableTextureCallTrace( true );
+  TraceCallStack& textureTrace = gl.GetTextureTrace();
+  textureTrace.Reset();
+
+  texture.Upload( CreatePixelData( 16u, 16u ), 0u, 0u, 0u, 0u, 0u, 16u );
+  texture.Upload( CreatePixelData( 16u, 16u ), 0u, 0u, 0u, 0u, 16u, 0u );
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK( !textureTrace.FindMethod( "TexSubImage2D" ) );
+  DALI_TEST_EQUALS( application.GetRenderStatus().GetPendingTextureUploads(), 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliTextureUploadBudgetThumbnails(void)
+{
+  TestApplication application;
+  tet_infoline("Compare the uploads per frame of a grid of thumbnails, with and without a budget");
+
+  const unsigned int THUMBNAIL_COUNT( 40u );
+  const unsigned int size( 128u );
+  const unsigned int budget( 512u * 1024u );
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.EnableTextureCallTrace( true );
+  TraceCallStack& textureTrace = gl.GetTextureTrace();
+
+  for( unsigned int pass = 0u; pass < 2u; ++pass )
+  {
+    application.GetCore().SetTextureUploadBudget( pass == 0u ? 0u : budget, 0u );
+
+    std::vector< Actor > actors;
+    std::vector< Texture > textures;
+    for( unsigned int i = 0u; i < THUMBNAIL_COUNT; ++i )
+    {
+      textures.push_back( Texture::New( TextureType::TEXTURE_2D, Pixel::RGBA8888, size, size ) );
+      actors.push_back( CreateTexturedActor( textures.back() ) );
+      Stage::GetCurrent().Add( actors.back() );
+    }
+    application.SendNotification();
+    application.Render();
+
+    for( unsigned int i = 0u; i < THUMBNAIL_COUNT; ++i )
+    {
+      textures[i].Upload( CreatePixelData( size, size ) );
+    }
+    application.SendNotification();
+
+    unsigned int frameCount( 0u );
+    unsigned int maxUploadsPerFrame( 0u );
+    do
+    {
+      textureTrace.Reset();
+      application.Render();
+      ++frameCount;
+      const unsigned int uploads = textureTrace.CountMethod( "TexImage2D" ) + textureTrace.CountMethod( "TexSubImage2D" );
+      maxUploadsPerFrame = std::max( maxUploadsPerFrame, uploads );
+    }
+    while( application.GetRenderStatus().GetPendingTextureUploads() > 0u && frameCount < 100u );
+
+    tet_printf( "%u thumbnails of %ux%u, budget %u bytes: %u frames, at most %u bytes per frame\n",
+                THUMBNAIL_COUNT, size, size, pass == 0u ? 0u : budget, frameCount, maxUploadsPerFrame * size * size * 4u );
+
+    if( pass == 0u )
+    {
+      DALI_TEST_EQUALS( frameCount, 1u, TEST_LOCATION );
+      DALI_TEST_EQUALS( maxUploadsPerFrame, THUMBNAIL_COUNT, TEST_LOCATION );
+    }
+    else
+    {
+      DALI_TEST_EQUALS( frameCount, THUMBNAIL_COUNT * size * size * 4u / budget, TEST_LOCATION );
+      DALI_TEST_EQUALS( maxUploadsPerFrame * size * size * 4u, budget, TEST_LOCATION );
+    }
+
+    for( unsigned int i = 0u; i < THUMBNAIL_COUNT; ++i )
+    {
+      Stage::GetCurrent().Remove( actors[i] );
+    }
+  }
+
+  END_TEST;
+}
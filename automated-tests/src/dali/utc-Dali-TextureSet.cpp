@@ -332,3 +332,79 @@ int UtcDaliTextureSetGetTextureCount(void)
 
   END_TEST;
 }
+
+int UtcDaliTextureSetManyImagesBenchmark(void)
+{
+  TestApplication application;
+  tet_infoline("Benchmark the rendering of many actors, each with its own image");
+
+  const unsigned int IMAGE_COUNT = 2000u;
+  const unsigned int FRAME_COUNT = 10u;
+
+  Shader shader = CreateShader();
+  Geometry geometry = CreateQuadGeometry();
+
+  std::vector< Actor > actors;
+  std::vector< Image > images;
+  for( unsigned int i = 0; i < IMAGE_COUNT; ++i )
+  {
+    Image image = BufferImage::New( 4, 4, Pixel::RGBA8888 );
+    TextureSet textureSet = CreateTextureSet();
+    TextureSetImage( textureSet, 0u, image );
+
+    Renderer renderer = Renderer::New( geometry, shader );
+    renderer.SetTextures( textureSet );
+
+    Actor actor = Actor::New();
+    actor.AddRenderer( renderer );
+    actor.SetSize( 4.0f, 4.0f );
+    actor.SetPosition( ( i % 40u ) * 4.0f, ( i / 40u ) * 4.0f );
+    Stage::GetCurrent().Add( actor );
+
+    actors.push_back( actor );
+    images.push_back( image );
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  TraceCallStack& textureTrace = gl.GetTextureTrace();
+  textureTrace.Enable( true );
+  textureTrace.Reset();
+
+  const double start = GetTimeMilliseconds();
+  for( unsigned int frame = 0; frame < FRAME_COUNT; ++frame )
+  {
+    // Keep the update busy so that the texture sets are prepared every frame
+    actors[ frame ].SetOpacity( 0.5f );
+    application.SendNotification();
+    application.Render();
+  }
+  const double elapsedMilliseconds = GetTimeMilliseconds() - start;
+  tet_printf( "Rendered %u frames of %u textured actors in %.2f ms\n", FRAME_COUNT, IMAGE_COUNT, elapsedMilliseconds );
+
+  // Each actor binds its own texture
+  DALI_TEST_CHECK( textureTrace.CountMethod( "BindTexture" ) >= static_cast< int >( FRAME_COUNT * IMAGE_COUNT ) );
+
+  // Discarding half of the images keeps the others bound
+  for( unsigned int i = 0; i < IMAGE_COUNT; i += 2u )
+  {
+    Stage::GetCurrent().Remove( actors[i] );
+    actors[i].Reset();
+    images[i].Reset();
+  }
+  application.SendNotification();
+  application.Render();
+  application.SendNotification();
+  application.Render();
+
+  textureTrace.Reset();
+  actors[1].SetOpacity( 0.5f );
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( textureTrace.CountMethod( "BindTexture" ), static_cast< int >( IMAGE_COUNT / 2u ), TEST_LOCATION );
+
+  END_TEST;
+}
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "constraint-skip-unchanged.h"
+
+// INTERNAL INCLUDES
+#include <dali/public-api/animation/constraint.h>
+#include <dali/internal/event/animation/constraint-base.h>
+
+namespace Dali
+{
+
+void ConstraintSetSkipUnchanged( Constraint constraint, bool skip )
+{
+  GetImplementation( constraint ).SetSkipUnchanged( skip );
+}
+
+bool ConstraintGetSkipUnchanged( Constraint constraint )
+{
+  return GetImplementation( constraint ).GetSkipUnchanged();
+}
+
+} // namespace Dali
@@ -0,0 +1,50 @@
+#ifndef DALI_CONSTRAINT_SKIP_UNCHANGED_H
+#define DALI_CONSTRAINT_SKIP_UNCHANGED_H
+
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-common.h>
+
+namespace Dali
+{
+
+class Constraint;
+
+/**
+ * @brief Set whether the constraint function is skipped when nothing it depends on has changed.
+ *
+ * When enabled, the constraint compares the values of its inputs and of the target property with
+ * the ones of the previous frame; if none has changed, the previous output is applied again instead
+ * of calling the constraint function. This is only correct when the constraint function depends on
+ * nothing else, e.g. it must not read the time or keep a state. Disabled by default.
+ * @param[in] constraint The constraint
+ * @param[in] skip True to skip the evaluation of unchanged constraints
+ */
+DALI_IMPORT_API void ConstraintSetSkipUnchanged( Constraint constraint, bool skip );
+
+/**
+ * @brief Query whether the constraint function is skipped when nothing it depends on has changed.
+ * @param[in] constraint The constraint
+ * @return True if the evaluation of unchanged constraints is skipped
+ */
+DALI_IMPORT_API bool ConstraintGetSkipUnchanged( Constraint constraint );
+
+} //namespace Dali
+
+#endif // DALI_CONSTRAINT_SKIP_UNCHANGED_H
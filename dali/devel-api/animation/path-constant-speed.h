@@ -0,0 +1,51 @@
+#ifndef DALI_PATH_CONSTANT_SPEED_H
+#define DALI_PATH_CONSTANT_SPEED_H
+
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-common.h>
+
+namespace Dali
+{
+
+class Path;
+
+/**
+ * @brief Set whether the progress along the path is mapped to the length along the path.
+ *
+ * When enabled, equal increments of progress move along equal lengths of the path, so an actor
+ * animated along it moves at a constant speed, whatever the length of the segments and the spacing
+ * of their control points. The progress is mapped through a table of lengths built once for the path.
+ * Otherwise each segment takes the same share of the progress. Disabled by default.
+ * @note This applies to the animations created after the call, as they use a copy of the path.
+ * @param[in] path The path
+ * @param[in] constantSpeed True to map the progress to the length along the path
+ */
+DALI_IMPORT_API void PathSetConstantSpeed( Path path, bool constantSpeed );
+
+/**
+ * @brief Query whether the progress along the path is mapped to the length along the path.
+ * @param[in] path The path
+ * @return True if the progress is mapped to the length along the path
+ */
+DALI_IMPORT_API bool PathGetConstantSpeed( Path path );
+
+} //namespace Dali
+
+#endif // DALI_PATH_CONSTANT_SPEED_H
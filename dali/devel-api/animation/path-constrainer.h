@@ -54,7 +54,8 @@ public:
     {
       FORWARD   =  DEFAULT_OBJECT_PROPERTY_START_INDEX, ///< name "forward" type Vector3
       POINTS,                                           ///< name "points" type Array of Vector3
-      CONTROL_POINTS                                    ///< name "controlPoints" type Array of Vector3
+      CONTROL_POINTS,                                   ///< name "controlPoints" type Array of Vector3
+      CONSTANT_SPEED                                    ///< name "constantSpeed" type bool, whether the source property is mapped to the length along the path
     };
   };
 
@@ -112,6 +113,7 @@ public:
    * @param[in] source Property used as parameter for the path
    * @param[in] range The range of values in the source property which will be mapped to [0,1]
    * @param[in] wrap Wrapping domain. Source property will be wrapped in the domain [wrap.x,wrap.y] before mapping to [0,1]
+   * @note The constraint uses a copy of the path; later changes of the properties apply to the constraints applied afterwards.
    */
   void Apply( Dali::Property target, Dali::Property source, const Vector2& range, const Vector2& wrap = Vector2(-FLT_MAX, FLT_MAX) );
 
@@ -68,6 +68,30 @@ bool Atlas::Upload( PixelData pixelData,
   return GetImplementation(*this).Upload( &internalPixelData, xOffset, yOffset );
 }
 
+bool Atlas::Upload( PixelData pixelData,
+                    Vector4& textureRect )
+{
+  Internal::PixelData& internalPixelData = GetImplementation( pixelData );
+  return GetImplementation(*this).Upload( &internalPixelData, textureRect );
+}
+
+bool Atlas::Upload( const std::string& url,
+                    Vector4& textureRect )
+{
+  return GetImplementation(*this).Upload( url, textureRect );
+}
+
+bool Atlas::GetTextureRect( const std::string& url,
+                            Vector4& textureRect ) const
+{
+  return GetImplementation(*this).GetTextureRect( url, textureRect );
+}
+
+void Atlas::Remove( const Vector4& textureRect )
+{
+  GetImplementation(*this).Remove( textureRect );
+}
+
 Atlas Atlas::DownCast( BaseHandle handle )
 {
   return Atlas( dynamic_cast<Dali::Internal::Atlas*>(handle.GetObjectPtr()) );
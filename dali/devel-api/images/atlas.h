@@ -26,6 +26,7 @@
 #include <dali/public-api/images/buffer-image.h>
 #include <dali/public-api/images/image.h>
 #include <dali/public-api/images/pixel-data.h>
+#include <dali/public-api/math/vector4.h>
 
 namespace Dali
 {
@@ -39,8 +40,12 @@ class Atlas;
  * @brief An Atlas is a large image containing multiple smaller images.
  *
  * Buffer image and resource image( by providing the url ) are supported for uploading.
- * Images must be uploaded at a specified position, to populate the Atlas.
- * The client is responsible for generating the appropriate geometry (UV coordinates) needed to draw images within the Atlas.
+ * Images can be uploaded at a specified position, to populate the Atlas.
+ * The client is then responsible for generating the appropriate geometry (UV coordinates) needed to draw images within the Atlas.
+ *
+ * Alternatively, the Atlas can allocate the positions of the images itself, and return their UV coordinates.
+ * The areas of the removed images are reused. The two ways of uploading should not be mixed in the same Atlas.
+ * When an image does not fit, the upload fails; the client can then upload it to another Atlas.
  *
  * @note For gles 2.0, matched pixel format is demanded to ensure the correct atlasing.
  *       The only exception supported is uploading image of RGB888 to atlas of RGBA8888 format which is converted manually before pushing to GPU.
@@ -128,6 +133,47 @@ public:
   bool Upload( PixelData pixelData,
                SizeType xOffset,
                SizeType yOffset );
+
+  /**
+   * @brief Upload a pixel buffer to the atlas, at a position allocated by the atlas.
+   *
+   * @param [in] pixelData      The pixel data.
+   * @param [out] textureRect   The area of the atlas containing the image, in texture coordinates: (left, top, right, bottom).
+   * @return True if the image has been uploaded, false if there is no room left for it in the atlas.
+   */
+  bool Upload( PixelData pixelData,
+               Vector4& textureRect );
+
+  /**
+   * @brief Upload a resource image to the atlas, at a position allocated by the atlas.
+   *
+   * If the image has already been uploaded to the atlas this way, it is shared rather than uploaded again;
+   * it is then kept until it has been removed as many times as it was uploaded.
+   * @param [in] url            The URL of the resource image file to use
+   * @param [out] textureRect   The area of the atlas containing the image, in texture coordinates: (left, top, right, bottom).
+   * @return True if the image has been uploaded, false if it could not be loaded or there is no room left for it in the atlas.
+   */
+  bool Upload( const std::string& url,
+               Vector4& textureRect );
+
+  /**
+   * @brief Retrieve the area of a resource image uploaded at a position allocated by the atlas.
+   *
+   * @param [in] url            The URL of the resource image file
+   * @param [out] textureRect   The area of the atlas containing the image, in texture coordinates: (left, top, right, bottom).
+   * @return True if the image is in the atlas.
+   */
+  bool GetTextureRect( const std::string& url,
+                       Vector4& textureRect ) const;
+
+  /**
+   * @brief Remove an image uploaded at a position allocated by the atlas, so that its area can be reused.
+   *
+   * Areas which were not allocated by the atlas, or which have already been removed, are ignored.
+   * @param [in] textureRect    The area of the image, as returned by Upload().
+   */
+  void Remove( const Vector4& textureRect );
+
   /**
    * @brief Downcast an Object handle to Atlas.
    *
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "property-buffer-update.h"
+
+// INTERNAL INCLUDES
+#include <dali/public-api/rendering/property-buffer.h>
+#include <dali/internal/event/common/property-buffer-impl.h>
+
+namespace Dali
+{
+
+void PropertyBufferSetUsage( PropertyBuffer propertyBuffer, PropertyBufferUsage::Type usage )
+{
+  GetImplementation( propertyBuffer ).SetUsage( usage );
+}
+
+PropertyBufferUsage::Type PropertyBufferGetUsage( PropertyBuffer propertyBuffer )
+{
+  return GetImplementation( propertyBuffer ).GetUsage();
+}
+
+void PropertyBufferSetData( PropertyBuffer propertyBuffer, const void* data, std::size_t offset, std::size_t count )
+{
+  GetImplementation( propertyBuffer ).SetData( data, offset, count );
+}
+
+} // namespace Dali
@@ -0,0 +1,75 @@
+#ifndef DALI_PROPERTY_BUFFER_UPDATE_H
+#define DALI_PROPERTY_BUFFER_UPDATE_H
+
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstddef> // std::size_t
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-common.h>
+
+namespace Dali
+{
+
+class PropertyBuffer;
+
+namespace PropertyBufferUsage
+{
+
+/**
+ * @brief How often the data of a property buffer is updated.
+ */
+enum Type
+{
+  STATIC,   ///< The data is set once, or rarely. The default.
+  DYNAMIC,  ///< Parts of the data are updated often; only the ranges set are uploaded.
+  STREAM    ///< The data is updated every frame; each upload gets a new GPU buffer store, so it does not wait for the GPU to finish drawing the previous one.
+};
+
+} // namespace PropertyBufferUsage
+
+/**
+ * @brief Set how often the data of a property buffer is updated.
+ * @param[in] propertyBuffer The property buffer
+ * @param[in] usage The usage of the buffer
+ */
+DALI_IMPORT_API void PropertyBufferSetUsage( PropertyBuffer propertyBuffer, PropertyBufferUsage::Type usage );
+
+/**
+ * @brief Retrieve how often the data of a property buffer is updated.
+ * @param[in] propertyBuffer The property buffer
+ * @return The usage of the buffer
+ */
+DALI_IMPORT_API PropertyBufferUsage::Type PropertyBufferGetUsage( PropertyBuffer propertyBuffer );
+
+/**
+ * @brief Update a range of the elements of a property buffer; only the bytes of this range are uploaded.
+ *
+ * The data must have the format of the buffer, as for PropertyBuffer::SetData(). The size of the buffer is unchanged.
+ * @pre The range is within the elements set by PropertyBuffer::SetData().
+ * @param[in] propertyBuffer The property buffer
+ * @param[in] data A pointer to the elements that will be copied to the buffer.
+ * @param[in] offset The index of the first element to update
+ * @param[in] count The number of elements to update
+ */
+DALI_IMPORT_API void PropertyBufferSetData( PropertyBuffer propertyBuffer, const void* data, std::size_t offset, std::size_t count );
+
+} //namespace Dali
+
+#endif // DALI_PROPERTY_BUFFER_UPDATE_H
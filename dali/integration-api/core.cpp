@@ -31,10 +31,11 @@ namespace Integration
 {
 
 Core* Core::New(RenderController& renderController, PlatformAbstraction& platformAbstraction,
-                GlAbstraction& glAbstraction, GlSyncAbstraction& glSyncAbstraction, GestureManager& gestureManager, ResourcePolicy::DataRetention policy )
+                GlAbstraction& glAbstraction, GlSyncAbstraction& glSyncAbstraction, GestureManager& gestureManager, ResourcePolicy::DataRetention policy,
+                unsigned int updateWorkerThreadCount )
 {
   Core* instance = new Core;
-  instance->mImpl = new Internal::Core( renderController, platformAbstraction, glAbstraction, glSyncAbstraction, gestureManager, policy );
+  instance->mImpl = new Internal::Core( renderController, platformAbstraction, glAbstraction, glSyncAbstraction, gestureManager, policy, updateWorkerThreadCount );
 
   return instance;
 }
@@ -74,6 +75,61 @@ void Core::SetDpi(unsigned int dpiHorizontal, unsigned int dpiVertical)
   mImpl->SetDpi(dpiHorizontal, dpiVertical);
 }
 
+void Core::SetPartialUpdateEnabled(bool enabled)
+{
+  mImpl->SetPartialUpdateEnabled(enabled);
+}
+
+void Core::SetTextureUploadBudget(std::size_t bytesPerFrame, unsigned int microsecondsPerFrame)
+{
+  mImpl->SetTextureUploadBudget(bytesPerFrame, microsecondsPerFrame);
+}
+
+void Core::SetMessageCoalescingEnabled(bool enabled)
+{
+  mImpl->SetMessageCoalescingEnabled(enabled);
+}
+
+unsigned int Core::GetElidedMessageCount() const
+{
+  return mImpl->GetElidedMessageCount();
+}
+
+std::size_t Core::GetElidedMessageBytes() const
+{
+  return mImpl->GetElidedMessageBytes();
+}
+
+void Core::SetImageCacheBudget(std::size_t bytes)
+{
+  mImpl->SetImageCacheBudget(bytes);
+}
+
+void Core::TrimImageCache(std::size_t bytes)
+{
+  mImpl->TrimImageCache(bytes);
+}
+
+unsigned int Core::GetImageCacheHitCount() const
+{
+  return mImpl->GetImageCacheHitCount();
+}
+
+unsigned int Core::GetImageCacheMissCount() const
+{
+  return mImpl->GetImageCacheMissCount();
+}
+
+unsigned int Core::GetImageCacheEvictionCount() const
+{
+  return mImpl->GetImageCacheEvictionCount();
+}
+
+std::size_t Core::GetImageCacheBytes() const
+{
+  return mImpl->GetImageCacheBytes();
+}
+
 void Core::Suspend()
 {
   mImpl->Suspend();
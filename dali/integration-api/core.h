@@ -20,7 +20,9 @@
 
 // EXTERNAL INCLUDES
 #include <dali/public-api/common/dali-common.h>
+#include <dali/public-api/common/vector-wrapper.h>
 #include <dali/public-api/common/view-mode.h>
+#include <dali/public-api/math/rect.h>
 #include <dali/integration-api/context-notifier.h>
 #include <dali/integration-api/resource-policies.h>
 
@@ -119,7 +121,12 @@ public:
    * Constructor
    */
   RenderStatus()
-  : needsUpdate(false)
+  : damagedRects(),
+    bufferAge(1u),
+    drawCallsSaved(0u),
+    pendingTextureUploads(0u),
+    needsUpdate(false),
+    partialUpdate(false)
   {
   }
 
@@ -136,9 +143,86 @@ public:
    */
   bool NeedsUpdate() { return needsUpdate; }
 
+  /**
+   * Set the age of the back buffer before rendering a frame, when partial updates are enabled.
+   * This is the number of frames since the buffer was last rendered to, e.g. as given by EGL_EXT_buffer_age.
+   * The areas damaged in the frames rendered since then are rendered again.
+   * @param[in] age The age of the back buffer; 0 if its content is undefined, which renders the whole surface.
+   * The default is 1, i.e. the back buffer contains the previous frame.
+   */
+  void SetBufferAge(unsigned int age) { bufferAge = age; }
+
+  /**
+   * Query the age of the back buffer.
+   * @return The age of the back buffer.
+   */
+  unsigned int GetBufferAge() const { return bufferAge; }
+
+  /**
+   * Set whether only the damaged areas of the surface were rendered.
+   * @param[in] partial True if the frame has been partially rendered.
+   */
+  void SetPartialUpdate(bool partial) { partialUpdate = partial; }
+
+  /**
+   * Query whether only the damaged areas of the surface were rendered.
+   * When false, the whole surface has been rendered and GetDamagedRects() is empty.
+   * @return true if the frame has been partially rendered.
+   */
+  bool IsPartialUpdate() const { return partialUpdate; }
+
+  /**
+   * Remove the damaged areas of the previous frame.
+   */
+  void ClearDamagedRects() { damagedRects.clear(); }
+
+  /**
+   * Add an area of the surface which changed since the previous frame.
+   * @param[in] rect The area, in GL window coordinates i.e. the lower-left corner of the surface is (0,0).
+   */
+  void AddDamagedRect(const Rect<int>& rect) { damagedRects.push_back( rect ); }
+
+  /**
+   * Query the areas of the surface which changed since the previous frame, following a partial update.
+   * These can be passed to e.g. eglSwapBuffersWithDamage; no swap is required when the frame is partial and
+   * there are no damaged areas.
+   * @return The damaged areas, in GL window coordinates.
+   */
+  const std::vector< Rect<int> >& GetDamagedRects() const { return damagedRects; }
+
+  /**
+   * Set the number of draw calls saved by drawing several renderers with one instanced draw call.
+   * @param[in] count The number of draw calls saved in the frame.
+   */
+  void SetDrawCallsSaved(unsigned int count) { drawCallsSaved = count; }
+
+  /**
+   * Query the number of draw calls saved by instanced drawing in the last rendered frame.
+   * @return The number of draw calls saved.
+   */
+  unsigned int GetDrawCallsSaved() const { return drawCallsSaved; }
+
+  /**
+   * Set the number of texture uploads still queued after rendering a frame.
+   * @param[in] count The number of uploads pending.
+   */
+  void SetPendingTextureUploads(unsigned int count) { pendingTextureUploads = count; }
+
+  /**
+   * Query the number of texture uploads which did not fit in the budget of the frames rendered so far.
+   * @see Core::SetTextureUploadBudget()
+   * @return The number of uploads pending.
+   */
+  unsigned int GetPendingTextureUploads() const { return pendingTextureUploads; }
+
 private:
 
+  std::vector< Rect<int> > damagedRects;
+  unsigned int bufferAge;
+  unsigned int drawCallsSaved;
+  unsigned int pendingTextureUploads;
   bool needsUpdate;
+  bool partialUpdate;
 };
 
 /**
@@ -197,6 +281,9 @@ public:
    * @param[in] policy The data retention policy. This depends on application setting
    * and platform support. Dali should honour this policy when deciding to discard
    * intermediate resource data.
+   * @param[in] updateWorkerThreadCount The number of worker threads helping the update thread to process
+   * the independent parts of the update, e.g. the world matrices of the nodes of a same depth.
+   * With 0 (the default), the whole update is processed on the update thread only.
    * @return A newly allocated Core.
    */
   static Core* New(RenderController& renderController,
@@ -204,7 +291,8 @@ public:
                    GlAbstraction& glAbstraction,
                    GlSyncAbstraction& glSyncAbstraction,
                    GestureManager& gestureManager,
-                   ResourcePolicy::DataRetention policy);
+                   ResourcePolicy::DataRetention policy,
+                   unsigned int updateWorkerThreadCount = 0u);
 
   /**
    * Non-virtual destructor. Core is not intended as a base class.
@@ -267,6 +355,102 @@ public:
    */
   void SetDpi(unsigned int dpiHorizontal, unsigned int dpiVertical);
 
+  /**
+   * Enable or disable partial updates. When enabled, the areas of the surface which changed since the
+   * previous frame are computed during the update, only these areas are cleared and rendered, and they are
+   * reported through RenderStatus::GetDamagedRects().
+   * The whole surface is still rendered when the damage can't be tracked, e.g. in the frames following a
+   * change of surface size or background color, a texture upload, or when rendering to a frame buffer.
+   * The adaptor must preserve the content of the back buffer, or report its age with RenderStatus::SetBufferAge().
+   * Multi-threading note: this method should be called from the main thread
+   * @param[in] enabled True to enable partial updates; they are disabled by default.
+   */
+  void SetPartialUpdateEnabled(bool enabled);
+
+  /**
+   * Set the budget of the texture uploads in each frame. The uploads exceeding it are queued in the render thread,
+   * and made in the next frames; large uncompressed uploads are split in strips of rows. The uploads of the textures
+   * needed to draw the current frame are made first, and a renderer is not drawn until its textures are complete.
+   * RenderStatus::GetPendingTextureUploads() reports the uploads still queued after a frame.
+   * Only the uploads to Texture objects are budgeted; the bitmaps of ResourceImage, BufferImage and the other
+   * Image objects are still uploaded by the texture cache when first bound or updated, within the frame.
+   * Multi-threading note: this method should be called from the main thread
+   * @param[in] bytesPerFrame The number of bytes uploaded in a frame, or 0 for no limit
+   * @param[in] microsecondsPerFrame The time spent uploading in a frame, or 0 for no limit.
+   * At least one strip is uploaded in each frame. By default there is no budget, and the textures are uploaded immediately.
+   */
+  void SetTextureUploadBudget(std::size_t bytesPerFrame, unsigned int microsecondsPerFrame);
+
+  /**
+   * Enable or disable the coalescing of the messages sent to the update thread.
+   * When enabled, a message setting a property, e.g. from Actor::SetPosition(), replaces the previous message
+   * setting the same property in the same way, unless the messages have been flushed or another kind of message,
+   * e.g. to add an actor to the stage, has been sent since then. The replaced messages are not processed.
+   * Multi-threading note: this method should be called from the main thread
+   * @param[in] enabled True to enable the coalescing; it is disabled by default.
+   */
+  void SetMessageCoalescingEnabled(bool enabled);
+
+  /**
+   * Query the number of messages which were not processed by the update thread, due to coalescing.
+   * Multi-threading note: this method should be called from the main thread
+   * @return The number of messages since the Core was created.
+   */
+  unsigned int GetElidedMessageCount() const;
+
+  /**
+   * Query the size of the messages which were not processed by the update thread, due to coalescing.
+   * Multi-threading note: this method should be called from the main thread
+   * @return The size in bytes of the messages since the Core was created.
+   */
+  std::size_t GetElidedMessageBytes() const;
+
+  /**
+   * Set the budget of the cache of the images released by the application. When the last handle of an image
+   * loaded from a file is released, or the image is disconnected with the Image::UNUSED policy, its texture is kept
+   * in a least recently used cache, so loading the same image again does not read and decode the file.
+   * The least recently used images are discarded when the budget is exceeded. The size of an image is estimated
+   * with 32 bits per pixel.
+   * Multi-threading note: this method should be called from the main thread
+   * @param[in] bytes The budget in bytes; 0 (the default) disables the cache.
+   */
+  void SetImageCacheBudget(std::size_t bytes);
+
+  /**
+   * Discard the least recently used images of the cache, e.g. when the system notifies that the memory is low.
+   * Multi-threading note: this method should be called from the main thread
+   * @param[in] bytes The size the cache is trimmed to; 0 empties the cache.
+   */
+  void TrimImageCache(std::size_t bytes);
+
+  /**
+   * Query the number of image loads which found the image in the cache.
+   * Multi-threading note: this method should be called from the main thread
+   * @return The number of cache hits since the Core was created.
+   */
+  unsigned int GetImageCacheHitCount() const;
+
+  /**
+   * Query the number of image loads which did not find the image in the cache, while the cache was enabled.
+   * Multi-threading note: this method should be called from the main thread
+   * @return The number of cache misses since the Core was created.
+   */
+  unsigned int GetImageCacheMissCount() const;
+
+  /**
+   * Query the number of images discarded from the cache, to keep it within its budget or when trimmed.
+   * Multi-threading note: this method should be called from the main thread
+   * @return The number of evictions since the Core was created.
+   */
+  unsigned int GetImageCacheEvictionCount() const;
+
+  /**
+   * Query the estimated size of the images in the cache.
+   * Multi-threading note: this method should be called from the main thread
+   * @return The size in bytes.
+   */
+  std::size_t GetImageCacheBytes() const;
+
   // Core Lifecycle
 
   /**
@@ -49,6 +49,7 @@
 #include <dali/internal/update/rendering/scene-graph-renderer.h>
 #include <dali/internal/update/resources/texture-metadata.h>
 
+#include <dali/internal/render/common/performance-monitor.h>
 #include <dali/internal/render/gl-resources/bitmap-texture.h>
 #include <dali/internal/render/renderers/render-geometry.h>
 #include <dali/internal/render/renderers/render-property-buffer.h>
@@ -84,6 +85,26 @@ void EnableProfiling( ProfilingType type )
   }
 }
 
+void EnablePerformanceMonitor( bool enable )
+{
+  Internal::PerformanceMonitor::Enable( enable );
+}
+
+bool GetPerformanceStatistics( PerformanceMetric metric, PerformanceStatistics& statistics )
+{
+  return Internal::PerformanceMonitor::GetStatistics( static_cast< Internal::PerformanceMonitor::Metric >( metric ), statistics );
+}
+
+void StartPerformanceTrace()
+{
+  Internal::PerformanceMonitor::StartTrace();
+}
+
+bool StopPerformanceTrace( const char* filename )
+{
+  return Internal::PerformanceMonitor::StopTrace( filename );
+}
+
 namespace Profiling
 {
 
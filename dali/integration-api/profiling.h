@@ -44,6 +44,75 @@ enum ProfilingType
  */
 DALI_IMPORT_API void EnableProfiling( ProfilingType type );
 
+/**
+ * The metrics measured by the performance monitor.
+ * The phases of a frame are timed; the other metrics are counted per frame.
+ */
+enum PerformanceMetric
+{
+  PERFORMANCE_METRIC_FRAME_TIME,            ///< Time between the start of two consecutive updates, in microseconds
+  PERFORMANCE_METRIC_MATRIX_MULTIPLYS,      ///< Not monitored
+  PERFORMANCE_METRIC_QUATERNION_TO_MATRIX,  ///< Not monitored
+  PERFORMANCE_METRIC_FLOAT_POINT_MULTIPLY,  ///< Not monitored
+  PERFORMANCE_METRIC_RESET_PROPERTIES,      ///< Time spent resetting the properties
+  PERFORMANCE_METRIC_PROCESS_MESSAGES,      ///< Time spent processing the messages from the event thread
+  PERFORMANCE_METRIC_ANIMATE_NODES,         ///< Time spent animating
+  PERFORMANCE_METRIC_ANIMATORS_APPLIED,     ///< Number of animators applied
+  PERFORMANCE_METRIC_APPLY_CONSTRAINTS,     ///< Time spent applying the constraints outside the node tree
+  PERFORMANCE_METRIC_CONSTRAINTS_APPLIED,   ///< Number of constraints applied
+  PERFORMANCE_METRIC_CONSTRAINTS_SKIPPED,   ///< Number of constraints skipped
+  PERFORMANCE_METRIC_UPDATE_NODES,          ///< Time spent updating the node tree
+  PERFORMANCE_METRIC_MATRICES_SKIPPED,      ///< Number of world matrices not recalculated
+  PERFORMANCE_METRIC_PREPARE_RENDERABLES,   ///< Time spent updating the renderers
+  PERFORMANCE_METRIC_PROCESS_RENDER_TASKS,  ///< Time spent creating the render instructions
+  PERFORMANCE_METRIC_DRAW_NODES,            ///< Time spent rendering the instructions
+  PERFORMANCE_METRIC_DRAW_CALLS_SAVED,      ///< Number of draw calls saved by instancing
+  PERFORMANCE_METRIC_TEXTURE_DATA_UPLOADED, ///< Number of bytes of texture data uploaded
+
+  PERFORMANCE_METRIC_END
+};
+
+/**
+ * The statistics of a performance metric over the last monitored frames.
+ * Times are in microseconds.
+ */
+struct PerformanceStatistics
+{
+  float minimum;            ///< The smallest value of a frame
+  float average;            ///< The average value per frame
+  float percentile99;       ///< The value not exceeded by 99% of the frames
+  unsigned int frameCount;  ///< The number of frames the statistics are calculated from
+};
+
+/**
+ * Enables or disables the performance monitor; it is disabled by default.
+ * When enabled, the phases of each frame are timed and the statistics of the last frames are kept.
+ * @param[in] enable True to enable the performance monitor.
+ */
+DALI_IMPORT_API void EnablePerformanceMonitor( bool enable );
+
+/**
+ * Retrieves the statistics of a metric.
+ * This can be called from any thread.
+ * @param[in] metric The metric.
+ * @param[out] statistics The statistics of the metric over the last monitored frames.
+ * @return True if at least one frame was monitored.
+ */
+DALI_IMPORT_API bool GetPerformanceStatistics( PerformanceMetric metric, PerformanceStatistics& statistics );
+
+/**
+ * Starts recording the timed phases and the counters of each frame for a trace.
+ * @pre The performance monitor is enabled.
+ */
+DALI_IMPORT_API void StartPerformanceTrace();
+
+/**
+ * Stops recording the trace and writes it in the Chrome trace event format.
+ * @param[in] filename The file to write; it can be loaded in chrome://tracing
+ * @return True if the file was written.
+ */
+DALI_IMPORT_API bool StopPerformanceTrace( const char* filename );
+
 
 namespace Profiling
 {
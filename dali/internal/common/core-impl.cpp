@@ -85,7 +85,8 @@ using Integration::RenderStatus;
 
 Core::Core( RenderController& renderController, PlatformAbstraction& platform,
             GlAbstraction& glAbstraction, GlSyncAbstraction& glSyncAbstraction,
-            GestureManager& gestureManager, ResourcePolicy::DataRetention dataRetentionPolicy)
+            GestureManager& gestureManager, ResourcePolicy::DataRetention dataRetentionPolicy,
+            unsigned int updateWorkerThreadCount )
 : mRenderController( renderController ),
   mPlatform(platform),
   mGestureEventProcessor(NULL),
@@ -103,7 +104,7 @@ Core::Core( RenderController& renderController, PlatformAbstraction& platform,
   // Create the thread local storage
   CreateThreadLocalStorage();
 
-  // This does nothing until Core is built with --enable-performance-monitor
+  // This does nothing; the performance monitor is enabled with Integration::EnablePerformanceMonitor()
   PERFORMANCE_MONITOR_INIT( platform );
 
   mNotificationManager = new NotificationManager();
@@ -145,7 +146,8 @@ Core::Core( RenderController& renderController, PlatformAbstraction& platform,
                                        renderController,
                                       *mRenderManager,
                                        renderQueue,
-                                      *mTextureCacheDispatcher );
+                                      *mTextureCacheDispatcher,
+                                       updateWorkerThreadCount );
 
   mRenderManager->SetShaderSaver( *mUpdateManager );
 
@@ -247,6 +249,62 @@ void Core::SetDpi( unsigned int dpiHorizontal, unsigned int dpiVertical )
   mStage->SetDpi( Vector2( dpiHorizontal , dpiVertical) );
 }
 
+void Core::SetPartialUpdateEnabled( bool enabled )
+{
+  SetPartialUpdateEnabledMessage( *mUpdateManager, enabled );
+}
+
+void Core::SetTextureUploadBudget( std::size_t bytesPerFrame, unsigned int microsecondsPerFrame )
+{
+  SetTextureUploadBudgetMessage( *mUpdateManager, bytesPerFrame, microsecondsPerFrame );
+}
+
+void Core::SetMessageCoalescingEnabled( bool enabled )
+{
+  // The messages are coalesced in the event-thread
+  mUpdateManager->SetMessageCoalescingEnabled( enabled );
+}
+
+unsigned int Core::GetElidedMessageCount() const
+{
+  return mUpdateManager->GetElidedMessageCount();
+}
+
+std::size_t Core::GetElidedMessageBytes() const
+{
+  return mUpdateManager->GetElidedMessageBytes();
+}
+
+void Core::SetImageCacheBudget( std::size_t bytes )
+{
+  mImageFactory->SetCacheBudget( bytes );
+}
+
+void Core::TrimImageCache( std::size_t bytes )
+{
+  mImageFactory->TrimCache( bytes );
+}
+
+unsigned int Core::GetImageCacheHitCount() const
+{
+  return mImageFactory->GetCacheHitCount();
+}
+
+unsigned int Core::GetImageCacheMissCount() const
+{
+  return mImageFactory->GetCacheMissCount();
+}
+
+unsigned int Core::GetImageCacheEvictionCount() const
+{
+  return mImageFactory->GetCacheEvictionCount();
+}
+
+std::size_t Core::GetImageCacheBytes() const
+{
+  return mImageFactory->GetCachedBytes();
+}
+
 void Core::Update( float elapsedSeconds, unsigned int lastVSyncTimeMilliseconds, unsigned int nextVSyncTimeMilliseconds, Integration::UpdateStatus& status )
 {
   // set the time delta so adaptor can easily print FPS with a release build with 0 as
@@ -83,7 +83,8 @@ public:
         Integration::GlAbstraction& glAbstraction,
         Integration::GlSyncAbstraction& glSyncAbstraction,
         Integration::GestureManager& gestureManager,
-        ResourcePolicy::DataRetention dataRetentionPolicy );
+        ResourcePolicy::DataRetention dataRetentionPolicy,
+        unsigned int updateWorkerThreadCount );
 
   /**
    * Destructor
@@ -120,6 +121,61 @@ public:
    */
   void SetDpi(unsigned int dpiHorizontal, unsigned int dpiVertical);
 
+  /**
+   * @copydoc Dali::Integration::Core::SetPartialUpdateEnabled(bool)
+   */
+  void SetPartialUpdateEnabled(bool enabled);
+
+  /**
+   * @copydoc Dali::Integration::Core::SetTextureUploadBudget(std::size_t,unsigned int)
+   */
+  void SetTextureUploadBudget(std::size_t bytesPerFrame, unsigned int microsecondsPerFrame);
+
+  /**
+   * @copydoc Dali::Integration::Core::SetMessageCoalescingEnabled(bool)
+   */
+  void SetMessageCoalescingEnabled(bool enabled);
+
+  /**
+   * @copydoc Dali::Integration::Core::GetElidedMessageCount()
+   */
+  unsigned int GetElidedMessageCount() const;
+
+  /**
+   * @copydoc Dali::Integration::Core::GetElidedMessageBytes()
+   */
+  std::size_t GetElidedMessageBytes() const;
+
+  /**
+   * @copydoc Dali::Integration::Core::SetImageCacheBudget(std::size_t)
+   */
+  void SetImageCacheBudget(std::size_t bytes);
+
+  /**
+   * @copydoc Dali::Integration::Core::TrimImageCache(std::size_t)
+   */
+  void TrimImageCache(std::size_t bytes);
+
+  /**
+   * @copydoc Dali::Integration::Core::GetImageCacheHitCount()
+   */
+  unsigned int GetImageCacheHitCount() const;
+
+  /**
+   * @copydoc Dali::Integration::Core::GetImageCacheMissCount()
+   */
+  unsigned int GetImageCacheMissCount() const;
+
+  /**
+   * @copydoc Dali::Integration::Core::GetImageCacheEvictionCount()
+   */
+  unsigned int GetImageCacheEvictionCount() const;
+
+  /**
+   * @copydoc Dali::Integration::Core::GetImageCacheBytes()
+   */
+  std::size_t GetImageCacheBytes() const;
+
   /**
    * @copydoc Dali::Integration::Core::SetMinimumFrameTimeInterval(unsigned int)
    */
@@ -19,7 +19,344 @@
 #include <dali/internal/common/math.h>
 
 //EXTERNAL INCLUDES
+#include <algorithm>
 #include <cmath>
+#include <cstring>
+
+#if defined(__SSE__)
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+//INTERNAL INCLUDES
+#include <dali/public-api/common/constants.h>
+
+namespace
+{
+
+const unsigned int COMPONENT_STRIDE( 10u );    ///< Floats per item in ComposeTransforms: scale (3), orientation (4), translation (3)
+
+/**
+ * Composes a single transformation matrix. Same operations, in the same order, as Matrix::SetTransformComponents
+ */
+void ComposeTransform( float* m, const float* components )
+{
+  const float* scale = components;
+  const float* rotation = components + 3;
+  const float* translation = components + 7;
+
+  if( ( fabsf( rotation[3] - 1.0f ) < Dali::Math::MACHINE_EPSILON_10 )&&
+      ( fabsf( rotation[0] ) < Dali::Math::MACHINE_EPSILON_10 )&&
+      ( fabsf( rotation[1] ) < Dali::Math::MACHINE_EPSILON_10 )&&
+      ( fabsf( rotation[2] ) < Dali::Math::MACHINE_EPSILON_10 ) )
+  {
+    m[0] = scale[0];
+    m[1] = 0.0f;
+    m[2] = 0.0f;
+    m[3] = 0.0f;
+
+    m[4] = 0.0f;
+    m[5] = scale[1];
+    m[6] = 0.0f;
+    m[7] = 0.0f;
+
+    m[8] = 0.0f;
+    m[9] = 0.0f;
+    m[10]= scale[2];
+    m[11]= 0.0f;
+  }
+  else
+  {
+    const float xx = rotation[0] * rotation[0];
+    const float yy = rotation[1] * rotation[1];
+    const float zz = rotation[2] * rotation[2];
+    const float xy = rotation[0] * rotation[1];
+    const float xz = rotation[0] * rotation[2];
+    const float wx = rotation[3] * rotation[0];
+    const float wy = rotation[3] * rotation[1];
+    const float wz = rotation[3] * rotation[2];
+    const float yz = rotation[1] * rotation[2];
+
+    m[0] = (scale[0] * (1.0f - 2.0f * (yy + zz)));
+    m[1] = (scale[0] * (       2.0f * (xy + wz)));
+    m[2] = (scale[0] * (       2.0f * (xz - wy)));
+    m[3] = 0.0f;
+
+    m[4] = (scale[1] * (       2.0f * (xy - wz)));
+    m[5] = (scale[1] * (1.0f - 2.0f * (xx + zz)));
+    m[6] = (scale[1] * (       2.0f * (yz + wx)));
+    m[7] = 0.0f;
+
+    m[8] = (scale[2] * (       2.0f * (xz + wy)));
+    m[9] = (scale[2] * (       2.0f * (yz - wx)));
+    m[10]= (scale[2] * (1.0f - 2.0f * (xx + yy)));
+    m[11]= 0.0f;
+  }
+
+  m[12] = translation[0];
+  m[13] = translation[1];
+  m[14] = translation[2];
+  m[15] = 1.0f;
+}
+
+#if defined(__SSE__)
+
+/**
+ * Loads the same component of four consecutive items
+ */
+inline __m128 Gather( const float* components, unsigned int offset )
+{
+  return _mm_setr_ps( components[offset],
+                      components[offset + COMPONENT_STRIDE],
+                      components[offset + 2u * COMPONENT_STRIDE],
+                      components[offset + 3u * COMPONENT_STRIDE] );
+}
+
+/**
+ * Composes four transformation matrices at once
+ */
+void ComposeTransforms4( Dali::Internal::Mat4* matrices, const unsigned int* indices, const float* components )
+{
+  const __m128 zero = _mm_setzero_ps();
+  const __m128 one = _mm_set1_ps( 1.0f );
+  const __m128 two = _mm_set1_ps( 2.0f );
+  const __m128 epsilon = _mm_set1_ps( Dali::Math::MACHINE_EPSILON_10 );
+  const __m128 signMask = _mm_set1_ps( -0.0f );
+
+  const __m128 sx = Gather( components, 0u );
+  const __m128 sy = Gather( components, 1u );
+  const __m128 sz = Gather( components, 2u );
+  const __m128 x = Gather( components, 3u );
+  const __m128 y = Gather( components, 4u );
+  const __m128 z = Gather( components, 5u );
+  const __m128 w = Gather( components, 6u );
+
+  //Lanes with an identity rotation are composed from the scale only, as in Matrix::SetTransformComponents
+  __m128 identity = _mm_cmplt_ps( _mm_andnot_ps( signMask, _mm_sub_ps( w, one ) ), epsilon );
+  identity = _mm_and_ps( identity, _mm_cmplt_ps( _mm_andnot_ps( signMask, x ), epsilon ) );
+  identity = _mm_and_ps( identity, _mm_cmplt_ps( _mm_andnot_ps( signMask, y ), epsilon ) );
+  identity = _mm_and_ps( identity, _mm_cmplt_ps( _mm_andnot_ps( signMask, z ), epsilon ) );
+
+  const __m128 xx = _mm_mul_ps( x, x );
+  const __m128 yy = _mm_mul_ps( y, y );
+  const __m128 zz = _mm_mul_ps( z, z );
+  const __m128 xy = _mm_mul_ps( x, y );
+  const __m128 xz = _mm_mul_ps( x, z );
+  const __m128 wx = _mm_mul_ps( w, x );
+  const __m128 wy = _mm_mul_ps( w, y );
+  const __m128 wz = _mm_mul_ps( w, z );
+  const __m128 yz = _mm_mul_ps( y, z );
+
+  __m128 m0 = _mm_mul_ps( sx, _mm_sub_ps( one, _mm_mul_ps( two, _mm_add_ps( yy, zz ) ) ) );
+  __m128 m1 = _mm_mul_ps( sx, _mm_mul_ps( two, _mm_add_ps( xy, wz ) ) );
+  __m128 m2 = _mm_mul_ps( sx, _mm_mul_ps( two, _mm_sub_ps( xz, wy ) ) );
+  __m128 m4 = _mm_mul_ps( sy, _mm_mul_ps( two, _mm_sub_ps( xy, wz ) ) );
+  __m128 m5 = _mm_mul_ps( sy, _mm_sub_ps( one, _mm_mul_ps( two, _mm_add_ps( xx, zz ) ) ) );
+  __m128 m6 = _mm_mul_ps( sy, _mm_mul_ps( two, _mm_add_ps( yz, wx ) ) );
+  __m128 m8 = _mm_mul_ps( sz, _mm_mul_ps( two, _mm_add_ps( xz, wy ) ) );
+  __m128 m9 = _mm_mul_ps( sz, _mm_mul_ps( two, _mm_sub_ps( yz, wx ) ) );
+  __m128 m10 = _mm_mul_ps( sz, _mm_sub_ps( one, _mm_mul_ps( two, _mm_add_ps( xx, yy ) ) ) );
+
+  m0 = _mm_or_ps( _mm_and_ps( identity, sx ), _mm_andnot_ps( identity, m0 ) );
+  m1 = _mm_andnot_ps( identity, m1 );
+  m2 = _mm_andnot_ps( identity, m2 );
+  m4 = _mm_andnot_ps( identity, m4 );
+  m5 = _mm_or_ps( _mm_and_ps( identity, sy ), _mm_andnot_ps( identity, m5 ) );
+  m6 = _mm_andnot_ps( identity, m6 );
+  m8 = _mm_andnot_ps( identity, m8 );
+  m9 = _mm_andnot_ps( identity, m9 );
+  m10 = _mm_or_ps( _mm_and_ps( identity, sz ), _mm_andnot_ps( identity, m10 ) );
+
+  //Transpose so each register holds a row of one of the matrices
+  __m128 row0Zero( zero ), row1Zero( zero ), row2Zero( zero );
+  _MM_TRANSPOSE4_PS( m0, m1, m2, row0Zero );
+  _MM_TRANSPOSE4_PS( m4, m5, m6, row1Zero );
+  _MM_TRANSPOSE4_PS( m8, m9, m10, row2Zero );
+
+  const __m128 row0[4] = { m0, m1, m2, row0Zero };
+  const __m128 row1[4] = { m4, m5, m6, row1Zero };
+  const __m128 row2[4] = { m8, m9, m10, row2Zero };
+  for( unsigned int i(0); i<4u; ++i )
+  {
+    float* m = matrices[ indices[i] ];
+    const float* translation = components + i * COMPONENT_STRIDE + 7u;
+    _mm_storeu_ps( m, row0[i] );
+    _mm_storeu_ps( m + 4u, row1[i] );
+    _mm_storeu_ps( m + 8u, row2[i] );
+    m[12] = translation[0];
+    m[13] = translation[1];
+    m[14] = translation[2];
+    m[15] = 1.0f;
+  }
+}
+
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+
+/**
+ * Loads the same component of four consecutive items
+ */
+inline float32x4_t Gather( const float* components, unsigned int offset )
+{
+  const float values[4] = { components[offset],
+                            components[offset + COMPONENT_STRIDE],
+                            components[offset + 2u * COMPONENT_STRIDE],
+                            components[offset + 3u * COMPONENT_STRIDE] };
+  return vld1q_f32( values );
+}
+
+/**
+ * Composes four transformation matrices at once
+ */
+void ComposeTransforms4( Dali::Internal::Mat4* matrices, const unsigned int* indices, const float* components )
+{
+  const float32x4_t zero = vdupq_n_f32( 0.0f );
+  const float32x4_t one = vdupq_n_f32( 1.0f );
+  const float32x4_t two = vdupq_n_f32( 2.0f );
+  const float32x4_t epsilon = vdupq_n_f32( Dali::Math::MACHINE_EPSILON_10 );
+
+  const float32x4_t sx = Gather( components, 0u );
+  const float32x4_t sy = Gather( components, 1u );
+  const float32x4_t sz = Gather( components, 2u );
+  const float32x4_t x = Gather( components, 3u );
+  const float32x4_t y = Gather( components, 4u );
+  const float32x4_t z = Gather( components, 5u );
+  const float32x4_t w = Gather( components, 6u );
+
+  //Lanes with an identity rotation are composed from the scale only, as in Matrix::SetTransformComponents
+  uint32x4_t identity = vcltq_f32( vabsq_f32( vsubq_f32( w, one ) ), epsilon );
+  identity = vandq_u32( identity, vcltq_f32( vabsq_f32( x ), epsilon ) );
+  identity = vandq_u32( identity, vcltq_f32( vabsq_f32( y ), epsilon ) );
+  identity = vandq_u32( identity, vcltq_f32( vabsq_f32( z ), epsilon ) );
+
+  const float32x4_t xx = vmulq_f32( x, x );
+  const float32x4_t yy = vmulq_f32( y, y );
+  const float32x4_t zz = vmulq_f32( z, z );
+  const float32x4_t xy = vmulq_f32( x, y );
+  const float32x4_t xz = vmulq_f32( x, z );
+  const float32x4_t wx = vmulq_f32( w, x );
+  const float32x4_t wy = vmulq_f32( w, y );
+  const float32x4_t wz = vmulq_f32( w, z );
+  const float32x4_t yz = vmulq_f32( y, z );
+
+  float32x4x4_t row0, row1, row2;
+  row0.val[0] = vbslq_f32( identity, sx,   vmulq_f32( sx, vsubq_f32( one, vmulq_f32( two, vaddq_f32( yy, zz ) ) ) ) );
+  row0.val[1] = vbslq_f32( identity, zero, vmulq_f32( sx, vmulq_f32( two, vaddq_f32( xy, wz ) ) ) );
+  row0.val[2] = vbslq_f32( identity, zero, vmulq_f32( sx, vmulq_f32( two, vsubq_f32( xz, wy ) ) ) );
+  row0.val[3] = zero;
+  row1.val[0] = vbslq_f32( identity, zero, vmulq_f32( sy, vmulq_f32( two, vsubq_f32( xy, wz ) ) ) );
+  row1.val[1] = vbslq_f32( identity, sy,   vmulq_f32( sy, vsubq_f32( one, vmulq_f32( two, vaddq_f32( xx, zz ) ) ) ) );
+  row1.val[2] = vbslq_f32( identity, zero, vmulq_f32( sy, vmulq_f32( two, vaddq_f32( yz, wx ) ) ) );
+  row1.val[3] = zero;
+  row2.val[0] = vbslq_f32( identity, zero, vmulq_f32( sz, vmulq_f32( two, vaddq_f32( xz, wy ) ) ) );
+  row2.val[1] = vbslq_f32( identity, zero, vmulq_f32( sz, vmulq_f32( two, vsubq_f32( yz, wx ) ) ) );
+  row2.val[2] = vbslq_f32( identity, sz,   vmulq_f32( sz, vsubq_f32( one, vmulq_f32( two, vaddq_f32( xx, yy ) ) ) ) );
+  row2.val[3] = zero;
+
+  //Interleaving stores write the rows of the four matrices one after the other
+  float rows[3][16];
+  vst4q_f32( rows[0], row0 );
+  vst4q_f32( rows[1], row1 );
+  vst4q_f32( rows[2], row2 );
+
+  for( unsigned int i(0); i<4u; ++i )
+  {
+    float* m = matrices[ indices[i] ];
+    const float* translation = components + i * COMPONENT_STRIDE + 7u;
+    memcpy( m, rows[0] + i * 4u, 4u * sizeof( float ) );
+    memcpy( m + 4u, rows[1] + i * 4u, 4u * sizeof( float ) );
+    memcpy( m + 8u, rows[2] + i * 4u, 4u * sizeof( float ) );
+    m[12] = translation[0];
+    m[13] = translation[1];
+    m[14] = translation[2];
+    m[15] = 1.0f;
+  }
+}
+
+#endif
+
+const unsigned int FRUSTUM_PLANE_COUNT( 6u );
+
+/**
+ * Tests a single sphere against the frustum planes. Same operations, in the same order, as Camera::CheckSphereInFrustum
+ */
+inline bool IsSphereVisible( const float* sphere, const Dali::Internal::Vec4* planes, float minRadius )
+{
+  if( !( sphere[3] > minRadius ) )
+  {
+    return false;
+  }
+
+  for( unsigned int i(0); i<FRUSTUM_PLANE_COUNT; ++i )
+  {
+    const float* plane = planes[i];
+    if( ( plane[3] + ( plane[0] * sphere[0] + plane[1] * sphere[1] + plane[2] * sphere[2] ) ) < -sphere[3] )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+#if defined(__SSE__)
+
+/**
+ * Tests four spheres at once
+ * @return The visibility of the spheres in the four lowest bits
+ */
+inline uint32_t CullSpheres4( const Dali::Internal::Vec4* spheres, const Dali::Internal::Vec4* planes, __m128 minRadius )
+{
+  __m128 x = _mm_loadu_ps( spheres[0] );
+  __m128 y = _mm_loadu_ps( spheres[1] );
+  __m128 z = _mm_loadu_ps( spheres[2] );
+  __m128 radius = _mm_loadu_ps( spheres[3] );
+  _MM_TRANSPOSE4_PS( x, y, z, radius );
+
+  const __m128 negativeRadius = _mm_sub_ps( _mm_setzero_ps(), radius );
+  __m128 visible = _mm_cmpgt_ps( radius, minRadius );
+  for( unsigned int i(0); i<FRUSTUM_PLANE_COUNT; ++i )
+  {
+    const float* plane = planes[i];
+    const __m128 dot = _mm_add_ps( _mm_add_ps( _mm_mul_ps( _mm_set1_ps( plane[0] ), x ),
+                                               _mm_mul_ps( _mm_set1_ps( plane[1] ), y ) ),
+                                   _mm_mul_ps( _mm_set1_ps( plane[2] ), z ) );
+    const __m128 distance = _mm_add_ps( _mm_set1_ps( plane[3] ), dot );
+    visible = _mm_andnot_ps( _mm_cmplt_ps( distance, negativeRadius ), visible );
+  }
+  return static_cast< uint32_t >( _mm_movemask_ps( visible ) );
+}
+
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+
+/**
+ * Tests four spheres at once
+ * @return The visibility of the spheres in the four lowest bits
+ */
+inline uint32_t CullSpheres4( const Dali::Internal::Vec4* spheres, const Dali::Internal::Vec4* planes, float32x4_t minRadius )
+{
+  // De-interleaving load, val[0] holds the x of the four spheres and so on
+  const float32x4x4_t sphere = vld4q_f32( spheres[0] );
+
+  const float32x4_t negativeRadius = vnegq_f32( sphere.val[3] );
+  uint32x4_t visible = vcgtq_f32( sphere.val[3], minRadius );
+  for( unsigned int i(0); i<FRUSTUM_PLANE_COUNT; ++i )
+  {
+    const float* plane = planes[i];
+    const float32x4_t dot = vaddq_f32( vaddq_f32( vmulq_n_f32( sphere.val[0], plane[0] ),
+                                                  vmulq_n_f32( sphere.val[1], plane[1] ) ),
+                                       vmulq_n_f32( sphere.val[2], plane[2] ) );
+    const float32x4_t distance = vaddq_f32( vdupq_n_f32( plane[3] ), dot );
+    visible = vbicq_u32( visible, vcltq_f32( distance, negativeRadius ) );
+  }
+  return ( vgetq_lane_u32( visible, 0 ) & 1u ) |
+         ( vgetq_lane_u32( visible, 1 ) & 2u ) |
+         ( vgetq_lane_u32( visible, 2 ) & 4u ) |
+         ( vgetq_lane_u32( visible, 3 ) & 8u );
+}
+
+#endif
+
+} // unnamed namespace
 
 void Dali::Internal::TransformVector3( Vec3 result, const Mat4 m, const Vec3 v )
 {
@@ -57,3 +394,143 @@ float Dali::Internal::Length( const Vec3 v )
 {
   return sqrtf(v[0]*v[0] + v[1]*v[1] + v[2]*v[2]);
 }
+
+void Dali::Internal::MultiplyMatrices( Mat4 result, const Mat4 lhs, const Mat4 rhs )
+{
+#if defined(__SSE__)
+
+  const __m128 rhs0 = _mm_loadu_ps( rhs );
+  const __m128 rhs1 = _mm_loadu_ps( rhs + 4 );
+  const __m128 rhs2 = _mm_loadu_ps( rhs + 8 );
+  const __m128 rhs3 = _mm_loadu_ps( rhs + 12 );
+
+  for( int i=0; i < 4; i++ )
+  {
+    const float* lhsRow = lhs + ( i<<2 );
+    __m128 row = _mm_mul_ps( _mm_set1_ps( lhsRow[0] ), rhs0 );
+    row = _mm_add_ps( row, _mm_mul_ps( _mm_set1_ps( lhsRow[1] ), rhs1 ) );
+    row = _mm_add_ps( row, _mm_mul_ps( _mm_set1_ps( lhsRow[2] ), rhs2 ) );
+    row = _mm_add_ps( row, _mm_mul_ps( _mm_set1_ps( lhsRow[3] ), rhs3 ) );
+    _mm_storeu_ps( result + ( i<<2 ), row );
+  }
+
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+
+  const float32x4_t rhs0 = vld1q_f32( rhs );
+  const float32x4_t rhs1 = vld1q_f32( rhs + 4 );
+  const float32x4_t rhs2 = vld1q_f32( rhs + 8 );
+  const float32x4_t rhs3 = vld1q_f32( rhs + 12 );
+
+  for( int i=0; i < 4; i++ )
+  {
+    const float* lhsRow = lhs + ( i<<2 );
+    float32x4_t row = vmulq_n_f32( rhs0, lhsRow[0] );
+    row = vaddq_f32( row, vmulq_n_f32( rhs1, lhsRow[1] ) );
+    row = vaddq_f32( row, vmulq_n_f32( rhs2, lhsRow[2] ) );
+    row = vaddq_f32( row, vmulq_n_f32( rhs3, lhsRow[3] ) );
+    vst1q_f32( result + ( i<<2 ), row );
+  }
+
+#else
+
+  for( int i=0; i < 4; i++ )
+  {
+    int loc = i<<2;
+    float value0 = lhs[loc];
+    float value1 = lhs[loc + 1];
+    float value2 = lhs[loc + 2];
+    float value3 = lhs[loc + 3];
+    for( int j=0; j < 4; j++ )
+    {
+      result[loc + j] = (value0 * rhs[j]) +
+                        (value1 * rhs[4 + j]) +
+                        (value2 * rhs[8 + j]) +
+                        (value3 * rhs[12 + j]);
+    }
+  }
+
+#endif
+}
+
+void Dali::Internal::ComposeTransforms( Mat4* matrices, const unsigned int* indices, const float* components, unsigned int count )
+{
+  unsigned int i(0);
+
+#if defined(__SSE__) || defined(__ARM_NEON) || defined(__ARM_NEON__)
+  for( ; i + 4u <= count; i += 4u )
+  {
+    ComposeTransforms4( matrices, indices + i, components + i * COMPONENT_STRIDE );
+  }
+#endif
+
+  for( ; i < count; ++i )
+  {
+    ComposeTransform( matrices[ indices[i] ], components + i * COMPONENT_STRIDE );
+  }
+}
+
+void Dali::Internal::CullSpheres( uint32_t* visibility, const Vec4* spheres, unsigned int count, const Vec4* planes, float minRadius )
+{
+  memset( visibility, 0, ( ( count + 31u ) / 32u ) * sizeof( uint32_t ) );
+
+  unsigned int i(0);
+
+#if defined(__SSE__)
+  const __m128 minRadius4 = _mm_set1_ps( minRadius );
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+  const float32x4_t minRadius4 = vdupq_n_f32( minRadius );
+#endif
+
+#if defined(__SSE__) || defined(__ARM_NEON) || defined(__ARM_NEON__)
+  // Groups of four never straddle two words
+  for( ; i + 4u <= count; i += 4u )
+  {
+    visibility[ i / 32u ] |= CullSpheres4( spheres + i, planes, minRadius4 ) << ( i % 32u );
+  }
+#endif
+
+  for( ; i < count; ++i )
+  {
+    if( IsSphereVisible( spheres[i], planes, minRadius ) )
+    {
+      visibility[ i / 32u ] |= 1u << ( i % 32u );
+    }
+  }
+}
+
+void Dali::Internal::IntersectRect( Rect<int>& rect, const Rect<int>& clip )
+{
+  const int left = std::max( rect.x, clip.x );
+  const int bottom = std::max( rect.y, clip.y );
+  const int right = std::min( rect.x + rect.width, clip.x + clip.width );
+  const int top = std::min( rect.y + rect.height, clip.y + clip.height );
+
+  if( right > left && top > bottom )
+  {
+    rect.Set( left, bottom, right - left, top - bottom );
+  }
+  else
+  {
+    rect.Set( left, bottom, 0, 0 );
+  }
+}
+
+void Dali::Internal::MergeRect( Rect<int>& rect, const Rect<int>& other )
+{
+  if( other.width <= 0 || other.height <= 0 )
+  {
+    return;
+  }
+
+  if( rect.width <= 0 || rect.height <= 0 )
+  {
+    rect = other;
+    return;
+  }
+
+  const int left = std::min( rect.x, other.x );
+  const int bottom = std::min( rect.y, other.y );
+  const int right = std::max( rect.x + rect.width, other.x + other.width );
+  const int top = std::max( rect.y + rect.height, other.y + other.height );
+  rect.Set( left, bottom, right - left, top - bottom );
+}
@@ -18,6 +18,12 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <stdint.h>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/math/rect.h>
+
 namespace Dali
 {
 
@@ -45,6 +51,63 @@ void TransformVector3( Vec3 result, const Mat4 m, const Vec3 v );
  */
 float Length( const Vec3 v );
 
+/**
+ * @brief Multiplies two 4x4 matrices, result = lhs * rhs
+ *
+ * Uses SSE or NEON when available. The result is identical to Matrix::Multiply
+ *
+ * @param[out] result The result of the multiplication
+ * @param[in] lhs The left-hand-side matrix
+ * @param[in] rhs The right-hand-side matrix
+ */
+void MultiplyMatrices( Mat4 result, const Mat4 lhs, const Mat4 rhs );
+
+/**
+ * @brief Composes a batch of transformation matrices from their scale, orientation and translation
+ *
+ * Each item of the batch is stored in ten consecutive floats: scale (x,y,z), orientation (x,y,z,w) and
+ * translation (x,y,z). Items are processed four at a time using SSE or NEON when available. The result
+ * is identical to Matrix::SetTransformComponents
+ *
+ * @param[out] matrices Array of matrices where the results will be written
+ * @param[in] indices Index in matrices of the result of each item
+ * @param[in] components The components of each item
+ * @param[in] count The number of items in the batch
+ */
+void ComposeTransforms( Mat4* matrices, const unsigned int* indices, const float* components, unsigned int count );
+
+/**
+ * @brief Tests a batch of bounding spheres against the six planes of a frustum
+ *
+ * A sphere is visible when its radius is greater than minRadius and it isn't entirely behind any plane. Spheres are
+ * processed four at a time using SSE or NEON when available. The result is identical to testing the planes one by one
+ *
+ * @param[out] visibility One bit per sphere, set when it is visible; there must be ( count + 31 ) / 32 words
+ * @param[in] spheres The spheres; xyz is the center and w is the radius
+ * @param[in] count The number of spheres
+ * @param[in] planes The six planes of the frustum; xyz is the normal and w is the distance
+ * @param[in] minRadius The radius under which a sphere is considered empty
+ */
+void CullSpheres( uint32_t* visibility, const Vec4* spheres, unsigned int count, const Vec4* planes, float minRadius );
+
+/**
+ * @brief Clips a rectangle to another one
+ *
+ * @param[in,out] rect The rectangle to clip. Its width and height are zero when the rectangles don't intersect
+ * @param[in] clip The clipping rectangle
+ */
+void IntersectRect( Rect<int>& rect, const Rect<int>& clip );
+
+/**
+ * @brief Grows a rectangle to the bounding box of itself and another rectangle
+ *
+ * Empty rectangles are ignored
+ *
+ * @param[in,out] rect The rectangle to grow
+ * @param[in] other The rectangle to add
+ */
+void MergeRect( Rect<int>& rect, const Rect<int>& other );
+
 } // namespace Internal
 
 } // namespace Dali
@@ -0,0 +1,99 @@
+#ifndef __DALI_INTERNAL_MESSAGE_KEY_H__
+#define __DALI_INTERNAL_MESSAGE_KEY_H__
+
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstddef>
+#include <cstring>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/compile-time-assert.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+/**
+ * Identifies the messages which set a property, or a component of it, to an absolute value with the
+ * same member function. When several of these messages are flushed together, only the last one
+ * changes the property; the previous ones can be coalesced.
+ */
+class MessageKey
+{
+public:
+
+  /**
+   * Create an empty key, which identifies no property.
+   */
+  MessageKey()
+  : mProperty( NULL ),
+    mMember()
+  {
+  }
+
+  /**
+   * Create a key.
+   * @param[in] property The property set by the message.
+   * @param[in] member The member function setting the property; it must not depend on the current value.
+   */
+  template< typename MemberFunction >
+  MessageKey( const void* property, MemberFunction member )
+  : mProperty( property ),
+    mMember()
+  {
+    DALI_COMPILE_TIME_ASSERT( sizeof( MemberFunction ) <= sizeof( mMember ) );
+    memcpy( mMember, &member, sizeof( MemberFunction ) );
+  }
+
+  /**
+   * Equality operator.
+   * @param[in] rhs The key to compare with.
+   * @return True if both keys identify the same property and member function.
+   */
+  bool operator==( const MessageKey& rhs ) const
+  {
+    return ( mProperty == rhs.mProperty ) && ( memcmp( mMember, rhs.mMember, sizeof( mMember ) ) == 0 );
+  }
+
+  /**
+   * Compute a hash of the key, to index it in a hash table.
+   * @return The hash.
+   */
+  std::size_t GetHash() const
+  {
+    // The properties are aligned, the low bits of their address are not significant
+    std::size_t hash = reinterpret_cast< std::size_t >( mProperty ) >> 2u;
+    hash = hash * 31u + mMember[0];
+    hash = hash * 31u + mMember[1];
+    return hash ^ ( hash >> 16u );
+  }
+
+private:
+
+  const void* mProperty;   ///< The address of the property
+  std::size_t mMember[2];  ///< The representation of the member function pointer
+};
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_MESSAGE_KEY_H__
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/common/message-ring.h>
+
+// EXTERNAL INCLUDES
+#include <cstdlib>
+
+// INTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+
+namespace // unnamed namespace
+{
+
+const unsigned int MESSAGE_SIZE_FIELD = 1u; // Size required to mark the message size
+const unsigned int MESSAGE_END_FIELD  = 1u; // Size required to mark the end of the segment
+
+const unsigned int MESSAGE_SIZE_PLUS_END_FIELD = MESSAGE_SIZE_FIELD + MESSAGE_END_FIELD;
+
+const unsigned int MAX_DIVISION_BY_WORD_REMAINDER = sizeof(Dali::Internal::MessageRing::WordType) - 1u; // For word alignment on ARM
+const unsigned int WORD_SIZE = sizeof(Dali::Internal::MessageRing::WordType);
+
+const unsigned int MAX_FREE_SEGMENT_COUNT = 3u; // Allow this number of free segments to be kept
+
+} // unnamed namespace
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+MessageRing::MessageRing( std::size_t segmentCapacity )
+: mSegmentCapacity( segmentCapacity / WORD_SIZE ),
+  mWriteSegment( NULL ),
+  mWritePosition( NULL ),
+  mReadSegment( NULL ),
+  mReadPosition( NULL ),
+  mReadEnd( NULL ),
+  mPublishedPosition( NULL ),
+  mReleasedSegment( NULL )
+{
+  DALI_ASSERT_DEBUG( mSegmentCapacity > MESSAGE_SIZE_PLUS_END_FIELD );
+
+  // A ring of one segment
+  mWriteSegment = NewSegment( mSegmentCapacity );
+  mWriteSegment->next = mWriteSegment;
+  mWritePosition = GetData( mWriteSegment );
+
+  mReadSegment = mWriteSegment;
+  mReadPosition = mReadEnd = mWritePosition;
+
+  mPublishedPosition = mWritePosition;
+  mReleasedSegment = mWriteSegment;
+}
+
+MessageRing::~MessageRing()
+{
+  Segment* segment = mWriteSegment->next;
+  while( segment != mWriteSegment )
+  {
+    Segment* next = segment->next;
+    free( segment );
+    segment = next;
+  }
+  free( mWriteSegment );
+}
+
+unsigned int* MessageRing::ReserveMessageSlot( std::size_t size )
+{
+  DALI_ASSERT_DEBUG( 0 != size );
+
+  // Number of aligned words required to handle a message of size in bytes
+  const std::size_t requestedSize = (size + MAX_DIVISION_BY_WORD_REMAINDER) / WORD_SIZE;
+  const std::size_t requiredSize = requestedSize + MESSAGE_SIZE_PLUS_END_FIELD;
+
+  if( mWritePosition + requiredSize > GetData( mWriteSegment ) + mWriteSegment->capacity )
+  {
+    // Continue in the next segment, unless the consumer may still be reading it
+    Segment* next = mWriteSegment->next;
+    Segment* released = mReleasedSegment;
+    __sync_synchronize();
+
+    if( next == released || next->capacity < requiredSize )
+    {
+      // The messages are never moved; insert a new segment instead
+      next = NewSegment( requiredSize > mSegmentCapacity ? requiredSize : mSegmentCapacity );
+      next->next = mWriteSegment->next;
+      mWriteSegment->next = next;
+    }
+
+    // End marker
+    *mWritePosition = 0;
+
+    mWriteSegment = next;
+    mWritePosition = GetData( next );
+  }
+
+  // Now reserve the slot
+  WordType* slot = mWritePosition;
+
+  *slot++ = requestedSize; // Object size marker is stored in first word
+
+  mWritePosition = slot + requestedSize;
+
+  return reinterpret_cast<unsigned int*>(slot);
+}
+
+bool MessageRing::Publish()
+{
+  if( mWritePosition == mPublishedPosition )
+  {
+    return false;
+  }
+
+  // The messages must be written before the consumer can see them
+  __sync_synchronize();
+  mPublishedPosition = mWritePosition;
+
+  // Guard against excessive memory use; the segments after the one being written are not used by the consumer
+  Segment* released = mReleasedSegment;
+  __sync_synchronize();
+
+  unsigned int freeSegmentCount( 0u );
+  Segment* previous = mWriteSegment;
+  while( previous->next != released && previous->next != mWriteSegment )
+  {
+    Segment* segment = previous->next;
+    if( MAX_FREE_SEGMENT_COUNT <= freeSegmentCount || mSegmentCapacity != segment->capacity )
+    {
+      previous->next = segment->next;
+      free( segment );
+    }
+    else
+    {
+      ++freeSegmentCount;
+      previous = segment;
+    }
+  }
+
+  return true;
+}
+
+bool MessageRing::AcquireMessages()
+{
+  mReadEnd = mPublishedPosition;
+
+  // The messages must not be read before they are published
+  __sync_synchronize();
+
+  return mReadPosition != mReadEnd;
+}
+
+unsigned int* MessageRing::ReadMessage()
+{
+  if( mReadPosition == mReadEnd )
+  {
+    return NULL;
+  }
+
+  if( 0 == *mReadPosition )
+  {
+    // End marker, the following messages are in the next segment
+    mReadSegment = mReadSegment->next;
+    mReadPosition = GetData( mReadSegment );
+  }
+
+  WordType* message = mReadPosition + MESSAGE_SIZE_FIELD;
+  mReadPosition = message + *mReadPosition;
+
+  return reinterpret_cast<unsigned int*>( message );
+}
+
+void MessageRing::ReleaseMessages()
+{
+  // The messages must be destroyed before the producer can reuse their segments
+  __sync_synchronize();
+  mReleasedSegment = mReadSegment;
+}
+
+MessageRing::Segment* MessageRing::NewSegment( std::size_t capacity )
+{
+  Segment* segment = reinterpret_cast<Segment*>( malloc( sizeof( Segment ) + capacity * WORD_SIZE ) );
+  DALI_ASSERT_ALWAYS( NULL != segment );
+
+  segment->next = NULL;
+  segment->capacity = capacity;
+  return segment;
+}
+
+MessageRing::WordType* MessageRing::GetData( Segment* segment )
+{
+  return reinterpret_cast<WordType*>( segment + 1 );
+}
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,149 @@
+#ifndef __DALI_INTERNAL_MESSAGE_RING_H__
+#define __DALI_INTERNAL_MESSAGE_RING_H__
+
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstddef>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+/**
+ * Lock-free queue of messages, between one producer thread and one consumer thread.
+ *
+ * The messages are stored in a ring of fixed-size segments. A message is never moved once
+ * reserved; when it does not fit in the current segment the producer continues in the next
+ * free segment of the ring, or inserts a new segment when the consumer is still reading it.
+ *
+ * The producer reserves messages with ReserveMessageSlot() and makes them visible to the
+ * consumer with Publish(). The consumer takes the published messages with AcquireMessages()
+ * and ReadMessage(), then gives the memory back with ReleaseMessages().
+ */
+class MessageRing
+{
+public:
+  typedef std::ptrdiff_t WordType;
+
+  /**
+   * Create a new MessageRing
+   * @param[in] segmentCapacity The capacity of a segment, with respect to the size of type "char".
+   */
+  MessageRing( std::size_t segmentCapacity );
+
+  /**
+   * Non-virtual destructor; not suitable as a base class
+   * @note The messages are not destroyed, as their type is unknown.
+   */
+  ~MessageRing();
+
+  // Producer thread
+
+  /**
+   * Reserve space for another message in the ring.
+   * @pre size is greater than zero.
+   * @param[in] size The message size with respect to the size of type "char".
+   * @return A pointer to the address allocated for the message, aligned to a word boundary
+   */
+  unsigned int* ReserveMessageSlot( std::size_t size );
+
+  /**
+   * Makes the messages reserved so far visible to the consumer.
+   * The free segments above the recycling limit are deleted.
+   * @return true if messages have been reserved since the previous call
+   */
+  bool Publish();
+
+  // Consumer thread
+
+  /**
+   * Takes the messages published so far; the messages published afterwards are left for the next call.
+   * @return true if there are messages to read
+   */
+  bool AcquireMessages();
+
+  /**
+   * Reads the next acquired message.
+   * The message stays valid until ReleaseMessages() is called.
+   * @return A pointer to the message, or NULL when all the acquired messages have been read
+   */
+  unsigned int* ReadMessage();
+
+  /**
+   * Gives the memory of the messages read so far back to the producer.
+   * @pre The messages have been destroyed.
+   */
+  void ReleaseMessages();
+
+private:
+
+  /**
+   * A segment of the ring; the words of the messages follow it in memory.
+   */
+  struct Segment
+  {
+    Segment* next;        ///< The next segment of the ring
+    std::size_t capacity; ///< The capacity with respect to sizeof(WordType)
+  };
+
+  /**
+   * Helper to allocate a segment.
+   * @param[in] capacity The capacity with respect to sizeof(WordType)
+   * @return The segment
+   */
+  static Segment* NewSegment( std::size_t capacity );
+
+  /**
+   * Helper to get the first word of a segment.
+   * @param[in] segment The segment
+   * @return The first word
+   */
+  static WordType* GetData( Segment* segment );
+
+  // Undefined
+  MessageRing( const MessageRing& );
+
+  // Undefined
+  MessageRing& operator=( const MessageRing& rhs );
+
+private:
+
+  std::size_t mSegmentCapacity;          ///< The capacity of a segment with respect to sizeof(WordType)
+
+  // Used by the producer only
+  Segment* mWriteSegment;                ///< The segment being written
+  WordType* mWritePosition;              ///< The next free location in the segment being written
+
+  // Used by the consumer only
+  Segment* mReadSegment;                 ///< The segment being read
+  WordType* mReadPosition;               ///< The next message to read
+  WordType* mReadEnd;                    ///< The end of the acquired messages
+
+  // Shared
+  WordType* volatile mPublishedPosition; ///< The end of the published messages; written by the producer
+  Segment* volatile mReleasedSegment;    ///< The segment the consumer is reading; the producer does not write it
+};
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_MESSAGE_RING_H__
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/common/thread-pool.h>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/threading/thread.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+/**
+ * Worker thread processing the chunks of the tasks given to the pool.
+ * Each worker has its own ConditionalWait as it only supports one waiting thread at a time.
+ */
+class ThreadPool::Worker : public Thread
+{
+public:
+
+  Worker( ThreadPool& pool )
+  : mPool( pool ),
+    mConditionalWait(),
+    mGeneration( 0u ),
+    mTerminate( false )
+  {
+  }
+
+  virtual ~Worker()
+  {
+  }
+
+  /**
+   * Wakes the worker up to process the current task of the pool
+   */
+  void Wake()
+  {
+    ConditionalWait::ScopedLock lock( mConditionalWait );
+    ++mGeneration;
+    mConditionalWait.Notify( lock );
+  }
+
+  /**
+   * Stops the worker; it exits its loop the next time it checks for work
+   */
+  void Terminate()
+  {
+    ConditionalWait::ScopedLock lock( mConditionalWait );
+    mTerminate = true;
+    mConditionalWait.Notify( lock );
+  }
+
+private:
+
+  virtual void Run()
+  {
+    unsigned int generation( 0u );
+    while( true )
+    {
+      {
+        ConditionalWait::ScopedLock lock( mConditionalWait );
+        while( !mTerminate && generation == mGeneration )
+        {
+          mConditionalWait.Wait( lock );
+        }
+
+        if( mTerminate )
+        {
+          return;
+        }
+        generation = mGeneration;
+      }
+
+      mPool.ProcessChunks();
+      mPool.WorkerFinished();
+    }
+  }
+
+  ThreadPool& mPool;
+  ConditionalWait mConditionalWait; ///< Used to wake the worker up
+  unsigned int mGeneration;         ///< Incremented every time the worker is woken up to process a task
+  bool mTerminate;                  ///< Set to stop the worker
+};
+
+ThreadPool::ThreadPool( unsigned int workerCount )
+: mWorkers(),
+  mConditionalWait(),
+  mTask( NULL ),
+  mCount( 0u ),
+  mChunkSize( 1u ),
+  mNextItem( 0u ),
+  mBusyWorkers( 0u )
+{
+  mWorkers.Reserve( workerCount );
+  for( unsigned int i(0); i<workerCount; ++i )
+  {
+    Worker* worker = new Worker( *this );
+    mWorkers.PushBack( worker );
+    worker->Start();
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  for( Vector<Worker*>::Iterator iter = mWorkers.Begin(), endIter = mWorkers.End(); iter != endIter; ++iter )
+  {
+    (*iter)->Terminate();
+    (*iter)->Join();
+    delete *iter;
+  }
+}
+
+unsigned int ThreadPool::GetWorkerCount() const
+{
+  return mWorkers.Count();
+}
+
+void ThreadPool::Process( Task& task, unsigned int count, unsigned int chunkSize )
+{
+  if( chunkSize == 0u )
+  {
+    chunkSize = 1u;
+  }
+
+  if( mWorkers.Empty() || count < chunkSize * 2u )
+  {
+    // Not worth waking up the workers
+    task.Process( 0u, count );
+    return;
+  }
+
+  // The workers read the task after locking their ConditionalWait in Wake()
+  mTask = &task;
+  mCount = count;
+  mChunkSize = chunkSize;
+  mNextItem = 0u;
+  {
+    ConditionalWait::ScopedLock lock( mConditionalWait );
+    mBusyWorkers = mWorkers.Count();
+  }
+
+  for( Vector<Worker*>::Iterator iter = mWorkers.Begin(), endIter = mWorkers.End(); iter != endIter; ++iter )
+  {
+    (*iter)->Wake();
+  }
+
+  ProcessChunks();
+
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+  while( mBusyWorkers > 0u )
+  {
+    mConditionalWait.Wait( lock );
+  }
+  mTask = NULL;
+}
+
+void ThreadPool::WorkerFinished()
+{
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+  if( --mBusyWorkers == 0u )
+  {
+    mConditionalWait.Notify( lock );
+  }
+}
+
+void ThreadPool::ProcessChunks()
+{
+  while( true )
+  {
+    const unsigned int begin = __sync_fetch_and_add( &mNextItem, mChunkSize );
+    if( begin >= mCount )
+    {
+      break;
+    }
+
+    const unsigned int end = ( begin + mChunkSize < mCount ) ? begin + mChunkSize : mCount;
+    mTask->Process( begin, end );
+  }
+}
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,126 @@
+#ifndef __DALI_INTERNAL_THREAD_POOL_H__
+#define __DALI_INTERNAL_THREAD_POOL_H__
+
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/devel-api/threading/conditional-wait.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+/**
+ * @brief A pool of worker threads used to split the processing of a range of independent items.
+ *
+ * The thread calling Process() takes part in the processing and blocks until every item has been
+ * processed, so the work is always complete, in the same state, when Process() returns.
+ * A pool without workers processes every item on the calling thread.
+ */
+class ThreadPool
+{
+public:
+
+  /**
+   * @brief Interface of the work which can be split across the threads of the pool.
+   * Process() may be called concurrently from several threads, with disjoint ranges.
+   */
+  class Task
+  {
+  public:
+
+    /**
+     * Processes the items in the range [begin, end)
+     * @param[in] begin The first item to process
+     * @param[in] end One past the last item to process
+     */
+    virtual void Process( unsigned int begin, unsigned int end ) = 0;
+
+  protected:
+
+    /**
+     * Virtual destructor, no deletion through this interface
+     */
+    virtual ~Task() {}
+  };
+
+  /**
+   * Constructor. Starts the worker threads
+   * @param[in] workerCount The number of worker threads, in addition to the calling thread
+   */
+  ThreadPool( unsigned int workerCount );
+
+  /**
+   * Destructor. Stops and joins the worker threads
+   */
+  ~ThreadPool();
+
+  /**
+   * @return The number of worker threads
+   */
+  unsigned int GetWorkerCount() const;
+
+  /**
+   * Processes the items [0, count) of a task, in chunks, on the calling thread and the worker threads.
+   * Blocks until every item has been processed.
+   * @param[in] task The task to process
+   * @param[in] count The number of items
+   * @param[in] chunkSize The minimum number of items processed at once. Ranges smaller than two chunks
+   * are processed on the calling thread only
+   */
+  void Process( Task& task, unsigned int count, unsigned int chunkSize );
+
+private:
+
+  class Worker;
+
+  /**
+   * Called by a worker thread when there are no chunks left to process
+   */
+  void WorkerFinished();
+
+  /**
+   * Processes chunks of the current task until there are none left
+   */
+  void ProcessChunks();
+
+  // Undefined
+  ThreadPool( const ThreadPool& );
+
+  // Undefined
+  ThreadPool& operator=( const ThreadPool& );
+
+private:
+
+  Vector<Worker*> mWorkers;         ///< The worker threads
+  ConditionalWait mConditionalWait; ///< Used to wait for the workers to finish
+  Task* mTask;                      ///< The task being processed
+  unsigned int mCount;              ///< The number of items of the task
+  unsigned int mChunkSize;          ///< The number of items processed at once
+  volatile unsigned int mNextItem;  ///< The first item of the next chunk to process
+  unsigned int mBusyWorkers;        ///< The number of workers processing the current task
+};
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_THREAD_POOL_H__
@@ -28,6 +28,7 @@
 #include <dali/public-api/common/dali-common.h>
 #include <dali/public-api/common/constants.h>
 #include <dali/public-api/events/touch-data.h>
+#include <dali/public-api/math/math-utils.h>
 #include <dali/public-api/math/vector2.h>
 #include <dali/public-api/math/vector3.h>
 #include <dali/public-api/math/radian.h>
@@ -109,9 +110,21 @@ struct Actor::RelayoutData
       dimensionPadding[ i ] = GetDefaultDimensionPadding();
       minimumSize[ i ] = 0.0f;
       maximumSize[ i ] = FLT_MAX;
+      measurements[ i ].valid = false;
     }
   }
 
+  /**
+   * The last measurement of a dimension
+   */
+  struct Measurement
+  {
+    ResizePolicy::Type policy;  ///< The policy the dimension was measured with
+    float input;                ///< The size of the dimension it depends on, or zero for the natural size
+    float result;               ///< The measured size
+    bool valid;                 ///< Whether the measurement can be reused
+  };
+
   ResizePolicy::Type resizePolicies[ Dimension::DIMENSION_COUNT ];      ///< Resize policies
 
   Dimension::Type dimensionDependencies[ Dimension::DIMENSION_COUNT ];  ///< A list of dimension dependencies
@@ -126,6 +139,8 @@ struct Actor::RelayoutData
   bool dimensionNegotiated[ Dimension::DIMENSION_COUNT ];         ///< Has the dimension been negotiated
   bool dimensionDirty[ Dimension::DIMENSION_COUNT ];              ///< Flags indicating whether the layout dimension is dirty or not
 
+  Measurement measurements[ Dimension::DIMENSION_COUNT ];         ///< The last measurements, reused while nothing they depend on has changed
+
   Vector3 sizeModeFactor;                              ///< Factor of size used for certain SizeModes
 
   Vector2 preferredSize;                               ///< The preferred size of the actor
@@ -1707,6 +1722,30 @@ bool Actor::RaySphereTest( const Vector4& rayOrigin, const Vector4& rayDir ) con
   return ( b2 * b2 - a * c ) >= 0.f;
 }
 
+bool Actor::RaySubtreeSphereTest( const Vector4& rayOrigin, const Vector4& rayDir ) const
+{
+  // Without a node, the sub-tree can't be culled
+  if( !mNode )
+  {
+    return true;
+  }
+
+  // Same test as RaySphereTest() with the sphere published by the TransformManager
+  const Vector4 sphere( mNode->GetSubtreeBoundingSphere( GetEventThreadServices().GetEventBufferIndex() ) );
+  if( sphere.w < 0.0f )
+  {
+    return true;
+  }
+
+  Vector3 rayOriginLocal( rayOrigin.x - sphere.x, rayOrigin.y - sphere.y, rayOrigin.z - sphere.z );
+
+  float a = rayDir.Dot( rayDir );                                       // a
+  float b2 = rayDir.Dot( rayOriginLocal );                              // b/2
+  float c = rayOriginLocal.Dot( rayOriginLocal ) - sphere.w * sphere.w; // c
+
+  return ( b2 * b2 - a * c ) >= 0.f;
+}
+
 bool Actor::RayActorTest( const Vector4& rayOrigin, const Vector4& rayDir, Vector4& hitPointLocal, float& distance ) const
 {
   bool hit = false;
@@ -1957,6 +1996,7 @@ Actor::Actor( DerivedType derivedType )
   mTargetSize( 0.0f, 0.0f, 0.0f ),
   mName(),
   mId( ++mActorCounter ), // actor ID is initialised to start from 1, and 0 is reserved
+  mRelayoutRequestIndex( INVALID_RELAYOUT_REQUEST_INDEX ),
   mDepth( 0u ),
   mIsRoot( ROOT_LAYER == derivedType ),
   mIsLayer( LAYER == derivedType || ROOT_LAYER == derivedType ),
@@ -2009,6 +2049,12 @@ Actor::~Actor()
   // Guard to allow handle destruction after Core has been destroyed
   if( EventThreadServices::IsCoreRunning() )
   {
+    if( INVALID_RELAYOUT_REQUEST_INDEX != mRelayoutRequestIndex )
+    {
+      // Only set while the relayout controller is alive
+      RelayoutController::Get()->OnActorDestroyed( *this );
+    }
+
     if( NULL != mNode )
     {
       DestroyNodeMessage( GetEventThreadServices().GetUpdateManager(), *mNode );
@@ -2048,7 +2094,7 @@ void Actor::ConnectToStage( unsigned int parentDepth )
     (*iter)->NotifyStageConnection();
   }
 
-  RelayoutRequest();
+  RelayoutRequestKeepingMeasurements();
 }
 
 void Actor::RecursiveConnectToStage( ActorContainer& connectionList, unsigned int depth )
@@ -2099,8 +2145,8 @@ void Actor::ConnectToSceneGraph()
     GetRendererAt(i)->Connect();
   }
 
-  // Request relayout on all actors that are added to the scenegraph
-  RelayoutRequest();
+  // Request relayout on all actors that are added to the scenegraph; their measurements are still valid
+  RelayoutRequestKeepingMeasurements();
 
   // Notification for Object::Observers
   OnSceneObjectAdd();
@@ -3662,6 +3708,21 @@ bool Actor::RelayoutDependentOnDimension( Dimension::Type dimension, Dimension::
   return false;
 }
 
+void Actor::InvalidateMeasurements( Dimension::Type dimension )
+{
+  if( mRelayoutData )
+  {
+    for( unsigned int i = 0; i < Dimension::DIMENSION_COUNT; ++i )
+    {
+      if( ( dimension & ( 1 << i ) ) ||
+          ( mRelayoutData->resizePolicies[ i ] == ResizePolicy::DIMENSION_DEPENDENCY && ( mRelayoutData->dimensionDependencies[ i ] & dimension ) ) )
+      {
+        mRelayoutData->measurements[ i ].valid = false;
+      }
+    }
+  }
+}
+
 void Actor::SetNegotiatedDimension( float negotiatedDimension, Dimension::Type dimension )
 {
   for( unsigned int i = 0; i < Dimension::DIMENSION_COUNT; ++i )
@@ -3886,7 +3947,7 @@ float Actor::CalculateSize( Dimension::Type dimension, const Vector2& maximumSiz
   {
     case ResizePolicy::USE_NATURAL_SIZE:
     {
-      return GetNaturalSize( dimension );
+      return Measure( dimension, 0.0f );
     }
 
     case ResizePolicy::FIXED:
@@ -3916,14 +3977,10 @@ float Actor::CalculateSize( Dimension::Type dimension, const Vector2& maximumSiz
       const Dimension::Type dimensionDependency = GetDimensionDependency( dimension );
 
       // Custom rules
-      if( dimension == Dimension::WIDTH && dimensionDependency == Dimension::HEIGHT )
-      {
-        return GetWidthForHeight( GetNegotiatedDimension( Dimension::HEIGHT ) );
-      }
-
-      if( dimension == Dimension::HEIGHT && dimensionDependency == Dimension::WIDTH )
+      if( ( dimension == Dimension::WIDTH && dimensionDependency == Dimension::HEIGHT ) ||
+          ( dimension == Dimension::HEIGHT && dimensionDependency == Dimension::WIDTH ) )
       {
-        return GetHeightForWidth( GetNegotiatedDimension( Dimension::WIDTH ) );
+        return Measure( dimension, GetNegotiatedDimension( dimensionDependency ) );
       }
 
       break;
@@ -3938,6 +3995,49 @@ float Actor::CalculateSize( Dimension::Type dimension, const Vector2& maximumSiz
   return 0.0f;  // Default
 }
 
+float Actor::Measure( Dimension::Type dimension, float input )
+{
+  for( unsigned int i = 0; i < Dimension::DIMENSION_COUNT; ++i )
+  {
+    if( dimension & ( 1 << i ) )
+    {
+      RelayoutController* relayoutController = RelayoutController::Get();
+      RelayoutData::Measurement& measurement = mRelayoutData->measurements[ i ];
+      const ResizePolicy::Type policy = mRelayoutData->resizePolicies[ i ];
+
+      if( measurement.valid && measurement.policy == policy && Equals( measurement.input, input ) )
+      {
+        relayoutController->CountMeasurement( true );
+        return measurement.result;
+      }
+
+      float result = 0.0f;
+      if( policy == ResizePolicy::USE_NATURAL_SIZE )
+      {
+        result = GetNaturalSize( dimension );
+      }
+      else if( dimension == Dimension::WIDTH )
+      {
+        result = GetWidthForHeight( input );
+      }
+      else
+      {
+        result = GetHeightForWidth( input );
+      }
+
+      measurement.policy = policy;
+      measurement.input = input;
+      measurement.result = result;
+      measurement.valid = true;
+      relayoutController->CountMeasurement( false );
+
+      return result;
+    }
+  }
+
+  return 0.0f;  // Default
+}
+
 float Actor::ClampDimension( float size, Dimension::Type dimension )
 {
   const float minSize = GetMinimumSize( dimension );
@@ -4186,6 +4286,14 @@ void Actor::NegotiateSize( const Vector2& allocatedSize, RelayoutContainer& cont
 }
 
 void Actor::RelayoutRequest( Dimension::Type dimension )
+{
+  // The actor has changed, even if it is already waiting for a relayout
+  InvalidateMeasurements( dimension );
+
+  RelayoutRequestKeepingMeasurements( dimension );
+}
+
+void Actor::RelayoutRequestKeepingMeasurements( Dimension::Type dimension )
 {
   Internal::RelayoutController* relayoutController = Internal::RelayoutController::Get();
   if( relayoutController )
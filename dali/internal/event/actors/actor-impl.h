@@ -950,6 +950,15 @@ public:
    */
   void RelayoutRequest( Dimension::Type dimension = Dimension::ALL_DIMENSIONS );
 
+  /**
+   * @brief Request a relayout, keeping the measurements of the actor as it has not changed itself
+   *
+   * For instance when it is connected to the stage again.
+   *
+   * @param[in] dimension The dimension(s) to request the relayout on
+   */
+  void RelayoutRequestKeepingMeasurements( Dimension::Type dimension = Dimension::ALL_DIMENSIONS );
+
   /**
    * @brief Determine if this actor is dependent on it's parent for relayout
    *
@@ -967,6 +976,16 @@ public:
    */
   bool RelayoutDependentOnDimension( Dimension::Type dimension, Dimension::Type dependentDimension );
 
+  /**
+   * @brief Discard the measurements of the given dimension(s), and of the dimensions depending on them
+   *
+   * The natural size and the dimension dependencies are measured once, and reused until the actor
+   * requests a relayout or, for the measurements depending on the children, one of its children does.
+   *
+   * @param dimension The dimension(s) to discard the measurements of
+   */
+  void InvalidateMeasurements( Dimension::Type dimension = Dimension::ALL_DIMENSIONS );
+
   /**
    * Negotiate sizes for a control in all dimensions
    *
@@ -998,6 +1017,17 @@ public:
    */
   float CalculateSize( Dimension::Type dimension, const Vector2& maximumSize );
 
+  /**
+   * @brief Measure a dimension from the natural size, or from the size of the dimension it depends on
+   *
+   * The last measurement of each dimension is reused while the policy and the input are the same.
+   *
+   * @param[in] dimension The dimension to measure
+   * @param[in] input The negotiated size of the dimension this one depends on, or zero for the natural size
+   * @return Return the measured size for the dimension
+   */
+  float Measure( Dimension::Type dimension, float input );
+
   /**
    * @brief Clamp a dimension given the relayout constraints on this actor
    *
@@ -1264,6 +1294,15 @@ public:
    */
   bool RaySphereTest( const Vector4& rayOrigin, const Vector4& rayDir ) const;
 
+  /**
+   * Performs a ray-sphere test with the given pick-ray and the bounding sphere of the actor and all its descendants.
+   * When it fails, neither the actor nor any of its descendants can be hit by the ray.
+   * @param[in] rayOrigin The ray origin in the world's reference system.
+   * @param[in] rayDir The ray director vector in the world's reference system.
+   * @return True if the ray intersects the bounding sphere, or if the sub-tree is unbounded.
+   */
+  bool RaySubtreeSphereTest( const Vector4& rayOrigin, const Vector4& rayDir ) const;
+
   /**
    * Performs a ray-actor test with the given pick-ray and the actor's geometry.
    * @note The actor coordinates are relative to the top-left (0.0, 0.0, 0.5)
@@ -1478,6 +1517,29 @@ public:
    */
   void NotifyPositionAnimation( Animation& animation, float targetPosition, Property::Index property );
 
+public:
+  // For RelayoutController
+
+  /**
+   * Set the index of the actor in the list of the roots of the dirty sub trees of the relayout controller.
+   * @param[in] index The index, or INVALID_RELAYOUT_REQUEST_INDEX when the actor is not in the list.
+   */
+  void SetRelayoutRequestIndex( unsigned int index )
+  {
+    mRelayoutRequestIndex = index;
+  }
+
+  /**
+   * Retrieve the index of the actor in the list of the roots of the dirty sub trees of the relayout controller.
+   * @return The index, or INVALID_RELAYOUT_REQUEST_INDEX when the actor is not in the list.
+   */
+  unsigned int GetRelayoutRequestIndex() const
+  {
+    return mRelayoutRequestIndex;
+  }
+
+  static const unsigned int INVALID_RELAYOUT_REQUEST_INDEX = 0xFFFFFFFFu;
+
 protected:
 
   enum DerivedType
@@ -1808,6 +1870,7 @@ protected:
 
   std::string     mName;      ///< Name of the actor
   unsigned int    mId;        ///< A unique ID to identify the actor starting from 1, and 0 is reserved
+  unsigned int    mRelayoutRequestIndex; ///< The index of the actor in the relayout requests, or INVALID_RELAYOUT_REQUEST_INDEX
 
   unsigned short mDepth                            :12; ///< Cached: The depth in the hierarchy of the actor. Only 4096 levels of depth are supported
   const bool mIsRoot                               : 1; ///< Flag to identify the root actor
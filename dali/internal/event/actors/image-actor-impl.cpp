@@ -201,6 +201,9 @@ void ImageActor::SetImage( ImagePtr& image )
       RemoveRenderer( mRendererIndex );
       mRendererIndex = INVALID_RENDERER_ID;
     }
+
+    // The natural size is now zero
+    RelayoutRequest();
   }
   else
   {
@@ -46,7 +46,8 @@ ConstraintBase::ConstraintBase( Object& object, Property::Index targetPropertyIn
   mRemoveAction( Dali::Constraint::DEFAULT_REMOVE_ACTION ),
   mTag( 0 ),
   mApplied( false ),
-  mSourceDestroyed( false )
+  mSourceDestroyed( false ),
+  mSkipUnchanged( false )
 {
   ObserveObject( object );
 }
@@ -156,6 +157,21 @@ unsigned int ConstraintBase::GetTag() const
   return mTag;
 }
 
+void ConstraintBase::SetSkipUnchanged( bool skip )
+{
+  mSkipUnchanged = skip;
+
+  if( mSceneGraphConstraint )
+  {
+    SetSkipUnchangedMessage( GetEventThreadServices(), *mSceneGraphConstraint, skip );
+  }
+}
+
+bool ConstraintBase::GetSkipUnchanged() const
+{
+  return mSkipUnchanged;
+}
+
 void ConstraintBase::SceneObjectAdded( Object& object )
 {
   if ( mApplied &&
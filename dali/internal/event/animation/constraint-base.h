@@ -134,6 +134,19 @@ public:
    */
   unsigned int GetTag() const;
 
+  /**
+   * Set whether the constraint reuses its previous output when the values of its inputs and of the
+   * target property have not changed; the constraint function must then only depend on those.
+   * @param[in] skip True to skip the evaluation of unchanged constraints.
+   */
+  void SetSkipUnchanged( bool skip );
+
+  /**
+   * Query whether the evaluation of the constraint is skipped when nothing has changed.
+   * @return True if the evaluation of unchanged constraints is skipped.
+   */
+  bool GetSkipUnchanged() const;
+
 private: // Object::Observer methods
 
   /**
@@ -209,6 +222,7 @@ protected:
   unsigned int mTag;
   bool mApplied:1; ///< Whether the constraint has been applied
   bool mSourceDestroyed:1; ///< Is set to true if any of our input source objects are destroyed
+  bool mSkipUnchanged:1; ///< Whether the evaluation is skipped when the inputs have not changed
 };
 
 } // namespace Internal
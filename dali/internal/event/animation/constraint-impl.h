@@ -102,6 +102,7 @@ public:
 
     clone->SetRemoveAction(mRemoveAction);
     clone->SetTag( mTag );
+    clone->SetSkipUnchanged( mSkipUnchanged );
 
     return clone;
   }
@@ -178,6 +179,7 @@ private:
                                                                                       func );
         DALI_ASSERT_DEBUG( NULL != sceneGraphConstraint );
         sceneGraphConstraint->SetRemoveAction( mRemoveAction );
+        sceneGraphConstraint->SetSkipUnchanged( mSkipUnchanged );
 
         // object is being used in a separate thread; queue a message to apply the constraint
         ApplyConstraintMessage( GetEventThreadServices(), *targetObject, *sceneGraphConstraint );
@@ -193,6 +195,7 @@ private:
                                                                                       func );
         DALI_ASSERT_DEBUG( NULL != sceneGraphConstraint );
         sceneGraphConstraint->SetRemoveAction( mRemoveAction );
+        sceneGraphConstraint->SetSkipUnchanged( mSkipUnchanged );
 
         // object is being used in a separate thread; queue a message to apply the constraint
         ApplyConstraintMessage( GetEventThreadServices(), *targetObject, *sceneGraphConstraint );
@@ -339,6 +342,7 @@ public:
 
     clone->SetRemoveAction(mRemoveAction);
     clone->SetTag( mTag );
+    clone->SetSkipUnchanged( mSkipUnchanged );
 
     return clone;
   }
@@ -509,6 +513,7 @@ private:
 
       DALI_ASSERT_DEBUG( NULL != sceneGraphConstraint );
       sceneGraphConstraint->SetRemoveAction( mRemoveAction );
+      sceneGraphConstraint->SetSkipUnchanged( mSkipUnchanged );
 
         // object is being used in a separate thread; queue a message to apply the constraint
       ApplyConstraintMessage( GetEventThreadServices(), *targetObject, *sceneGraphConstraint );
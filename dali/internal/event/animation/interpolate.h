@@ -1,5 +1,5 @@
-#ifndef __DALI_INTERNAL_PROGRESS_VALUE_H__
-#define __DALI_INTERNAL_PROGRESS_VALUE_H__
+#ifndef __DALI_INTERNAL_INTERPOLATE_H__
+#define __DALI_INTERNAL_INTERPOLATE_H__
 
 /*
  * Copyright (c) 2014 Samsung Electronics Co., Ltd.
@@ -30,62 +30,6 @@ namespace Dali
 namespace Internal
 {
 
-/**
- * Progress / value pair for animating channels (properties) with keyframes
- */
-template <typename T>
-class ProgressValue
-{
-public:
-  ProgressValue (float progress, T value)
-  : mProgress(progress),
-    mValue (value)
-  {
-  }
-
-  ~ProgressValue ()
-  {
-  }
-
-  float GetProgress () const
-  {
-    return mProgress;
-  }
-
-  const T& GetValue () const
-  {
-    return mValue;
-  }
-
-public:
-  float mProgress;   ///< Progress this value applies to animation channel
-  T mValue;          ///< value this animation channel should take
-};
-
-typedef ProgressValue<Quaternion>                       ProgressQuaternion;
-typedef std::vector<ProgressQuaternion>                 ProgressQuaternionContainer;
-
-typedef ProgressValue<AngleAxis>                        ProgressAngleAxis;
-typedef std::vector<AngleAxis>                          ProgressAngleAxisContainer;
-
-typedef ProgressValue<bool>                             ProgressBoolean;
-typedef std::vector<ProgressBoolean>                    ProgressBooleanContainer;
-
-typedef ProgressValue<int>                              ProgressInteger;
-typedef std::vector<ProgressInteger>                    ProgressIntegerContainer;
-
-typedef ProgressValue<float>                            ProgressNumber;
-typedef std::vector<ProgressNumber>                     ProgressNumberContainer;
-
-typedef ProgressValue<Vector2>                          ProgressVector2;
-typedef std::vector<ProgressVector2>                    ProgressVector2Container;
-
-typedef ProgressValue<Vector3>                          ProgressVector3;
-typedef std::vector<ProgressVector3>                    ProgressVector3Container;
-
-typedef ProgressValue<Vector4>                          ProgressVector4;
-typedef std::vector<ProgressVector4>                    ProgressVector4Container;
-
 inline void Interpolate (Quaternion& result, const Quaternion& a, const Quaternion& b, float progress)
 {
   result = Quaternion::Slerp(a, b, progress);
@@ -216,4 +160,4 @@ inline void CubicInterpolate( AngleAxis& result, const AngleAxis& p0, const Angl
 
 } // namespace Dali
 
-#endif //__DALI_PROGRESS_VALUE_H__
+#endif // __DALI_INTERNAL_INTERPOLATE_H__
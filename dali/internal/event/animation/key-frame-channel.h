@@ -18,8 +18,11 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+
 // INTERNAL INCLUDES
-#include <dali/internal/event/animation/progress-value.h>
+#include <dali/internal/event/animation/interpolate.h>
 #include <dali/public-api/animation/animation.h>
 #include <dali/public-api/common/vector-wrapper.h>
 
@@ -36,6 +39,8 @@ public:
     Translate, Rotate, Scale,
   };
 
+  static const unsigned int INVALID_INTERVAL = 0xFFFFFFFFu; ///< The initial value of an interval hint
+
   KeyFrameChannelBase(KeyFrameChannelId channel_id)
   : mChannelId(channel_id)
   {
@@ -50,147 +55,253 @@ public:
     return mChannelId;
   }
 
-  virtual bool IsActive(float progress) = 0;
+  virtual bool IsActive(float progress) const = 0;
 
 protected:
   KeyFrameChannelId       mChannelId;
 };
 
 
+/**
+ * The key frames of a channel, with the progress values stored contiguously, apart from the values.
+ * The key frames should be added in progress order.
+ */
 template <typename V>
 class KeyFrameChannel : public KeyFrameChannelBase
 {
 public:
-  typedef std::vector<ProgressValue<V> > ProgressValues;
+  typedef std::vector<float> ProgressContainer;
+  typedef std::vector<V> ValueContainer;
 
-  KeyFrameChannel(KeyFrameChannelId channel_id, ProgressValues& values )
-  : KeyFrameChannelBase(channel_id),
-    mValues(values)
+  KeyFrameChannel(KeyFrameChannelId channel_id)
+  : KeyFrameChannelBase(channel_id)
   {
   }
 
-
   virtual ~KeyFrameChannel()
   {
   }
 
-  bool IsActive (float progress);
+  /**
+   * Add a key frame
+   * @param[in] progress The progress of the key frame
+   * @param[in] value The value at this progress
+   */
+  void AddKeyFrame(float progress, const V& value)
+  {
+    mProgress.push_back(progress);
+    mValues.push_back(value);
+  }
 
-  V GetValue(float progress, Dali::Animation::Interpolation interpolation) const;
+  /**
+   * @return The number of key frames
+   */
+  unsigned int GetNumberOfKeyFrames() const
+  {
+    return mProgress.size();
+  }
 
-  bool FindInterval(typename ProgressValues::iterator& start,
-                    typename ProgressValues::iterator& end,
-                    float progress) const;
+  /**
+   * Get a key frame
+   * @param[in] index The index of the key frame
+   * @param[out] progress The progress of the key frame
+   * @param[out] value The value of the key frame
+   */
+  void GetKeyFrame(unsigned int index, float& progress, V& value) const
+  {
+    progress = mProgress[index];
+    value = mValues[index];
+  }
 
-  ProgressValues& mValues;
+  /**
+   * @return Whether the progress has reached the first key frame
+   */
+  virtual bool IsActive (float progress) const;
+
+  /**
+   * Get the value at a given progress
+   * @param[in] progress The progress
+   * @param[in] interpolation The interpolation between the key frames
+   * @return The interpolated value
+   */
+  V GetValue(float progress, Dali::Animation::Interpolation interpolation) const;
+
+  /**
+   * Get the value at a given progress, starting the search from the interval found by the previous call
+   * As animations progress monotonically, the interval is usually the same or the next one.
+   * @param[in] progress The progress
+   * @param[in] interpolation The interpolation between the key frames
+   * @param[in,out] interval The interval found by the previous call, or KeyFrameChannelBase::INVALID_INTERVAL; updated with the interval found
+   * @return The interpolated value
+   */
+  V GetValue(float progress, Dali::Animation::Interpolation interpolation, unsigned int& interval) const;
+
+  /**
+   * Use a binary search to find the interval containing progress
+   * @param[in] progress The progress
+   * @param[out] interval The index of the key frame starting the interval
+   * @return True if an interval containing progress was found
+   */
+  bool FindInterval(float progress, unsigned int& interval) const;
+
+  /**
+   * Find the interval containing progress, checking the interval hint and the next one before searching
+   * @param[in] progress The progress
+   * @param[in,out] interval The interval hint; updated with the interval found
+   * @return True if an interval containing progress was found
+   */
+  bool FindIntervalFrom(float progress, unsigned int& interval) const;
+
+private:
+
+  /**
+   * Search the first key frame after progress, within a range of key frames
+   * @return The index of the key frame
+   */
+  unsigned int UpperBound(float progress, unsigned int first, unsigned int last) const;
+
+  /**
+   * Interpolate within an interval
+   */
+  V InterpolateInterval(float progress, unsigned int interval, Dali::Animation::Interpolation interpolation) const;
+
+private:
+  ProgressContainer mProgress; ///< The progress of each key frame, in increasing order
+  ValueContainer mValues;      ///< The value of each key frame
 };
 
 template <class V>
-bool KeyFrameChannel<V>::IsActive (float progress)
+bool KeyFrameChannel<V>::IsActive (float progress) const
 {
-  bool active = false;
-  if(!mValues.empty())
-  {
-    ProgressValue<V>& first = mValues.front();
-
-    if( progress >= first.GetProgress() )
-    {
-      active = true;
-    }
-  }
-  return active;
+  return !mProgress.empty() && ( progress >= mProgress.front() );
 }
 
-/**
- * Use a linear search to find the interval containing progress
- */
 template <class V>
-bool KeyFrameChannel<V>::FindInterval(
-  typename ProgressValues::iterator& start,
-  typename ProgressValues::iterator& end,
-  float progress) const
+unsigned int KeyFrameChannel<V>::UpperBound(float progress, unsigned int first, unsigned int last) const
 {
-  bool found = false;
-  typename std::vector<ProgressValue<V> >::iterator iter = mValues.begin();
-  typename std::vector<ProgressValue<V> >::iterator prevIter = iter;
+  return std::upper_bound( mProgress.begin() + first, mProgress.begin() + last, progress ) - mProgress.begin();
+}
 
-  while(iter != mValues.end() && iter->GetProgress() <= progress)
+template <class V>
+bool KeyFrameChannel<V>::FindInterval(float progress, unsigned int& interval) const
+{
+  const unsigned int count = mProgress.size();
+  const unsigned int next = UpperBound( progress, 0u, count );
+  if( next == 0u || next >= count )
   {
-    prevIter = iter;
-    ++iter;
+    return false;
   }
 
-  if(iter == mValues.end())
-  {
-    --prevIter;
-    --iter;
-  }
+  interval = next - 1u;
+  return true;
+}
 
-  if(prevIter->GetProgress() <= progress
-     &&
-     iter->GetProgress() > progress)
+template <class V>
+bool KeyFrameChannel<V>::FindIntervalFrom(float progress, unsigned int& interval) const
+{
+  const unsigned int count = mProgress.size();
+  if( interval < count - 1u )
   {
-    found = true;
-    start = prevIter;
-    end   = iter;
+    if( progress >= mProgress[interval] )
+    {
+      // Most frames stay within the interval, or move to the next one
+      if( progress < mProgress[interval + 1u] )
+      {
+        return true;
+      }
+      if( ( interval + 2u < count ) && ( progress < mProgress[interval + 2u] ) )
+      {
+        ++interval;
+        return true;
+      }
+
+      const unsigned int next = UpperBound( progress, interval + 1u, count );
+      if( next >= count )
+      {
+        return false;
+      }
+      interval = next - 1u;
+      return true;
+    }
+
+    // Played backwards, or looping
+    const unsigned int next = UpperBound( progress, 0u, interval + 1u );
+    if( next == 0u )
+    {
+      return false;
+    }
+    interval = next - 1u;
+    return true;
   }
 
-  return found;
+  return FindInterval( progress, interval );
 }
 
 template <class V>
-V KeyFrameChannel<V>::GetValue (float progress, Dali::Animation::Interpolation interpolation) const
+V KeyFrameChannel<V>::InterpolateInterval(float progress, unsigned int interval, Dali::Animation::Interpolation interpolation) const
 {
-  ProgressValue<V>&  firstPV =  mValues.front();
+  const unsigned int end = interval + 1u;
+  const float frameProgress = (progress - mProgress[interval]) / (mProgress[end] - mProgress[interval]);
 
-  typename std::vector<ProgressValue<V> >::iterator start;
-  typename std::vector<ProgressValue<V> >::iterator end;
-
-  V interpolatedV = firstPV.GetValue();
-  if(progress >= mValues.back().GetProgress() )
+  V interpolatedV;
+  if( interpolation == Dali::Animation::Linear )
   {
-    interpolatedV = mValues.back().GetValue(); // This should probably be last value...
+    Internal::Interpolate(interpolatedV, mValues[interval], mValues[end], frameProgress);
   }
-  else if(FindInterval(start, end, progress))
+  else
   {
-    float frameProgress = (progress - start->GetProgress()) / (end->GetProgress() - start->GetProgress());
-
-    if( interpolation == Dali::Animation::Linear )
+    //Calculate prev and next values
+    V prev;
+    if( interval > 0u )
     {
-      Interpolate(interpolatedV, start->GetValue(), end->GetValue(), frameProgress);
+      prev = mValues[interval - 1u];
     }
     else
     {
-      //Calculate prev and next values
-      V prev;
-      if( start != mValues.begin() )
-      {
-        prev = (start-1)->GetValue();
-      }
-      else
-      {
-        //Project next value through start point
-        prev = start->GetValue() + (start->GetValue()-(start+1)->GetValue());
-      }
-
-      V next;
-      if( end != mValues.end()-1)
-      {
-        next = (end+1)->GetValue();
-      }
-      else
-      {
-        //Project prev value through end point
-        next = end->GetValue() + (end->GetValue()-(end-1)->GetValue());
-      }
+      //Project next value through start point
+      prev = mValues[interval] + (mValues[interval]-mValues[end]);
+    }
 
-      CubicInterpolate(interpolatedV, prev, start->GetValue(), end->GetValue(), next, frameProgress);
+    V next;
+    if( end < mValues.size() - 1u )
+    {
+      next = mValues[end + 1u];
     }
+    else
+    {
+      //Project prev value through end point
+      next = mValues[end] + (mValues[end]-mValues[interval]);
+    }
+
+    CubicInterpolate(interpolatedV, prev, mValues[interval], mValues[end], next, frameProgress);
   }
 
   return interpolatedV;
 }
 
+template <class V>
+V KeyFrameChannel<V>::GetValue (float progress, Dali::Animation::Interpolation interpolation) const
+{
+  unsigned int interval = INVALID_INTERVAL;
+  return GetValue( progress, interpolation, interval );
+}
+
+template <class V>
+V KeyFrameChannel<V>::GetValue (float progress, Dali::Animation::Interpolation interpolation, unsigned int& interval) const
+{
+  if(progress >= mProgress.back() )
+  {
+    return mValues.back(); // This should probably be last value...
+  }
+
+  if( FindIntervalFrom( progress, interval ) )
+  {
+    return InterpolateInterval( progress, interval, interpolation );
+  }
+
+  return mValues.front();
+}
+
 typedef KeyFrameChannel<float>      KeyFrameChannelNumber;
 typedef KeyFrameChannel<Vector2>    KeyFrameChannelVector2;
 typedef KeyFrameChannel<Vector3>    KeyFrameChannelVector3;
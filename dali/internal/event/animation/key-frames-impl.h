@@ -23,7 +23,7 @@
 #include <dali/public-api/animation/key-frames.h>
 #include <dali/public-api/object/base-object.h>
 #include <dali/public-api/animation/alpha-function.h>
-#include <dali/internal/event/animation/progress-value.h>
+#include <dali/internal/event/animation/interpolate.h>
 #include <dali/internal/event/animation/key-frame-channel.h>
 
 namespace Dali
@@ -126,19 +126,14 @@ protected:
 
 
 /**
- * The base template class for each key frame specialization. It stores a vector of
- * ProgressValue pairs in mPVs, and uses the existing interface for KeyFrameChannel
- * to point at this vector.
+ * The base template class for each key frame specialization. It stores the key frames
+ * in a KeyFrameChannel, which also interpolates between them.
  */
 template<typename V>
 class KeyFrameBaseSpec : public KeyFrameSpec
 {
 private:
-  typedef ProgressValue<V> PV;
-  typedef std::vector<PV> PVContainer;
-
-  PVContainer                    mPVs;       // The ProgressValue pairs
-  KeyFrameChannel<V>*            mKeyFrames; // The key frame interpolator
+  KeyFrameChannel<V>             mKeyFrames; // The key frames and their interpolator
 
 public:
   static KeyFrameBaseSpec<V>* New()
@@ -155,8 +150,8 @@ public:
    * Constructor
    */
   KeyFrameBaseSpec<V>()
+  : mKeyFrames(KeyFrameChannelBase::Translate)
   {
-    mKeyFrames = new KeyFrameChannel<V>(KeyFrameChannelBase::Translate, mPVs);
   }
 
 protected:
@@ -165,52 +160,46 @@ protected:
    * Allow cloning of this object
    */
   KeyFrameBaseSpec<V>(const KeyFrameBaseSpec<V>& keyFrames)
-  : mPVs(keyFrames.mPVs)
+  : mKeyFrames(keyFrames.mKeyFrames)
   {
-    mKeyFrames = new KeyFrameChannel<V>(KeyFrameChannelBase::Translate, mPVs);
   }
 
   KeyFrameBaseSpec<V>& operator=( const KeyFrameBaseSpec<V>& keyFrames )
   {
-    if( *this != keyFrames )
+    if( this != &keyFrames )
     {
-      mPVs.clear();
-      mPVs = keyFrames.mPVs;
-      delete mKeyFrames;
-      mKeyFrames = new KeyFrameChannel<V>(KeyFrameChannelBase::Translate, mPVs);
+      mKeyFrames = keyFrames.mKeyFrames;
     }
     return *this;
   }
 
   /**
-   * Destructor. Ensure progress value pairs are cleared down
+   * Destructor
    */
   virtual ~KeyFrameBaseSpec<V>()
   {
-    delete mKeyFrames;
-    mPVs.clear();
   }
 
 public:
   /**
-   * Add a key frame to the progress value vector. Key frames should be added
-   * in time order (this method does not sort the vector by time)
+   * Add a key frame. Key frames should be added
+   * in time order (this method does not sort the key frames by time)
    * @param[in] t - progress
    * @param[in] v - value
    * @param[in] alpha - Alpha function for blending to the next keyframe
    */
   void AddKeyFrame(float t, V v, AlphaFunction alpha)
   {
-    mPVs.push_back(PV(t, v));
+    mKeyFrames.AddKeyFrame(t, v);
   }
 
   /**
    * Get the number of key frames
-   * @return The size of the progress value vector
+   * @return The number of key frames
    */
   virtual unsigned int GetNumberOfKeyFrames() const
   {
-    return mPVs.size();
+    return mKeyFrames.GetNumberOfKeyFrames();
   }
 
   /**
@@ -221,9 +210,8 @@ public:
    */
   virtual void GetKeyFrame(unsigned int index, float& time, V& value) const
   {
-    DALI_ASSERT_ALWAYS( index < mPVs.size() && "KeyFrame index is out of bounds" );
-    time  = mPVs[index].mProgress;
-    value = mPVs[index].mValue;
+    DALI_ASSERT_ALWAYS( index < mKeyFrames.GetNumberOfKeyFrames() && "KeyFrame index is out of bounds" );
+    mKeyFrames.GetKeyFrame(index, time, value);
   }
 
   /**
@@ -234,7 +222,7 @@ public:
    */
   bool IsActive(float progress) const
   {
-    return mKeyFrames->IsActive(progress);
+    return mKeyFrames.IsActive(progress);
   }
 
   /**
@@ -244,7 +232,19 @@ public:
    */
   V GetValue(float progress, Dali::Animation::Interpolation interpolation) const
   {
-    return mKeyFrames->GetValue(progress, interpolation);
+    return mKeyFrames.GetValue(progress, interpolation);
+  }
+
+  /**
+   * Return an interpolated value for the given progress, starting the search from the interval of the previous call.
+   * @param[in] progress The progress to test
+   * @param[in] interpolation The interpolation between the key frames
+   * @param[in,out] interval The interval found by the previous call, or KeyFrameChannelBase::INVALID_INTERVAL
+   * @return The interpolated value
+   */
+  V GetValue(float progress, Dali::Animation::Interpolation interpolation, unsigned int& interval) const
+  {
+    return mKeyFrames.GetValue(progress, interpolation, interval);
   }
 };
 
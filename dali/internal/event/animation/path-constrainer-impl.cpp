@@ -41,6 +41,7 @@ DALI_PROPERTY_TABLE_BEGIN
 DALI_PROPERTY( "forward",       VECTOR3,   true,    false,       false,        Dali::PathConstrainer::Property::FORWARD )
 DALI_PROPERTY( "points",         ARRAY,    true,    false,       false,        Dali::PathConstrainer::Property::POINTS )
 DALI_PROPERTY( "controlPoints",  ARRAY,    true,    false,       false,        Dali::PathConstrainer::Property::CONTROL_POINTS )
+DALI_PROPERTY( "constantSpeed",  BOOLEAN,  true,    false,       false,        Dali::PathConstrainer::Property::CONSTANT_SPEED )
 DALI_PROPERTY_TABLE_END( DEFAULT_OBJECT_PROPERTY_START_INDEX )
 
 } //Unnamed namespace
@@ -156,6 +157,10 @@ Property::Value PathConstrainer::GetDefaultProperty( Property::Index index ) con
       }
       return value;
     }
+    else if( index == Dali::PathConstrainer::Property::CONSTANT_SPEED )
+    {
+      return Property::Value( mPath->GetConstantSpeed() );
+    }
   }
 
   return Property::Value();
@@ -195,6 +200,14 @@ void PathConstrainer::SetDefaultProperty( Property::Index index, const Property:
       }
     }
   }
+  else if( index == Dali::PathConstrainer::Property::CONSTANT_SPEED )
+  {
+    bool constantSpeed( false );
+    if( propertyValue.Get( constantSpeed ) )
+    {
+      mPath->SetConstantSpeed( constantSpeed );
+    }
+  }
 }
 
 bool PathConstrainer::IsDefaultPropertyWritable(Property::Index index) const
@@ -229,11 +242,14 @@ bool PathConstrainer::IsDefaultPropertyAConstraintInput( Property::Index index )
 
 void PathConstrainer::Apply( Property target, Property source, const Vector2& range, const Vector2& wrap)
 {
+  // The constraints sample a copy of the path in the update thread
+  PathPtr path = Path::Clone( *mPath );
+
   Dali::Property::Type propertyType = target.object.GetPropertyType( target.propertyIndex);
   if( propertyType == Dali::Property::VECTOR3)
   {
     // If property type is Vector3, constrain its value to the position of the path
-    Dali::Constraint constraint = Dali::Constraint::New<Vector3>( target.object, target.propertyIndex, PathConstraintFunctor( mPath, range, wrap ) );
+    Dali::Constraint constraint = Dali::Constraint::New<Vector3>( target.object, target.propertyIndex, PathConstraintFunctor( path, range, wrap ) );
     constraint.AddSource( Dali::Source(source.object, source.propertyIndex ) );
 
     constraint.SetTag( reinterpret_cast<size_t>( this ) );
@@ -243,7 +259,7 @@ void PathConstrainer::Apply( Property target, Property source, const Vector2& ra
   else if( propertyType == Dali::Property::ROTATION )
   {
     // If property type is Rotation, constrain its value to align the forward vector to the tangent of the path
-    Dali::Constraint constraint = Dali::Constraint::New<Quaternion>( target.object, target.propertyIndex, PathConstraintFunctor( mPath, range, mForward, wrap) );
+    Dali::Constraint constraint = Dali::Constraint::New<Quaternion>( target.object, target.propertyIndex, PathConstraintFunctor( path, range, mForward, wrap) );
     constraint.AddSource( Dali::Source(source.object, source.propertyIndex ) );
 
     constraint.SetTag( reinterpret_cast<size_t>( this ) );
@@ -79,8 +79,10 @@ struct PathConstraintFunctor
 
     float t = ( inputWrapped - mRange.x ) / ( mRange.y-mRange.x );
 
-    Vector3 tangent;
-    mPath->Sample( t, position, tangent );
+    if( !mPath->SamplePosition( t, position ) )
+    {
+      DALI_ASSERT_ALWAYS(!"Spline not fully initialized" );
+    }
   }
 
   /**
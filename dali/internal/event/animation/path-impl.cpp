@@ -19,6 +19,7 @@
 #include <dali/internal/event/animation/path-impl.h>
 
 // EXTERNAL INCLUDES
+#include <algorithm> // for std::upper_bound
 #include <cstring> // for strcmp
 
 // INTERNAL INCLUDES
@@ -44,9 +45,6 @@ DALI_PROPERTY( "controlPoints",  ARRAY, true, false, false,   Dali::Path::Proper
 DALI_PROPERTY_TABLE_END( DEFAULT_OBJECT_PROPERTY_START_INDEX )
 
 /**
- * These coefficient arise from the cubic polynomial equations for
- * a bezier curve.
- *
  * A bezier curve is defined by a cubic polynomial. Given two end points p0 and p1
  * and two control points cp0 and cp1, the bezier curve will be defined by a polynomial in the form
  * f(x) = a3*x^3 + a2*x^2 + a1*x + a0 with this restrictions:
@@ -54,13 +52,16 @@ DALI_PROPERTY_TABLE_END( DEFAULT_OBJECT_PROPERTY_START_INDEX )
  * f(1) = p1
  * f'(0) = 3*(cp0 - p0)
  * f'(1) = 3*(p1-cp1)
+ *
+ * which gives:
+ * a3 = -p0 + 3*cp0 - 3*cp1 + p1
+ * a2 = 3*p0 - 6*cp0 + 3*cp1
+ * a1 = -3*p0 + 3*cp0
+ * a0 = p0
  */
-const float BezierBasisCoeff[] = {  -1.0f,  3.0f, -3.0f, 1.0f,
-                                     3.0f, -6.0f,  3.0f, 0.0f,
-                                    -3.0f,  3.0f,  0.0f, 0.0f,
-                                     1.0f,  0.0f,  0.0f, 0.0f  };
-
-const Dali::Matrix BezierBasis = Dali::Matrix( BezierBasisCoeff );
+const unsigned int COEFFICIENT_COUNT = 4u;      ///< The coefficients a3, a2, a1, a0 of each coordinate of a segment
+const unsigned int ARC_LENGTH_SAMPLES = 32u;    ///< The number of samples of the length along each segment
+const float MAX_ARC_LENGTH_SLOPE = 3.0f;        ///< The interpolation of the progress between two samples of the length is monotonic below this slope
 
 Dali::BaseHandle Create()
 {
@@ -82,7 +83,10 @@ Path* Path::New()
 }
 
 Path::Path()
-: Object()
+: Object(),
+  mSegmentCount( 0u ),
+  mSamplingDirty( true ),
+  mConstantSpeed( false )
 {
 }
 
@@ -95,6 +99,10 @@ Path* Path::Clone(const Path& path)
   Path* clone = new Path();
   clone->SetPoints( path.GetPoints() );
   clone->SetControlPoints( path.GetControlPoints() );
+  clone->SetConstantSpeed( path.GetConstantSpeed() );
+
+  // The clone is sampled in the update thread
+  clone->PrepareSampling();
 
   return clone;
 }
@@ -217,6 +225,7 @@ void Path::SetDefaultProperty(Property::Index index, const Property::Value& prop
         mControlPoint.PushBack( point );
       }
     }
+    mSamplingDirty = true;
   }
 }
 
@@ -253,11 +262,13 @@ bool Path::IsDefaultPropertyAConstraintInput( Property::Index index ) const
 void Path::AddPoint(const Vector3& point )
 {
   mPoint.PushBack( point );
+  mSamplingDirty = true;
 }
 
 void Path::AddControlPoint(const Vector3& point )
 {
   mControlPoint.PushBack( point );
+  mSamplingDirty = true;
 }
 
 unsigned int Path::GetNumberOfSegments() const
@@ -271,6 +282,7 @@ void Path::GenerateControlPoints( float curvature )
   DALI_ASSERT_ALWAYS( numSegments > 0 && "Need at least 1 segment to generate control points" ); // need at least 1 segment
 
   mControlPoint.Resize( numSegments * 2);
+  mSamplingDirty = true;
 
   //Generate two control points for each segment
   for( unsigned int i(0); i<numSegments; ++i )
@@ -348,6 +360,152 @@ void Path::FindSegmentAndProgress( float t, unsigned int& segment, float& tLocal
   }
 }
 
+void Path::MapProgress( float t, unsigned int& segment, float& tLocal ) const
+{
+  const unsigned int sampleCount = mArcLength.Count();
+  if( !mConstantSpeed || sampleCount < 2u || !( mArcLength[sampleCount - 1u] > 0.0f ) )
+  {
+    FindSegmentAndProgress( t, segment, tLocal );
+  }
+  else if( t <= 0.0f )
+  {
+    segment = 0;
+    tLocal = 0.0f;
+  }
+  else if( t >= 1.0f )
+  {
+    segment = mSegmentCount - 1u;
+    tLocal = 1.0f;
+  }
+  else
+  {
+    // Find the samples around the length along the path, and interpolate the local progress between them
+    const float length = t * mArcLength[sampleCount - 1u];
+    const float* begin = mArcLength.Begin();
+    unsigned int sample = std::upper_bound( begin, begin + sampleCount, length ) - begin - 1u;
+    if( sample > sampleCount - 2u )
+    {
+      sample = sampleCount - 2u;
+    }
+
+    // Interpolate the local progress as a cubic hermite function of the length, given its slopes at both samples
+    const float sampleLength = mArcLength[sample + 1u] - mArcLength[sample];
+    const float s = ( sampleLength > 0.0f ) ? ( length - mArcLength[sample] ) / sampleLength : 0.0f;
+    const float slope0 = mArcLengthSlope[2u * sample];
+    const float slope1 = mArcLengthSlope[2u * sample + 1u];
+    const float fraction = ( ( ( slope0 + slope1 - 2.0f ) * s + ( 3.0f - 2.0f * slope0 - slope1 ) ) * s + slope0 ) * s;
+
+    segment = sample / ARC_LENGTH_SAMPLES;
+    tLocal = ( static_cast<float>( sample % ARC_LENGTH_SAMPLES ) + fraction ) / ARC_LENGTH_SAMPLES;
+  }
+}
+
+Vector3 Path::EvaluatePosition( unsigned int segment, float tLocal ) const
+{
+  const float* x = mCoefficients.Begin() + segment;
+  const float* y = x + COEFFICIENT_COUNT * mSegmentCount;
+  const float* z = y + COEFFICIENT_COUNT * mSegmentCount;
+  const unsigned int stride = mSegmentCount;
+
+  return Vector3( ( ( x[0] * tLocal + x[stride] ) * tLocal + x[2 * stride] ) * tLocal + x[3 * stride],
+                  ( ( y[0] * tLocal + y[stride] ) * tLocal + y[2 * stride] ) * tLocal + y[3 * stride],
+                  ( ( z[0] * tLocal + z[stride] ) * tLocal + z[2 * stride] ) * tLocal + z[3 * stride] );
+}
+
+Vector3 Path::EvaluateDerivative( unsigned int segment, float tLocal ) const
+{
+  const float* x = mCoefficients.Begin() + segment;
+  const float* y = x + COEFFICIENT_COUNT * mSegmentCount;
+  const float* z = y + COEFFICIENT_COUNT * mSegmentCount;
+  const unsigned int stride = mSegmentCount;
+
+  return Vector3( ( 3.0f * x[0] * tLocal + 2.0f * x[stride] ) * tLocal + x[2 * stride],
+                  ( 3.0f * y[0] * tLocal + 2.0f * y[stride] ) * tLocal + y[2 * stride],
+                  ( 3.0f * z[0] * tLocal + 2.0f * z[stride] ) * tLocal + z[2 * stride] );
+}
+
+void Path::PrepareSampling() const
+{
+  if( !mSamplingDirty )
+  {
+    return;
+  }
+  mSamplingDirty = false;
+
+  mCoefficients.Clear();
+  mArcLength.Clear();
+  mArcLengthSlope.Clear();
+  mSegmentCount = 0u;
+
+  if( !PathIsComplete( mPoint, mControlPoint ) )
+  {
+    return;
+  }
+
+  // The coefficients of the polynomials, stored by coordinate then by power, for all the segments
+  const unsigned int segmentCount = GetNumberOfSegments();
+  mSegmentCount = segmentCount;
+  mCoefficients.Resize( 3u * COEFFICIENT_COUNT * segmentCount );
+  for( unsigned int segment = 0; segment < segmentCount; ++segment )
+  {
+    const Vector3& point0 = mPoint[segment];
+    const Vector3& controlPoint0 = mControlPoint[2 * segment];
+    const Vector3& controlPoint1 = mControlPoint[2 * segment + 1];
+    const Vector3& point1 = mPoint[segment + 1];
+
+    for( unsigned int axis = 0; axis < 3u; ++axis )
+    {
+      float* coefficients = mCoefficients.Begin() + axis * COEFFICIENT_COUNT * segmentCount + segment;
+      coefficients[0] = -point0[axis] + 3.0f * controlPoint0[axis] - 3.0f * controlPoint1[axis] + point1[axis];
+      coefficients[segmentCount] = 3.0f * point0[axis] - 6.0f * controlPoint0[axis] + 3.0f * controlPoint1[axis];
+      coefficients[2 * segmentCount] = -3.0f * point0[axis] + 3.0f * controlPoint0[axis];
+      coefficients[3 * segmentCount] = point0[axis];
+    }
+  }
+
+  // The length along the path at regular steps of each segment, measured along the chords between the steps,
+  // and the slopes of the local progress as a function of the length at both ends of each step
+  const unsigned int sampleCount = segmentCount * ARC_LENGTH_SAMPLES + 1u;
+  mArcLength.Resize( sampleCount );
+  mArcLengthSlope.Resize( 2u * ( sampleCount - 1u ) );
+  mArcLength[0] = 0.0f;
+
+  Vector3 previous = mPoint[0];
+  for( unsigned int sample = 1u; sample < sampleCount; ++sample )
+  {
+    const unsigned int segment = ( sample - 1u ) / ARC_LENGTH_SAMPLES;
+    const float tStart = static_cast<float>( sample - 1u - segment * ARC_LENGTH_SAMPLES ) / ARC_LENGTH_SAMPLES;
+    const float tEnd = tStart + 1.0f / ARC_LENGTH_SAMPLES;
+    const Vector3 position = EvaluatePosition( segment, tEnd );
+    const float stepLength = ( position - previous ).Length();
+    mArcLength[sample] = mArcLength[sample - 1u] + stepLength;
+    previous = position;
+
+    // The slopes are relative to the step, i.e. 1 where the speed is the average speed of the step
+    float* slope = mArcLengthSlope.Begin() + 2u * ( sample - 1u );
+    const float speedStart = EvaluateDerivative( segment, tStart ).Length();
+    const float speedEnd = EvaluateDerivative( segment, tEnd ).Length();
+    slope[0] = ( speedStart > Math::MACHINE_EPSILON_1 ) ? stepLength * ARC_LENGTH_SAMPLES / speedStart : 1.0f;
+    slope[1] = ( speedEnd > Math::MACHINE_EPSILON_1 ) ? stepLength * ARC_LENGTH_SAMPLES / speedEnd : 1.0f;
+
+    // Limit the slopes so the interpolation stays monotonic
+    slope[0] = std::min( slope[0], MAX_ARC_LENGTH_SLOPE );
+    slope[1] = std::min( slope[1], MAX_ARC_LENGTH_SLOPE );
+  }
+}
+
+void Path::SetConstantSpeed( bool constantSpeed )
+{
+  mConstantSpeed = constantSpeed;
+}
+
+float Path::GetLength() const
+{
+  PrepareSampling();
+
+  return mArcLength.Count() ? mArcLength[mArcLength.Count() - 1u] : 0.0f;
+}
+
 void Path::Sample( float t, Vector3& position, Vector3& tangent ) const
 {
   if( !SampleAt(t, position, tangent) )
@@ -360,65 +518,30 @@ bool Path::SampleAt( float t, Vector3& position, Vector3& tangent ) const
 {
   bool done = false;
 
-  if( PathIsComplete(mPoint, mControlPoint) )
+  PrepareSampling();
+  if( mSegmentCount > 0u )
   {
     unsigned int segment;
     float tLocal;
-    FindSegmentAndProgress( t, segment, tLocal );
-
-    //Get points and control points in the segment
-    const Vector3& controlPoint0 = mControlPoint[2*segment];
-    const Vector3& controlPoint1 = mControlPoint[2*segment+1];
-    const Vector3& point0 = mPoint[segment];
-    const Vector3& point1 = mPoint[segment+1];
+    MapProgress( t, segment, tLocal );
 
     if(tLocal < Math::MACHINE_EPSILON_1)
     {
-      position = point0;
-      tangent = ( controlPoint0 - point0 ) * 3.0f;
-      tangent.Normalize();
+      position = mPoint[segment];
+      tangent = ( mControlPoint[2*segment] - mPoint[segment] ) * 3.0f;
     }
-    else if( (1.0 - tLocal) < Math::MACHINE_EPSILON_1)
+    else if( (1.0f - tLocal) < Math::MACHINE_EPSILON_1)
     {
-      position = point1;
-      tangent = ( point1 - controlPoint1 ) * 3.0f;
-      tangent.Normalize();
+      position = mPoint[segment+1];
+      tangent = ( mPoint[segment+1] - mControlPoint[2*segment+1] ) * 3.0f;
     }
     else
     {
-      const Vector4 sVect(tLocal*tLocal*tLocal, tLocal*tLocal, tLocal, 1.0f );
-      const Vector3 sVectDerivative(3.0f*tLocal*tLocal, 2.0f*tLocal, 1.0f );
-
-      //X
-      Vector4  cVect( point0.x, controlPoint0.x, controlPoint1.x,  point1.x);
-
-      Vector4 A = BezierBasis * cVect;
-      position.x = sVect.Dot4(A);
-      tangent.x  = sVectDerivative.Dot(Vector3(A));
-
-      //Y
-      cVect.x  = point0.y;
-      cVect.y  = controlPoint0.y;
-      cVect.z  = controlPoint1.y;
-      cVect.w  = point1.y;
-
-      A = BezierBasis * cVect;
-      position.y = sVect.Dot4(A);
-      tangent.y  = sVectDerivative.Dot(Vector3(A));
-
-      //Z
-      cVect.x  = point0.z;
-      cVect.y  = controlPoint0.z;
-      cVect.z  = controlPoint1.z;
-      cVect.w  = point1.z;
-
-      A = BezierBasis * cVect;
-      position.z = sVect.Dot4(A);
-      tangent.z  = sVectDerivative.Dot(Vector3(A));
-
-      tangent.Normalize();
+      position = EvaluatePosition( segment, tLocal );
+      tangent = EvaluateDerivative( segment, tLocal );
     }
 
+    tangent.Normalize();
     done = true;
   }
 
@@ -429,46 +552,24 @@ bool Path::SamplePosition( float t, Vector3& position ) const
 {
   bool done = false;
 
-  if( PathIsComplete(mPoint, mControlPoint) )
+  PrepareSampling();
+  if( mSegmentCount > 0u )
   {
     unsigned int segment;
     float tLocal;
-    FindSegmentAndProgress( t, segment, tLocal );
-
-    const Vector3& controlPoint0 = mControlPoint[2*segment];
-    const Vector3& controlPoint1 = mControlPoint[2*segment+1];
-    const Vector3& point0 = mPoint[segment];
-    const Vector3& point1 = mPoint[segment+1];
+    MapProgress( t, segment, tLocal );
 
     if(tLocal < Math::MACHINE_EPSILON_1)
     {
-      position = point0;
+      position = mPoint[segment];
     }
-    else if( (1.0 - tLocal) < Math::MACHINE_EPSILON_1)
+    else if( (1.0f - tLocal) < Math::MACHINE_EPSILON_1)
     {
-      position = point1;
+      position = mPoint[segment+1];
     }
     else
     {
-      const Vector4 sVect(tLocal*tLocal*tLocal, tLocal*tLocal, tLocal, 1.0f );
-
-      //X
-      Vector4  cVect( point0.x, controlPoint0.x, controlPoint1.x,  point1.x);
-      position.x = sVect.Dot4(BezierBasis * cVect);
-
-      //Y
-      cVect.x  = point0.y;
-      cVect.y  = controlPoint0.y;
-      cVect.z  = controlPoint1.y;
-      cVect.w  = point1.y;
-      position.y = sVect.Dot4(BezierBasis * cVect);
-
-      //Z
-      cVect.x  = point0.z;
-      cVect.y  = controlPoint0.z;
-      cVect.z  = controlPoint1.z;
-      cVect.w  = point1.z;
-      position.z = sVect.Dot4(BezierBasis * cVect);
+      position = EvaluatePosition( segment, tLocal );
     }
 
     done = true;
@@ -481,46 +582,24 @@ bool Path::SampleTangent( float t, Vector3& tangent ) const
 {
   bool done = false;
 
-  if( PathIsComplete(mPoint, mControlPoint) )
+  PrepareSampling();
+  if( mSegmentCount > 0u )
   {
     unsigned int segment;
     float tLocal;
-    FindSegmentAndProgress( t, segment, tLocal );
-
-    const Vector3& controlPoint0 = mControlPoint[2*segment];
-    const Vector3& controlPoint1 = mControlPoint[2*segment+1];
-    const Vector3& point0 = mPoint[segment];
-    const Vector3& point1 = mPoint[segment+1];
+    MapProgress( t, segment, tLocal );
 
     if(tLocal < Math::MACHINE_EPSILON_1)
     {
-      tangent = ( controlPoint0 - point0 ) * 3.0f;
+      tangent = ( mControlPoint[2*segment] - mPoint[segment] ) * 3.0f;
     }
     else if( (1.0f - tLocal) < Math::MACHINE_EPSILON_1)
     {
-      tangent = ( point1 - controlPoint1 ) * 3.0f;
+      tangent = ( mPoint[segment+1] - mControlPoint[2*segment+1] ) * 3.0f;
     }
     else
     {
-      const Vector3 sVectDerivative(3.0f*tLocal*tLocal, 2.0f*tLocal, 1.0f );
-
-      //X
-      Vector4  cVect( point0.x, controlPoint0.x, controlPoint1.x,  point1.x);
-      tangent.x  = sVectDerivative.Dot(Vector3(BezierBasis * cVect));
-
-      //Y
-      cVect.x  = point0.y;
-      cVect.y  = controlPoint0.y;
-      cVect.z  = controlPoint1.y;
-      cVect.w  = point1.y;
-      tangent.y  = sVectDerivative.Dot(Vector3(BezierBasis * cVect));
-
-      //Z
-      cVect.x  = point0.z;
-      cVect.y  = controlPoint0.z;
-      cVect.z  = controlPoint1.z;
-      cVect.w  = point1.z;
-      tangent.z  = sVectDerivative.Dot(Vector3(BezierBasis * cVect));
+      tangent = EvaluateDerivative( segment, tLocal );
     }
 
     tangent.Normalize();
@@ -534,6 +613,9 @@ Vector3& Path::GetPoint( size_t index )
 {
   DALI_ASSERT_ALWAYS( index < mPoint.Size() && "Path: Point index out of bounds" );
 
+  // The point may be written through the reference
+  mSamplingDirty = true;
+
   return mPoint[index];
 }
 
@@ -541,6 +623,8 @@ Vector3& Path::GetControlPoint( size_t index )
 {
   DALI_ASSERT_ALWAYS( index < mControlPoint.Size() && "Path: Control Point index out of bounds" );
 
+  mSamplingDirty = true;
+
   return mControlPoint[index];
 }
 
@@ -552,11 +636,13 @@ size_t Path::GetPointCount() const
 void Path::ClearPoints()
 {
   mPoint.Clear();
+  mSamplingDirty = true;
 }
 
 void Path::ClearControlPoints()
 {
   mControlPoint.Clear();
+  mSamplingDirty = true;
 }
 
 } // Internal
@@ -192,6 +192,38 @@ public:
    */
   bool SampleTangent( float t, Vector3& tangent ) const;
 
+  /**
+   * @brief Set whether the progress is mapped to the length along the path.
+   *
+   * When enabled, equal increments of progress move along equal lengths of the path, whatever
+   * the length of the segments and the spacing of their control points. Otherwise each segment
+   * takes the same share of the progress. Disabled by default.
+   * @param[in] constantSpeed True to map the progress to the length along the path.
+   */
+  void SetConstantSpeed( bool constantSpeed );
+
+  /**
+   * @brief Query whether the progress is mapped to the length along the path.
+   * @return True if the progress is mapped to the length along the path.
+   */
+  bool GetConstantSpeed() const
+  {
+    return mConstantSpeed;
+  }
+
+  /**
+   * @brief Retrieve the length of the path, as measured in the arc-length table.
+   * @return The length of the path, or zero if the path is not complete.
+   */
+  float GetLength() const;
+
+  /**
+   * @brief Compute the coefficients of the segments, and the arc-length table, if the points have changed.
+   *
+   * This is done before the first sample otherwise; it must be done before a path is read from the update thread.
+   */
+  void PrepareSampling() const;
+
   /**
    * @copydoc Dali::Path::GetPoint
    */
@@ -229,7 +261,7 @@ public:
    *
    * @param[in] p New value for mPoint property
    */
-  void SetPoints( const Dali::Vector<Vector3>& p ){ mPoint = p; }
+  void SetPoints( const Dali::Vector<Vector3>& p ){ mPoint = p; mSamplingDirty = true; }
 
   /**
    * @brief Get mCotrolPoint property
@@ -243,7 +275,7 @@ public:
    *
    * @param[in] p New value for mControlPoint property
    */
-  void SetControlPoints( const Dali::Vector<Vector3>& p ){ mControlPoint = p; }
+  void SetControlPoints( const Dali::Vector<Vector3>& p ){ mControlPoint = p; mSamplingDirty = true; }
 
 private:
 
@@ -273,8 +305,41 @@ private:
    */
   unsigned int GetNumberOfSegments() const;
 
+  /**
+   * Helper function to calculate the segment and local progress in that segment given a progress,
+   * using the arc-length table if the speed is constant.
+   *
+   * @param[in] t Progress
+   * @param[out] segment Segment for t
+   * @param[out] tLocal Local progress in the segment
+   */
+  void MapProgress( float t, unsigned int& segment, float& tLocal ) const;
+
+  /**
+   * Evaluate the position of a segment from its coefficients
+   * @param[in] segment The segment
+   * @param[in] tLocal The local progress in the segment
+   * @return The position
+   */
+  Vector3 EvaluatePosition( unsigned int segment, float tLocal ) const;
+
+  /**
+   * Evaluate the derivative of a segment from its coefficients
+   * @param[in] segment The segment
+   * @param[in] tLocal The local progress in the segment
+   * @return The derivative, not normalized
+   */
+  Vector3 EvaluateDerivative( unsigned int segment, float tLocal ) const;
+
   Dali::Vector<Vector3> mPoint;            ///< Interpolation points
   Dali::Vector<Vector3> mControlPoint;     ///< Control points
+
+  mutable Dali::Vector<float> mCoefficients;   ///< The polynomial coefficients of the segments; for each coordinate and power, the values of all segments are contiguous
+  mutable Dali::Vector<float> mArcLength;      ///< The length along the path at ARC_LENGTH_SAMPLES regular steps of each segment, plus the total length
+  mutable Dali::Vector<float> mArcLengthSlope; ///< The slopes of the local progress as a function of the length, at the start and end of each step
+  mutable unsigned int mSegmentCount;          ///< The number of segments of the coefficients
+  mutable bool mSamplingDirty:1;               ///< Whether the points have changed since the coefficients were computed
+  bool mConstantSpeed:1;                       ///< Whether the progress is mapped to the length along the path
 };
 
 } // Internal
@@ -18,6 +18,9 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <cstring>
+
 // INTERNAL INCLUDES
 #include <dali/public-api/animation/constraint.h>
 #include <dali/public-api/common/dali-vector.h>
@@ -171,6 +174,46 @@ public:
     return false;
   }
 
+  /**
+   * Query whether the value of any input differs from the previous call; the values are compared bitwise.
+   * Unlike InputsChanged(), this does not depend on the dirty flags, which some inputs never clear.
+   * @param [in] bufferIndex The current update buffer index.
+   * @return True if any of the input values has changed, or if this is the first call.
+   */
+  bool InputValuesChanged( BufferIndex bufferIndex )
+  {
+    bool changed( mInputValues.Empty() );
+    std::size_t offset( 0u );
+
+    const InputContainerConstIter endIter = mInputs.end();
+    for ( InputContainerConstIter iter = mInputs.begin(); iter != endIter; ++iter )
+    {
+      const void* value( NULL );
+      std::size_t size( 0u );
+      if ( !GetInputValue( *iter, bufferIndex, value, size ) )
+      {
+        // The type can't be compared, assume it changes every frame
+        changed = true;
+        continue;
+      }
+
+      if ( offset + size > mInputValues.Count() )
+      {
+        mInputValues.Resize( offset + size );
+        changed = true;
+      }
+
+      if ( changed || ( 0 != memcmp( &mInputValues[ offset ], value, size ) ) )
+      {
+        memcpy( &mInputValues[ offset ], value, size );
+        changed = true;
+      }
+      offset += size;
+    }
+
+    return changed;
+  }
+
   /**
    * Apply the constraint.
    * @param [in] bufferIndex The current update buffer index.
@@ -199,6 +242,80 @@ public:
 
 private:
 
+  /**
+   * Retrieve the value of an input, as bytes.
+   * @param [in] input The input.
+   * @param [in] bufferIndex The current update buffer index.
+   * @param [out] value The address of the value.
+   * @param [out] size The size of the value.
+   * @return False if the type of the input is not supported.
+   */
+  static bool GetInputValue( const PropertyInputAccessor& input, BufferIndex bufferIndex, const void*& value, std::size_t& size )
+  {
+    switch ( input.GetType() )
+    {
+      case Property::BOOLEAN:
+      {
+        value = &input.GetConstraintInputBoolean( bufferIndex );
+        size = sizeof( bool );
+        break;
+      }
+      case Property::INTEGER:
+      {
+        value = &input.GetConstraintInputInteger( bufferIndex );
+        size = sizeof( int );
+        break;
+      }
+      case Property::FLOAT:
+      {
+        value = &input.GetConstraintInputFloat( bufferIndex );
+        size = sizeof( float );
+        break;
+      }
+      case Property::VECTOR2:
+      {
+        value = &input.GetConstraintInputVector2( bufferIndex );
+        size = sizeof( Vector2 );
+        break;
+      }
+      case Property::VECTOR3:
+      {
+        value = &input.GetConstraintInputVector3( bufferIndex );
+        size = sizeof( Vector3 );
+        break;
+      }
+      case Property::VECTOR4:
+      {
+        value = &input.GetConstraintInputVector4( bufferIndex );
+        size = sizeof( Vector4 );
+        break;
+      }
+      case Property::ROTATION:
+      {
+        value = &input.GetConstraintInputQuaternion( bufferIndex );
+        size = sizeof( Quaternion );
+        break;
+      }
+      case Property::MATRIX3:
+      {
+        value = &input.GetConstraintInputMatrix3( bufferIndex );
+        size = sizeof( Matrix3 );
+        break;
+      }
+      case Property::MATRIX:
+      {
+        value = &input.GetConstraintInputMatrix( bufferIndex );
+        size = sizeof( Matrix );
+        break;
+      }
+      default:
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
   // Undefined
   PropertyConstraint( const PropertyConstraint& );
 
@@ -212,6 +329,8 @@ private:
   ConstraintFunction* mFunction;
 
   InputContainer mInputs;
+
+  Dali::Vector< char > mInputValues; ///< The values of the inputs at the previous call of InputValuesChanged()
 };
 
 } // namespace Internal
@@ -32,6 +32,8 @@ class BaseObject;
 namespace Internal
 {
 
+class MessageKey;
+
 namespace SceneGraph
 {
 class UpdateManager;
@@ -83,6 +85,17 @@ public:
    */
   virtual unsigned int* ReserveMessageSlot( std::size_t size, bool updateScene = true ) = 0;
 
+  /**
+   * Reserve space for a message which sets a property to an absolute value; this must then be initialized by the caller.
+   * When message coalescing is enabled, a previous message with the same key, not flushed yet, is not processed.
+   * The message requires an update of the scene-graph node tree.
+   * @post Calling this method may invalidate any previously returned slots.
+   * @param[in] size The message size with respect to the size of type "char".
+   * @param[in] key Identifies the property and how it is set.
+   * @return A pointer to the first char allocated for the message.
+   */
+  virtual unsigned int* ReserveMessageSlot( std::size_t size, const MessageKey& key ) = 0;
+
   /**
    * @return the current event-buffer index.
    */
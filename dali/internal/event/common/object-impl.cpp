@@ -1039,7 +1039,7 @@ void Object::SetSceneGraphProperty( Property::Index index, const PropertyMetadat
       DALI_ASSERT_DEBUG( NULL != property );
 
       // property is being used in a separate thread; queue a message to set the property
-      BakeMessage<bool>( GetEventThreadServices(), *property, value.Get<bool>() );
+      SceneGraph::AnimatablePropertyMessage<bool>::Send( GetEventThreadServices(), GetSceneObject(), property, &AnimatableProperty<bool>::Bake, value.Get<bool>() );
       break;
     }
 
@@ -1049,7 +1049,7 @@ void Object::SetSceneGraphProperty( Property::Index index, const PropertyMetadat
       DALI_ASSERT_DEBUG( NULL != property );
 
       // property is being used in a separate thread; queue a message to set the property
-      BakeMessage<int>( GetEventThreadServices(), *property, value.Get<int>() );
+      SceneGraph::AnimatablePropertyMessage<int>::Send( GetEventThreadServices(), GetSceneObject(), property, &AnimatableProperty<int>::Bake, value.Get<int>() );
       break;
     }
 
@@ -1059,7 +1059,7 @@ void Object::SetSceneGraphProperty( Property::Index index, const PropertyMetadat
       DALI_ASSERT_DEBUG( NULL != property );
 
       // property is being used in a separate thread; queue a message to set the property
-      BakeMessage<float>( GetEventThreadServices(), *property, value.Get<float>() );
+      SceneGraph::AnimatablePropertyMessage<float>::Send( GetEventThreadServices(), GetSceneObject(), property, &AnimatableProperty<float>::Bake, value.Get<float>() );
       break;
     }
 
@@ -1071,15 +1071,15 @@ void Object::SetSceneGraphProperty( Property::Index index, const PropertyMetadat
       // property is being used in a separate thread; queue a message to set the property
       if(entry.componentIndex == 0)
       {
-        SetXComponentMessage<Vector2>( GetEventThreadServices(), *property, value.Get<float>() );
+        SceneGraph::AnimatablePropertyComponentMessage<Vector2>::Send( GetEventThreadServices(), GetSceneObject(), property, &AnimatableProperty<Vector2>::BakeX, value.Get<float>() );
       }
       else if(entry.componentIndex == 1)
       {
-        SetYComponentMessage<Vector2>( GetEventThreadServices(), *property, value.Get<float>() );
+        SceneGraph::AnimatablePropertyComponentMessage<Vector2>::Send( GetEventThreadServices(), GetSceneObject(), property, &AnimatableProperty<Vector2>::BakeY, value.Get<float>() );
       }
       else
       {
-        BakeMessage<Vector2>( GetEventThreadServices(), *property, value.Get<Vector2>() );
+        SceneGraph::AnimatablePropertyMessage<Vector2>::Send( GetEventThreadServices(), GetSceneObject(), property, &AnimatableProperty<Vector2>::Bake, value.Get<Vector2>() );
       }
       break;
     }
@@ -1092,19 +1092,19 @@ void Object::SetSceneGraphProperty( Property::Index index, const PropertyMetadat
       // property is being used in a separate thread; queue a message to set the property
       if(entry.componentIndex == 0)
       {
-        SetXComponentMessage<Vector3>( GetEventThreadServices(), *property, value.Get<float>() );
+        SceneGraph::AnimatablePropertyComponentMessage<Vector3>::Send( GetEventThreadServices(), GetSceneObject(), property, &AnimatableProperty<Vector3>::BakeX, value.Get<float>() );
       }
       else if(entry.componentIndex == 1)
       {
-        SetYComponentMessage<Vector3>( GetEventThreadServices(), *property, value.Get<float>() );
+        SceneGraph::AnimatablePropertyComponentMessage<Vector3>::Send( GetEventThreadServices(), GetSceneObject(), property, &AnimatableProperty<Vector3>::BakeY, value.Get<float>() );
       }
       else if(entry.componentIndex == 2)
       {
-        SetZComponentMessage<Vector3>( GetEventThreadServices(), *property, value.Get<float>() );
+        SceneGraph::AnimatablePropertyComponentMessage<Vector3>::Send( GetEventThreadServices(), GetSceneObject(), property, &AnimatableProperty<Vector3>::BakeZ, value.Get<float>() );
       }
       else
       {
-        BakeMessage<Vector3>( GetEventThreadServices(), *property, value.Get<Vector3>() );
+        SceneGraph::AnimatablePropertyMessage<Vector3>::Send( GetEventThreadServices(), GetSceneObject(), property, &AnimatableProperty<Vector3>::Bake, value.Get<Vector3>() );
       }
 
       break;
@@ -1118,23 +1118,23 @@ void Object::SetSceneGraphProperty( Property::Index index, const PropertyMetadat
       // property is being used in a separate thread; queue a message to set the property
       if(entry.componentIndex == 0)
       {
-        SetXComponentMessage<Vector4>( GetEventThreadServices(), *property, value.Get<float>() );
+        SceneGraph::AnimatablePropertyComponentMessage<Vector4>::Send( GetEventThreadServices(), GetSceneObject(), property, &AnimatableProperty<Vector4>::BakeX, value.Get<float>() );
       }
       else if(entry.componentIndex == 1)
       {
-        SetYComponentMessage<Vector4>( GetEventThreadServices(), *property, value.Get<float>() );
+        SceneGraph::AnimatablePropertyComponentMessage<Vector4>::Send( GetEventThreadServices(), GetSceneObject(), property, &AnimatableProperty<Vector4>::BakeY, value.Get<float>() );
       }
       else if(entry.componentIndex == 2)
       {
-        SetZComponentMessage<Vector4>( GetEventThreadServices(), *property, value.Get<float>() );
+        SceneGraph::AnimatablePropertyComponentMessage<Vector4>::Send( GetEventThreadServices(), GetSceneObject(), property, &AnimatableProperty<Vector4>::BakeZ, value.Get<float>() );
       }
       else if(entry.componentIndex == 3)
       {
-        SetWComponentMessage<Vector4>( GetEventThreadServices(), *property, value.Get<float>() );
+        SceneGraph::AnimatablePropertyComponentMessage<Vector4>::Send( GetEventThreadServices(), GetSceneObject(), property, &AnimatableProperty<Vector4>::BakeW, value.Get<float>() );
       }
       else
       {
-        BakeMessage<Vector4>( GetEventThreadServices(), *property, value.Get<Vector4>() );
+        SceneGraph::AnimatablePropertyMessage<Vector4>::Send( GetEventThreadServices(), GetSceneObject(), property, &AnimatableProperty<Vector4>::Bake, value.Get<Vector4>() );
       }
       break;
     }
@@ -1145,7 +1145,7 @@ void Object::SetSceneGraphProperty( Property::Index index, const PropertyMetadat
       DALI_ASSERT_DEBUG( NULL != property );
 
       // property is being used in a separate thread; queue a message to set the property
-      BakeMessage<Quaternion>( GetEventThreadServices(), *property, value.Get<Quaternion>() );
+      SceneGraph::AnimatablePropertyMessage<Quaternion>::Send( GetEventThreadServices(), GetSceneObject(), property, &AnimatableProperty<Quaternion>::Bake, value.Get<Quaternion>() );
       break;
     }
 
@@ -1155,7 +1155,7 @@ void Object::SetSceneGraphProperty( Property::Index index, const PropertyMetadat
       DALI_ASSERT_DEBUG( NULL != property );
 
       // property is being used in a separate thread; queue a message to set the property
-      BakeMessage<Matrix>( GetEventThreadServices(), *property, value.Get<Matrix>() );
+      SceneGraph::AnimatablePropertyMessage<Matrix>::Send( GetEventThreadServices(), GetSceneObject(), property, &AnimatableProperty<Matrix>::Bake, value.Get<Matrix>() );
       break;
     }
 
@@ -1165,7 +1165,7 @@ void Object::SetSceneGraphProperty( Property::Index index, const PropertyMetadat
       DALI_ASSERT_DEBUG( NULL != property );
 
       // property is being used in a separate thread; queue a message to set the property
-      BakeMessage<Matrix3>( GetEventThreadServices(), *property, value.Get<Matrix3>() );
+      SceneGraph::AnimatablePropertyMessage<Matrix3>::Send( GetEventThreadServices(), GetSceneObject(), property, &AnimatableProperty<Matrix3>::Bake, value.Get<Matrix3>() );
       break;
     }
 
@@ -150,11 +150,54 @@ void PropertyBuffer::SetData( const void* data, std::size_t size )
   SceneGraph::SetPropertyBufferData( mEventThreadServices.GetUpdateManager(), *mRenderObject, new Dali::Vector<char>( mBuffer ), mSize );
 }
 
+void PropertyBuffer::SetData( const void* data, std::size_t offset, std::size_t count )
+{
+  DALI_ASSERT_ALWAYS( offset + count <= mSize && "Range must be within the data set" );
+
+  if( count > 0u && mBufferFormat != NULL )
+  {
+    const std::size_t elementSize = mBufferFormat->size;
+    const char* source = static_cast<const char*>( data );
+    std::copy( source, source + count * elementSize, &mBuffer[ offset * elementSize ] );
+
+    // Send only the elements of the range
+    Dali::Vector<char>* range = new Dali::Vector<char>();
+    range->Resize( count * elementSize );
+    std::copy( source, source + count * elementSize, range->Begin() );
+
+    SceneGraph::SetPropertyBufferDataRange( mEventThreadServices.GetUpdateManager(), *mRenderObject, range, offset * elementSize );
+  }
+}
+
 std::size_t PropertyBuffer::GetSize() const
 {
   return mSize;
 }
 
+void PropertyBuffer::SetUsage( Dali::PropertyBufferUsage::Type usage )
+{
+  if( usage != mUsage )
+  {
+    mUsage = usage;
+
+    GpuBuffer::Usage gpuUsage( GpuBuffer::STATIC_DRAW );
+    if( usage == Dali::PropertyBufferUsage::DYNAMIC )
+    {
+      gpuUsage = GpuBuffer::DYNAMIC_DRAW;
+    }
+    else if( usage == Dali::PropertyBufferUsage::STREAM )
+    {
+      gpuUsage = GpuBuffer::STREAM_DRAW;
+    }
+    SceneGraph::SetPropertyBufferUsage( mEventThreadServices.GetUpdateManager(), *mRenderObject, gpuUsage );
+  }
+}
+
+Dali::PropertyBufferUsage::Type PropertyBuffer::GetUsage() const
+{
+  return mUsage;
+}
+
 const Render::PropertyBuffer* PropertyBuffer::GetRenderObject() const
 {
   return mRenderObject;
@@ -172,7 +215,8 @@ PropertyBuffer::PropertyBuffer()
 : mEventThreadServices( *Stage::GetCurrent() ),
   mRenderObject( NULL ),
   mBufferFormat( NULL ),
-  mSize( 0 )
+  mSize( 0 ),
+  mUsage( Dali::PropertyBufferUsage::STATIC )
 {
 }
 
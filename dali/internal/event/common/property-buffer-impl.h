@@ -23,6 +23,7 @@
 #include <dali/public-api/common/intrusive-ptr.h> // Dali::IntrusivePtr
 #include <dali/public-api/object/base-object.h>
 #include <dali/public-api/object/property-map.h> // Dali::Property::Map
+#include <dali/devel-api/rendering/property-buffer-update.h> // Dali::PropertyBufferUsage
 #include <dali/internal/event/common/event-thread-services.h>
 #include <dali/internal/render/renderers/render-property-buffer.h>
 
@@ -52,11 +53,26 @@ public:
    */
   void SetData( const void* data, std::size_t size );
 
+  /**
+   * @copydoc Dali::PropertyBufferSetData()
+   */
+  void SetData( const void* data, std::size_t offset, std::size_t count );
+
   /**
    * @copydoc PropertBuffer::GetSize()
    */
   std::size_t GetSize() const;
 
+  /**
+   * @copydoc Dali::PropertyBufferSetUsage()
+   */
+  void SetUsage( Dali::PropertyBufferUsage::Type usage );
+
+  /**
+   * @copydoc Dali::PropertyBufferGetUsage()
+   */
+  Dali::PropertyBufferUsage::Type GetUsage() const;
+
 public: // Default property extensions from Object
 
   /**
@@ -94,6 +110,7 @@ private: // data
   Property::Map mFormat;  ///< Format of the property buffer
   const Render::PropertyBuffer::Format* mBufferFormat;  ///< Metadata for the format of the property buffer
   unsigned int mSize; ///< Number of elements in the buffer
+  Dali::PropertyBufferUsage::Type mUsage; ///< How often the data is updated
   Dali::Vector< char > mBuffer; // Data of the property-buffer
 };
 
@@ -637,6 +637,11 @@ unsigned int* Stage::ReserveMessageSlot( std::size_t size, bool updateScene )
   return mUpdateManager.ReserveMessageSlot( size, updateScene );
 }
 
+unsigned int* Stage::ReserveMessageSlot( std::size_t size, const MessageKey& key )
+{
+  return mUpdateManager.ReserveMessageSlot( size, key );
+}
+
 BufferIndex Stage::GetEventBufferIndex() const
 {
   return mUpdateManager.GetEventBufferIndex();
@@ -402,6 +402,11 @@ public: // Implementation of EventThreadServices
    */
   virtual unsigned int* ReserveMessageSlot( std::size_t size, bool updateScene );
 
+  /**
+   * @copydoc EventThreadServices::ReserveMessageSlot( std::size_t, const MessageKey& )
+   */
+  virtual unsigned int* ReserveMessageSlot( std::size_t size, const MessageKey& key );
+
   /**
    * @copydoc EventThreadServices::GetEventBufferIndex
    */
@@ -159,6 +159,8 @@ bool IsActorExclusiveToAnotherRenderTask( const Actor& actor,
  * Exceptions to this rule are:
  * - When comparing against renderable parents, if Actor is the same distance
  * or closer than it's renderable parent, then it takes priority.
+ * Children whose sub-tree bounding sphere is missed by the ray are skipped, as none
+ * of their actors could be hit. Sub-trees containing stencils are never skipped.
  */
 HitActor HitTestWithinLayer( Actor& actor,
                              const RenderTask& renderTask,
@@ -273,7 +275,9 @@ HitActor HitTestWithinLayer( Actor& actor,
     {
       // Descend tree only if...
       if ( !(*iter)->IsLayer() &&    // Child is NOT a layer, hit testing current layer only or Child is not a layer and we've inherited the stencil draw mode
-           ( isStencil || hitCheck.DescendActorHierarchy( ( *iter ).Get() ) ) ) // We are a stencil OR we can descend into child hierarchy
+           ( isStencil || hitCheck.DescendActorHierarchy( ( *iter ).Get() ) ) && // We are a stencil OR we can descend into child hierarchy
+           ( (*iter)->GetChildCount() == 0 ||   // A leaf only needs its own sphere test, done when it is hit-tested
+             (*iter)->GetDrawMode() == DrawMode::STENCIL || (*iter)->RaySubtreeSphereTest( rayOrigin, rayDir ) ) ) // The ray can hit the child's sub-tree
       {
         HitActor currentHit( HitTestWithinLayer(  (*iter->Get()),
                                                   renderTask,
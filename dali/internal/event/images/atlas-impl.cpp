@@ -123,6 +123,113 @@ bool Atlas::Upload( PixelDataPtr pixelData,
   return uploadSuccess;
 }
 
+bool Atlas::Upload( PixelDataPtr pixelData,
+                    Vector4& textureRect )
+{
+  bool uploadSuccess( false );
+
+  SizeType xOffset( 0u );
+  SizeType yOffset( 0u );
+  if( mPacker.Pack( pixelData->GetWidth(), pixelData->GetHeight(), xOffset, yOffset ) )
+  {
+    uploadSuccess = Upload( pixelData, xOffset, yOffset );
+    if( uploadSuccess )
+    {
+      // Without a url, only kept so that Remove() can tell the allocated blocks
+      mTiles.PushBack( new Tile( xOffset, yOffset, pixelData->GetWidth(), pixelData->GetHeight(), std::string() ) );
+      textureRect = GetTextureRect( xOffset, yOffset, pixelData->GetWidth(), pixelData->GetHeight() );
+    }
+    else
+    {
+      mPacker.DeleteBlock( xOffset, yOffset, pixelData->GetWidth(), pixelData->GetHeight() );
+    }
+  }
+
+  return uploadSuccess;
+}
+
+bool Atlas::Upload( const std::string& url,
+                    Vector4& textureRect )
+{
+  // Share the images already uploaded
+  const unsigned int index = FindPackedTile( url );
+  if( index < mTiles.Count() )
+  {
+    Tile& tile( *mTiles[index] );
+    ++tile.referenceCount;
+    textureRect = GetTextureRect( tile.xOffset, tile.yOffset, tile.width, tile.height );
+    return true;
+  }
+
+  bool uploadSuccess( false );
+
+  Integration::BitmapPtr bitmap = LoadBitmap( url );
+  SizeType xOffset( 0u );
+  SizeType yOffset( 0u );
+  if( bitmap && mPacker.Pack( bitmap->GetImageWidth(), bitmap->GetImageHeight(), xOffset, yOffset ) )
+  {
+    AllocateAtlas();
+    ResourceId destId = GetResourceId();
+    if( destId )
+    {
+      mResourceClient.UploadBitmap( destId, bitmap, xOffset, yOffset );
+      uploadSuccess = true;
+
+      // Kept for the queries, and re-uploaded when regaining the context if mRecoverContext is set
+      mTiles.PushBack( new Tile( xOffset, yOffset, bitmap->GetImageWidth(), bitmap->GetImageHeight(), url ) );
+      textureRect = GetTextureRect( xOffset, yOffset, bitmap->GetImageWidth(), bitmap->GetImageHeight() );
+    }
+    else
+    {
+      mPacker.DeleteBlock( xOffset, yOffset, bitmap->GetImageWidth(), bitmap->GetImageHeight() );
+    }
+  }
+
+  return uploadSuccess;
+}
+
+bool Atlas::GetTextureRect( const std::string& url,
+                            Vector4& textureRect ) const
+{
+  const unsigned int index = FindPackedTile( url );
+  if( index < mTiles.Count() )
+  {
+    const Tile& tile( *mTiles[index] );
+    textureRect = GetTextureRect( tile.xOffset, tile.yOffset, tile.width, tile.height );
+    return true;
+  }
+
+  return false;
+}
+
+void Atlas::Remove( const Vector4& textureRect )
+{
+  const SizeType xOffset = static_cast<SizeType>( textureRect.x * mWidth + 0.5f );
+  const SizeType yOffset = static_cast<SizeType>( textureRect.y * mHeight + 0.5f );
+  const SizeType width = static_cast<SizeType>( textureRect.z * mWidth + 0.5f ) - xOffset;
+  const SizeType height = static_cast<SizeType>( textureRect.w * mHeight + 0.5f ) - yOffset;
+
+  for( Vector<Tile*>::Iterator iter = mTiles.Begin(); iter != mTiles.End(); ++iter )
+  {
+    Tile* tile( *iter );
+    if( tile->referenceCount > 0u &&
+        tile->xOffset == xOffset && tile->yOffset == yOffset &&
+        tile->width == width && tile->height == height )
+    {
+      if( --tile->referenceCount == 0u )
+      {
+        delete tile;
+        mTiles.Erase( iter );
+        mPacker.DeleteBlock( xOffset, yOffset, width, height );
+      }
+      return;
+    }
+  }
+
+  // The area was not allocated by the atlas, or has already been removed
+  DALI_LOG_WARNING( "Area not allocated by the atlas: %f,%f,%f,%f\n", textureRect.x, textureRect.y, textureRect.z, textureRect.w );
+}
+
 void Atlas::RecoverFromContextLoss()
 {
   ResourceId destId = GetResourceId();
@@ -139,6 +246,12 @@ void Atlas::RecoverFromContextLoss()
       Vector< Tile* >::ConstIterator end = mTiles.End();
       for( Vector<Tile*>::Iterator iter = mTiles.Begin(); iter != end; iter++ )
       {
+        if( (*iter)->url.empty() )
+        {
+          // Pixel data are not kept
+          continue;
+        }
+
         Integration::BitmapPtr bitmap = LoadBitmap( (*iter)->url );
         mResourceClient.UploadBitmap( destId, bitmap, (*iter)->xOffset, (*iter)->yOffset  );
       }
@@ -158,6 +271,8 @@ Atlas::Atlas( SizeType width,
 : mResourceClient( ThreadLocalStorage::Get().GetResourceClient() ),
   mImageFactory( ThreadLocalStorage::Get().GetImageFactory() ),
   mClearColor( Vector4::ZERO ),
+  mTiles(),
+  mPacker( width, height ),
   mPixelFormat( pixelFormat ),
   mClear( false ),
   mRecoverContext( recoverContext )
@@ -281,6 +396,7 @@ void Atlas::ClearCache()
     delete *iter;
   }
   mTiles.Clear();
+  mPacker.Reset();
 }
 
 Integration::BitmapPtr Atlas::LoadBitmap( const std::string& url )
@@ -294,6 +410,30 @@ Integration::BitmapPtr Atlas::LoadBitmap( const std::string& url )
   return bitmap;
 }
 
+unsigned int Atlas::FindPackedTile( const std::string& url ) const
+{
+  if( url.empty() )
+  {
+    // The tiles of the pixel data have no url
+    return mTiles.Count();
+  }
+
+  unsigned int index = 0u;
+  while( index < mTiles.Count() && ( mTiles[index]->referenceCount == 0u || mTiles[index]->url != url ) )
+  {
+    ++index;
+  }
+  return index;
+}
+
+Vector4 Atlas::GetTextureRect( SizeType xOffset, SizeType yOffset, SizeType width, SizeType height ) const
+{
+  return Vector4( static_cast<float>( xOffset ) / mWidth,
+                  static_cast<float>( yOffset ) / mHeight,
+                  static_cast<float>( xOffset + width ) / mWidth,
+                  static_cast<float>( yOffset + height ) / mHeight );
+}
+
 } // namespace Internal
 
 } // namespace Dali
@@ -21,6 +21,7 @@
 // INTERNAL INCLUDES
 #include <dali/public-api/common/dali-vector.h>
 #include <dali/devel-api/images/atlas.h>
+#include <dali/internal/event/images/atlas-packer.h>
 #include <dali/internal/event/images/context-recovery-interface.h>
 #include <dali/internal/event/images/image-impl.h>
 #include <dali/internal/event/images/buffer-image-impl.h>
@@ -84,6 +85,29 @@ public:
                SizeType xOffset,
                SizeType yOffset );
 
+  /**
+   * @copydoc Dali::Atlas::Upload( Dali::PixelData, Vector4& )
+   */
+  bool Upload( PixelDataPtr pixelData,
+               Vector4& textureRect );
+
+  /**
+   * @copydoc Dali::Atlas::Upload( const std::string&, Vector4& )
+   */
+  bool Upload( const std::string& url,
+               Vector4& textureRect );
+
+  /**
+   * @copydoc Dali::Atlas::GetTextureRect
+   */
+  bool GetTextureRect( const std::string& url,
+                       Vector4& textureRect ) const;
+
+  /**
+   * @copydoc Dali::Atlas::Remove
+   */
+  void Remove( const Vector4& textureRect );
+
   /**
    * @copydoc ContextRecoveryInterface::RecoverFromContextLoss
    */
@@ -154,6 +178,17 @@ private:
    */
   Integration::BitmapPtr LoadBitmap( const std::string& url );
 
+  /**
+   * Find the image uploaded from a url at a position allocated by the atlas.
+   * @return The index of its tile, or the number of tiles if not found.
+   */
+  unsigned int FindPackedTile( const std::string& url ) const;
+
+  /**
+   * Convert an area of the atlas in pixels to texture coordinates.
+   */
+  Vector4 GetTextureRect( SizeType xOffset, SizeType yOffset, SizeType width, SizeType height ) const;
+
 private:
 
   /**
@@ -162,14 +197,21 @@ private:
   struct Tile
   {
     Tile( SizeType xOffset, SizeType yOffset, const std::string& url )
-    : xOffset( xOffset ), yOffset( yOffset ), url(url)
+    : xOffset( xOffset ), yOffset( yOffset ), width( 0u ), height( 0u ), url(url), referenceCount( 0u )
+    {}
+
+    Tile( SizeType xOffset, SizeType yOffset, SizeType width, SizeType height, const std::string& url )
+    : xOffset( xOffset ), yOffset( yOffset ), width( width ), height( height ), url(url), referenceCount( 1u )
     {}
 
     ~Tile(){};
 
     SizeType xOffset;   ///< Offset in the x direction within the atlas
     SizeType yOffset;   ///< Offset in the y direction within the atlas
-    std::string url;    ///< The URL of the resource image file to use
+    SizeType width;     ///< The width of the image, when its position was allocated by the atlas
+    SizeType height;    ///< The height of the image, when its position was allocated by the atlas
+    std::string url;    ///< The URL of the resource image file to use, empty for pixel data
+    unsigned int referenceCount; ///< The number of uploads sharing the image, or 0 if the position was specified
 
   private:
     Tile(const Tile& rhs); ///< not defined
@@ -181,7 +223,8 @@ private:
   ResourceClient&          mResourceClient;
   ImageFactory&            mImageFactory;
   Vector4                  mClearColor;       ///< The background clear color
-  Vector<Tile*>            mTiles;            ///< The url resources, which would recover automatically when regaining context
+  Vector<Tile*>            mTiles;            ///< The url resources, which would recover automatically when regaining context, and the packed images
+  AtlasPacker              mPacker;           ///< Allocates the positions of the images when not specified
   Pixel::Format            mPixelFormat;      ///< The pixel format (rgba 32 bit by default)
   bool                     mClear:1;          ///< Clear the backgound or not
   bool                     mRecoverContext:1; ///< Re-upload the url resources or not when regaining context
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/event/images/atlas-packer.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+AtlasPacker::AtlasPacker( SizeType width, SizeType height )
+: mFreeRectangles(),
+  mWidth( width ),
+  mHeight( height ),
+  mAvailableArea( 0u )
+{
+  Reset();
+}
+
+AtlasPacker::~AtlasPacker()
+{
+}
+
+bool AtlasPacker::Pack( SizeType blockWidth, SizeType blockHeight, SizeType& xOffset, SizeType& yOffset )
+{
+  if( blockWidth == 0u || blockHeight == 0u )
+  {
+    return false;
+  }
+
+  // Best short side fit; ties are broken by the long side
+  unsigned int bestIndex = mFreeRectangles.Count();
+  SizeType bestShortSide = 0u;
+  SizeType bestLongSide = 0u;
+  for( unsigned int i = 0u; i < mFreeRectangles.Count(); ++i )
+  {
+    const Rectangle& rectangle( mFreeRectangles[i] );
+    if( rectangle.width >= blockWidth && rectangle.height >= blockHeight )
+    {
+      const SizeType leftoverWidth = rectangle.width - blockWidth;
+      const SizeType leftoverHeight = rectangle.height - blockHeight;
+      const SizeType shortSide = std::min( leftoverWidth, leftoverHeight );
+      const SizeType longSide = std::max( leftoverWidth, leftoverHeight );
+      if( bestIndex == mFreeRectangles.Count() ||
+          shortSide < bestShortSide || ( shortSide == bestShortSide && longSide < bestLongSide ) )
+      {
+        bestIndex = i;
+        bestShortSide = shortSide;
+        bestLongSide = longSide;
+      }
+    }
+  }
+
+  if( bestIndex == mFreeRectangles.Count() )
+  {
+    return false;
+  }
+
+  const Rectangle freeRectangle( mFreeRectangles[ bestIndex ] );
+  mFreeRectangles.Erase( mFreeRectangles.Begin() + bestIndex );
+
+  xOffset = freeRectangle.x;
+  yOffset = freeRectangle.y;
+
+  // Split the rest along the shorter leftover axis, which keeps the larger free rectangle as large as possible
+  const SizeType leftoverWidth = freeRectangle.width - blockWidth;
+  const SizeType leftoverHeight = freeRectangle.height - blockHeight;
+  if( leftoverWidth < leftoverHeight )
+  {
+    AddFreeRectangle( freeRectangle.x + blockWidth, freeRectangle.y, leftoverWidth, blockHeight );
+    AddFreeRectangle( freeRectangle.x, freeRectangle.y + blockHeight, freeRectangle.width, leftoverHeight );
+  }
+  else
+  {
+    AddFreeRectangle( freeRectangle.x + blockWidth, freeRectangle.y, leftoverWidth, freeRectangle.height );
+    AddFreeRectangle( freeRectangle.x, freeRectangle.y + blockHeight, blockWidth, leftoverHeight );
+  }
+
+  mAvailableArea -= blockWidth * blockHeight;
+  return true;
+}
+
+void AtlasPacker::DeleteBlock( SizeType xOffset, SizeType yOffset, SizeType blockWidth, SizeType blockHeight )
+{
+  DALI_ASSERT_DEBUG( xOffset + blockWidth <= mWidth && yOffset + blockHeight <= mHeight );
+
+  AddFreeRectangle( xOffset, yOffset, blockWidth, blockHeight );
+  mAvailableArea += blockWidth * blockHeight;
+
+  MergeFreeRectangles();
+}
+
+void AtlasPacker::Reset()
+{
+  mFreeRectangles.Clear();
+  AddFreeRectangle( 0u, 0u, mWidth, mHeight );
+  mAvailableArea = mWidth * mHeight;
+}
+
+void AtlasPacker::AddFreeRectangle( SizeType x, SizeType y, SizeType width, SizeType height )
+{
+  if( width > 0u && height > 0u )
+  {
+    Rectangle rectangle;
+    rectangle.x = x;
+    rectangle.y = y;
+    rectangle.width = width;
+    rectangle.height = height;
+    mFreeRectangles.PushBack( rectangle );
+  }
+}
+
+void AtlasPacker::MergeFreeRectangles()
+{
+  bool merged = true;
+  while( merged )
+  {
+    merged = false;
+    for( unsigned int i = 0u; !merged && i < mFreeRectangles.Count(); ++i )
+    {
+      for( unsigned int j = i + 1u; !merged && j < mFreeRectangles.Count(); ++j )
+      {
+        Rectangle& first( mFreeRectangles[i] );
+        const Rectangle& second( mFreeRectangles[j] );
+
+        if( first.x == second.x && first.width == second.width )
+        {
+          // One above the other
+          if( first.y + first.height == second.y )
+          {
+            first.height += second.height;
+            merged = true;
+          }
+          else if( second.y + second.height == first.y )
+          {
+            first.y = second.y;
+            first.height += second.height;
+            merged = true;
+          }
+        }
+        else if( first.y == second.y && first.height == second.height )
+        {
+          // Side by side
+          if( first.x + first.width == second.x )
+          {
+            first.width += second.width;
+            merged = true;
+          }
+          else if( second.x + second.width == first.x )
+          {
+            first.x = second.x;
+            first.width += second.width;
+            merged = true;
+          }
+        }
+
+        if( merged )
+        {
+          mFreeRectangles.Erase( mFreeRectangles.Begin() + j );
+        }
+      }
+    }
+  }
+}
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,142 @@
+#ifndef __DALI_INTERNAL_ATLAS_PACKER_H__
+#define __DALI_INTERNAL_ATLAS_PACKER_H__
+
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/devel-api/images/atlas.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+/**
+ * Allocates the blocks of an atlas with the guillotine algorithm.
+ *
+ * The free area is kept as a list of free rectangles. A block is placed in the corner of the free rectangle
+ * which it fits best (the one leaving the shortest side), and the rest of this rectangle is split in two along
+ * the shorter leftover axis. The rectangles of the deleted blocks return to the list, and are merged with the
+ * adjacent free rectangles sharing a whole edge.
+ */
+class AtlasPacker
+{
+public:
+
+  typedef Dali::Atlas::SizeType SizeType;
+
+  /**
+   * Constructor; the whole atlas is free.
+   * @param[in] width The width of the atlas
+   * @param[in] height The height of the atlas
+   */
+  AtlasPacker( SizeType width, SizeType height );
+
+  /**
+   * Destructor
+   */
+  ~AtlasPacker();
+
+  /**
+   * Allocate a block.
+   * @param[in] blockWidth The width of the block
+   * @param[in] blockHeight The height of the block
+   * @param[out] xOffset The x offset of the block within the atlas
+   * @param[out] yOffset The y offset of the block within the atlas
+   * @return True if the block has been allocated, false if no free rectangle is large enough.
+   */
+  bool Pack( SizeType blockWidth, SizeType blockHeight, SizeType& xOffset, SizeType& yOffset );
+
+  /**
+   * Release a block allocated with Pack().
+   * @param[in] xOffset The x offset of the block
+   * @param[in] yOffset The y offset of the block
+   * @param[in] blockWidth The width of the block
+   * @param[in] blockHeight The height of the block
+   */
+  void DeleteBlock( SizeType xOffset, SizeType yOffset, SizeType blockWidth, SizeType blockHeight );
+
+  /**
+   * Release all the blocks.
+   */
+  void Reset();
+
+  /**
+   * Query the area which is not allocated.
+   * @return The number of free pixels.
+   */
+  unsigned int GetAvailableArea() const
+  {
+    return mAvailableArea;
+  }
+
+  /**
+   * Query the number of free rectangles, i.e. the fragmentation of the free area.
+   * @return The number of free rectangles.
+   */
+  unsigned int GetFreeRectangleCount() const
+  {
+    return mFreeRectangles.Count();
+  }
+
+private:
+
+  /**
+   * A free rectangle
+   */
+  struct Rectangle
+  {
+    SizeType x;
+    SizeType y;
+    SizeType width;
+    SizeType height;
+  };
+
+  typedef Dali::Vector< Rectangle > RectangleContainer;
+
+  /**
+   * Add a free rectangle, unless it is empty.
+   */
+  void AddFreeRectangle( SizeType x, SizeType y, SizeType width, SizeType height );
+
+  /**
+   * Merge the free rectangles sharing a whole edge, until no more can be merged.
+   */
+  void MergeFreeRectangles();
+
+  // Undefined
+  AtlasPacker( const AtlasPacker& );
+
+  // Undefined
+  AtlasPacker& operator=( const AtlasPacker& rhs );
+
+private:
+
+  RectangleContainer mFreeRectangles;   ///< The free area; the rectangles do not overlap
+  SizeType mWidth;                      ///< The width of the atlas
+  SizeType mHeight;                     ///< The height of the atlas
+  unsigned int mAvailableArea;          ///< The number of free pixels
+};
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_ATLAS_PACKER_H__
@@ -46,7 +46,14 @@ namespace Internal
 ImageFactory::ImageFactory( ResourceClient& resourceClient )
 : mResourceClient(resourceClient),
   mMaxScale( 4 / 1024.0f ), ///< Only allow a very tiny fudge factor in matching new requests to existing resource transactions: 4 pixels at a dimension of 1024, 2 at 512, ...
-  mReqIdCurrent(0)
+  mReqIdCurrent(0),
+  mCachedResources(),
+  mCacheIndex(),
+  mCacheBudget( 0u ),
+  mCachedBytes( 0u ),
+  mCacheHitCount( 0u ),
+  mCacheMissCount( 0u ),
+  mCacheEvictionCount( 0u )
 {
 }
 
@@ -95,6 +102,28 @@ ResourceTicketPtr ImageFactory::Load( Request& request )
     ticket = FindCompatibleResource( request.url, urlHash, request.attributes );
   }
 
+  if( ticket )
+  {
+    // The resource may have been kept alive by the cache only, e.g. while the image was off-stage
+    if( RemoveFromCache( *ticket ) )
+    {
+      ++mCacheHitCount;
+    }
+  }
+  else if( mCacheBudget > 0u )
+  {
+    // The images released recently
+    ticket = FindCachedResource( request.url, CalculateHash( request.url ), request.attributes );
+    if( ticket )
+    {
+      ++mCacheHitCount;
+    }
+    else
+    {
+      ++mCacheMissCount;
+    }
+  }
+
   // Start a new resource IO transaction for the request if none is already happening:
   if( !ticket )
   {
@@ -180,6 +209,9 @@ ResourceTicketPtr ImageFactory::Reload( Request& request )
 
 void ImageFactory::RecoverFromContextLoss()
 {
+  // The cached resources are not reloaded; discard them
+  TrimCache( 0u );
+
   for( RequestIdMap::iterator it = mRequestCache.begin(); it != mRequestCache.end(); ++it )
   {
     // go through requests, reload with resource ticket's attributes.
@@ -300,6 +332,11 @@ void ImageFactory::ReleaseTicket( ResourceTicket* ticket )
 {
   ResourceTicketPtr ticketPtr(ticket);
   mTicketsToRelease.push_back(ticketPtr);
+
+  if( mCacheBudget > 0u )
+  {
+    AddToCache( ticket );
+  }
 }
 
 void ImageFactory::FlushReleaseQueue()
@@ -307,6 +344,22 @@ void ImageFactory::FlushReleaseQueue()
   mTicketsToRelease.clear();
 }
 
+void ImageFactory::SetCacheBudget( std::size_t bytes )
+{
+  mCacheBudget = bytes;
+  TrimCache( bytes );
+}
+
+void ImageFactory::TrimCache( std::size_t bytes )
+{
+  while( mCachedBytes > bytes )
+  {
+    // Least recently used first
+    EraseCachedResource( --mCachedResources.end() );
+    ++mCacheEvictionCount;
+  }
+}
+
 bool ImageFactory::CompareAttributes( const ImageAttributes& requested,
                                       const ImageAttributes& actual ) const
 {
@@ -496,6 +549,127 @@ void ImageFactory::RequestDiscarded( const Request& req )
   }
 }
 
+void ImageFactory::AddToCache( ResourceTicket* ticket )
+{
+  if( ticket->GetTypePath().type->id != ResourceBitmap || ticket->GetLoadingState() != ResourceLoadingSucceeded )
+  {
+    return;
+  }
+
+  // Estimated as a texture of 32 bits per pixel
+  const ImageAttributes& attributes = static_cast<ImageTicket*>( ticket )->GetAttributes();
+  const std::size_t size = static_cast<std::size_t>( attributes.GetWidth() ) * attributes.GetHeight() * 4u;
+  if( size > mCacheBudget )
+  {
+    return;
+  }
+
+  // Released again; it becomes the most recently used
+  RemoveFromCache( *ticket );
+
+  // Only cached when released by its last user. The references left are then the ones of the releasing image,
+  // of ReleaseTicket() and of the release queue
+  int references = 2;
+  for( ResourceTicketContainer::const_iterator iter = mTicketsToRelease.begin(); iter != mTicketsToRelease.end(); ++iter )
+  {
+    if( iter->Get() == ticket )
+    {
+      ++references;
+    }
+  }
+  if( ticket->ReferenceCount() > references )
+  {
+    return;
+  }
+
+  CachedResource resource;
+  resource.ticket = ticket;
+  resource.urlHash = CalculateHash( ticket->GetTypePath().path );
+  resource.size = size;
+  mCachedResources.push_front( resource );
+  mCacheIndex.insert( CachedResourceHashMap::value_type( resource.urlHash, mCachedResources.begin() ) );
+  mCachedBytes += size;
+
+  TrimCache( mCacheBudget );
+}
+
+ResourceTicketPtr ImageFactory::FindCachedResource( const std::string& filename, size_t hash, const ImageAttributes* attributes )
+{
+  ResourceTicketPtr ticket;
+
+  if( mCachedResources.empty() )
+  {
+    return ticket;
+  }
+
+  ImageAttributes requested( attributes ? *attributes : ImageAttributes::DEFAULT_ATTRIBUTES );
+  bool sizeRequested( requested.GetWidth() != 0u || requested.GetHeight() != 0u );
+
+  std::pair< CachedResourceHashMap::iterator, CachedResourceHashMap::iterator > range = mCacheIndex.equal_range( hash );
+  for( CachedResourceHashMap::iterator it = range.first; it != range.second; ++it )
+  {
+    const ResourceTicketPtr& cachedTicket = it->second->ticket;
+    if( filename.compare( cachedTicket->GetTypePath().path ) )
+    {
+      // hash collision, filenames don't match
+      continue;
+    }
+
+    if( !sizeRequested )
+    {
+      // Loaded with the size of the file, only read once a resource of the same file is cached
+      const ImageDimensions dimensions = Dali::ResourceImage::GetImageSize( filename );
+      requested.SetSize( dimensions.GetWidth(), dimensions.GetHeight() );
+      sizeRequested = true;
+    }
+
+    if( CompareAttributes( requested, static_cast<ImageTicket*>( cachedTicket.Get() )->GetAttributes() ) )
+    {
+      ticket = cachedTicket;
+      EraseCachedResource( it->second );
+      break;
+    }
+  }
+
+  return ticket;
+}
+
+bool ImageFactory::RemoveFromCache( const ResourceTicket& ticket )
+{
+  if( mCachedResources.empty() )
+  {
+    return false;
+  }
+
+  std::pair< CachedResourceHashMap::iterator, CachedResourceHashMap::iterator > range = mCacheIndex.equal_range( CalculateHash( ticket.GetTypePath().path ) );
+  for( CachedResourceHashMap::iterator it = range.first; it != range.second; ++it )
+  {
+    if( it->second->ticket.Get() == &ticket )
+    {
+      EraseCachedResource( it->second );
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void ImageFactory::EraseCachedResource( CachedResourceList::iterator iter )
+{
+  std::pair< CachedResourceHashMap::iterator, CachedResourceHashMap::iterator > range = mCacheIndex.equal_range( iter->urlHash );
+  for( CachedResourceHashMap::iterator it = range.first; it != range.second; ++it )
+  {
+    if( it->second == iter )
+    {
+      mCacheIndex.erase( it );
+      break;
+    }
+  }
+
+  mCachedBytes -= iter->size;
+  mCachedResources.erase( iter );
+}
+
 std::size_t ImageFactory::GetHashForCachedRequest( const Request& request )
 {
   const RequestId requestId = request.GetId();
@@ -18,6 +18,9 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <list>
+
 // INTERNAL INCLUDES
 #include <dali/public-api/common/dali-vector.h>
 #include <dali/internal/event/resources/resource-ticket.h>
@@ -40,6 +43,9 @@ struct Request;
  * ImageFactory is an object that manages Image resource load requests.
  * It utilises an internal caching system where previous requests and associated
  * resources are stored to avoid accessing the file system when not necessary.
+ *
+ * When a cache budget is set, the resources released by the images are kept in a least recently used
+ * cache until the budget is exceeded, so that loading the same images again does not access the file system.
  */
 class ImageFactory : public ImageFactoryCache::RequestLifetimeObserver
 {
@@ -158,6 +164,64 @@ public:
    */
   void FlushReleaseQueue();
 
+  /**
+   * Set the budget of the cache of released resources; the least recently used ones are discarded
+   * when it is exceeded.
+   * @param[in] bytes The budget in bytes, 0 to disable the cache (the default)
+   */
+  void SetCacheBudget( std::size_t bytes );
+
+  /**
+   * Discard the least recently used resources of the cache, e.g. when the memory is low.
+   * @param[in] bytes The size the cache is trimmed to, 0 to empty it
+   */
+  void TrimCache( std::size_t bytes );
+
+  /**
+   * Query the number of loads which found their resource in the cache.
+   * @return The number of cache hits.
+   */
+  unsigned int GetCacheHitCount() const
+  {
+    return mCacheHitCount;
+  }
+
+  /**
+   * Query the number of loads which did not find their resource in the cache, while it was enabled.
+   * @return The number of cache misses.
+   */
+  unsigned int GetCacheMissCount() const
+  {
+    return mCacheMissCount;
+  }
+
+  /**
+   * Query the number of resources discarded from the cache to keep it within its budget, or trimmed.
+   * @return The number of evictions.
+   */
+  unsigned int GetCacheEvictionCount() const
+  {
+    return mCacheEvictionCount;
+  }
+
+  /**
+   * Query the estimated size of the resources in the cache.
+   * @return The size in bytes.
+   */
+  std::size_t GetCachedBytes() const
+  {
+    return mCachedBytes;
+  }
+
+  /**
+   * Query the number of resources in the cache.
+   * @return The number of resources.
+   */
+  unsigned int GetCachedResourceCount() const
+  {
+    return static_cast<unsigned int>( mCachedResources.size() );
+  }
+
 public: // From RequestLifetimeObserver
 
   /**
@@ -228,6 +292,48 @@ private:
    */
   std::size_t GetHashForCachedRequest( const ImageFactoryCache::Request& request );
 
+  /**
+   * A resource released by the images, kept in the cache
+   */
+  struct CachedResource
+  {
+    ResourceTicketPtr ticket;   ///< Keeps the resource alive
+    std::size_t urlHash;        ///< The hash of the url of the resource
+    std::size_t size;           ///< The estimated size of the resource in bytes
+  };
+
+  typedef std::list< CachedResource > CachedResourceList;                       ///< Most recently used first
+  typedef std::multimap< std::size_t, CachedResourceList::iterator > CachedResourceHashMap;
+
+  /**
+   * Keep a released resource in the cache, if it has been loaded, fits in the budget and is not used by another image.
+   * @pre The ticket has just been added to the release queue by ReleaseTicket(), and the releasing image still holds it.
+   * @param [in] ticket The ticket of the resource.
+   */
+  void AddToCache( ResourceTicket* ticket );
+
+  /**
+   * Searches the cache for a compatible resource, and removes it from the cache.
+   * @param [in] filename   The url of the image resource.
+   * @param [in] hash       Hash value for the filename.
+   * @param [in] attributes Pointer to ImageAttributes used for the request or NULL if default attributes were used.
+   * @return A ticket pointer to the found resource or an unitialized pointer if no compatible one is found.
+   */
+  ResourceTicketPtr FindCachedResource( const std::string& filename, size_t hash, const ImageAttributes* attributes );
+
+  /**
+   * Removes a resource from the cache, if it is in it.
+   * @param [in] ticket The ticket of the resource.
+   * @return True if the resource was in the cache.
+   */
+  bool RemoveFromCache( const ResourceTicket& ticket );
+
+  /**
+   * Removes an entry of the cache.
+   * @param [in] iter The entry.
+   */
+  void EraseCachedResource( CachedResourceList::iterator iter );
+
 private:
   ResourceClient&                          mResourceClient;
   ImageFactoryCache::RequestPathHashMap    mUrlCache;         ///< A multimap of url hashes and request IDs
@@ -236,6 +342,13 @@ private:
   Vector<ContextRecoveryInterface*>        mContextRecoveryList; ///< List of the objects who needs context recovery
   float                                    mMaxScale;         ///< Defines maximum size difference between compatible resources
   ImageFactoryCache::RequestId             mReqIdCurrent;     ///< Internal counter for Request IDs
+  CachedResourceList                       mCachedResources;  ///< The released resources, most recently used first
+  CachedResourceHashMap                    mCacheIndex;       ///< The cached resources by url hash
+  std::size_t                              mCacheBudget;      ///< The budget of the cache in bytes, 0 if disabled
+  std::size_t                              mCachedBytes;      ///< The estimated size of the cached resources
+  unsigned int                             mCacheHitCount;    ///< The number of loads which found their resource in the cache
+  unsigned int                             mCacheMissCount;   ///< The number of loads which did not
+  unsigned int                             mCacheEvictionCount; ///< The number of resources discarded from the cache
 };
 
 } // namespace Internal
@@ -28,7 +28,6 @@
 #include <dali/integration-api/debug.h>
 #include <dali/integration-api/render-controller.h>
 #include <dali/public-api/object/type-registry.h>
-#include <dali/public-api/object/object-registry.h>
 #include <dali/internal/event/actors/actor-impl.h>
 #include <dali/internal/event/common/stage-impl.h>
 #include <dali/internal/event/common/system-overlay-impl.h>
@@ -109,10 +108,10 @@ void PrintHierarchy()
 RelayoutController::RelayoutController( Integration::RenderController& controller )
 : mRenderController( controller ),
   mRelayoutInfoAllocator(),
-  mSlotDelegate( this ),
   mRelayoutStack( new MemoryPoolRelayoutContainer( mRelayoutInfoAllocator ) ),
   mStageSize(), // zero initialized
-  mRelayoutConnection( false ),
+  mMeasurementCacheHits( 0u ),
+  mMeasurementCacheMisses( 0u ),
   mRelayoutFlag( false ),
   mEnabled( false ),
   mPerformingRelayout( false ),
@@ -124,6 +123,12 @@ RelayoutController::RelayoutController( Integration::RenderController& controlle
 
 RelayoutController::~RelayoutController()
 {
+  // The actors still waiting for a relayout may outlive the controller
+  for( RawActorList::Iterator it = mDirtyLayoutSubTrees.Begin(), itEnd = mDirtyLayoutSubTrees.End(); it != itEnd; ++it )
+  {
+    (*it)->SetRelayoutRequestIndex( Actor::INVALID_RELAYOUT_REQUEST_INDEX );
+  }
+
   delete mRelayoutStack;
 }
 
@@ -289,6 +294,12 @@ void RelayoutController::PropagateAll( Dali::Actor& actor, Dimension::Type dimen
     if( parent )
     {
       Actor& parentImpl = GetImplementation( parent );
+      if( parentImpl.RelayoutDependentOnChildren( dimension ) )
+      {
+        // A natural size may depend on the children
+        parentImpl.InvalidateMeasurements( dimension );
+      }
+
       if( parentImpl.RelayoutDependentOnChildren( dimension ) && !parentImpl.IsLayoutDirty( dimension ) )
       {
         // Store the highest parent reached
@@ -364,6 +375,9 @@ void RelayoutController::PropagateFlags( Dali::Actor& actor, Dimension::Type dim
       Actor& parentImpl = GetImplementation( parent );
       if( parentImpl.RelayoutDependentOnChildren( dimension ) )
       {
+        // A natural size may depend on the children
+        parentImpl.InvalidateMeasurements( dimension );
+
         // Propagate up
         PropagateFlags( parent, dimension );
       }
@@ -385,57 +399,44 @@ void RelayoutController::PropagateFlags( Dali::Actor& actor, Dimension::Type dim
 
 void RelayoutController::AddRequest( Dali::Actor& actor )
 {
-  BaseObject* actorPtr = &GetImplementation( actor );
+  Actor& actorImpl = GetImplementation( actor );
 
   // Only add the rootActor if it is not already recorded
-  bool found = false;
-  for( unsigned int i = 0, count = mDirtyLayoutSubTrees.Size(); i < count; ++i )
+  if( Actor::INVALID_RELAYOUT_REQUEST_INDEX == actorImpl.GetRelayoutRequestIndex() )
   {
-    if( mDirtyLayoutSubTrees[ i ] == actorPtr )
-    {
-      found = true;
-      break;
-    }
-  }
-
-  if( !found )
-  {
-    mDirtyLayoutSubTrees.PushBack( actorPtr );
+    actorImpl.SetRelayoutRequestIndex( mDirtyLayoutSubTrees.Count() );
+    mDirtyLayoutSubTrees.PushBack( &actorImpl );
   }
 }
 
 void RelayoutController::RemoveRequest( Dali::Actor& actor )
 {
-  BaseObject* actorPtr = &GetImplementation( actor );
+  RemoveRequest( GetImplementation( actor ) );
+}
 
-  // Remove actor from dirty sub trees
-  for( RawActorList::Iterator it = mDirtyLayoutSubTrees.Begin(), itEnd = mDirtyLayoutSubTrees.End(); it != itEnd; ++it )
+void RelayoutController::RemoveRequest( Actor& actor )
+{
+  const unsigned int index = actor.GetRelayoutRequestIndex();
+  if( Actor::INVALID_RELAYOUT_REQUEST_INDEX != index )
   {
-    if( *it == actorPtr )
-    {
-      mDirtyLayoutSubTrees.Erase( it );
-      break;
-    }
+    // Move the last actor to the place of the removed one
+    Actor* lastActor = mDirtyLayoutSubTrees[ mDirtyLayoutSubTrees.Count() - 1u ];
+    mDirtyLayoutSubTrees[ index ] = lastActor;
+    lastActor->SetRelayoutRequestIndex( index );
+    mDirtyLayoutSubTrees.Resize( mDirtyLayoutSubTrees.Count() - 1u );
+
+    actor.SetRelayoutRequestIndex( Actor::INVALID_RELAYOUT_REQUEST_INDEX );
   }
 }
 
 void RelayoutController::Request()
 {
   mRelayoutFlag = true;
-
-  if( !mRelayoutConnection )
-  {
-    Dali::Stage stage = Dali::Stage::GetCurrent();
-    stage.GetObjectRegistry().ObjectDestroyedSignal().Connect( mSlotDelegate, &RelayoutController::OnObjectDestroyed );
-
-    mRelayoutConnection = true;
-  }
 }
 
-void RelayoutController::OnObjectDestroyed( const Dali::RefObject* object )
+void RelayoutController::OnActorDestroyed( Actor& actor )
 {
-  // Search for and null the object if found in the following lists
-  FindAndZero( mDirtyLayoutSubTrees, object );
+  RemoveRequest( actor );
 }
 
 void RelayoutController::Relayout()
@@ -450,22 +451,18 @@ void RelayoutController::Relayout()
 
     // 1. Finds all top-level controls from the dirty list and allocate them the size of the stage
     //    These controls are paired with the parent/stage size and added to the stack.
+    //    Destroyed actors have already removed themselves from the list.
     for( RawActorList::Iterator it = mDirtyLayoutSubTrees.Begin(), itEnd = mDirtyLayoutSubTrees.End(); it != itEnd; ++it )
     {
-      BaseObject* dirtyActor = *it;
+      Actor* dirtyActor = *it;
+      dirtyActor->SetRelayoutRequestIndex( Actor::INVALID_RELAYOUT_REQUEST_INDEX );
 
-      // Need to test if actor is valid (could have been deleted and had the pointer cleared)
-      if( dirtyActor )
+      // Only negotiate actors that are on stage
+      if( dirtyActor->OnStage() )
       {
-        // We know that BaseObject is a base class of Internal::Actor but need to instruct the compiler to do the cast
-        Dali::Actor actor = Dali::Actor( reinterpret_cast<Dali::Internal::Actor*>( dirtyActor ) );
-
-        // Only negotiate actors that are on stage
-        if( actor.OnStage() )
-        {
-          Dali::Actor parent = actor.GetParent();
-          QueueActor( actor, *mRelayoutStack, ( parent ) ? Vector2( parent.GetTargetSize() ) : mStageSize );
-        }
+        Dali::Actor actor( dirtyActor );
+        Dali::Actor parent = actor.GetParent();
+        QueueActor( actor, *mRelayoutStack, ( parent ) ? Vector2( parent.GetTargetSize() ) : mStageSize );
       }
     }
 
@@ -498,6 +495,8 @@ void RelayoutController::Relayout()
       // We are done with the RelayoutInfos now so delete the pool
       mRelayoutInfoAllocator.ResetMemoryPool();
 
+      DALI_LOG_INFO( gLogFilter, Debug::General, "[Internal::RelayoutController::Relayout] Measurement cache: %u hits, %u misses\n", mMeasurementCacheHits, mMeasurementCacheMisses );
+
       PRINT_HIERARCHY;
     }
 
@@ -522,20 +521,6 @@ void RelayoutController::SetProcessingCoreEvents( bool processingEvents )
   mProcessingCoreEvents = processingEvents;
 }
 
-void RelayoutController::FindAndZero( const RawActorList& list, const Dali::RefObject* object )
-{
-  // Object has been destroyed so clear it from this list
-  for( RawActorList::Iterator it = list.Begin(), itEnd = list.End(); it != itEnd; ++it )
-  {
-    BaseObject* actor = *it;
-
-    if( actor && ( actor == object ) )
-    {
-      *it = NULL;    // Reset the pointer in the list. We don't want to remove it in case something is iterating over the list.
-    }
-  }
-}
-
 } // namespace Internal
 
 } // namespace Dali
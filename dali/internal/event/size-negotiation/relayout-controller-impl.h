@@ -36,6 +36,8 @@ class RenderController;
 namespace Internal
 {
 
+class Actor;
+
 /**
  * @brief The relayout controller is responsible for taking request from actors to relayout their sizes.
  * The requests are actioned on at the end of the frame where all actors that have made a request are
@@ -139,15 +141,66 @@ public: // CALLBACKS
   void OnApplicationSceneCreated();
 
   /**
-   * @brief Callback for when an object is destroyed
+   * @brief Called when an actor which is the root of a dirty sub tree is destroyed
+   *
+   * @param[in] actor The actor being destroyed
+   */
+  void OnActorDestroyed( Actor& actor );
+
+  /**
+   * @brief Retrieve the number of roots of dirty sub trees waiting for the relayout
    *
-   * @param[in] object The object being destroyed
+   * @return The number of roots of dirty sub trees
    */
-  void OnObjectDestroyed( const Dali::RefObject* object );
+  unsigned int GetDirtySubTreeCount() const
+  {
+    return mDirtyLayoutSubTrees.Count();
+  }
+
+  /**
+   * @brief Count a measurement of an actor dimension
+   *
+   * @param[in] cached Whether the previous measurement was reused
+   */
+  void CountMeasurement( bool cached )
+  {
+    if( cached )
+    {
+      ++mMeasurementCacheHits;
+    }
+    else
+    {
+      ++mMeasurementCacheMisses;
+    }
+  }
+
+  /**
+   * @brief Retrieve the number of measurements of actor dimensions reused since the controller was created
+   *
+   * @return The number of cache hits
+   */
+  unsigned int GetMeasurementCacheHits() const
+  {
+    return mMeasurementCacheHits;
+  }
+
+  /**
+   * @brief Retrieve the number of measurements of actor dimensions made since the controller was created
+   *
+   * @return The number of cache misses
+   */
+  unsigned int GetMeasurementCacheMisses() const
+  {
+    return mMeasurementCacheMisses;
+  }
 
 private:
 
-  typedef Dali::Vector< BaseObject* > RawActorList;
+  /**
+   * The roots of the dirty sub trees; each actor in the list stores its index, so that it can be found and
+   * removed in constant time. The last actor is moved to the place of a removed one.
+   */
+  typedef Dali::Vector< Actor* > RawActorList;
 
   /**
    * @brief Request for relayout. Relays out whole scene.
@@ -168,6 +221,13 @@ private:
    */
   void RemoveRequest( Dali::Actor& actor );
 
+  /**
+   * @brief Remove actor from request list, if it is in it
+   *
+   * @param[in] actor The root of the sub tree to remove
+   */
+  void RemoveRequest( Actor& actor );
+
   /**
    * @brief Disconnect the Relayout() method from the Stage::EventProcessingFinishedSignal().
    */
@@ -193,14 +253,6 @@ private:
    */
   void QueueActor( Dali::Actor& actor, RelayoutContainer& actors, Vector2 size );
 
-  /**
-   * @brief Find the given object in the list and null it out
-   *
-   * @param[in] list The list to search
-   * @param[in] object The object to search for
-   */
-  void FindAndZero( const RawActorList& list, const Dali::RefObject* object );
-
   // Undefined
   RelayoutController(const RelayoutController&);
   RelayoutController& operator=(const RelayoutController&);
@@ -210,13 +262,12 @@ private:
   Integration::RenderController& mRenderController;
   MemoryPoolObjectAllocator< MemoryPoolRelayoutContainer::RelayoutInfo > mRelayoutInfoAllocator;
 
-  SlotDelegate< RelayoutController > mSlotDelegate;
-
-  RawActorList mDirtyLayoutSubTrees;    ///< List of roots of sub trees that are dirty
+  RawActorList mDirtyLayoutSubTrees;    ///< List of roots of sub trees that are dirty, not referenced
   MemoryPoolRelayoutContainer* mRelayoutStack;  ///< Stack for relayouting
 
   Vector2 mStageSize;              ///< size of the stage
-  bool mRelayoutConnection : 1;    ///< Whether EventProcessingFinishedSignal signal is connected.
+  unsigned int mMeasurementCacheHits;    ///< The number of measurements reused
+  unsigned int mMeasurementCacheMisses;  ///< The number of measurements made
   bool mRelayoutFlag : 1;          ///< Relayout flag to avoid unnecessary calls
   bool mEnabled : 1;               ///< Initially disabled. Must be enabled at some point.
   bool mPerformingRelayout : 1;    ///< The relayout controller is currently performing a relayout
@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/render/common/performance-monitor.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include <stdint.h>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/compile-time-assert.h>
+#include <dali/devel-api/threading/mutex.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace // unnamed namespace
+{
+
+const char* const METRIC_NAMES[] =
+{
+  "FRAME_TIME",
+  "MATRIX_MULTIPLYS",
+  "QUATERNION_TO_MATRIX",
+  "FLOAT_POINT_MULTIPLY",
+  "RESET_PROPERTIES",
+  "PROCESS_MESSAGES",
+  "ANIMATE_NODES",
+  "ANIMATORS_APPLIED",
+  "APPLY_CONSTRAINTS",
+  "CONSTRAINTS_APPLIED",
+  "CONSTRAINTS_SKIPPED",
+  "UPDATE_NODES",
+  "MATRICES_SKIPPED",
+  "PREPARE_RENDERABLES",
+  "PROCESS_RENDER_TASKS",
+  "DRAW_NODES",
+  "DRAW_CALLS_SAVED",
+  "TEXTURE_DATA_UPLOADED"
+};
+DALI_COMPILE_TIME_ASSERT( sizeof( METRIC_NAMES ) / sizeof( METRIC_NAMES[0] ) == PerformanceMonitor::METRIC_COUNT );
+
+const unsigned int MAX_TRACE_EVENT_COUNT = 1u << 20; ///< Stop recording once reached, to bound the memory used
+
+/**
+ * Whether a metric is the time spent in a phase, rather than a counter
+ */
+bool IsTimed( unsigned int metric )
+{
+  switch( metric )
+  {
+    case PerformanceMonitor::RESET_PROPERTIES:
+    case PerformanceMonitor::PROCESS_MESSAGES:
+    case PerformanceMonitor::ANIMATE_NODES:
+    case PerformanceMonitor::APPLY_CONSTRAINTS:
+    case PerformanceMonitor::UPDATE_NODES:
+    case PerformanceMonitor::PREPARE_RENDERABLES:
+    case PerformanceMonitor::PROCESS_RENDER_TASKS:
+    case PerformanceMonitor::DRAW_NODES:
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @return The time of a monotonic clock, in microseconds
+ */
+uint64_t GetTimeMicroseconds()
+{
+  timespec time;
+  clock_gettime( CLOCK_MONOTONIC, &time );
+  return static_cast< uint64_t >( time.tv_sec ) * 1000000u + static_cast< uint64_t >( time.tv_nsec / 1000 );
+}
+
+/**
+ * An entry of the trace; either a timed phase or the value of a counter at the end of a frame
+ */
+struct TraceEvent
+{
+  uint64_t time;          ///< The start of the phase, or the end of the frame
+  unsigned int value;     ///< The duration of the phase, or the value of the counter
+  unsigned int metric;
+  unsigned int threadId;
+};
+
+typedef std::vector< TraceEvent > TraceEventContainer;
+
+// Written by the thread owning the phase only
+__thread uint64_t gStartTime[ PerformanceMonitor::METRIC_COUNT ];
+__thread unsigned int gThreadId = 0u;
+
+// Accumulated from any thread with atomic operations, until the end of the frame
+volatile unsigned int gFrameValues[ PerformanceMonitor::METRIC_COUNT ];
+
+// The following are protected by gMutex
+Mutex gMutex;
+unsigned int gHistory[ PerformanceMonitor::METRIC_COUNT ][ PerformanceMonitor::HISTORY_FRAME_COUNT ];
+unsigned int gHistoryFrameCount = 0u;   ///< The number of frames stored in the history
+unsigned int gHistoryPosition = 0u;     ///< Where the next frame is stored
+uint64_t gFrameStartTime = 0u;          ///< The start time of the current frame, or zero
+TraceEventContainer gTraceEvents;
+bool gTracing = false;                  ///< Written with gMutex locked, but read atomically by End() before locking it
+
+volatile unsigned int gNextThreadId = 0u;
+
+unsigned int GetThreadId()
+{
+  if( 0u == gThreadId )
+  {
+    gThreadId = __sync_add_and_fetch( &gNextThreadId, 1u );
+  }
+  return gThreadId;
+}
+
+/**
+ * Adds an event to the trace; gMutex must be locked
+ */
+void AddTraceEvent( uint64_t time, unsigned int value, unsigned int metric, unsigned int threadId )
+{
+  if( gTraceEvents.size() < MAX_TRACE_EVENT_COUNT )
+  {
+    TraceEvent event = { time, value, metric, threadId };
+    gTraceEvents.push_back( event );
+  }
+}
+
+} // unnamed namespace
+
+bool PerformanceMonitor::mEnabled = false;
+
+void PerformanceMonitor::Enable( bool enable )
+{
+  Mutex::ScopedLock lock( gMutex );
+
+  if( enable && !__atomic_load_n( &mEnabled, __ATOMIC_RELAXED ) )
+  {
+    for( unsigned int i = 0; i < METRIC_COUNT; ++i )
+    {
+      __sync_fetch_and_and( &gFrameValues[i], 0u );
+    }
+    gHistoryFrameCount = 0u;
+    gHistoryPosition = 0u;
+    gFrameStartTime = 0u;
+  }
+  __atomic_store_n( &mEnabled, enable, __ATOMIC_RELEASE );
+}
+
+void PerformanceMonitor::Start( Metric metric )
+{
+  gStartTime[ metric ] = GetTimeMicroseconds();
+}
+
+void PerformanceMonitor::End( Metric metric )
+{
+  const uint64_t startTime = gStartTime[ metric ];
+  if( 0u != startTime ) // The monitor may have been enabled during the phase
+  {
+    gStartTime[ metric ] = 0u;
+    const unsigned int duration = static_cast< unsigned int >( GetTimeMicroseconds() - startTime );
+    __sync_fetch_and_add( &gFrameValues[ metric ], duration );
+
+    if( __atomic_load_n( &gTracing, __ATOMIC_RELAXED ) )
+    {
+      Mutex::ScopedLock lock( gMutex );
+      if( gTracing )
+      {
+        AddTraceEvent( startTime, duration, metric, GetThreadId() );
+      }
+    }
+  }
+}
+
+void PerformanceMonitor::Increase( Metric metric, unsigned int value )
+{
+  __sync_fetch_and_add( &gFrameValues[ metric ], value );
+}
+
+void PerformanceMonitor::NextFrame()
+{
+  const uint64_t time = GetTimeMicroseconds();
+
+  Mutex::ScopedLock lock( gMutex );
+
+  if( 0u != gFrameStartTime )
+  {
+    __sync_fetch_and_add( &gFrameValues[ FRAME_TIME ], static_cast< unsigned int >( time - gFrameStartTime ) );
+
+    for( unsigned int i = 0; i < METRIC_COUNT; ++i )
+    {
+      const unsigned int value = __sync_fetch_and_and( &gFrameValues[i], 0u );
+      gHistory[i][ gHistoryPosition ] = value;
+
+      if( gTracing && !IsTimed( i ) )
+      {
+        AddTraceEvent( time, value, i, 0u );
+      }
+    }
+
+    gHistoryPosition = ( gHistoryPosition + 1u ) % HISTORY_FRAME_COUNT;
+    if( gHistoryFrameCount < HISTORY_FRAME_COUNT )
+    {
+      ++gHistoryFrameCount;
+    }
+  }
+  else
+  {
+    // The first frame monitored is incomplete
+    for( unsigned int i = 0; i < METRIC_COUNT; ++i )
+    {
+      __sync_fetch_and_and( &gFrameValues[i], 0u );
+    }
+  }
+
+  gFrameStartTime = time;
+}
+
+bool PerformanceMonitor::GetStatistics( Metric metric, Integration::PerformanceStatistics& statistics )
+{
+  std::vector< unsigned int > values;
+  {
+    Mutex::ScopedLock lock( gMutex );
+    values.assign( gHistory[ metric ], gHistory[ metric ] + gHistoryFrameCount );
+  }
+
+  statistics.frameCount = values.size();
+  if( values.empty() )
+  {
+    statistics.minimum = statistics.average = statistics.percentile99 = 0.0f;
+    return false;
+  }
+
+  std::sort( values.begin(), values.end() );
+
+  double sum( 0.0 );
+  for( std::vector< unsigned int >::const_iterator iter = values.begin(), endIter = values.end(); iter != endIter; ++iter )
+  {
+    sum += *iter;
+  }
+
+  // Nearest rank
+  const std::size_t rank = ( values.size() * 99u + 99u ) / 100u;
+
+  statistics.minimum = values.front();
+  statistics.average = static_cast< float >( sum / values.size() );
+  statistics.percentile99 = values[ rank - 1u ];
+
+  return true;
+}
+
+void PerformanceMonitor::StartTrace()
+{
+  Mutex::ScopedLock lock( gMutex );
+  gTraceEvents.clear();
+  __atomic_store_n( &gTracing, true, __ATOMIC_RELAXED );
+}
+
+bool PerformanceMonitor::StopTrace( const char* filename )
+{
+  TraceEventContainer events;
+  {
+    Mutex::ScopedLock lock( gMutex );
+    __atomic_store_n( &gTracing, false, __ATOMIC_RELAXED );
+    events.swap( gTraceEvents );
+  }
+
+  FILE* file = fopen( filename, "w" );
+  if( NULL == file )
+  {
+    return false;
+  }
+
+  fprintf( file, "{\"traceEvents\":[" );
+  for( TraceEventContainer::const_iterator iter = events.begin(), endIter = events.end(); iter != endIter; ++iter )
+  {
+    const char* separator = ( iter == events.begin() ) ? "\n" : ",\n";
+    if( IsTimed( iter->metric ) )
+    {
+      fprintf( file, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%llu,\"dur\":%u}",
+               separator, METRIC_NAMES[ iter->metric ], iter->threadId, static_cast< unsigned long long >( iter->time ), iter->value );
+    }
+    else
+    {
+      fprintf( file, "%s{\"name\":\"%s\",\"ph\":\"C\",\"pid\":1,\"tid\":%u,\"ts\":%llu,\"args\":{\"value\":%u}}",
+               separator, METRIC_NAMES[ iter->metric ], iter->threadId, static_cast< unsigned long long >( iter->time ), iter->value );
+    }
+  }
+  fprintf( file, "\n]}\n" );
+
+  return 0 == fclose( file );
+}
+
+} // namespace Internal
+
+} // namespace Dali
@@ -18,17 +18,21 @@
  *
  */
 
+// INTERNAL INCLUDES
+#include <dali/integration-api/profiling.h>
+
 namespace Dali
 {
 
 namespace Internal
 {
 
-
-
 /**
  * @brief PerformanceMonitor.
- * Empty stubs should we decided to hook into monitoring counters
+ * Times the phases of each frame and counts the work done per frame, when enabled.
+ * The timings use a monotonic clock; the counters are updated atomically, so the markers can be used
+ * from any thread without locking. The values of each frame are kept for the last HISTORY_FRAME_COUNT
+ * frames, from which the minimum, average and 99th percentile are calculated.
  */
 class PerformanceMonitor
 {
@@ -39,32 +43,99 @@ public:
    */
   enum Metric
   {
-    FRAME_RATE,
-    MATRIX_MULTIPLYS,
-    QUATERNION_TO_MATRIX,
-    FLOAT_POINT_MULTIPLY,
-    RESET_PROPERTIES,
-    PROCESS_MESSAGES,
-    ANIMATE_NODES,
-    ANIMATORS_APPLIED,
-    APPLY_CONSTRAINTS,
-    CONSTRAINTS_APPLIED,
-    CONSTRAINTS_SKIPPED,
-    UPDATE_NODES,
-    PREPARE_RENDERABLES,
-    PROCESS_RENDER_TASKS,
-    DRAW_NODES,
+    FRAME_TIME            = Integration::PERFORMANCE_METRIC_FRAME_TIME,
+    MATRIX_MULTIPLYS      = Integration::PERFORMANCE_METRIC_MATRIX_MULTIPLYS,
+    QUATERNION_TO_MATRIX  = Integration::PERFORMANCE_METRIC_QUATERNION_TO_MATRIX,
+    FLOAT_POINT_MULTIPLY  = Integration::PERFORMANCE_METRIC_FLOAT_POINT_MULTIPLY,
+    RESET_PROPERTIES      = Integration::PERFORMANCE_METRIC_RESET_PROPERTIES,
+    PROCESS_MESSAGES      = Integration::PERFORMANCE_METRIC_PROCESS_MESSAGES,
+    ANIMATE_NODES         = Integration::PERFORMANCE_METRIC_ANIMATE_NODES,
+    ANIMATORS_APPLIED     = Integration::PERFORMANCE_METRIC_ANIMATORS_APPLIED,
+    APPLY_CONSTRAINTS     = Integration::PERFORMANCE_METRIC_APPLY_CONSTRAINTS,
+    CONSTRAINTS_APPLIED   = Integration::PERFORMANCE_METRIC_CONSTRAINTS_APPLIED,
+    CONSTRAINTS_SKIPPED   = Integration::PERFORMANCE_METRIC_CONSTRAINTS_SKIPPED,
+    UPDATE_NODES          = Integration::PERFORMANCE_METRIC_UPDATE_NODES,
+    MATRICES_SKIPPED      = Integration::PERFORMANCE_METRIC_MATRICES_SKIPPED,
+    PREPARE_RENDERABLES   = Integration::PERFORMANCE_METRIC_PREPARE_RENDERABLES,
+    PROCESS_RENDER_TASKS  = Integration::PERFORMANCE_METRIC_PROCESS_RENDER_TASKS,
+    DRAW_NODES            = Integration::PERFORMANCE_METRIC_DRAW_NODES,
+    DRAW_CALLS_SAVED      = Integration::PERFORMANCE_METRIC_DRAW_CALLS_SAVED,
+    TEXTURE_DATA_UPLOADED = Integration::PERFORMANCE_METRIC_TEXTURE_DATA_UPLOADED,
+
+    METRIC_COUNT          = Integration::PERFORMANCE_METRIC_END
   };
+
+  static const unsigned int HISTORY_FRAME_COUNT = 128u; ///< The number of frames the statistics are calculated from
+
+  /**
+   * Enables or disables the monitor. Enabling it clears the values of the previous frames.
+   * @param[in] enable True to enable the monitor.
+   */
+  static void Enable( bool enable );
+
+  /**
+   * Query whether the monitor is enabled.
+   * @return True if enabled.
+   */
+  static bool IsEnabled()
+  {
+    // Read by every thread, while Enable() may write it from another one
+    return __atomic_load_n( &mEnabled, __ATOMIC_ACQUIRE );
+  }
+
+  /**
+   * Marks the start of a timed phase in the calling thread.
+   * @param[in] metric The phase.
+   */
+  static void Start( Metric metric );
+
+  /**
+   * Marks the end of a timed phase in the calling thread; the time since Start() is added to the current frame.
+   * @param[in] metric The phase.
+   */
+  static void End( Metric metric );
+
+  /**
+   * Increases a counter of the current frame.
+   * @param[in] metric The counter.
+   * @param[in] value The amount to add.
+   */
+  static void Increase( Metric metric, unsigned int value );
+
+  /**
+   * Stores the values of the current frame in the history, then starts a new frame.
+   * This is called by the update thread at the start of each update.
+   */
+  static void NextFrame();
+
+  /**
+   * @copydoc Dali::Integration::GetPerformanceStatistics()
+   */
+  static bool GetStatistics( Metric metric, Integration::PerformanceStatistics& statistics );
+
+  /**
+   * @copydoc Dali::Integration::StartPerformanceTrace()
+   */
+  static void StartTrace();
+
+  /**
+   * @copydoc Dali::Integration::StopPerformanceTrace()
+   */
+  static bool StopTrace( const char* filename );
+
+private:
+
+  static bool mEnabled; ///< Whether the monitor is enabled; accessed with atomic operations
 };
 
 #define PERFORMANCE_MONITOR_INIT(x)
-#define PERF_MONITOR_START(x)     // start of timed event
-#define PERF_MONITOR_END(x)       // end of a timed event
-#define INCREASE_COUNTER(x)       // increase a counter by 1
-#define INCREASE_BY(x,y)          // increase a count by x
-#define MATH_INCREASE_COUNTER(x)  // increase a math counter ( MATRIX_MULTIPLYS, QUATERNION_TO_MATRIX, FLOAT_POINT_MULTIPLY)
+#define PERF_MONITOR_START(x)     do { if( PerformanceMonitor::IsEnabled() ) { PerformanceMonitor::Start( x ); } } while( false )    // start of timed event
+#define PERF_MONITOR_END(x)       do { if( PerformanceMonitor::IsEnabled() ) { PerformanceMonitor::End( x ); } } while( false )      // end of a timed event
+#define INCREASE_COUNTER(x)       do { if( PerformanceMonitor::IsEnabled() ) { PerformanceMonitor::Increase( x, 1u ); } } while( false ) // increase a counter by 1
+#define INCREASE_BY(x,y)          do { if( PerformanceMonitor::IsEnabled() ) { PerformanceMonitor::Increase( x, y ); } } while( false )  // increase a count by x
+#define MATH_INCREASE_COUNTER(x)  // increase a math counter ( MATRIX_MULTIPLYS, QUATERNION_TO_MATRIX, FLOAT_POINT_MULTIPLY); not monitored as the math is too fine grained
 #define MATH_INCREASE_BY(x,y)     // increase a math counter by x
-#define PERF_MONITOR_NEXT_FRAME() // update started rendering a new frame
+#define PERF_MONITOR_NEXT_FRAME() do { if( PerformanceMonitor::IsEnabled() ) { PerformanceMonitor::NextFrame(); } } while( false )    // update started rendering a new frame
 
 } // namespace Internal
 
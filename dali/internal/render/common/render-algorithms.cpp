@@ -19,6 +19,7 @@
 #include <dali/internal/render/common/render-algorithms.h>
 
 // INTERNAL INCLUDES
+#include <dali/internal/common/math.h>
 #include <dali/internal/render/common/render-debug.h>
 #include <dali/internal/render/common/render-list.h>
 #include <dali/internal/render/common/render-instruction.h>
@@ -61,17 +62,27 @@ const int DaliStencilOperationToGL[] = { GL_ZERO, GL_KEEP, GL_REPLACE, GL_INCR,
  * Sets up the scissor test if required.
  * @param[in] renderList The render list from which to get the clipping flag
  * @param[in] context The context
+ * @param[in] damagedArea The area of the surface to render, or NULL
  */
-inline void SetScissorTest( const RenderList& renderList, Context& context )
+inline void SetScissorTest( const RenderList& renderList, Context& context, const Rect<int>* damagedArea )
 {
   // Scissor testing
   if( renderList.IsClipping() )
   {
     context.SetScissorTest( true );
 
-    const Dali::ClippingBox& clip = renderList.GetClippingBox();
+    Dali::ClippingBox clip = renderList.GetClippingBox();
+    if( damagedArea )
+    {
+      IntersectRect( clip, *damagedArea );
+    }
     context.Scissor(clip.x, clip.y, clip.width, clip.height);
   }
+  else if( damagedArea )
+  {
+    context.SetScissorTest( true );
+    context.Scissor( damagedArea->x, damagedArea->y, damagedArea->width, damagedArea->height );
+  }
   else
   {
     context.SetScissorTest( false );
@@ -207,6 +218,95 @@ inline void SetupDepthBuffer( const RenderItem& item, Context& context, bool isL
   context.EnableDepthBuffer( enableDepthWrite || enableDepthTest );
 }
 
+/**
+ * Counts the consecutive items, starting at a given one, which can be drawn with one instanced draw call.
+ * The renderers must be batch compatible, and the items must have the same size, opacity and node uniforms.
+ * @param[in] renderList The render-list holding the items
+ * @param[in] first The index of the first item
+ * @param[in] bufferIndex The current render buffer index (previous update buffer)
+ * @return The number of items which can be drawn together, at least 1
+ */
+inline size_t GetBatchSize( const RenderList& renderList, size_t first, BufferIndex bufferIndex )
+{
+  const RenderItem& firstItem = renderList.GetItem( first );
+  const SceneGraph::CollectedUniformMap& firstUniformMap = firstItem.mNode->GetUniformMap( bufferIndex );
+
+  const size_t count = renderList.Count();
+  size_t index = first + 1u;
+  for( ; index < count; ++index )
+  {
+    const RenderItem& item = renderList.GetItem( index );
+    if( item.mSize != firstItem.mSize ||
+        item.mIsOpaque != firstItem.mIsOpaque ||
+        !item.mRenderer->IsBatchCompatible( bufferIndex, *firstItem.mRenderer ) )
+    {
+      break;
+    }
+
+    // Uniforms mapped to node properties would be different for each item
+    const SceneGraph::CollectedUniformMap& uniformMap = item.mNode->GetUniformMap( bufferIndex );
+    bool sameUniforms = ( uniformMap.Count() == firstUniformMap.Count() );
+    for( SceneGraph::CollectedUniformMap::SizeType i = 0; sameUniforms && i < uniformMap.Count(); ++i )
+    {
+      sameUniforms = ( uniformMap[i]->propertyPtr == firstUniformMap[i]->propertyPtr );
+    }
+    if( !sameUniforms )
+    {
+      break;
+    }
+  }
+
+  return index - first;
+}
+
+/**
+ * Renders the item at the given index of a render-list, together with the following items when they can be
+ * drawn with the same instanced draw call, if the context supports it.
+ * @param[in] renderList The render-list holding the items.
+ * @param[in,out] index The index of the item to render; on return, the index of the next item to render.
+ * @param[in,out] unbatchedEnd The index before which no item can be instanced, as the shader does not support it.
+ * @param[in] context The GL context.
+ * @param[in] defaultShader The default shader to use.
+ * @param[in] buffer The current render buffer index (previous update buffer)
+ * @param[in] viewMatrix The view matrix from the appropriate camera.
+ * @param[in] projectionMatrix The projection matrix from the appropriate camera.
+ * @return The number of draw calls saved
+ */
+inline unsigned int RenderItems( const RenderList& renderList,
+                                 size_t& index,
+                                 size_t& unbatchedEnd,
+                                 Context& context,
+                                 SceneGraph::TextureCache& textureCache,
+                                 SceneGraph::Shader& defaultShader,
+                                 BufferIndex bufferIndex,
+                                 const Matrix& viewMatrix,
+                                 const Matrix& projectionMatrix )
+{
+  const RenderItem& item = renderList.GetItem( index );
+
+  // Instanced drawing needs OpenGL ES 3.0
+  if( index >= unbatchedEnd && context.IsInstancingSupported() )
+  {
+    const size_t batchSize = GetBatchSize( renderList, index, bufferIndex );
+    if( batchSize > 1u )
+    {
+      if( item.mRenderer->RenderInstances( context, textureCache, bufferIndex, renderList, index, batchSize, viewMatrix, projectionMatrix ) )
+      {
+        index += batchSize;
+        return batchSize - 1u;
+      }
+
+      // Avoid checking the same items again
+      unbatchedEnd = index + batchSize;
+    }
+  }
+
+  item.mRenderer->Render( context, textureCache, bufferIndex, *item.mNode, defaultShader,
+                          item.mModelMatrix, item.mModelViewMatrix, viewMatrix, projectionMatrix, item.mSize, !item.mIsOpaque );
+  ++index;
+  return 0u;
+}
+
 /**
  * Process a render-list.
  * @param[in] renderList The render-list to process.
@@ -215,15 +315,18 @@ inline void SetupDepthBuffer( const RenderItem& item, Context& context, bool isL
  * @param[in] buffer The current render buffer index (previous update buffer)
  * @param[in] viewMatrix The view matrix from the appropriate camera.
  * @param[in] projectionMatrix The projection matrix from the appropriate camera.
+ * @param[in] damagedArea The area of the surface to render, or NULL
+ * @return The number of draw calls saved by instanced drawing
  */
-inline void ProcessRenderList(
+inline unsigned int ProcessRenderList(
   const RenderList& renderList,
   Context& context,
   SceneGraph::TextureCache& textureCache,
   SceneGraph::Shader& defaultShader,
   BufferIndex bufferIndex,
   const Matrix& viewMatrix,
-  const Matrix& projectionMatrix )
+  const Matrix& projectionMatrix,
+  const Rect<int>* damagedArea )
 {
   DALI_PRINT_RENDER_LIST( renderList );
 
@@ -231,8 +334,10 @@ inline void ProcessRenderList(
   bool isLayer3D = renderList.GetSourceLayer()->GetBehavior() == Dali::Layer::LAYER_3D;
   bool usedStencilBuffer = false;
   bool stencilManagedByDrawMode = renderList.GetFlags() & RenderList::STENCIL_BUFFER_ENABLED;
+  unsigned int drawCallsSaved = 0u;
+  size_t unbatchedEnd = 0u;
 
-  SetScissorTest( renderList, context );
+  SetScissorTest( renderList, context, damagedArea );
   SetRenderFlags( renderList, context, depthTestEnabled, isLayer3D );
 
   // The Layers depth enabled flag overrides the per-renderer depth flags.
@@ -241,20 +346,20 @@ inline void ProcessRenderList(
   if( DALI_LIKELY( !renderList.HasColorRenderItems() || !depthTestEnabled ) )
   {
     size_t count = renderList.Count();
-    for ( size_t index = 0; index < count; ++index )
+    for ( size_t index = 0; index < count; )
     {
       const RenderItem& item = renderList.GetItem( index );
       DALI_PRINT_RENDER_ITEM( item );
 
+      // The items drawn with the same instanced draw call have the same flags
       SetupPerRendererFlags( item, context, usedStencilBuffer, stencilManagedByDrawMode );
-      item.mRenderer->Render( context, textureCache, bufferIndex, *item.mNode, defaultShader,
-                              item.mModelMatrix, item.mModelViewMatrix, viewMatrix, projectionMatrix, item.mSize, !item.mIsOpaque );
+      drawCallsSaved += RenderItems( renderList, index, unbatchedEnd, context, textureCache, defaultShader, bufferIndex, viewMatrix, projectionMatrix );
     }
   }
   else
   {
     size_t count = renderList.Count();
-    for ( size_t index = 0; index < count; ++index )
+    for ( size_t index = 0; index < count; )
     {
       const RenderItem& item = renderList.GetItem( index );
       DALI_PRINT_RENDER_ITEM( item );
@@ -263,18 +368,22 @@ inline void ProcessRenderList(
       SetupDepthBuffer( item, context, isLayer3D );
       SetupPerRendererFlags( item, context, usedStencilBuffer, stencilManagedByDrawMode );
 
-      item.mRenderer->Render( context, textureCache, bufferIndex, *item.mNode, defaultShader,
-                              item.mModelMatrix, item.mModelViewMatrix, viewMatrix, projectionMatrix, item.mSize, !item.mIsOpaque );
+      drawCallsSaved += RenderItems( renderList, index, unbatchedEnd, context, textureCache, defaultShader, bufferIndex, viewMatrix, projectionMatrix );
     }
   }
+
+  return drawCallsSaved;
 }
 
-void ProcessRenderInstruction( const RenderInstruction& instruction,
-                               Context& context,
-                               SceneGraph::TextureCache& textureCache,
-                               SceneGraph::Shader& defaultShader,
-                               BufferIndex bufferIndex )
+unsigned int ProcessRenderInstruction( const RenderInstruction& instruction,
+                                       Context& context,
+                                       SceneGraph::TextureCache& textureCache,
+                                       SceneGraph::Shader& defaultShader,
+                                       BufferIndex bufferIndex,
+                                       const Rect<int>* damagedArea )
 {
+  unsigned int drawCallsSaved = 0u;
+
   DALI_PRINT_RENDER_INSTRUCTION( instruction, bufferIndex );
 
   const Matrix* viewMatrix       = instruction.GetViewMatrix( bufferIndex );
@@ -297,10 +406,12 @@ void ProcessRenderInstruction( const RenderInstruction& instruction,
       if(  renderList &&
           !renderList->IsEmpty() )
       {
-        ProcessRenderList( *renderList, context, textureCache, defaultShader, bufferIndex, *viewMatrix, *projectionMatrix );
+        drawCallsSaved += ProcessRenderList( *renderList, context, textureCache, defaultShader, bufferIndex, *viewMatrix, *projectionMatrix, damagedArea );
       }
     }
   }
+
+  return drawCallsSaved;
 }
 
 } // namespace Render
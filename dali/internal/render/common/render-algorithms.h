@@ -19,6 +19,7 @@
  */
 
 // INTERNAL INCLUDES
+#include <dali/public-api/math/rect.h>
 #include <dali/internal/common/buffer-index.h>
 
 namespace Dali
@@ -44,12 +45,15 @@ namespace Render
  * @param[in] textureCache The texture cache used to get textures.
  * @param[in] defaultShader The default shader.
  * @param[in] bufferIndex The current render buffer index (previous update buffer)
+ * @param[in] damagedArea The area of the surface to render, or NULL to render the whole viewport.
+ * @return The number of draw calls saved by drawing several render items with one instanced draw call.
  */
-void ProcessRenderInstruction( const SceneGraph::RenderInstruction& instruction,
-                               Context& context,
-                               SceneGraph::TextureCache& textureCache,
-                               SceneGraph::Shader& defaultShader,
-                               BufferIndex bufferIndex );
+unsigned int ProcessRenderInstruction( const SceneGraph::RenderInstruction& instruction,
+                                       Context& context,
+                                       SceneGraph::TextureCache& textureCache,
+                                       SceneGraph::Shader& defaultShader,
+                                       BufferIndex bufferIndex,
+                                       const Rect<int>* damagedArea );
 
 } // namespace Render
 
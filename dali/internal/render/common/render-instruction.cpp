@@ -39,6 +39,8 @@ RenderInstruction::RenderInstruction()
   mIsClearColorSet( false ),
   mOffscreenTextureId( 0 ),
   mFrameBuffer( 0 ),
+  mDamagedRects(),
+  mIsDamageTracked( false ),
   mCamera( 0 ),
   mNextFreeRenderList( 0 )
 {
@@ -120,6 +122,8 @@ void RenderInstruction::Reset( Camera*         camera,
   mRenderTracker = NULL;
   mNextFreeRenderList = 0;
   mFrameBuffer = frameBuffer;
+  mDamagedRects.clear();
+  mIsDamageTracked = false;
 
   RenderListContainer::Iterator iter = mRenderLists.Begin();
   RenderListContainer::ConstIterator end = mRenderLists.End();
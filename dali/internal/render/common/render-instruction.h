@@ -19,7 +19,9 @@
  */
 
 // INTERNAL INCLUDES
+#include <dali/public-api/common/vector-wrapper.h>
 #include <dali/public-api/math/matrix.h>
+#include <dali/public-api/math/rect.h>
 #include <dali/public-api/math/viewport.h>
 #include <dali/internal/update/render-tasks/scene-graph-camera.h>
 #include <dali/internal/render/common/render-list.h>
@@ -144,6 +146,9 @@ public: // Data
   unsigned int mOffscreenTextureId;     ///< Optional offscreen target
   Render::FrameBuffer* mFrameBuffer;
 
+  std::vector< Rect<int> > mDamagedRects; ///< The areas which changed since the previous frame, in GL window coordinates
+  bool     mIsDamageTracked;            ///< Flag to determine whether mDamagedRects has been computed
+
 private: // Data
 
   Camera* mCamera;  ///< camera that is used
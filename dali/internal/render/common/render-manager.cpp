@@ -25,12 +25,15 @@
 #include <dali/public-api/render-tasks/render-task.h>
 #include <dali/integration-api/debug.h>
 #include <dali/integration-api/core.h>
+#include <dali/internal/common/math.h>
 #include <dali/internal/common/owner-pointer.h>
+#include <dali/internal/render/common/performance-monitor.h>
 #include <dali/internal/render/common/render-algorithms.h>
 #include <dali/internal/render/common/render-debug.h>
 #include <dali/internal/render/common/render-tracker.h>
 #include <dali/internal/render/common/render-instruction-container.h>
 #include <dali/internal/render/common/render-instruction.h>
+#include <dali/internal/render/common/texture-upload-queue.h>
 #include <dali/internal/render/data-providers/uniform-name-cache.h>
 #include <dali/internal/render/gl-resources/context.h>
 #include <dali/internal/render/gl-resources/frame-buffer-texture.h>
@@ -51,6 +54,13 @@ namespace Internal
 namespace SceneGraph
 {
 
+namespace
+{
+
+const unsigned int MAXIMUM_BUFFER_AGE( 4u ); ///< Above this back buffer age, the whole surface is rendered
+
+} // unnamed namespace
+
 typedef OwnerContainer< Render::Renderer* >    RendererOwnerContainer;
 typedef RendererOwnerContainer::Iterator       RendererOwnerIter;
 
@@ -95,11 +105,16 @@ struct RenderManager::Impl
     rendererContainer(),
     samplerContainer(),
     textureContainer(),
+    textureUploadQueue(),
     frameBufferContainer(),
     renderersAdded( false ),
     firstRenderCompleted( false ),
     defaultShader( NULL ),
-    programController( glAbstraction )
+    programController( glAbstraction ),
+    damageHistory(),
+    onScreenInstructionCount( 0u ),
+    partialUpdateEnabled( false ),
+    fullUpdateRequired( true )
   {
   }
 
@@ -134,6 +149,91 @@ struct RenderManager::Impl
     }
   }
 
+  /**
+   * Computes the area of the default surface to render, from the areas damaged by the on-screen instructions
+   * and, depending on the age of the back buffer, by the previous frames.
+   * @param[in,out] status The age of the back buffer is read, the damaged areas of the frame are added
+   * @param[out] damagedArea The area to render
+   * @return True if only the damaged area has to be rendered; false if the whole surface has to be rendered
+   */
+  bool GetDamagedArea( Integration::RenderStatus& status, Rect<int>& damagedArea )
+  {
+    bool partialUpdate = partialUpdateEnabled && !fullUpdateRequired;
+    fullUpdateRequired = false;
+
+    Rect<int> frameDamage( 0, 0, 0, 0 );
+    unsigned int instructionCount( 0u );
+    const size_t count = instructions.Count( renderBufferIndex );
+    for ( size_t i = 0; i < count; ++i )
+    {
+      const RenderInstruction& instruction = instructions.At( renderBufferIndex, i );
+      if( instruction.mOffscreenTextureId != 0 || instruction.mFrameBuffer != 0 )
+      {
+        // The result may be used by any on-screen renderer
+        partialUpdate = false;
+        continue;
+      }
+
+      ++instructionCount;
+      if( !instruction.mIsDamageTracked )
+      {
+        partialUpdate = false;
+        continue;
+      }
+
+      for( std::vector< Rect<int> >::const_iterator iter = instruction.mDamagedRects.begin(), endIter = instruction.mDamagedRects.end(); iter != endIter; ++iter )
+      {
+        MergeRect( frameDamage, *iter );
+      }
+    }
+
+    // The area of a removed or added render task is not tracked
+    if( instructionCount != onScreenInstructionCount )
+    {
+      partialUpdate = false;
+    }
+    onScreenInstructionCount = instructionCount;
+
+    // The back buffer misses the areas damaged by the frames rendered after it
+    const unsigned int bufferAge = status.GetBufferAge();
+    if( bufferAge == 0u || bufferAge > damageHistory.size() + 1u )
+    {
+      partialUpdate = false;
+    }
+
+    if( partialUpdate )
+    {
+      damagedArea = frameDamage;
+      for( unsigned int i(0); i + 1u < bufferAge; ++i )
+      {
+        MergeRect( damagedArea, damageHistory[i] );
+      }
+      IntersectRect( damagedArea, defaultSurfaceRect );
+
+      for ( size_t i = 0; i < count; ++i )
+      {
+        const RenderInstruction& instruction = instructions.At( renderBufferIndex, i );
+        for( std::vector< Rect<int> >::const_iterator iter = instruction.mDamagedRects.begin(), endIter = instruction.mDamagedRects.end(); iter != endIter; ++iter )
+        {
+          status.AddDamagedRect( *iter );
+        }
+      }
+    }
+    else
+    {
+      damagedArea = defaultSurfaceRect;
+      frameDamage = defaultSurfaceRect;
+    }
+
+    damageHistory.insert( damageHistory.begin(), frameDamage );
+    if( damageHistory.size() >= MAXIMUM_BUFFER_AGE )
+    {
+      damageHistory.resize( MAXIMUM_BUFFER_AGE - 1u );
+    }
+
+    return partialUpdate;
+  }
+
   // the order is important for destruction,
   // programs are owned by context at the moment.
   Context                       context;                  ///< holds the GL state
@@ -157,6 +257,7 @@ struct RenderManager::Impl
   RendererOwnerContainer        rendererContainer;        ///< List of owned renderers
   SamplerOwnerContainer         samplerContainer;         ///< List of owned samplers
   TextureOwnerContainer         textureContainer;         ///< List of owned textures
+  Render::TextureUploadQueue    textureUploadQueue;       ///< The uploads made over several frames, when they have a budget
   FrameBufferOwnerContainer     frameBufferContainer;     ///< List of owned framebuffers
   PropertyBufferOwnerContainer  propertyBufferContainer;  ///< List of owned property buffers
   GeometryOwnerContainer        geometryContainer;        ///< List of owned Geometries
@@ -168,6 +269,11 @@ struct RenderManager::Impl
   bool                          firstRenderCompleted;     ///< False until the first render is done
   Shader*                       defaultShader;            ///< Default shader to use
   ProgramController             programController;        ///< Owner of the GL programs
+
+  std::vector< Rect<int> >      damageHistory;            ///< The areas damaged by the last frames, most recent first
+  unsigned int                  onScreenInstructionCount; ///< The number of on-screen instructions of the last frame
+  bool                          partialUpdateEnabled;     ///< Whether only the damaged areas of the surface are rendered
+  bool                          fullUpdateRequired;       ///< Set when the next frame has to render the whole surface
 };
 
 RenderManager* RenderManager::New( Integration::GlAbstraction& glAbstraction,
@@ -211,6 +317,7 @@ TextureCache& RenderManager::GetTextureCache()
 
 void RenderManager::ContextCreated()
 {
+  mImpl->fullUpdateRequired = true;
   mImpl->context.GlContextCreated();
   mImpl->programController.GlContextCreated();
 
@@ -234,10 +341,17 @@ void RenderManager::ContextDestroyed()
     GlResourceOwner* renderer = *iter;
     renderer->GlContextDestroyed(); // Clear up vertex buffers
   }
+
+  // inform geometries
+  for ( GeometryOwnerIter iter = mImpl->geometryContainer.Begin(); iter != mImpl->geometryContainer.End(); ++iter )
+  {
+    (*iter)->GlContextDestroyed(); // Clear up vertex arrays
+  }
 }
 
 void RenderManager::DispatchTextureUploaded(ResourceId request)
 {
+  mImpl->fullUpdateRequired = true;
   mImpl->textureUploadedQueue.PushBack( request );
 }
 
@@ -254,11 +368,19 @@ RenderInstructionContainer& RenderManager::GetRenderInstructionContainer()
 void RenderManager::SetBackgroundColor( const Vector4& color )
 {
   mImpl->backgroundColor = color;
+  mImpl->fullUpdateRequired = true;
 }
 
 void RenderManager::SetDefaultSurfaceRect(const Rect<int>& rect)
 {
   mImpl->defaultSurfaceRect = rect;
+  mImpl->fullUpdateRequired = true;
+}
+
+void RenderManager::SetPartialUpdateEnabled( bool enabled )
+{
+  mImpl->partialUpdateEnabled = enabled;
+  mImpl->fullUpdateRequired = true;
 }
 
 void RenderManager::AddRenderer( Render::Renderer* renderer )
@@ -330,6 +452,7 @@ void RenderManager::RemoveTexture( Render::NewTexture* texture )
   {
     if ( *iter == texture )
     {
+      mImpl->textureUploadQueue.Remove( texture );
       texture->Destroy( mImpl->context );
       textures.Erase( iter ); // Texture found; now destroy it
       break;
@@ -339,18 +462,41 @@ void RenderManager::RemoveTexture( Render::NewTexture* texture )
 
 void RenderManager::UploadTexture( Render::NewTexture* texture, PixelDataPtr pixelData, const NewTexture::UploadParams& params )
 {
-  texture->Upload( mImpl->context, pixelData, params );
+  // The uploads of a texture are made in order; once one is queued, the next ones are queued too
+  if( mImpl->textureUploadQueue.HasBudget() || texture->IsUploadPending() )
+  {
+    mImpl->textureUploadQueue.Add( texture, pixelData, params );
+  }
+  else
+  {
+    texture->Upload( mImpl->context, pixelData, params );
+  }
+  mImpl->fullUpdateRequired = true;
 }
 
 void RenderManager::GenerateMipmaps( Render::NewTexture* texture )
 {
-  texture->GenerateMipmaps( mImpl->context );
+  if( mImpl->textureUploadQueue.HasBudget() || texture->IsUploadPending() )
+  {
+    mImpl->textureUploadQueue.AddGenerateMipmaps( texture );
+  }
+  else
+  {
+    texture->GenerateMipmaps( mImpl->context );
+  }
+  mImpl->fullUpdateRequired = true;
+}
+
+void RenderManager::SetTextureUploadBudget( std::size_t bytesPerFrame, unsigned int microsecondsPerFrame )
+{
+  mImpl->textureUploadQueue.SetBudget( bytesPerFrame, microsecondsPerFrame );
 }
 
 void RenderManager::SetFilterMode( Render::Sampler* sampler, unsigned int minFilterMode, unsigned int magFilterMode )
 {
   sampler->mMinificationFilter = static_cast<Dali::FilterMode::Type>(minFilterMode);
   sampler->mMagnificationFilter = static_cast<Dali::FilterMode::Type>(magFilterMode );
+  mImpl->fullUpdateRequired = true;
 }
 
 void RenderManager::SetWrapMode( Render::Sampler* sampler, unsigned int rWrapMode, unsigned int sWrapMode, unsigned int tWrapMode )
@@ -358,6 +504,7 @@ void RenderManager::SetWrapMode( Render::Sampler* sampler, unsigned int rWrapMod
   sampler->mRWrapMode = static_cast<Dali::WrapMode::Type>(rWrapMode);
   sampler->mSWrapMode = static_cast<Dali::WrapMode::Type>(sWrapMode);
   sampler->mTWrapMode = static_cast<Dali::WrapMode::Type>(tWrapMode);
+  mImpl->fullUpdateRequired = true;
 }
 
 void RenderManager::AddFrameBuffer( Render::FrameBuffer* frameBuffer )
@@ -419,11 +566,24 @@ void RenderManager::SetPropertyBufferFormat(Render::PropertyBuffer* propertyBuff
 void RenderManager::SetPropertyBufferData( Render::PropertyBuffer* propertyBuffer, Dali::Vector<char>* data, size_t size )
 {
   propertyBuffer->SetData( data, size );
+  mImpl->fullUpdateRequired = true;
+}
+
+void RenderManager::SetPropertyBufferDataRange( Render::PropertyBuffer* propertyBuffer, Dali::Vector<char>* data, size_t offset )
+{
+  propertyBuffer->SetDataRange( data, offset );
+  mImpl->fullUpdateRequired = true;
+}
+
+void RenderManager::SetPropertyBufferUsage( Render::PropertyBuffer* propertyBuffer, GpuBuffer::Usage usage )
+{
+  propertyBuffer->SetUsage( usage );
 }
 
 void RenderManager::SetIndexBuffer( Render::Geometry* geometry, Dali::Vector<unsigned short>& indices )
 {
   geometry->SetIndexBuffer( indices );
+  mImpl->fullUpdateRequired = true;
 }
 
 void RenderManager::AddGeometry( Render::Geometry* geometry )
@@ -520,8 +680,29 @@ bool RenderManager::Render( Integration::RenderStatus& status )
   // Process messages queued during previous update
   mImpl->renderQueue.ProcessMessages( mImpl->renderBufferIndex );
 
-  // No need to make any gl calls if we've done 1st glClear & don't have any renderers to render during startup.
-  if( !mImpl->firstRenderCompleted || mImpl->renderersAdded )
+  // Make the texture uploads within the budget of the frame
+  const unsigned int pendingUploadCount = mImpl->textureUploadQueue.GetCount();
+  if( pendingUploadCount > 0u )
+  {
+    const std::size_t uploadedBytes = mImpl->textureUploadQueue.Process( mImpl->context );
+    if( ( uploadedBytes > 0u ) || ( mImpl->textureUploadQueue.GetCount() != pendingUploadCount ) )
+    {
+      mImpl->fullUpdateRequired = true;
+    }
+  }
+  status.SetPendingTextureUploads( mImpl->textureUploadQueue.GetCount() );
+
+  // When partial updates are enabled, only the area damaged since the back buffer was rendered is cleared and rendered
+  status.ClearDamagedRects();
+  Rect<int> damagedArea;
+  const bool partialUpdate = mImpl->GetDamagedArea( status, damagedArea );
+  status.SetPartialUpdate( partialUpdate );
+  unsigned int drawCallsSaved = 0u;
+
+  // No need to make any gl calls if we've done 1st glClear & don't have any renderers to render during startup,
+  // or if nothing changed since the back buffer was rendered.
+  if( ( !mImpl->firstRenderCompleted || mImpl->renderersAdded ) &&
+      ( !partialUpdate || !damagedArea.IsEmpty() ) )
   {
     // switch rendering to adaptor provided (default) buffer
     mImpl->context.BindFramebuffer( GL_FRAMEBUFFER, 0 );
@@ -542,7 +723,15 @@ bool RenderManager::Render( Integration::RenderStatus& status )
     // It is important to clear all 3 buffers, for performance on deferred renderers like Mali
     // e.g. previously when the depth & stencil buffers were NOT cleared, it caused the DDK to exceed a "vertex count limit",
     // and then stall. That problem is only noticeable when rendering a large number of vertices per frame.
-    mImpl->context.SetScissorTest( false );
+    if( partialUpdate )
+    {
+      mImpl->context.SetScissorTest( true );
+      mImpl->context.Scissor( damagedArea.x, damagedArea.y, damagedArea.width, damagedArea.height );
+    }
+    else
+    {
+      mImpl->context.SetScissorTest( false );
+    }
     mImpl->context.ColorMask( true );
     mImpl->context.DepthMask( true );
     mImpl->context.StencilMask( 0xFF ); // 8 bit stencil mask, all 1's
@@ -555,21 +744,36 @@ bool RenderManager::Render( Integration::RenderStatus& status )
     // if we don't have default shader, no point doing the render calls
     if( mImpl->defaultShader )
     {
+      PERF_MONITOR_START( PerformanceMonitor::DRAW_NODES );
+
       size_t count = mImpl->instructions.Count( mImpl->renderBufferIndex );
       for ( size_t i = 0; i < count; ++i )
       {
         RenderInstruction& instruction = mImpl->instructions.At( mImpl->renderBufferIndex, i );
 
-        DoRender( instruction, *mImpl->defaultShader );
+        drawCallsSaved += DoRender( instruction, *mImpl->defaultShader, partialUpdate ? &damagedArea : NULL );
       }
+      // Leave the default vertex array bound for the other users of the context
+      mImpl->context.BindVertexArray( 0 );
       GLenum attachments[] = { GL_DEPTH, GL_STENCIL };
       mImpl->context.InvalidateFramebuffer(GL_FRAMEBUFFER, 2, attachments);
 
+      PERF_MONITOR_END( PerformanceMonitor::DRAW_NODES );
+
       mImpl->UpdateTrackers();
 
       mImpl->firstRenderCompleted = true;
     }
   }
+  else if( partialUpdate )
+  {
+    // Nothing changed, the back buffer is already up to date
+    mImpl->UpdateTrackers();
+  }
+
+  // Report the draw calls saved by drawing several renderers with one instanced draw call
+  status.SetDrawCallsSaved( drawCallsSaved );
+  INCREASE_BY( PerformanceMonitor::DRAW_CALLS_SAVED, drawCallsSaved );
 
   //Notify RenderGeometries that rendering has finished
   for ( GeometryOwnerIter iter = mImpl->geometryContainer.Begin(); iter != mImpl->geometryContainer.End(); ++iter )
@@ -587,10 +791,11 @@ bool RenderManager::Render( Integration::RenderStatus& status )
   DALI_PRINT_RENDER_END();
 
   // check if anything has been posted to the update thread, if IsEmpty then no update required.
-  return !mImpl->textureUploadedQueue.IsEmpty();
+  // Keep rendering until the queued texture uploads are complete.
+  return !mImpl->textureUploadedQueue.IsEmpty() || ( mImpl->textureUploadQueue.GetCount() > 0u );
 }
 
-void RenderManager::DoRender( RenderInstruction& instruction, Shader& defaultShader )
+unsigned int RenderManager::DoRender( RenderInstruction& instruction, Shader& defaultShader, const Rect<int>* damagedArea )
 {
   Rect<int> viewportRect;
   Vector4   clearColor;
@@ -629,7 +834,7 @@ void RenderManager::DoRender( RenderInstruction& instruction, Shader& defaultSha
     else
     {
       // Offscreen is NULL or could not be prepared.
-      return;
+      return 0u;
     }
   }
   else if( instruction.mFrameBuffer != 0 )
@@ -674,18 +879,24 @@ void RenderManager::DoRender( RenderInstruction& instruction, Shader& defaultSha
                                clearColor.a );
 
     // Clear the viewport area only
+    Rect<int> clearRect( viewportRect );
+    if( damagedArea )
+    {
+      IntersectRect( clearRect, *damagedArea );
+    }
     mImpl->context.SetScissorTest( true );
-    mImpl->context.Scissor( viewportRect.x, viewportRect.y, viewportRect.width, viewportRect.height );
+    mImpl->context.Scissor( clearRect.x, clearRect.y, clearRect.width, clearRect.height );
     mImpl->context.ColorMask( true );
     mImpl->context.Clear( GL_COLOR_BUFFER_BIT , Context::CHECK_CACHED_VALUES );
     mImpl->context.SetScissorTest( false );
   }
 
-  Render::ProcessRenderInstruction( instruction,
-                                    mImpl->context,
-                                    mImpl->textureCache,
-                                    defaultShader,
-                                    mImpl->renderBufferIndex );
+  const unsigned int drawCallsSaved = Render::ProcessRenderInstruction( instruction,
+                                                                       mImpl->context,
+                                                                       mImpl->textureCache,
+                                                                       defaultShader,
+                                                                       mImpl->renderBufferIndex,
+                                                                       damagedArea );
 
   if(instruction.mOffscreenTextureId != 0)
   {
@@ -701,6 +912,8 @@ void RenderManager::DoRender( RenderInstruction& instruction, Shader& defaultSha
     instruction.mRenderTracker->CreateSyncObject( mImpl->glSyncAbstraction );
     instruction.mRenderTracker = NULL; // Only create once.
   }
+
+  return drawCallsSaved;
 }
 
 } // namespace SceneGraph
@@ -150,6 +150,13 @@ public:
    */
   void SetDefaultSurfaceRect( const Rect<int>& rect );
 
+  /**
+   * Enable or disable partial updates; when enabled, only the areas damaged since the back buffer
+   * was rendered are cleared and rendered.
+   * @param[in] enabled True to enable partial updates.
+   */
+  void SetPartialUpdateEnabled( bool enabled );
+
   /**
    * Add a Renderer to the render manager.
    * @param[in] renderer The renderer to add.
@@ -251,6 +258,21 @@ public:
    */
   void SetPropertyBufferData( Render::PropertyBuffer* propertyBuffer, Dali::Vector<char>* data, size_t size );
 
+  /**
+   * Sets a range of the data of an existing property buffer
+   * @param[in] propertyBuffer The property buffer.
+   * @param[in] data The new data of the range
+   * @param[in] offset The offset of the range in bytes
+   */
+  void SetPropertyBufferDataRange( Render::PropertyBuffer* propertyBuffer, Dali::Vector<char>* data, size_t offset );
+
+  /**
+   * Sets how the data of an existing property buffer is updated
+   * @param[in] propertyBuffer The property buffer.
+   * @param[in] usage The usage of the GPU buffer
+   */
+  void SetPropertyBufferUsage( Render::PropertyBuffer* propertyBuffer, GpuBuffer::Usage usage );
+
   /**
    * Sets the data for the index buffer of an existing geometry
    * @param[in] geometry The geometry
@@ -291,6 +313,13 @@ public:
    */
   void GenerateMipmaps( Render::NewTexture* texture );
 
+  /**
+   * Set the budget of the texture uploads in each frame; the uploads exceeding it are made in the next frames.
+   * @param[in] bytesPerFrame The number of bytes uploaded in a frame, or 0 for no limit
+   * @param[in] microsecondsPerFrame The time spent uploading in a frame, or 0 for no limit
+   */
+  void SetTextureUploadBudget( std::size_t bytesPerFrame, unsigned int microsecondsPerFrame );
+
   /**
    * Adds a framebuffer to the render manager
    * @param[in] frameBuffer The framebuffer to add
@@ -353,8 +382,10 @@ private:
    * Helper to process a single RenderInstruction.
    * @param[in] instruction A description of the rendering operation.
    * @param[in] defaultShader default shader to use.
+   * @param[in] damagedArea The area of the default surface to render, or NULL to render the whole viewport.
+   * @return The number of draw calls saved by instanced drawing.
    */
-  void DoRender( RenderInstruction& instruction, Shader& defaultShader );
+  unsigned int DoRender( RenderInstruction& instruction, Shader& defaultShader, const Rect<int>* damagedArea );
 
 private:
 
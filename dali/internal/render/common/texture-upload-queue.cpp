@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/render/common/texture-upload-queue.h>
+
+// EXTERNAL INCLUDES
+#include <time.h>
+#include <stdint.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/render/gl-resources/context.h>
+#include <dali/internal/render/renderers/render-texture.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Render
+{
+
+namespace
+{
+
+const std::size_t STRIP_SIZE = 64u * 1024u; ///< The size of the strips, when only the time of the uploads is limited
+
+uint64_t GetTimeMicroseconds()
+{
+  timespec time;
+  clock_gettime( CLOCK_MONOTONIC, &time );
+  return static_cast< uint64_t >( time.tv_sec ) * 1000000u + time.tv_nsec / 1000u;
+}
+
+} // unnamed namespace
+
+TextureUploadQueue::TextureUploadQueue()
+: mUploads(),
+  mBytesPerFrame( 0u ),
+  mMicrosecondsPerFrame( 0u )
+{
+}
+
+TextureUploadQueue::~TextureUploadQueue()
+{
+}
+
+void TextureUploadQueue::SetBudget( std::size_t bytesPerFrame, unsigned int microsecondsPerFrame )
+{
+  mBytesPerFrame = bytesPerFrame;
+  mMicrosecondsPerFrame = microsecondsPerFrame;
+}
+
+void TextureUploadQueue::Add( NewTexture* texture, PixelDataPtr pixelData, const Internal::NewTexture::UploadParams& params )
+{
+  if( pixelData && ( params.width == 0u || params.height == 0u ) )
+  {
+    // Nothing to upload; an empty upload can't be split in rows either
+    return;
+  }
+
+  Upload upload;
+  upload.texture = texture;
+  upload.pixelData = pixelData;
+  upload.params = params;
+  upload.uploadedRows = 0u;
+  mUploads.push_back( upload );
+
+  texture->AddPendingUpload();
+}
+
+void TextureUploadQueue::AddGenerateMipmaps( NewTexture* texture )
+{
+  Internal::NewTexture::UploadParams params = { 0u, 0u, 0u, 0u, 0u, 0u };
+  Add( texture, PixelDataPtr(), params );
+}
+
+void TextureUploadQueue::Remove( NewTexture* texture )
+{
+  UploadContainer::iterator iter = mUploads.begin();
+  while( iter != mUploads.end() )
+  {
+    if( iter->texture == texture )
+    {
+      texture->RemovePendingUpload();
+      iter = mUploads.erase( iter );
+    }
+    else
+    {
+      ++iter;
+    }
+  }
+}
+
+std::size_t TextureUploadQueue::Process( Context& context )
+{
+  const uint64_t startTime = GetTimeMicroseconds();
+  std::size_t uploadedBytes = 0u;
+  bool withinBudget = true;
+
+  // The uploads of the textures requested by renderers first; the order of the uploads of each texture is kept
+  for( unsigned int pass = 0u; withinBudget && pass < 2u; ++pass )
+  {
+    const bool requested = ( pass == 0u );
+    UploadContainer::iterator iter = mUploads.begin();
+    while( withinBudget && iter != mUploads.end() )
+    {
+      Upload& upload( *iter );
+      if( upload.texture->IsUploadRequested() != requested )
+      {
+        ++iter;
+        continue;
+      }
+
+      const std::size_t remainingBytes = ( mBytesPerFrame == 0u ) ? static_cast< std::size_t >( -1 ) :
+                                         ( ( uploadedBytes < mBytesPerFrame ) ? mBytesPerFrame - uploadedBytes : 0u );
+      bool complete = true;
+
+      if( !upload.pixelData )
+      {
+        upload.texture->GenerateMipmaps( context );
+      }
+      else if( upload.texture->CanUploadRows( upload.params ) )
+      {
+        const std::size_t rowSize = upload.params.width * Pixel::GetBytesPerPixel( upload.pixelData->GetPixelFormat() );
+        const unsigned int remainingRows = upload.params.height - upload.uploadedRows;
+
+        std::size_t rowCount = remainingBytes / rowSize;
+        if( ( mMicrosecondsPerFrame > 0u ) && ( rowCount * rowSize > STRIP_SIZE ) )
+        {
+          // Check the time after each strip
+          rowCount = STRIP_SIZE / rowSize;
+        }
+        if( rowCount == 0u && uploadedBytes == 0u )
+        {
+          rowCount = 1u;
+        }
+
+        if( rowCount > 0u )
+        {
+          if( rowCount > remainingRows )
+          {
+            rowCount = remainingRows;
+          }
+          upload.texture->UploadRows( context, upload.pixelData, upload.params, upload.uploadedRows, static_cast< unsigned int >( rowCount ) );
+          upload.uploadedRows += static_cast< unsigned int >( rowCount );
+          uploadedBytes += rowCount * rowSize;
+        }
+
+        complete = ( upload.uploadedRows == upload.params.height );
+        withinBudget = complete || ( rowCount > 0u );
+      }
+      else if( ( upload.pixelData->GetBufferSize() <= remainingBytes ) || ( uploadedBytes == 0u ) )
+      {
+        upload.texture->Upload( context, upload.pixelData, upload.params );
+        uploadedBytes += upload.pixelData->GetBufferSize();
+      }
+      else
+      {
+        // Wait for the next frame, rather than exceeding the budget
+        complete = false;
+        withinBudget = false;
+      }
+
+      if( complete )
+      {
+        upload.texture->RemovePendingUpload();
+        iter = mUploads.erase( iter );
+      }
+
+      if( ( mBytesPerFrame > 0u && uploadedBytes >= mBytesPerFrame ) ||
+          ( mMicrosecondsPerFrame > 0u && GetTimeMicroseconds() - startTime >= mMicrosecondsPerFrame ) )
+      {
+        withinBudget = false;
+      }
+    }
+  }
+
+  return uploadedBytes;
+}
+
+} // namespace Render
+
+} // namespace Internal
+
+} // namespace Dali
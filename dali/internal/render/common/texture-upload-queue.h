@@ -0,0 +1,148 @@
+#ifndef __DALI_INTERNAL_RENDER_TEXTURE_UPLOAD_QUEUE_H
+#define __DALI_INTERNAL_RENDER_TEXTURE_UPLOAD_QUEUE_H
+
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstddef>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/vector-wrapper.h>
+#include <dali/internal/event/rendering/texture-impl.h>
+
+namespace Dali
+{
+namespace Internal
+{
+class Context;
+
+namespace Render
+{
+class NewTexture;
+
+/**
+ * Queues the texture uploads and uploads them over several frames, within a budget of bytes and of time per frame.
+ *
+ * The uploads of the textures which renderers tried to bind are made first; the other ones are made in the order
+ * they were queued. An upload which exceeds the budget is split in strips of rows, when the texture allows it.
+ * A texture is not bound until all the uploads queued for it are complete.
+ *
+ * Only the uploads to Render::NewTexture are queued. The bitmap textures of the images, held by the TextureCache,
+ * are still created and updated synchronously when bound.
+ */
+class TextureUploadQueue
+{
+public:
+
+  /**
+   * Constructor
+   */
+  TextureUploadQueue();
+
+  /**
+   * Destructor
+   */
+  ~TextureUploadQueue();
+
+  /**
+   * Set the budget of the uploads in each frame.
+   * @param[in] bytesPerFrame The number of bytes uploaded in a frame, or 0 for no limit
+   * @param[in] microsecondsPerFrame The time spent uploading in a frame, or 0 for no limit
+   */
+  void SetBudget( std::size_t bytesPerFrame, unsigned int microsecondsPerFrame );
+
+  /**
+   * Query whether the uploads are limited in each frame. If not, they need not be queued.
+   * @return True if a budget has been set.
+   */
+  bool HasBudget() const
+  {
+    return ( mBytesPerFrame > 0u ) || ( mMicrosecondsPerFrame > 0u );
+  }
+
+  /**
+   * Queue an upload. Uploads of an empty area are dropped.
+   * @param[in] texture The texture
+   * @param[in] pixelData The data to upload
+   * @param[in] params The parameters of the upload
+   */
+  void Add( NewTexture* texture, PixelDataPtr pixelData, const Internal::NewTexture::UploadParams& params );
+
+  /**
+   * Queue the generation of the mipmaps of a texture, to be made after the uploads queued before.
+   * @param[in] texture The texture
+   */
+  void AddGenerateMipmaps( NewTexture* texture );
+
+  /**
+   * Remove the uploads of a texture, e.g. when it is destroyed.
+   * @param[in] texture The texture
+   */
+  void Remove( NewTexture* texture );
+
+  /**
+   * Make the uploads which fit in the budget of a frame; at least one strip is uploaded.
+   * @param[in] context The GL context
+   * @return The number of bytes uploaded.
+   */
+  std::size_t Process( Context& context );
+
+  /**
+   * Query the number of uploads queued.
+   * @return The number of uploads pending, including the ones partially made.
+   */
+  unsigned int GetCount() const
+  {
+    return static_cast< unsigned int >( mUploads.size() );
+  }
+
+private:
+
+  /**
+   * An upload, or a mipmap generation if there is no pixel data
+   */
+  struct Upload
+  {
+    NewTexture* texture;
+    PixelDataPtr pixelData;
+    Internal::NewTexture::UploadParams params;
+    unsigned int uploadedRows;    ///< The number of rows uploaded, when the upload is split
+  };
+
+  typedef std::vector< Upload > UploadContainer;
+
+  // Undefined
+  TextureUploadQueue( const TextureUploadQueue& );
+
+  // Undefined
+  TextureUploadQueue& operator=( const TextureUploadQueue& rhs );
+
+private:
+
+  UploadContainer mUploads;             ///< The uploads in the order they were queued
+  std::size_t mBytesPerFrame;           ///< The number of bytes uploaded in a frame, or 0 for no limit
+  unsigned int mMicrosecondsPerFrame;   ///< The time spent uploading in a frame, or 0 for no limit
+};
+
+} // namespace Render
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_RENDER_TEXTURE_UPLOAD_QUEUE_H
@@ -36,28 +36,25 @@ UniformNameCache::~UniformNameCache()
 
 int32_t UniformNameCache::GetSamplerUniformUniqueIndex( const std::string& uniformName )
 {
-  OwnerContainer< UniformEntry* >::SizeType index = 0;
-  const OwnerContainer< UniformEntry* >::SizeType end = mSamplerUniformCache.Size();
-
   const std::size_t hash = Dali::CalculateHash( uniformName );
 
-  for( ;index < end; ++index )
+  // only the names with the same hash need comparing
+  std::pair< SamplerUniformIndices::const_iterator, SamplerUniformIndices::const_iterator > range = mSamplerUniformIndices.equal_range( hash );
+  for( SamplerUniformIndices::const_iterator iter = range.first; iter != range.second; ++iter )
   {
-    // check hash first
-    if( hash == mSamplerUniformCache[ index ]->nameHash )
+    // check full name in case of collision
+    if( mSamplerUniformCache[ iter->second ]->uniformName == uniformName )
     {
-      // check full name in case of collision
-      if( mSamplerUniformCache[ index ]->uniformName == uniformName )
-      {
-        // match, return the index
-        return index;
-      }
+      // match, return the index
+      return iter->second;
     }
   }
   // no match found, add new entry to cache
+  const int32_t index = mSamplerUniformCache.Size();
   mSamplerUniformCache.PushBack( new UniformEntry( uniformName, hash ) );
+  mSamplerUniformIndices.insert( range.second, std::make_pair( hash, index ) );
 
-  return end;
+  return index;
 }
 
 } // namespace Render
@@ -18,6 +18,7 @@
  */
 
 // EXTERNAL INCLUDES
+#include <map>
 #include <string>
 
 // INTERNAL INCLUDES
@@ -71,6 +72,9 @@ private: // Data
 
   OwnerContainer< UniformEntry* > mSamplerUniformCache;
 
+  typedef std::multimap< std::size_t, int32_t > SamplerUniformIndices;
+  SamplerUniformIndices mSamplerUniformIndices; ///< index of the entries in the cache, keyed by name hash
+
 };
 
 } // namespace Render
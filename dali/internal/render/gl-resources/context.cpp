@@ -95,7 +95,10 @@ Context::Context(Integration::GlAbstraction& glAbstraction)
   mMaxTextureSize(0),
   mClearColor(Color::WHITE),    // initial color, never used until it's been set by the user
   mCullFaceMode( FaceCullingMode::NONE ),
-  mViewPort( 0, 0, 0, 0 )
+  mViewPort( 0, 0, 0, 0 ),
+  mBoundVertexArrayId( 0 ),
+  mVertexArraySupport( -1 ),
+  mRecordingVertexArray( false )
 {
 }
 
@@ -125,6 +128,26 @@ void Context::GlContextDestroyed()
   mGlContextCreated = false;
 }
 
+bool Context::IsVertexArraySupported()
+{
+  if( mVertexArraySupport < 0 )
+  {
+    // e.g. "OpenGL ES 3.0 ..." or, for desktop OpenGL, "4.5.0 ..."
+    const char* version = reinterpret_cast< const char* >( GetString( GL_VERSION ) );
+    const char* OPENGL_ES = "OpenGL ES ";
+    const size_t OPENGL_ES_LENGTH = strlen( OPENGL_ES );
+    if( version && strncmp( version, OPENGL_ES, OPENGL_ES_LENGTH ) == 0 )
+    {
+      version += OPENGL_ES_LENGTH;
+    }
+    mVertexArraySupport = ( version && version[0] >= '3' && version[0] <= '9' ) ? 1 : 0;
+
+    DALI_LOG_INFO( gContextLogFilter, Debug::General, "Context::IsVertexArraySupported() %d\n", mVertexArraySupport );
+  }
+
+  return mVertexArraySupport == 1;
+}
+
 const char* Context::ErrorToString( GLenum errorCode )
 {
   for( unsigned int i = 0; i < sizeof(errors) / sizeof(errors[0]); ++i)
@@ -144,6 +167,12 @@ const Rect< int >& Context::GetViewport()
 
 void Context::FlushVertexAttributeLocations()
 {
+  if( mBoundVertexArrayId )
+  {
+    // The vertex array has its own attributes; the cache is for the default vertex array
+    return;
+  }
+
   for( unsigned int i = 0; i < MAX_ATTRIBUTE_CACHE_SIZE; ++i )
   {
     // see if our cached state is different to the actual state
@@ -170,6 +199,7 @@ void Context::FlushVertexAttributeLocations()
 
 void Context::SetVertexAttributeLocation(unsigned int location, bool state)
 {
+  UseDefaultVertexArray();
 
   if( location >= MAX_ATTRIBUTE_CACHE_SIZE )
   {
@@ -217,6 +247,10 @@ void Context::InitializeGlState()
   mBoundTransformFeedbackBufferId = 0;
   mActiveTextureUnit = TEXTURE_UNIT_IMAGE;
 
+  mBoundVertexArrayId = 0;
+  mVertexArraySupport = -1; // Queried when first needed
+  mRecordingVertexArray = false;
+
   mUsingDefaultBlendColor = true; //Default blend color is (0,0,0,0)
 
   mBlendFuncSeparateSrcRGB = GL_ONE;
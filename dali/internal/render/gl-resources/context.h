@@ -184,6 +184,16 @@ public:
    */
   void BindElementArrayBuffer(GLuint buffer)
   {
+    if( mRecordingVertexArray )
+    {
+      // The binding is part of the vertex array being recorded
+      LOG_GL("BindBuffer GL_ELEMENT_ARRAY_BUFFER %d\n", buffer);
+      CHECK_GL( mGlAbstraction, mGlAbstraction.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer) );
+      return;
+    }
+
+    UseDefaultVertexArray();
+
     // Avoid unecessary calls to BindBuffer
     if (mBoundElementArrayBufferId!= buffer)
     {
@@ -194,6 +204,58 @@ public:
     }
   }
 
+  /**
+   * Query whether vertex array objects are supported, i.e. whether the context is OpenGL ES 3.0 or later
+   * @return True if vertex array objects are supported.
+   */
+  bool IsVertexArraySupported();
+
+  /**
+   * Query whether instanced drawing is supported, i.e. glDrawElementsInstanced() and glVertexAttribDivisor();
+   * like vertex array objects, they require OpenGL ES 3.0 or later
+   * @return True if instanced drawing is supported.
+   */
+  bool IsInstancingSupported()
+  {
+    return IsVertexArraySupported();
+  }
+
+  /**
+   * Wrapper for OpenGL ES 3.0 glBindVertexArray()
+   * The calls changing the state of the default vertex array bind it again; the element array buffer and the
+   * vertex attributes are cached for the default vertex array only.
+   */
+  void BindVertexArray( GLuint vertexArray )
+  {
+    // Avoid unecessary calls to BindVertexArray
+    if( mBoundVertexArrayId != vertexArray )
+    {
+      mBoundVertexArrayId = vertexArray;
+
+      LOG_GL("BindVertexArray %d\n", vertexArray);
+      CHECK_GL( mGlAbstraction, mGlAbstraction.BindVertexArray( vertexArray ) );
+    }
+  }
+
+  /**
+   * Bind a new vertex array, and record the element array buffer and the vertex attributes set until
+   * EndVertexArray() in it.
+   * @param[in] vertexArray The vertex array to record.
+   */
+  void BeginVertexArray( GLuint vertexArray )
+  {
+    BindVertexArray( vertexArray );
+    mRecordingVertexArray = true;
+  }
+
+  /**
+   * Stop recording the vertex array; it stays bound for drawing.
+   */
+  void EndVertexArray()
+  {
+    mRecordingVertexArray = false;
+  }
+
   /**
    * Wrapper for OpenGL ES 3.0 glBindBuffer(GL_TRANSFORM_FEEDBACK_BUFFER, ...)
    */
@@ -625,6 +687,24 @@ public:
     CHECK_GL( mGlAbstraction, mGlAbstraction.DeleteFramebuffers(n, framebuffers) );
   }
 
+  /**
+   * Wrapper for OpenGL ES 3.0 glDeleteVertexArrays()
+   */
+  void DeleteVertexArrays(GLsizei n, const GLuint* arrays)
+  {
+    for( GLsizei i = 0; i < n; ++i )
+    {
+      if( arrays[i] == mBoundVertexArrayId )
+      {
+        // Deleting the bound vertex array binds the default one
+        mBoundVertexArrayId = 0;
+      }
+    }
+
+    LOG_GL("DeleteVertexArrays %d %p\n", n, arrays);
+    CHECK_GL( mGlAbstraction, mGlAbstraction.DeleteVertexArrays(n, arrays) );
+  }
+
   /**
    * Wrapper for OpenGL ES 3.0 glDeleteQueries()
    */
@@ -799,6 +879,15 @@ public:
     CHECK_GL( mGlAbstraction, mGlAbstraction.GenTransformFeedbacks(n, ids) );
   }
 
+  /**
+   * Wrapper for OpenGL ES 3.0 glGenVertexArrays()
+   */
+  void GenVertexArrays(GLsizei n, GLuint* arrays)
+  {
+    LOG_GL("GenVertexArrays %d %p\n", n, arrays);
+    CHECK_GL( mGlAbstraction, mGlAbstraction.GenVertexArrays(n, arrays) );
+  }
+
   /**
    * @return the current buffer bound for a given target
    */
@@ -832,6 +921,14 @@ public:
 
   void EnableVertexAttributeArray( GLuint location )
   {
+    if( mRecordingVertexArray )
+    {
+      // The attributes of a new vertex array are all disabled
+      LOG_GL("EnableVertexAttribArray %d\n", location);
+      CHECK_GL( mGlAbstraction, mGlAbstraction.EnableVertexAttribArray( location ) );
+      return;
+    }
+
     SetVertexAttributeLocation( location, true);
   }
 
@@ -845,6 +942,7 @@ public:
    */
   void VertexAttribDivisor ( GLuint index, GLuint divisor )
   {
+    UseDefaultVertexArray();
     LOG_GL("VertexAttribDivisor(%d, %d)\n", index, divisor );
     CHECK_GL( mGlAbstraction, mGlAbstraction.VertexAttribDivisor( index, divisor ) );
   }
@@ -854,10 +952,20 @@ public:
    */
   void VertexAttribPointer( GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* ptr )
   {
+    UseDefaultVertexArray();
     LOG_GL("VertexAttribPointer(%d, %d, %d, %d, %d, %x)\n", index, size, type, normalized, stride, ptr );
     CHECK_GL( mGlAbstraction, mGlAbstraction.VertexAttribPointer( index, size, type, normalized, stride, ptr ) );
   }
 
+  /**
+   * Wrapper for OpenGL ES 2.0 glVertexAttrib4fv()
+   */
+  void VertexAttrib4fv( GLuint index, const GLfloat* values )
+  {
+    LOG_GL("VertexAttrib4fv(%d, %p)\n", index, values );
+    CHECK_GL( mGlAbstraction, mGlAbstraction.VertexAttrib4fv( index, values ) );
+  }
+
   /**
    * Wrapper for OpenGL ES 3.0 glInvalidateFramebuffer()
    */
@@ -1673,6 +1781,17 @@ private: // Implementation
     return mStencilBufferEnabled && ( mStencilMask > 0 );
   }
 
+  /**
+   * Binds the default vertex array if another one is bound, unless it is being recorded
+   */
+  void UseDefaultVertexArray()
+  {
+    if( mBoundVertexArrayId && !mRecordingVertexArray )
+    {
+      BindVertexArray( 0 );
+    }
+  }
+
   /**
    * Flushes vertex attribute location changes to the driver
    */
@@ -1745,6 +1864,11 @@ private: // Data
   // cached viewport size
   Rect< int > mViewPort;
 
+  // glBindVertexArray() state
+  GLuint mBoundVertexArrayId;          ///< The ID passed to glBindVertexArray()
+  int mVertexArraySupport;             ///< Whether vertex arrays are supported; -1 until queried
+  bool mRecordingVertexArray;          ///< Whether the vertex array bound is being recorded
+
   // Vertex Attribute Buffer enable caching
   bool mVertexAttributeCachedState[ MAX_ATTRIBUTE_CACHE_SIZE ];    ///< Value cache for Enable Vertex Attribute
   bool mVertexAttributeCurrentState[ MAX_ATTRIBUTE_CACHE_SIZE ];   ///< Current state on the driver for Enable Vertex Attribute
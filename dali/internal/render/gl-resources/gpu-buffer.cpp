@@ -66,6 +66,7 @@ GpuBuffer::GpuBuffer( Context& context )
   mCapacity( 0 ),
   mSize( 0 ),
   mBufferId( 0 ),
+  mUsage( STATIC_DRAW ),
   mBufferCreated( false )
 {
 }
@@ -96,60 +97,34 @@ void GpuBuffer::UpdateDataBuffer(GLsizeiptr size, const GLvoid *data, Usage usag
     DALI_ASSERT_DEBUG(mBufferId);
   }
 
-  GLenum glTargetEnum = GL_ARRAY_BUFFER;
-
   // make sure the buffer is bound, don't perform any checks because size may be zero
-  if(ARRAY_BUFFER == target)
-  {
-    mContext.BindArrayBuffer( mBufferId );
-  }
-  else if(ELEMENT_ARRAY_BUFFER == target)
-  {
-    glTargetEnum = GL_ELEMENT_ARRAY_BUFFER;
-    mContext.BindElementArrayBuffer( mBufferId );
-  }
-  else if(TRANSFORM_FEEDBACK_BUFFER == target)
-  {
-    glTargetEnum = GL_TRANSFORM_FEEDBACK_BUFFER;
-    mContext.BindTransformFeedbackBuffer( mBufferId );
-  }
+  GLenum glTargetEnum = BindNoChecks( mBufferId, target );
 
-  // if the buffer has already been created, just update the data providing it fits
-  if (mBufferCreated )
+  // if the buffer has already been created, just update the data providing it fits and its usage is the same;
+  // a stream buffer gets a new data store instead of waiting for the GPU to finish reading the current one
+  if ( mBufferCreated && ( size <= mCapacity ) && ( usage == mUsage ) && ( usage != STREAM_DRAW ) )
   {
-    // if the data will fit in the existing buffer, just update it
-    if (size <= mCapacity )
-    {
-      mContext.BufferSubData( glTargetEnum, 0, size, data );
-    }
-    else
-    {
-      // create a new buffer of the larger size,
-      // gl should automatically deallocate the old buffer
-      mContext.BufferData( glTargetEnum, size, data, ModeAsGlEnum( usage ) );
-      mCapacity = size;
-    }
+    mContext.BufferSubData( glTargetEnum, 0, size, data );
   }
   else
   {
-    // create the buffer
+    // create the buffer, gl should automatically deallocate the old one
     mContext.BufferData( glTargetEnum, size, data, ModeAsGlEnum( usage ) );
     mBufferCreated = true;
     mCapacity = size;
+    mUsage = usage;
   }
 
-  if(ARRAY_BUFFER == target)
-  {
-    mContext.BindArrayBuffer( 0 );
-  }
-  else if(ELEMENT_ARRAY_BUFFER == target)
-  {
-    mContext.BindElementArrayBuffer( 0 );
-  }
-  else if(TRANSFORM_FEEDBACK_BUFFER == target)
-  {
-    mContext.BindTransformFeedbackBuffer( 0 );
-  }
+  BindNoChecks( 0, target );
+}
+
+void GpuBuffer::UpdateDataBufferRange(GLintptr offset, GLsizeiptr size, const GLvoid *data, Target target)
+{
+  DALI_ASSERT_DEBUG( mBufferCreated && ( offset + size <= mSize ) );
+
+  GLenum glTargetEnum = BindNoChecks( mBufferId, target );
+  mContext.BufferSubData( glTargetEnum, offset, size, data );
+  BindNoChecks( 0, target );
 }
 
 void GpuBuffer::Bind(Target target) const
@@ -175,6 +150,28 @@ bool GpuBuffer::BufferIsValid() const
   return mBufferCreated && (0 != mCapacity );
 }
 
+GLenum GpuBuffer::BindNoChecks(GLuint bufferId, Target target) const
+{
+  GLenum glTargetEnum = GL_ARRAY_BUFFER;
+
+  if(ARRAY_BUFFER == target)
+  {
+    mContext.BindArrayBuffer( bufferId );
+  }
+  else if(ELEMENT_ARRAY_BUFFER == target)
+  {
+    glTargetEnum = GL_ELEMENT_ARRAY_BUFFER;
+    mContext.BindElementArrayBuffer( bufferId );
+  }
+  else if(TRANSFORM_FEEDBACK_BUFFER == target)
+  {
+    glTargetEnum = GL_TRANSFORM_FEEDBACK_BUFFER;
+    mContext.BindTransformFeedbackBuffer( bufferId );
+  }
+
+  return glTargetEnum;
+}
+
 void GpuBuffer::GlContextDestroyed()
 {
   // If the context is destroyed, GL would have released the buffer.
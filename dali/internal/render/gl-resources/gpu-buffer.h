@@ -77,6 +77,8 @@ public:
   /**
    *
    * Creates or updates a buffer object and binds it to the target.
+   * A STREAM_DRAW buffer is given a new data store for each update (orphaning the previous one, which the GPU
+   * may still be reading), so the update does not wait for the draw calls of the previous frames.
    * @param size Specifies the size in bytes of the buffer object's new data store.
    * @param data pointer to the data to load
    * @param usage How the buffer will be used
@@ -84,6 +86,15 @@ public:
    */
   void UpdateDataBuffer(GLsizeiptr size, const GLvoid *data, Usage usage, Target target);
 
+  /**
+   * Updates a range of the data of a buffer object already created.
+   * @param offset Specifies the offset in bytes of the range to update
+   * @param size Specifies the size in bytes of the range to update
+   * @param data pointer to the data to load
+   * @param target The target buffer to update
+   */
+  void UpdateDataBufferRange(GLintptr offset, GLsizeiptr size, const GLvoid *data, Target target);
+
   /**
    * Bind the buffer object to the target
    * Will assert if the buffer size is zero
@@ -114,8 +125,10 @@ private:
   /**
    * Perfoms a bind without checking the size of the buffer
    * @param bufferId to bind
+   * @param target The target to bind the buffer to
+   * @return The GL enum of the target
    */
-  void BindNoChecks(GLuint bufferId) const;
+  GLenum BindNoChecks(GLuint bufferId, Target target) const;
 
 private: // Data
 
@@ -123,6 +136,7 @@ private: // Data
   GLsizeiptr         mCapacity;            ///< buffer capacity
   GLsizeiptr         mSize;                ///< buffer size
   GLuint             mBufferId;            ///< buffer object name(id)
+  Usage              mUsage;               ///< usage of the data store
 
   bool               mBufferCreated:1;     ///< whether buffer has been created
 
@@ -95,7 +95,7 @@ void TextureCache::CreateTexture( ResourceId        id,
   DALI_LOG_INFO(Debug::Filter::gGLResource, Debug::General, "TextureCache::CreateTexture(id=%i width:%u height:%u)\n", id, width, height);
 
   Texture* texture = TextureFactory::NewBitmapTexture(width, height, pixelFormat, clearPixels, mContext, GetDiscardBitmapsPolicy() );
-  mTextures.insert(TexturePair(id, texture));
+  AddTexture( mTextures, id, texture );
 }
 
 void TextureCache::AddBitmap(ResourceId id, Integration::BitmapPtr bitmap)
@@ -103,7 +103,7 @@ void TextureCache::AddBitmap(ResourceId id, Integration::BitmapPtr bitmap)
   DALI_LOG_INFO(Debug::Filter::gGLResource, Debug::General, "TextureCache::AddBitmap(id=%i Bitmap:%p)\n", id, bitmap.Get());
 
   Texture* texture = TextureFactory::NewBitmapTexture(bitmap.Get(), mContext, GetDiscardBitmapsPolicy());
-  mTextures.insert(TexturePair(id, texture));
+  AddTexture( mTextures, id, texture );
 }
 
 void TextureCache::AddNativeImage(ResourceId id, NativeImageInterfacePtr nativeImage)
@@ -112,7 +112,7 @@ void TextureCache::AddNativeImage(ResourceId id, NativeImageInterfacePtr nativeI
 
   /// WARNING - currently a new Texture is created even if we reuse the same NativeImage
   Texture* texture = TextureFactory::NewNativeImageTexture(*nativeImage, mContext);
-  mTextures.insert(TexturePair(id, texture));
+  AddTexture( mTextures, id, texture );
 }
 
 void TextureCache::AddFrameBuffer( ResourceId id, unsigned int width, unsigned int height, Pixel::Format pixelFormat, RenderBuffer::Format bufferFormat )
@@ -122,7 +122,7 @@ void TextureCache::AddFrameBuffer( ResourceId id, unsigned int width, unsigned i
   // Note: Do not throttle framebuffer generation - a request for a framebuffer should always be honoured
   // as soon as possible.
   Texture* texture = TextureFactory::NewFrameBufferTexture( width, height, pixelFormat, bufferFormat, mContext );
-  mFramebufferTextures.insert(TexturePair(id, texture));
+  AddTexture( mFramebufferTextures, id, texture );
 }
 
 void TextureCache::AddFrameBuffer( ResourceId id, NativeImageInterfacePtr nativeImage )
@@ -132,7 +132,7 @@ void TextureCache::AddFrameBuffer( ResourceId id, NativeImageInterfacePtr native
   // Note: Do not throttle framebuffer generation - a request for a framebuffer should always be honoured
   // as soon as possible.
   Texture* texture = TextureFactory::NewFrameBufferTexture( nativeImage, mContext );
-  mFramebufferTextures.insert(TexturePair(id, texture));
+  AddTexture( mFramebufferTextures, id, texture );
 }
 
 void TextureCache::CreateGlTexture( ResourceId id )
@@ -254,6 +254,7 @@ void TextureCache::DiscardTexture( ResourceId id )
         texturePtr->GlCleanup();
       }
       mTextures.erase(iter);
+      mTextureLookup[ id ] = NULL;
       deleted = true;
     }
   }
@@ -270,6 +271,7 @@ void TextureCache::DiscardTexture( ResourceId id )
         texturePtr->GlCleanup();
       }
       mFramebufferTextures.erase(iter);
+      mTextureLookup[ id ] = NULL;
       deleted = true;
     }
   }
@@ -312,28 +314,9 @@ bool TextureCache::BindTexture( Texture *texture, ResourceId id, GLenum target,
 Texture* TextureCache::GetTexture(ResourceId id)
 {
   Texture* texture = NULL;
-  TextureIter iter = mTextures.find(id);
-
-  if( iter != mTextures.end() )
+  if( id < mTextureLookup.Count() )
   {
-    TexturePointer texturePtr = iter->second;
-    if( texturePtr )
-    {
-      texture = texturePtr.Get();
-    }
-  }
-
-  if( texture == NULL )
-  {
-    TextureIter iter = mFramebufferTextures.find(id);
-    if( iter != mFramebufferTextures.end() )
-    {
-      TexturePointer texturePtr = iter->second;
-      if( texturePtr )
-      {
-        texture = texturePtr.Get();
-      }
-    }
+    texture = mTextureLookup[ id ];
   }
 
   DALI_LOG_INFO(Debug::Filter::gGLResource, Debug::General, "TextureCache::GetTexture(id:%u) : %p\n", id, texture);
@@ -380,6 +363,24 @@ FrameBufferTexture* TextureCache::GetFramebuffer(ResourceId id)
   return offscreen;
 }
 
+void TextureCache::AddTexture( TextureContainer& container, ResourceId id, Texture* texture )
+{
+  std::pair< TextureIter, bool > result = container.insert( TexturePair( id, texture ) );
+  if( result.second )
+  {
+    if( id >= mTextureLookup.Count() )
+    {
+      if( id >= mTextureLookup.Capacity() )
+      {
+        // The ids are allocated in sequence; grow geometrically
+        mTextureLookup.Reserve( ( id + 1u ) * 2u );
+      }
+      mTextureLookup.Resize( id + 1u, NULL );
+    }
+    mTextureLookup[ id ] = texture;
+  }
+}
+
 void TextureCache::AddObserver( ResourceId id, TextureObserver* observer )
 {
   TextureResourceObserversIter observersIter = mObservers.find(id);
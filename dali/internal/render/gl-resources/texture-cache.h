@@ -23,6 +23,7 @@
 
 // INTERNAL INCLUDES
 #include <dali/devel-api/common/map-wrapper.h>
+#include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/common/intrusive-ptr.h>
 #include <dali/public-api/images/native-image.h>
 #include <dali/public-api/math/rect.h>
@@ -256,12 +257,23 @@ public:
    */
   ResourcePolicy::Discardable GetDiscardBitmapsPolicy();
 
+private:
+
+  /**
+   * Add a texture to a container, and to the lookup table
+   * @param[in] container The textures or the framebuffers
+   * @param[in] id Resource id of the texture
+   * @param[in] texture The texture
+   */
+  void AddTexture( TextureContainer& container, ResourceId id, Texture* texture );
+
 private:
 
   TextureUploadedDispatcher& mTextureUploadedDispatcher;
   Context&         mContext;
   TextureContainer mTextures;
   TextureContainer mFramebufferTextures;
+  Dali::Vector< Texture* > mTextureLookup; ///< The textures and framebuffers indexed by resource id, to find them in constant time
 
   typedef std::vector< TextureObserver* > TextureObservers;
   typedef TextureObservers::iterator      TextureObserversIter;
@@ -15,6 +15,9 @@
  */
 
 #include <dali/internal/render/renderers/render-geometry.h>
+
+#include <algorithm>
+
 #include <dali/internal/common/buffer-index.h>
 #include <dali/internal/render/gl-resources/context.h>
 #include <dali/internal/render/gl-resources/gpu-buffer.h>
@@ -29,17 +32,22 @@ namespace Render
 {
 
 Geometry::Geometry()
-: mIndices(),
+: mVertexArrays(),
+  mVertexArrayLocations(),
+  mContext( NULL ),
+  mIndices(),
   mIndexBuffer(NULL),
   mGeometryType( Dali::Geometry::TRIANGLES ),
   mIndicesChanged(false),
   mHasBeenUpdated(false),
-  mAttributesChanged(true)
+  mAttributesChanged(true),
+  mVertexArraysChanged(false)
 {
 }
 
 Geometry::~Geometry()
 {
+  DeleteVertexArrays();
 }
 
 void Geometry::GlContextCreated( Context& context )
@@ -48,12 +56,16 @@ void Geometry::GlContextCreated( Context& context )
 
 void Geometry::GlContextDestroyed()
 {
+  // GL has released the vertex arrays
+  mVertexArrays.Clear();
+  mVertexArrayLocations.Clear();
 }
 
 void Geometry::AddPropertyBuffer( Render::PropertyBuffer* propertyBuffer )
 {
   mVertexBuffers.PushBack( propertyBuffer );
   mAttributesChanged = true;
+  mVertexArraysChanged = true;
 }
 
 void Geometry::SetIndexBuffer( Dali::Vector<unsigned short>& indices )
@@ -72,6 +84,7 @@ void Geometry::RemovePropertyBuffer( const Render::PropertyBuffer* propertyBuffe
       //This will delete the gpu buffer associated to the RenderPropertyBuffer if there is one
       mVertexBuffers.Remove( mVertexBuffers.Begin()+i);
       mAttributesChanged = true;
+      mVertexArraysChanged = true;
       break;
     }
   }
@@ -100,6 +113,58 @@ void Geometry::GetAttributeLocationFromProgram( Vector<GLint>& attributeLocation
   }
 }
 
+void Geometry::BindVertexArray( Context& context, Vector<GLint>& attributeLocation )
+{
+  // Find the vertex array recorded for these locations
+  const size_t locationCount = attributeLocation.Count();
+  for( size_t i = 0; i < mVertexArrays.Count(); ++i )
+  {
+    const GLint* locations = mVertexArrayLocations.Begin() + i * locationCount;
+    if( std::equal( attributeLocation.Begin(), attributeLocation.End(), locations ) )
+    {
+      context.BindVertexArray( mVertexArrays[i] );
+      return;
+    }
+  }
+
+  // Record a new one
+  GLuint vertexArray( 0u );
+  context.GenVertexArrays( 1, &vertexArray );
+  mContext = &context;
+  mVertexArrays.PushBack( vertexArray );
+  for( size_t i = 0; i < locationCount; ++i )
+  {
+    mVertexArrayLocations.PushBack( attributeLocation[i] );
+  }
+
+  context.BeginVertexArray( vertexArray );
+
+  unsigned int base = 0u;
+  for( unsigned int i = 0; i < mVertexBuffers.Count(); ++i )
+  {
+    mVertexBuffers[i]->BindBuffer( GpuBuffer::ARRAY_BUFFER );
+    base += mVertexBuffers[i]->EnableVertexAttributes( context, attributeLocation, base );
+  }
+
+  if( mIndexBuffer )
+  {
+    mIndexBuffer->Bind( GpuBuffer::ELEMENT_ARRAY_BUFFER );
+  }
+
+  context.EndVertexArray();
+}
+
+void Geometry::DeleteVertexArrays()
+{
+  if( !mVertexArrays.Empty() && mContext && mContext->IsGlContextCreated() )
+  {
+    mContext->DeleteVertexArrays( mVertexArrays.Count(), mVertexArrays.Begin() );
+  }
+  mVertexArrays.Clear();
+  mVertexArrayLocations.Clear();
+  mVertexArraysChanged = false;
+}
+
 void Geometry::OnRenderFinished()
 {
   mHasBeenUpdated = false;
@@ -111,7 +176,8 @@ void Geometry::UploadAndDraw(
     BufferIndex bufferIndex,
     Vector<GLint>& attributeLocation,
     size_t elementBufferOffset,
-    size_t elementBufferCount )
+    size_t elementBufferCount,
+    unsigned int instanceCount )
 {
   if( !mHasBeenUpdated )
   {
@@ -121,12 +187,14 @@ void Geometry::UploadAndDraw(
       if( mIndices.Empty() )
       {
         mIndexBuffer = NULL;
+        mVertexArraysChanged = true;
       }
       else
       {
         if ( mIndexBuffer == NULL )
         {
           mIndexBuffer = new GpuBuffer( context );
+          mVertexArraysChanged = true;
         }
 
         std::size_t bufferSize =  sizeof( unsigned short ) * mIndices.Size();
@@ -148,13 +216,28 @@ void Geometry::UploadAndDraw(
     mHasBeenUpdated = true;
   }
 
-  //Bind buffers to attribute locations
-  unsigned int base = 0u;
+  if( mVertexArraysChanged )
+  {
+    DeleteVertexArrays();
+  }
+
+  // The instance attributes are set up in the default vertex array by the caller
+  const bool useVertexArray = ( instanceCount <= 1u ) && context.IsVertexArraySupported();
   size_t vertexBufferCount(mVertexBuffers.Count());
-  for( unsigned int i = 0; i < vertexBufferCount; ++i )
+  if( useVertexArray )
   {
-    mVertexBuffers[i]->BindBuffer( GpuBuffer::ARRAY_BUFFER );
-    base += mVertexBuffers[i]->EnableVertexAttributes( context, attributeLocation, base );
+    BindVertexArray( context, attributeLocation );
+  }
+  else
+  {
+    //Bind buffers to attribute locations
+    context.BindVertexArray( 0 );
+    unsigned int base = 0u;
+    for( unsigned int i = 0; i < vertexBufferCount; ++i )
+    {
+      mVertexBuffers[i]->BindBuffer( GpuBuffer::ARRAY_BUFFER );
+      base += mVertexBuffers[i]->EnableVertexAttributes( context, attributeLocation, base );
+    }
   }
 
   size_t numIndices(0u);
@@ -219,9 +302,19 @@ void Geometry::UploadAndDraw(
   //Draw call
   if( mIndexBuffer && geometryGLType != GL_POINTS )
   {
-    //Indexed draw call
-    mIndexBuffer->Bind( GpuBuffer::ELEMENT_ARRAY_BUFFER );
-    context.DrawElements(geometryGLType, numIndices, GL_UNSIGNED_SHORT, reinterpret_cast<void*>(firstIndexOffset));
+    //Indexed draw call; the index buffer is bound by the vertex array
+    if( !useVertexArray )
+    {
+      mIndexBuffer->Bind( GpuBuffer::ELEMENT_ARRAY_BUFFER );
+    }
+    if( instanceCount > 1u )
+    {
+      context.DrawElementsInstanced(geometryGLType, numIndices, GL_UNSIGNED_SHORT, reinterpret_cast<void*>(firstIndexOffset), instanceCount);
+    }
+    else
+    {
+      context.DrawElements(geometryGLType, numIndices, GL_UNSIGNED_SHORT, reinterpret_cast<void*>(firstIndexOffset));
+    }
   }
   else
   {
@@ -232,15 +325,25 @@ void Geometry::UploadAndDraw(
       numVertices = mVertexBuffers[0]->GetElementCount();
     }
 
-    context.DrawArrays( geometryGLType, 0, numVertices );
+    if( instanceCount > 1u )
+    {
+      context.DrawArraysInstanced( geometryGLType, 0, numVertices, instanceCount );
+    }
+    else
+    {
+      context.DrawArrays( geometryGLType, 0, numVertices );
+    }
   }
 
-  //Disable attributes
-  for( unsigned int i = 0; i < attributeLocation.Count(); ++i )
+  //Disable attributes; the ones of a vertex array stay in it
+  if( !useVertexArray )
   {
-    if( attributeLocation[i] != -1 )
+    for( unsigned int i = 0; i < attributeLocation.Count(); ++i )
     {
-      context.DisableVertexAttributeArray( attributeLocation[i] );
+      if( attributeLocation[i] != -1 )
+      {
+        context.DisableVertexAttributeArray( attributeLocation[i] );
+      }
     }
   }
 }
@@ -122,18 +122,40 @@ public:
    * @param[in] attributeLocation The location for the attributes in the shader
    * @param[in] elementBufferOffset The index of first element to draw if index buffer bound
    * @param[in] elementBufferCount Number of elements to draw if index buffer bound, uses whole buffer when 0
+   * @param[in] instanceCount Number of instances to draw; an instanced draw call is used when greater than 1
    */
   void UploadAndDraw(Context& context,
                      BufferIndex bufferIndex,
                      Vector<GLint>& attributeLocation,
                      size_t elementBufferOffset,
-                     size_t elementBufferCount );
+                     size_t elementBufferCount,
+                     unsigned int instanceCount );
+
+private:
+
+  /**
+   * Bind the vertex array recording the buffers and the attributes for the given attribute locations,
+   * creating it on the first draw with these locations.
+   * @param[in] context The GL context
+   * @param[in] attributeLocation The location for the attributes in the shader
+   */
+  void BindVertexArray( Context& context, Vector<GLint>& attributeLocation );
+
+  /**
+   * Delete the vertex arrays, e.g. when the buffers have changed.
+   */
+  void DeleteVertexArrays();
 
 private:
 
   // PropertyBuffers
   Vector< Render::PropertyBuffer* > mVertexBuffers;
 
+  // Vertex array objects, one per layout of the attribute locations; the locations of all of them are stored one after the other
+  Vector< GLuint > mVertexArrays;
+  Vector< GLint > mVertexArrayLocations;
+  Context* mContext;                    ///< The context of the vertex arrays, to delete them
+
   Dali::Vector< unsigned short> mIndices;
   OwnerPointer< GpuBuffer > mIndexBuffer;
   Type mGeometryType;
@@ -142,6 +164,7 @@ private:
   bool mIndicesChanged : 1;
   bool mHasBeenUpdated : 1;
   bool mAttributesChanged : 1;
+  bool mVertexArraysChanged : 1;      ///< Whether the vertex arrays must be recorded again
 
 };
 
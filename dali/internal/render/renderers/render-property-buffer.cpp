@@ -2,6 +2,8 @@
 #include <dali/internal/render/renderers/render-property-buffer.h>
 #include <dali/internal/event/common/property-buffer-impl.h>  // Dali::Internal::PropertyBuffer
 
+#include <algorithm> // std::min, std::max
+
 namespace
 {
 
@@ -104,6 +106,9 @@ PropertyBuffer::PropertyBuffer()
  mData(NULL),
  mGpuBuffer(NULL),
  mSize(0),
+ mUpdateBegin(0),
+ mUpdateEnd(0),
+ mUsage(GpuBuffer::STATIC_DRAW),
  mDataChanged(true)
 {
 }
@@ -125,6 +130,36 @@ void PropertyBuffer::SetData( Dali::Vector<char>* data, size_t size )
   mDataChanged = true;
 }
 
+void PropertyBuffer::SetDataRange( Dali::Vector<char>* data, size_t offset )
+{
+  OwnerPointer< Dali::Vector< char > > range( data );
+
+  if( mData && ( offset + range->Size() <= mData->Size() ) && !range->Empty() )
+  {
+    std::copy( range->Begin(), range->End(), mData->Begin() + offset );
+
+    if( mUpdateBegin == mUpdateEnd )
+    {
+      mUpdateBegin = offset;
+      mUpdateEnd = offset + range->Size();
+    }
+    else
+    {
+      mUpdateBegin = std::min( mUpdateBegin, offset );
+      mUpdateEnd = std::max( mUpdateEnd, offset + range->Size() );
+    }
+  }
+}
+
+void PropertyBuffer::SetUsage( GpuBuffer::Usage usage )
+{
+  if( usage != mUsage )
+  {
+    mUsage = usage;
+    mDataChanged = true;
+  }
+}
+
 bool PropertyBuffer::Update( Context& context )
 {
   if( !mData || !mFormat || !mSize )
@@ -132,7 +167,9 @@ bool PropertyBuffer::Update( Context& context )
     return false;
   }
 
-  if( !mGpuBuffer || mDataChanged )
+  // The data store of a stream buffer is replaced on each update, so it is always uploaded whole
+  const bool rangeChanged( mUpdateEnd > mUpdateBegin );
+  if( !mGpuBuffer || mDataChanged || ( rangeChanged && mUsage == GpuBuffer::STREAM_DRAW ) )
   {
     if ( ! mGpuBuffer )
     {
@@ -143,11 +180,17 @@ bool PropertyBuffer::Update( Context& context )
     if ( mGpuBuffer )
     {
       DALI_ASSERT_DEBUG( mSize && "No data in the property buffer!" );
-      mGpuBuffer->UpdateDataBuffer( GetDataSize(), &((*mData)[0]), GpuBuffer::STATIC_DRAW, GpuBuffer::ARRAY_BUFFER );
+      mGpuBuffer->UpdateDataBuffer( GetDataSize(), &((*mData)[0]), mUsage, GpuBuffer::ARRAY_BUFFER );
     }
 
     mDataChanged = false;
   }
+  else if( rangeChanged )
+  {
+    // Upload only the bytes changed
+    mGpuBuffer->UpdateDataBufferRange( mUpdateBegin, mUpdateEnd - mUpdateBegin, &((*mData)[mUpdateBegin]), GpuBuffer::ARRAY_BUFFER );
+  }
+  mUpdateBegin = mUpdateEnd = 0;
 
   return true;
 }
@@ -79,6 +79,21 @@ public:
    */
   void SetData( Dali::Vector<char>* data, size_t size );
 
+  /**
+   * @brief Set a range of the data of the PropertyBuffer; only this range is uploaded
+   *
+   * This function takes ownership of the pointer
+   * @param[in] data The new data of the range
+   * @param[in] offset The offset of the range in bytes
+   */
+  void SetDataRange( Dali::Vector<char>* data, size_t offset );
+
+  /**
+   * @brief Set how the data of the buffer is updated
+   * @param[in] usage The usage of the GPU buffer
+   */
+  void SetUsage( GpuBuffer::Usage usage );
+
   /**
    * @brief Set the number of elements
    * @param[in] size The number of elements
@@ -162,6 +177,9 @@ private:
   OwnerPointer< GpuBuffer > mGpuBuffer;               ///< Pointer to the GpuBuffer associated with this RenderPropertyBuffer
 
   size_t mSize;       ///< Number of Elements in the buffer
+  size_t mUpdateBegin;  ///< Offset in bytes of the first byte changed since the last upload
+  size_t mUpdateEnd;    ///< Offset in bytes after the last byte changed since the last upload
+  GpuBuffer::Usage mUsage;  ///< Usage of the GpuBuffer
   bool mDataChanged;  ///< Flag to know if data has changed in a frame
 
 };
@@ -18,9 +18,14 @@
 // CLASS HEADER
 #include <dali/internal/render/renderers/render-renderer.h>
 
+// EXTERNAL INCLUDES
+#include <cstring> // for memcpy
+
 // INTERNAL INCLUDES
 #include <dali/internal/common/image-sampler.h>
+#include <dali/internal/render/common/render-list.h>
 #include <dali/internal/render/gl-resources/context.h>
+#include <dali/internal/render/gl-resources/gpu-buffer.h>
 #include <dali/internal/render/renderers/render-sampler.h>
 #include <dali/internal/render/shaders/scene-graph-shader.h>
 #include <dali/internal/render/shaders/program.h>
@@ -39,9 +44,28 @@ namespace Internal
 namespace
 {
 
+const unsigned int INSTANCE_MATRIX_COLUMNS( 4u ); ///< A matrix attribute takes one location per column
+const unsigned int INSTANCE_FLOAT_COUNT( 20u );   ///< Per-instance attributes: model-view matrix and color
+const unsigned int INSTANCE_COLOR_OFFSET( 16u );  ///< Offset of the color in the per-instance attributes, in floats
+
 static Matrix gModelViewProjectionMatrix( false ); ///< a shared matrix to calculate the MVP matrix, dont want to store it in object to reduce storage overhead
 static Matrix3 gNormalMatrix; ///< a shared matrix to calculate normal matrix, dont want to store it in object to reduce storage overhead
 
+/**
+ * Helper to query the locations of the per-instance attributes of a program
+ * @param[in] program to query
+ * @param[out] modelViewLocation of the first column of the model-view matrix
+ * @param[out] colorLocation of the color
+ * @return true if the program declares both attributes at distinct locations
+ */
+inline bool GetInstanceAttribLocations( Program& program, GLint& modelViewLocation, GLint& colorLocation )
+{
+  modelViewLocation = program.GetAttribLocation( Program::ATTRIB_INSTANCE_MODEL_VIEW );
+  colorLocation = program.GetAttribLocation( Program::ATTRIB_INSTANCE_COLOR );
+  return modelViewLocation >= 0 && colorLocation >= 0 &&
+         ( colorLocation < modelViewLocation || colorLocation >= modelViewLocation + static_cast<GLint>( INSTANCE_MATRIX_COLUMNS ) );
+}
+
 /**
  * Helper to set view and projection matrices once per program
  * @param program to set the matrices to
@@ -144,6 +168,8 @@ Renderer::Renderer( SceneGraph::RenderDataProvider* dataProvider,
   mGeometry( geometry ),
   mUniformIndexMap(),
   mAttributesLocation(),
+  mInstanceBuffer(),
+  mInstanceData(),
   mStencilParameters( stencilParameters ),
   mBlendingOptions(),
   mIndexedDrawFirstElement( 0 ),
@@ -221,6 +247,11 @@ void Renderer::SetBlending( Context& context, bool blend )
 void Renderer::GlContextDestroyed()
 {
   mGeometry->GlContextDestroyed();
+
+  if( mInstanceBuffer )
+  {
+    mInstanceBuffer->GlContextDestroyed();
+  }
 }
 
 void Renderer::GlCleanup()
@@ -228,6 +259,26 @@ void Renderer::GlCleanup()
 }
 
 void Renderer::SetUniforms( BufferIndex bufferIndex, const SceneGraph::NodeDataProvider& node, const Vector3& size, Program& program )
+{
+  UpdateUniformIndexMap( bufferIndex, node, program );
+
+  // Set uniforms in local map
+  for( UniformIndexMappings::Iterator iter = mUniformIndexMap.Begin(),
+         end = mUniformIndexMap.End() ;
+       iter != end ;
+       ++iter )
+  {
+    SetUniformFromProperty( bufferIndex, program, *iter );
+  }
+
+  GLint sizeLoc = program.GetUniformLocation( Program::UNIFORM_SIZE );
+  if( -1 != sizeLoc )
+  {
+    program.SetSizeUniform3f( sizeLoc, size.x, size.y, size.z );
+  }
+}
+
+void Renderer::UpdateUniformIndexMap( BufferIndex bufferIndex, const SceneGraph::NodeDataProvider& node, Program& program )
 {
   // Check if the map has changed
   DALI_ASSERT_DEBUG( mRenderDataProvider && "No Uniform map data provider available" );
@@ -248,12 +299,12 @@ void Renderer::SetUniforms( BufferIndex bufferIndex, const SceneGraph::NodeDataP
     for(; mapIndex < uniformMap.Count() ; ++mapIndex )
     {
       mUniformIndexMap[mapIndex].propertyValue = uniformMap[mapIndex]->propertyPtr;
-      mUniformIndexMap[mapIndex].uniformIndex = program.RegisterUniform( uniformMap[mapIndex]->uniformName );
+      mUniformIndexMap[mapIndex].uniformIndex = program.RegisterUniform( uniformMap[mapIndex]->uniformName, uniformMap[mapIndex]->uniformNameHash );
     }
 
     for( unsigned int nodeMapIndex = 0; nodeMapIndex < uniformMapNode.Count() ; ++nodeMapIndex )
     {
-      unsigned int uniformIndex = program.RegisterUniform( uniformMapNode[nodeMapIndex]->uniformName );
+      unsigned int uniformIndex = program.RegisterUniform( uniformMapNode[nodeMapIndex]->uniformName, uniformMapNode[nodeMapIndex]->uniformNameHash );
       bool found(false);
       for( unsigned int i(0); i<uniformMap.Count(); ++i )
       {
@@ -275,21 +326,6 @@ void Renderer::SetUniforms( BufferIndex bufferIndex, const SceneGraph::NodeDataP
 
     mUniformIndexMap.Resize( mapIndex );
   }
-
-  // Set uniforms in local map
-  for( UniformIndexMappings::Iterator iter = mUniformIndexMap.Begin(),
-         end = mUniformIndexMap.End() ;
-       iter != end ;
-       ++iter )
-  {
-    SetUniformFromProperty( bufferIndex, program, *iter );
-  }
-
-  GLint sizeLoc = program.GetUniformLocation( Program::UNIFORM_SIZE );
-  if( -1 != sizeLoc )
-  {
-    program.SetSizeUniform3f( sizeLoc, size.x, size.y, size.z );
-  }
 }
 
 void Renderer::SetUniformFromProperty( BufferIndex bufferIndex, Program& program, UniformIndexMap& map )
@@ -631,16 +667,236 @@ void Renderer::Render( Context& context,
 
     SetUniforms( bufferIndex, node, size, *program );
 
+    // A shader written for instancing reads its transform and color from the instance attributes,
+    // so give them constant values matching the ones RenderInstances() would have streamed
+    GLint modelViewLocation( -1 );
+    GLint colorLocation( -1 );
+    if( GetInstanceAttribLocations( *program, modelViewLocation, colorLocation ) )
+    {
+      const float* modelView = modelViewMatrix.AsFloat();
+      for( unsigned int column = 0; column < INSTANCE_MATRIX_COLUMNS; ++column )
+      {
+        context.VertexAttrib4fv( modelViewLocation + column, modelView + column * 4u );
+      }
+
+      const Vector4& color = node.GetRenderColor( bufferIndex );
+      const float alpha = mPremultipledAlphaEnabled ? color.a : 1.0f;
+      const Vector4 instanceColor( color.r * alpha, color.g * alpha, color.b * alpha, color.a );
+      context.VertexAttrib4fv( colorLocation, instanceColor.AsFloat() );
+    }
+
     if( mUpdateAttributesLocation || mGeometry->AttributesChanged() )
     {
       mGeometry->GetAttributeLocationFromProgram( mAttributesLocation, *program, bufferIndex );
       mUpdateAttributesLocation = false;
     }
 
-    mGeometry->UploadAndDraw( context, bufferIndex, mAttributesLocation, mIndexedDrawFirstElement, mIndexedDrawElementsCount );
+    mGeometry->UploadAndDraw( context, bufferIndex, mAttributesLocation, mIndexedDrawFirstElement, mIndexedDrawElementsCount, 1u );
   }
 }
 
+bool Renderer::IsBatchCompatible( BufferIndex bufferIndex, const Renderer& other ) const
+{
+  if( &other == this )
+  {
+    return true;
+  }
+
+  if( &mRenderDataProvider->GetShader() != &other.mRenderDataProvider->GetShader() ||
+      mGeometry != other.mGeometry ||
+      mIndexedDrawFirstElement != other.mIndexedDrawFirstElement ||
+      mIndexedDrawElementsCount != other.mIndexedDrawElementsCount ||
+      mFaceCullingMode != other.mFaceCullingMode ||
+      mDepthFunction != other.mDepthFunction ||
+      mDepthWriteMode != other.mDepthWriteMode ||
+      mDepthTestMode != other.mDepthTestMode ||
+      mWriteToColorBuffer != other.mWriteToColorBuffer ||
+      mPremultipledAlphaEnabled != other.mPremultipledAlphaEnabled ||
+      mBlendingOptions.GetBitmask() != other.mBlendingOptions.GetBitmask() )
+  {
+    return false;
+  }
+
+  const Vector4* blendColor = mBlendingOptions.GetBlendColor();
+  const Vector4* otherBlendColor = other.mBlendingOptions.GetBlendColor();
+  if( ( blendColor == NULL ) != ( otherBlendColor == NULL ) ||
+      ( blendColor && *blendColor != *otherBlendColor ) )
+  {
+    return false;
+  }
+
+  if( mStencilParameters.stencilMode != other.mStencilParameters.stencilMode ||
+      mStencilParameters.stencilFunction != other.mStencilParameters.stencilFunction ||
+      mStencilParameters.stencilFunctionMask != other.mStencilParameters.stencilFunctionMask ||
+      mStencilParameters.stencilFunctionReference != other.mStencilParameters.stencilFunctionReference ||
+      mStencilParameters.stencilMask != other.mStencilParameters.stencilMask ||
+      mStencilParameters.stencilOperationOnFail != other.mStencilParameters.stencilOperationOnFail ||
+      mStencilParameters.stencilOperationOnZFail != other.mStencilParameters.stencilOperationOnZFail ||
+      mStencilParameters.stencilOperationOnZPass != other.mStencilParameters.stencilOperationOnZPass )
+  {
+    return false;
+  }
+
+  // Same textures and samplers
+  const std::vector<Render::Texture>& textures( mRenderDataProvider->GetTextures() );
+  const std::vector<Render::Texture>& otherTextures( other.mRenderDataProvider->GetTextures() );
+  if( textures.size() != otherTextures.size() )
+  {
+    return false;
+  }
+  for( size_t i(0); i < textures.size(); ++i )
+  {
+    if( textures[i].GetTextureId() != otherTextures[i].GetTextureId() )
+    {
+      return false;
+    }
+  }
+
+  if( mRenderDataProvider->GetNewTextures() != other.mRenderDataProvider->GetNewTextures() )
+  {
+    return false;
+  }
+
+  const std::vector<Render::Sampler*>& samplers( mRenderDataProvider->GetSamplers() );
+  const std::vector<Render::Sampler*>& otherSamplers( other.mRenderDataProvider->GetSamplers() );
+  if( samplers.size() != otherSamplers.size() )
+  {
+    return false;
+  }
+  for( size_t i(0); i < samplers.size(); ++i )
+  {
+    const unsigned int bitfield = samplers[i] ? samplers[i]->mBitfield : static_cast<unsigned int>( ImageSampler::DEFAULT_BITFIELD );
+    const unsigned int otherBitfield = otherSamplers[i] ? otherSamplers[i]->mBitfield : static_cast<unsigned int>( ImageSampler::DEFAULT_BITFIELD );
+    if( bitfield != otherBitfield )
+    {
+      return false;
+    }
+  }
+
+  // The uniforms must come from the same properties, e.g. the ones of the shader
+  const SceneGraph::CollectedUniformMap& uniformMap = mRenderDataProvider->GetUniformMap().GetUniformMap( bufferIndex );
+  const SceneGraph::CollectedUniformMap& otherUniformMap = other.mRenderDataProvider->GetUniformMap().GetUniformMap( bufferIndex );
+  if( uniformMap.Count() != otherUniformMap.Count() )
+  {
+    return false;
+  }
+  for( SceneGraph::CollectedUniformMap::SizeType i(0); i < uniformMap.Count(); ++i )
+  {
+    if( uniformMap[i]->propertyPtr != otherUniformMap[i]->propertyPtr )
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool Renderer::RenderInstances( Context& context,
+                                SceneGraph::TextureCache& textureCache,
+                                BufferIndex bufferIndex,
+                                const SceneGraph::RenderList& renderList,
+                                size_t first,
+                                size_t count,
+                                const Matrix& viewMatrix,
+                                const Matrix& projectionMatrix )
+{
+  // The default shader does not declare the instance attributes
+  Program* program = mRenderDataProvider->GetShader().GetProgram();
+  if( !program )
+  {
+    return false;
+  }
+
+  // Take the program into use so the attribute locations can be queried
+  program->Use();
+
+  GLint modelViewLocation( -1 );
+  GLint colorLocation( -1 );
+  if( !GetInstanceAttribLocations( *program, modelViewLocation, colorLocation ) )
+  {
+    return false;
+  }
+
+  const SceneGraph::RenderItem& firstItem = renderList.GetItem( first );
+
+  //Set cull face  mode
+  context.CullFace( mFaceCullingMode );
+
+  //Set blending mode
+  SetBlending( context, !firstItem.mIsOpaque );
+
+  // The renderers drawn by this one still need to follow the changes of their uniform maps and attributes
+  for( size_t index = first + 1u; index < first + count; ++index )
+  {
+    const SceneGraph::RenderItem& item = renderList.GetItem( index );
+    if( item.mRenderer != this )
+    {
+      item.mRenderer->UpdateUniformIndexMap( bufferIndex, *item.mNode, *program );
+      item.mRenderer->mUpdateAttributesLocation |= mUpdateAttributesLocation || mGeometry->AttributesChanged();
+    }
+  }
+
+  if( DALI_LIKELY( BindTextures( context, textureCache, *program ) ) )
+  {
+    SetMatrices( *program, firstItem.mModelMatrix, viewMatrix, projectionMatrix, firstItem.mModelViewMatrix );
+    SetUniforms( bufferIndex, *firstItem.mNode, firstItem.mSize, *program );
+
+    if( mUpdateAttributesLocation || mGeometry->AttributesChanged() )
+    {
+      mGeometry->GetAttributeLocationFromProgram( mAttributesLocation, *program, bufferIndex );
+      mUpdateAttributesLocation = false;
+    }
+
+    // Gather the model-view matrix and the color of each instance
+    mInstanceData.Resize( count * INSTANCE_FLOAT_COUNT );
+    float* instanceData = mInstanceData.Begin();
+    for( size_t index = first; index < first + count; ++index, instanceData += INSTANCE_FLOAT_COUNT )
+    {
+      const SceneGraph::RenderItem& item = renderList.GetItem( index );
+      memcpy( instanceData, item.mModelViewMatrix.AsFloat(), INSTANCE_COLOR_OFFSET * sizeof( float ) );
+
+      const SceneGraph::NodeDataProvider& node = *item.mNode;
+      const Vector4& color = node.GetRenderColor( bufferIndex );
+      const float alpha = mPremultipledAlphaEnabled ? color.a : 1.0f;
+      instanceData[ INSTANCE_COLOR_OFFSET ] = color.r * alpha;
+      instanceData[ INSTANCE_COLOR_OFFSET + 1u ] = color.g * alpha;
+      instanceData[ INSTANCE_COLOR_OFFSET + 2u ] = color.b * alpha;
+      instanceData[ INSTANCE_COLOR_OFFSET + 3u ] = color.a;
+    }
+
+    if( !mInstanceBuffer )
+    {
+      mInstanceBuffer = new GpuBuffer( context );
+    }
+    mInstanceBuffer->UpdateDataBuffer( mInstanceData.Count() * sizeof( float ), mInstanceData.Begin(), GpuBuffer::STREAM_DRAW, GpuBuffer::ARRAY_BUFFER );
+    mInstanceBuffer->Bind( GpuBuffer::ARRAY_BUFFER );
+
+    const GLsizei stride = INSTANCE_FLOAT_COUNT * sizeof( float );
+    for( unsigned int column = 0; column < INSTANCE_MATRIX_COLUMNS; ++column )
+    {
+      context.EnableVertexAttributeArray( modelViewLocation + column );
+      context.VertexAttribPointer( modelViewLocation + column, 4, GL_FLOAT, GL_FALSE, stride, reinterpret_cast< const void* >( column * 4u * sizeof( float ) ) );
+      context.VertexAttribDivisor( modelViewLocation + column, 1 );
+    }
+    context.EnableVertexAttributeArray( colorLocation );
+    context.VertexAttribPointer( colorLocation, 4, GL_FLOAT, GL_FALSE, stride, reinterpret_cast< const void* >( INSTANCE_COLOR_OFFSET * sizeof( float ) ) );
+    context.VertexAttribDivisor( colorLocation, 1 );
+
+    mGeometry->UploadAndDraw( context, bufferIndex, mAttributesLocation, mIndexedDrawFirstElement, mIndexedDrawElementsCount, count );
+
+    // Other programs may use these locations for per-vertex attributes
+    for( unsigned int column = 0; column < INSTANCE_MATRIX_COLUMNS; ++column )
+    {
+      context.VertexAttribDivisor( modelViewLocation + column, 0 );
+      context.DisableVertexAttributeArray( modelViewLocation + column );
+    }
+    context.VertexAttribDivisor( colorLocation, 0 );
+    context.DisableVertexAttributeArray( colorLocation );
+  }
+
+  return true;
+}
+
 void Renderer::SetSortAttributes( BufferIndex bufferIndex, SceneGraph::RendererWithSortAttributes& sortAttributes ) const
 {
   sortAttributes.shader = &( mRenderDataProvider->GetShader() );
@@ -41,6 +41,7 @@ namespace Internal
 class Context;
 class Texture;
 class Program;
+class GpuBuffer;
 
 namespace SceneGraph
 {
@@ -48,6 +49,7 @@ class SceneController;
 class Shader;
 class TextureCache;
 class NodeDataProvider;
+class RenderList;
 }
 
 
@@ -384,6 +386,39 @@ public:
                const Vector3& size,
                bool blend);
 
+  /**
+   * Checks whether this renderer draws in the same way as another renderer, so that both can be
+   * drawn by the same instanced draw call.
+   * @param[in] bufferIndex The index of the previous update buffer.
+   * @param[in] other The other renderer
+   * @return True if both renderers use the same shader, geometry, textures, uniform properties and render states
+   */
+  bool IsBatchCompatible( BufferIndex bufferIndex, const Renderer& other ) const;
+
+  /**
+   * Called to render consecutive items of a render list with one instanced draw call during RenderManager::Render().
+   * The model-view matrix and the color of each item are passed to the "aInstanceModelView" and "aInstanceColor"
+   * attributes of the shader, which is otherwise given the uniforms of the first item.
+   * @pre The renderers of the items are batch compatible with this renderer, and the items have the same size and opacity.
+   * @param[in] context The context used for rendering
+   * @param[in] textureCache The texture cache used to get textures
+   * @param[in] bufferIndex The index of the previous update buffer.
+   * @param[in] renderList The render list holding the items
+   * @param[in] first The index of the first item, which is rendered by this renderer
+   * @param[in] count The number of items
+   * @param[in] viewMatrix The view matrix.
+   * @param[in] projectionMatrix The projection matrix.
+   * @return False if the shader does not declare the instance attributes, in which case nothing is rendered
+   */
+  bool RenderInstances( Context& context,
+                        SceneGraph::TextureCache& textureCache,
+                        BufferIndex bufferIndex,
+                        const SceneGraph::RenderList& renderList,
+                        size_t first,
+                        size_t count,
+                        const Matrix& viewMatrix,
+                        const Matrix& projectionMatrix );
+
   /**
    * Write the renderer's sort attributes to the passed in reference
    *
@@ -418,6 +453,14 @@ private:
    */
   void SetUniforms( BufferIndex bufferIndex, const SceneGraph::NodeDataProvider& node, const Vector3& size, Program& program );
 
+  /**
+   * Rebuild the uniform index map if the uniform map of the renderer or of the node has changed
+   * @param[in] bufferIndex The index of the previous update buffer.
+   * @param[in] node The node using the renderer
+   * @param[in] program The shader program on which the uniforms are set.
+   */
+  void UpdateUniformIndexMap( BufferIndex bufferIndex, const SceneGraph::NodeDataProvider& node, Program& program );
+
   /**
    * Set the program uniform in the map from the mapped property
    * @param[in] bufferIndex The index of the previous update buffer.
@@ -454,6 +497,9 @@ private:
   UniformIndexMappings         mUniformIndexMap;
   Vector<GLint>                mAttributesLocation;
 
+  OwnerPointer< GpuBuffer >    mInstanceBuffer;             ///< Per-instance attributes of instanced draw calls, created on first use
+  Dali::Vector< float >        mInstanceData;               ///< Staging area for the per-instance attributes
+
   StencilParameters            mStencilParameters;          ///< Struct containing all stencil related options
   BlendingOptions              mBlendingOptions;            ///< Blending options including blend color, blend func and blend equation
 
@@ -597,6 +597,8 @@ NewTexture::NewTexture( Type type, Pixel::Format format, unsigned int width, uns
  mPixelDataType(GL_UNSIGNED_BYTE),
  mWidth( width ),
  mHeight( height ),
+ mPendingUploads( 0u ),
+ mUploadRequested( false ),
  mHasAlpha( HasAlpha( format ) ),
  mIsCompressed( IsCompressedFormat( format ) )
 {
@@ -612,6 +614,8 @@ NewTexture::NewTexture( NativeImageInterfacePtr nativeImageInterface )
  mPixelDataType(GL_UNSIGNED_BYTE),
  mWidth( nativeImageInterface->GetWidth() ),
  mHeight( nativeImageInterface->GetHeight() ),
+ mPendingUploads( 0u ),
+ mUploadRequested( false ),
  mHasAlpha( nativeImageInterface->RequiresBlending() ),
  mIsCompressed( false )
 {
@@ -706,15 +710,31 @@ void NewTexture::Upload( Context& context, PixelDataPtr pixelData, const Interna
 {
   DALI_ASSERT_ALWAYS( mNativeImage == NULL );
 
-  //Get pointer to the data of the PixelData object
-  unsigned char* buffer( pixelData->GetBuffer() );
+  UploadBuffer( context, pixelData->GetBuffer(), pixelData->GetBufferSize(), pixelData->GetPixelFormat(), params );
+}
+
+void NewTexture::UploadRows( Context& context, PixelDataPtr pixelData, const Internal::NewTexture::UploadParams& params, unsigned int firstRow, unsigned int rowCount )
+{
+  DALI_ASSERT_DEBUG( CanUploadRows( params ) && ( firstRow + rowCount <= params.height ) );
 
+  // The rows are tightly packed
+  const unsigned int rowSize = params.width * Pixel::GetBytesPerPixel( pixelData->GetPixelFormat() );
+
+  Internal::NewTexture::UploadParams rowParams( params );
+  rowParams.yOffset += firstRow;
+  rowParams.height = rowCount;
+
+  UploadBuffer( context, pixelData->GetBuffer() + firstRow * rowSize, rowCount * rowSize, pixelData->GetPixelFormat(), rowParams );
+}
+
+void NewTexture::UploadBuffer( Context& context, unsigned char* buffer, unsigned int bufferSize, Pixel::Format pixelFormat, const Internal::NewTexture::UploadParams& params )
+{
   //This buffer is only used if manually converting from RGB to RGBA
   unsigned char* tempBuffer(0);
 
   //Get pixel format and data type of the data contained in the PixelData object
   GLenum pixelDataFormat, pixelDataElementType;
-  PixelFormatToGl( pixelData->GetPixelFormat(), pixelDataElementType, pixelDataFormat );
+  PixelFormatToGl( pixelFormat, pixelDataElementType, pixelDataFormat );
 
 #if DALI_GLES_VERSION < 30
   if( pixelDataFormat == GL_RGB && mInternalFormat == GL_RGBA )
@@ -761,7 +781,7 @@ void NewTexture::Upload( Context& context, PixelDataPtr pixelData, const Interna
     }
     else
     {
-      context.CompressedTexImage2D( target, params.mipmap, mInternalFormat, params.width, params.height, 0, pixelData->GetBufferSize(), buffer );
+      context.CompressedTexImage2D( target, params.mipmap, mInternalFormat, params.width, params.height, 0, bufferSize, buffer );
     }
   }
   else
@@ -777,7 +797,7 @@ void NewTexture::Upload( Context& context, PixelDataPtr pixelData, const Interna
     {
       context.CompressedTexSubImage2D( target, params.mipmap,
                                        params.xOffset, params.yOffset, params.width, params.height,
-                                       pixelDataFormat, pixelData->GetBufferSize(), buffer );
+                                       pixelDataFormat, bufferSize, buffer );
     }
   }
 
@@ -788,6 +808,13 @@ void NewTexture::Upload( Context& context, PixelDataPtr pixelData, const Interna
 
 bool NewTexture::Bind( Context& context, unsigned int textureUnit, Render::Sampler* sampler )
 {
+  if( mPendingUploads > 0u )
+  {
+    // Wait for the uploads rather than drawing an incomplete texture; they are prioritised from now on
+    mUploadRequested = true;
+    return false;
+  }
+
   if( mId != 0 )
   {
     context.ActiveTexture( static_cast<TextureUnit>(textureUnit) );
@@ -150,8 +150,70 @@ public:
    */
   void Upload( Context& context, PixelDataPtr pixelData, const Internal::NewTexture::UploadParams& params );
 
+  /**
+   * Uploads some rows of the data to the texture.
+   * @pre CanUploadRows() returns true for these parameters.
+   * @param[in] context The GL context
+   * @param[in] pixelData A pixel data object
+   * @param[in] params Upload parameters of the whole data. See UploadParams
+   * @param[in] firstRow The first row of the data to upload
+   * @param[in] rowCount The number of rows to upload
+   */
+  void UploadRows( Context& context, PixelDataPtr pixelData, const Internal::NewTexture::UploadParams& params, unsigned int firstRow, unsigned int rowCount );
+
+  /**
+   * Query whether an upload can be split in rows uploaded separately, i.e. the storage for its mipmap level has
+   * been created and the format is not compressed.
+   * @param[in] params Upload parameters. See UploadParams
+   * @return True if UploadRows() can be used for the upload.
+   */
+  bool CanUploadRows( const Internal::NewTexture::UploadParams& params ) const
+  {
+    return !mIsCompressed && !mNativeImage && ( params.mipmap == 0 );
+  }
+
+  /**
+   * Notify the texture that an upload or a mipmap generation has been queued for it.
+   * The texture is not bound until all the uploads queued are complete.
+   */
+  void AddPendingUpload()
+  {
+    ++mPendingUploads;
+  }
+
+  /**
+   * Notify the texture that an upload queued for it is complete.
+   */
+  void RemovePendingUpload()
+  {
+    DALI_ASSERT_DEBUG( mPendingUploads > 0u );
+    if( --mPendingUploads == 0u )
+    {
+      mUploadRequested = false;
+    }
+  }
+
+  /**
+   * Query whether uploads queued for the texture are not complete yet.
+   * @return True if some uploads are pending.
+   */
+  bool IsUploadPending() const
+  {
+    return mPendingUploads > 0u;
+  }
+
+  /**
+   * Query whether a renderer tried to bind the texture while its uploads were pending.
+   * @return True if the texture is needed to draw.
+   */
+  bool IsUploadRequested() const
+  {
+    return mUploadRequested;
+  }
+
   /**
    * Bind the texture to the given texture unit and applies the given sampler
+   * Fails while uploads queued for the texture are pending, so the renderers using it wait for them to complete.
    * @param[in] context The GL context
    * @param[in] textureUnit the texture unit
    * @param[in] sampler The sampler to be used with the texture
@@ -216,6 +278,16 @@ private:
    */
   void ApplySampler( Context& context, Render::Sampler* sampler );
 
+  /**
+   * Helper method to upload data to the texture
+   * @param[in] context The GL context
+   * @param[in] buffer The data to upload
+   * @param[in] bufferSize The size of the data in bytes
+   * @param[in] pixelFormat The format of the data
+   * @param[in] params Upload parameters. See UploadParams
+   */
+  void UploadBuffer( Context& context, unsigned char* buffer, unsigned int bufferSize, Pixel::Format pixelFormat, const Internal::NewTexture::UploadParams& params );
+
   GLuint mId;                         ///<Id of the texture
   Type mType;                         ///<Type of the texture
   Render::Sampler mSampler;           ///<The current sampler state
@@ -224,6 +296,8 @@ private:
   GLenum mPixelDataType;              ///<The data type of the pixel data
   unsigned int mWidth;                ///<Widht of the texture
   unsigned int mHeight;               ///<Height of the texture
+  unsigned int mPendingUploads;       ///<Number of uploads queued and not complete
+  bool mUploadRequested : 1;          ///<Whether a renderer tried to bind the texture while uploads were pending
   bool mHasAlpha : 1;                 ///<Whether the format has an alpha channel
   bool mIsCompressed : 1;             ///<Whether the format is compressed
 };
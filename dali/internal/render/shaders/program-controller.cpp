@@ -101,15 +101,10 @@ Integration::GlAbstraction& ProgramController::GetGlAbstraction()
 Program* ProgramController::GetProgram( size_t shaderHash )
 {
   Program* program = NULL;
-  const ProgramIterator end = mProgramCache.End();
-  for ( ProgramIterator iter = mProgramCache.Begin(); iter != end; ++iter )
+  ProgramHashMap::const_iterator iter = mProgramHashMap.find( shaderHash );
+  if( iter != mProgramHashMap.end() )
   {
-    size_t hash = (*iter)->GetHash();
-    if( shaderHash == hash )
-    {
-      program = (*iter)->GetProgram();
-      break;
-    }
+    program = iter->second;
   }
   return program;
 }
@@ -119,6 +114,7 @@ void ProgramController::AddProgram( size_t shaderHash, Program* program )
   // we expect unique hash values so its event thread sides job to guarantee that
   // AddProgram is only called after program checks that GetProgram returns NULL
   mProgramCache.PushBack( new ProgramPair( program, shaderHash ) );
+  mProgramHashMap.insert( std::make_pair( shaderHash, program ) );
 }
 
 Program* ProgramController::GetCurrentProgram()
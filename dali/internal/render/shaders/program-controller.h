@@ -18,6 +18,9 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <map>
+
 // INTERNAL INCLUDES
 #include <dali/devel-api/common/owner-container.h>
 #include <dali/internal/render/shaders/program.h>
@@ -180,6 +183,9 @@ private: // Data
   typedef ProgramContainer::Iterator ProgramIterator;
   ProgramContainer mProgramCache;
 
+  typedef std::map< size_t, Program* > ProgramHashMap;
+  ProgramHashMap mProgramHashMap; ///< The programs of the cache, keyed by shader hash
+
   GLint mProgramBinaryFormat;
   GLint mNumberOfProgramBinaryFormats;
 
@@ -25,6 +25,7 @@
 #include <dali/public-api/common/dali-common.h>
 #include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/common/constants.h>
+#include <dali/devel-api/common/hash.h>
 #include <dali/integration-api/debug.h>
 #include <dali/internal/common/shader-data.h>
 #include <dali/integration-api/gl-defines.h>
@@ -78,8 +79,10 @@ namespace
 
 const char* gStdAttribs[ Program::ATTRIB_TYPE_LAST ] =
 {
-  "aPosition",    // ATTRIB_POSITION
-  "aTexCoord",    // ATTRIB_TEXCOORD
+  "aPosition",          // ATTRIB_POSITION
+  "aTexCoord",          // ATTRIB_TEXCOORD
+  "aInstanceModelView", // ATTRIB_INSTANCE_MODEL_VIEW
+  "aInstanceColor",     // ATTRIB_INSTANCE_COLOR
 };
 
 const char* gStdUniforms[ Program::UNIFORM_TYPE_LAST ] =
@@ -188,18 +191,25 @@ GLint Program::GetCustomAttributeLocation( unsigned int attributeIndex )
 
 unsigned int Program::RegisterUniform( const std::string& name )
 {
-  unsigned int index = 0;
-  // find the value from cache
-  for( ;index < mUniformLocations.size(); ++index )
+  return RegisterUniform( name, Dali::CalculateHash( name ) );
+}
+
+unsigned int Program::RegisterUniform( const std::string& name, std::size_t nameHash )
+{
+  // find the value from cache, only the names with the same hash need comparing
+  std::pair< UniformIndices::const_iterator, UniformIndices::const_iterator > range = mUniformIndices.equal_range( nameHash );
+  for( UniformIndices::const_iterator iter = range.first; iter != range.second; ++iter )
   {
-    if( mUniformLocations[ index ].first == name )
+    if( mUniformLocations[ iter->second ].first == name )
     {
       // name found so return index
-      return index;
+      return iter->second;
     }
   }
-  // if we get here, index is one past end so push back the new name
+  // not found so push back the new name
+  const unsigned int index = mUniformLocations.size();
   mUniformLocations.push_back( std::make_pair( name, UNIFORM_NOT_QUERIED ) );
+  mUniformIndices.insert( range.second, std::make_pair( nameHash, index ) );
   return index;
 }
 
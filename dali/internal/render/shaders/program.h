@@ -19,6 +19,7 @@
  */
 
 // EXTERNAL INCLUDES
+#include <map>
 #include <string>
 
 // INTERNAL INCLUDES
@@ -75,6 +76,8 @@ public:
     ATTRIB_UNKNOWN = -1,
     ATTRIB_POSITION,
     ATTRIB_TEXCOORD,
+    ATTRIB_INSTANCE_MODEL_VIEW,
+    ATTRIB_INSTANCE_COLOR,
     ATTRIB_TYPE_LAST
   };
 
@@ -148,6 +151,14 @@ public:
    */
   unsigned int RegisterUniform( const std::string& name );
 
+  /**
+   * Register a uniform name in our local cache when the hash of the name is already known
+   * @param [in] name uniform name
+   * @param [in] nameHash the hash of the name, as calculated by Dali::CalculateHash()
+   * @return the index of the uniform name in local cache
+   */
+  unsigned int RegisterUniform( const std::string& name, std::size_t nameHash );
+
   /**
    * Gets the location of a pre-registered uniform.
    * Uniforms in list UniformType are always registered and in the order of the enumeration
@@ -375,6 +386,9 @@ private:  // Data
 
   Locations mAttributeLocations;      ///< attribute location cache
   Locations mUniformLocations;        ///< uniform location cache
+
+  typedef std::multimap< std::size_t, unsigned int > UniformIndices;
+  UniformIndices mUniformIndices;     ///< index of the uniforms in the location cache, keyed by name hash
   std::vector<GLint> mSamplerUniformLocations; ///< sampler uniform location cache
 
   // uniform value caching
@@ -32,6 +32,7 @@
 #include <dali/public-api/math/quaternion.h>
 #include <dali/public-api/math/radian.h>
 #include <dali/internal/update/animation/property-accessor.h>
+#include <dali/internal/update/animation/scene-graph-bezier-alpha-function.h>
 
 
 namespace Dali
@@ -71,6 +72,7 @@ public:
   : mDurationSeconds(1.0f),
     mInitialDelaySeconds(0.0f),
     mAlphaFunction(AlphaFunction::DEFAULT),
+    mBezierAlphaFunction(),
     mDisconnectAction(Dali::Animation::BakeFinal),
     mActive(false),
     mEnabled(true),
@@ -137,6 +139,16 @@ public:
   void SetAlphaFunction(const AlphaFunction& alphaFunction)
   {
     mAlphaFunction = alphaFunction;
+
+    // Bezier curves are sampled once here, in the event-thread, rather than searched each frame
+    if( alphaFunction.GetMode() == AlphaFunction::BEZIER )
+    {
+      mBezierAlphaFunction = BezierAlphaFunction::Get( alphaFunction.GetBezierControlPoints() );
+    }
+    else
+    {
+      mBezierAlphaFunction.Reset();
+    }
   }
 
   /**
@@ -249,29 +261,7 @@ public:
       //be almost 0 or almost 1 respectively
       if( ( progress > Math::MACHINE_EPSILON_1 ) && ((1.0f - progress) > Math::MACHINE_EPSILON_1) )
       {
-        Dali::Vector4 controlPoints = mAlphaFunction.GetBezierControlPoints();
-
-        static const float tolerance = 0.001f;  //10 iteration max
-
-        //Perform a binary search on the curve
-        float lowerBound(0.0f);
-        float upperBound(1.0f);
-        float currentT(0.5f);
-        float currentX = EvaluateCubicBezier( controlPoints.x, controlPoints.z, currentT);
-        while( fabs( progress - currentX ) > tolerance )
-        {
-          if( progress > currentX )
-          {
-            lowerBound = currentT;
-          }
-          else
-          {
-            upperBound = currentT;
-          }
-          currentT = (upperBound+lowerBound)*0.5f;
-          currentX = EvaluateCubicBezier( controlPoints.x, controlPoints.z, currentT);
-        }
-        result = EvaluateCubicBezier( controlPoints.y, controlPoints.w, currentT);
+        result = mBezierAlphaFunction->Evaluate( progress );
       }
     }
 
@@ -343,23 +333,11 @@ public:
 
 protected:
 
-  /**
-   * Helper function to evaluate a cubic bezier curve assuming first point is at 0.0 and last point is at 1.0
-   * @param[in] p0 First control point of the bezier curve
-   * @param[in] p1 Second control point of the bezier curve
-   * @param[in] t A floating point value between 0.0 and 1.0
-   * @return Value of the curve at progress t
-   */
-  inline float EvaluateCubicBezier( float p0, float p1, float t ) const
-  {
-    float tSquare = t*t;
-    return 3.0f*(1.0f-t)*(1.0f-t)*t*p0 + 3.0f*(1.0f-t)*tSquare*p1 + tSquare*t;
-  }
-
   float mDurationSeconds;
   float mInitialDelaySeconds;
 
   AlphaFunction mAlphaFunction;
+  BezierAlphaFunctionPtr mBezierAlphaFunction;      ///< The sampled curve of a bezier alpha function, shared with other animators
 
   Dali::Animation::EndAction mDisconnectAction;     ///< EndAction to apply when target object gets disconnected from the stage.
   bool mActive:1;                                   ///< Animator is "active" while it's running.
@@ -467,6 +445,11 @@ public:
     const PropertyType& current = mPropertyAccessor.Get( bufferIndex );
 
     const PropertyType result = (*mAnimatorFunction)( alpha, current );
+    if( mPropertyOwner )
+    {
+      mPropertyOwner->RequestReset();
+    }
+
     if ( bake )
     {
       mPropertyAccessor.Bake( bufferIndex, result );
@@ -995,7 +978,7 @@ struct RotateToQuaternion : public AnimatorFunctionBase
 struct KeyFrameBooleanFunctor : public AnimatorFunctionBase
 {
   KeyFrameBooleanFunctor(KeyFrameBooleanPtr keyFrames)
-  : mKeyFrames(keyFrames)
+  : mKeyFrames(keyFrames),mInterval(KeyFrameChannelBase::INVALID_INTERVAL)
   {
   }
 
@@ -1003,18 +986,19 @@ struct KeyFrameBooleanFunctor : public AnimatorFunctionBase
   {
     if(mKeyFrames->IsActive(progress))
     {
-      return mKeyFrames->GetValue(progress, Dali::Animation::Linear);
+      return mKeyFrames->GetValue(progress, Dali::Animation::Linear, mInterval);
     }
     return property;
   }
 
   KeyFrameBooleanPtr mKeyFrames;
+  unsigned int mInterval; ///< The key frame interval of the previous update
 };
 
 struct KeyFrameIntegerFunctor : public AnimatorFunctionBase
 {
   KeyFrameIntegerFunctor(KeyFrameIntegerPtr keyFrames, Interpolation interpolation)
-  : mKeyFrames(keyFrames),mInterpolation(interpolation)
+  : mKeyFrames(keyFrames),mInterpolation(interpolation),mInterval(KeyFrameChannelBase::INVALID_INTERVAL)
   {
   }
 
@@ -1022,19 +1006,20 @@ struct KeyFrameIntegerFunctor : public AnimatorFunctionBase
   {
     if(mKeyFrames->IsActive(progress))
     {
-      return mKeyFrames->GetValue(progress, mInterpolation);
+      return mKeyFrames->GetValue(progress, mInterpolation, mInterval);
     }
     return property;
   }
 
   KeyFrameIntegerPtr mKeyFrames;
   Interpolation mInterpolation;
+  unsigned int mInterval; ///< The key frame interval of the previous update
 };
 
 struct KeyFrameNumberFunctor : public AnimatorFunctionBase
 {
   KeyFrameNumberFunctor(KeyFrameNumberPtr keyFrames, Interpolation interpolation)
-  : mKeyFrames(keyFrames),mInterpolation(interpolation)
+  : mKeyFrames(keyFrames),mInterpolation(interpolation),mInterval(KeyFrameChannelBase::INVALID_INTERVAL)
   {
   }
 
@@ -1042,19 +1027,20 @@ struct KeyFrameNumberFunctor : public AnimatorFunctionBase
   {
     if(mKeyFrames->IsActive(progress))
     {
-      return mKeyFrames->GetValue(progress, mInterpolation);
+      return mKeyFrames->GetValue(progress, mInterpolation, mInterval);
     }
     return property;
   }
 
   KeyFrameNumberPtr mKeyFrames;
   Interpolation mInterpolation;
+  unsigned int mInterval; ///< The key frame interval of the previous update
 };
 
 struct KeyFrameVector2Functor : public AnimatorFunctionBase
 {
   KeyFrameVector2Functor(KeyFrameVector2Ptr keyFrames, Interpolation interpolation)
-  : mKeyFrames(keyFrames),mInterpolation(interpolation)
+  : mKeyFrames(keyFrames),mInterpolation(interpolation),mInterval(KeyFrameChannelBase::INVALID_INTERVAL)
   {
   }
 
@@ -1062,20 +1048,21 @@ struct KeyFrameVector2Functor : public AnimatorFunctionBase
   {
     if(mKeyFrames->IsActive(progress))
     {
-      return mKeyFrames->GetValue(progress, mInterpolation);
+      return mKeyFrames->GetValue(progress, mInterpolation, mInterval);
     }
     return property;
   }
 
   KeyFrameVector2Ptr mKeyFrames;
   Interpolation mInterpolation;
+  unsigned int mInterval; ///< The key frame interval of the previous update
 };
 
 
 struct KeyFrameVector3Functor : public AnimatorFunctionBase
 {
   KeyFrameVector3Functor(KeyFrameVector3Ptr keyFrames, Interpolation interpolation)
-  : mKeyFrames(keyFrames),mInterpolation(interpolation)
+  : mKeyFrames(keyFrames),mInterpolation(interpolation),mInterval(KeyFrameChannelBase::INVALID_INTERVAL)
   {
   }
 
@@ -1083,19 +1070,20 @@ struct KeyFrameVector3Functor : public AnimatorFunctionBase
   {
     if(mKeyFrames->IsActive(progress))
     {
-      return mKeyFrames->GetValue(progress, mInterpolation);
+      return mKeyFrames->GetValue(progress, mInterpolation, mInterval);
     }
     return property;
   }
 
   KeyFrameVector3Ptr mKeyFrames;
   Interpolation mInterpolation;
+  unsigned int mInterval; ///< The key frame interval of the previous update
 };
 
 struct KeyFrameVector4Functor : public AnimatorFunctionBase
 {
   KeyFrameVector4Functor(KeyFrameVector4Ptr keyFrames, Interpolation interpolation)
-  : mKeyFrames(keyFrames),mInterpolation(interpolation)
+  : mKeyFrames(keyFrames),mInterpolation(interpolation),mInterval(KeyFrameChannelBase::INVALID_INTERVAL)
   {
   }
 
@@ -1103,19 +1091,20 @@ struct KeyFrameVector4Functor : public AnimatorFunctionBase
   {
     if(mKeyFrames->IsActive(progress))
     {
-      return mKeyFrames->GetValue(progress, mInterpolation);
+      return mKeyFrames->GetValue(progress, mInterpolation, mInterval);
     }
     return property;
   }
 
   KeyFrameVector4Ptr mKeyFrames;
   Interpolation mInterpolation;
+  unsigned int mInterval; ///< The key frame interval of the previous update
 };
 
 struct KeyFrameQuaternionFunctor : public AnimatorFunctionBase
 {
   KeyFrameQuaternionFunctor(KeyFrameQuaternionPtr keyFrames)
-  : mKeyFrames(keyFrames)
+  : mKeyFrames(keyFrames),mInterval(KeyFrameChannelBase::INVALID_INTERVAL)
   {
   }
 
@@ -1123,12 +1112,13 @@ struct KeyFrameQuaternionFunctor : public AnimatorFunctionBase
   {
     if(mKeyFrames->IsActive(progress))
     {
-      return mKeyFrames->GetValue(progress, Dali::Animation::Linear);
+      return mKeyFrames->GetValue(progress, Dali::Animation::Linear, mInterval);
     }
     return property;
   }
 
   KeyFrameQuaternionPtr mKeyFrames;
+  unsigned int mInterval; ///< The key frame interval of the previous update
 };
 
 struct PathPositionFunctor : public AnimatorFunctionBase
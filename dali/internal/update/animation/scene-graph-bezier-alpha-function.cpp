@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/update/animation/scene-graph-bezier-alpha-function.h>
+
+// EXTERNAL INCLUDES
+#include <cmath>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/threading/mutex.h>
+#include <dali/public-api/math/math-utils.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+namespace // unnamed namespace
+{
+
+const float SAMPLE_STEP = 1.0f / static_cast<float>( BezierAlphaFunction::SAMPLE_COUNT - 1u );
+const unsigned int NEWTON_ITERATIONS = 4u;
+const float NEWTON_MIN_SLOPE = 0.001f;           ///< Below this slope, the Newton iterations may not converge
+const float NEWTON_PRECISION = 0.00001f;
+const float BISECTION_PRECISION = 0.0000001f;
+const unsigned int BISECTION_MAX_ITERATIONS = 24u;
+
+typedef std::vector< BezierAlphaFunctionPtr > BezierAlphaFunctionContainer;
+
+Mutex gMutex;
+BezierAlphaFunctionContainer gAlphaFunctions; ///< The alpha functions which may be shared, protected by gMutex
+
+/**
+ * Evaluate one coordinate of the curve, given the coordinates of its control points
+ * @param[in] p1 The coordinate of the first control point
+ * @param[in] p2 The coordinate of the second control point
+ * @param[in] t The parameter of the curve
+ * @return The coordinate at t
+ */
+inline float EvaluateCubicBezier( float p1, float p2, float t )
+{
+  const float c = 3.0f * p1;
+  const float b = 3.0f * ( p2 - p1 ) - c;
+  const float a = 1.0f - c - b;
+  return ( ( a * t + b ) * t + c ) * t;
+}
+
+/**
+ * Evaluate the derivative of one coordinate of the curve
+ * @param[in] p1 The coordinate of the first control point
+ * @param[in] p2 The coordinate of the second control point
+ * @param[in] t The parameter of the curve
+ * @return The derivative at t
+ */
+inline float EvaluateCubicBezierSlope( float p1, float p2, float t )
+{
+  const float c = 3.0f * p1;
+  const float b = 3.0f * ( p2 - p1 ) - c;
+  const float a = 1.0f - c - b;
+  return ( 3.0f * a * t + 2.0f * b ) * t + c;
+}
+
+} // unnamed namespace
+
+BezierAlphaFunctionPtr BezierAlphaFunction::Get( const Vector4& controlPoints )
+{
+  Mutex::ScopedLock lock( gMutex );
+
+  BezierAlphaFunctionContainer::iterator iter = gAlphaFunctions.begin();
+  while( iter != gAlphaFunctions.end() )
+  {
+    const Vector4& points = (*iter)->mControlPoints;
+    if( points == controlPoints )
+    {
+      return *iter;
+    }
+
+    if( 1 == (*iter)->ReferenceCount() )
+    {
+      // Only referenced here; no animator can take a new reference to it meanwhile, as this is the only way to get one
+      iter = gAlphaFunctions.erase( iter );
+    }
+    else
+    {
+      ++iter;
+    }
+  }
+
+  BezierAlphaFunctionPtr alphaFunction( new BezierAlphaFunction( controlPoints ) );
+  gAlphaFunctions.push_back( alphaFunction );
+  return alphaFunction;
+}
+
+unsigned int BezierAlphaFunction::GetSharedCount()
+{
+  Mutex::ScopedLock lock( gMutex );
+  return gAlphaFunctions.size();
+}
+
+float BezierAlphaFunction::Evaluate( float progress ) const
+{
+  if( mLinear )
+  {
+    return progress;
+  }
+
+  return EvaluateCubicBezier( mControlPoints.y, mControlPoints.w, GetParameter( progress ) );
+}
+
+BezierAlphaFunction::BezierAlphaFunction( const Vector4& controlPoints )
+: mControlPoints( controlPoints ),
+  mLinear( Equals( controlPoints.x, controlPoints.y ) && Equals( controlPoints.z, controlPoints.w ) )
+{
+  for( unsigned int i = 0; i < SAMPLE_COUNT; ++i )
+  {
+    mSamples[i] = EvaluateCubicBezier( mControlPoints.x, mControlPoints.z, static_cast<float>( i ) * SAMPLE_STEP );
+  }
+}
+
+BezierAlphaFunction::~BezierAlphaFunction()
+{
+}
+
+float BezierAlphaFunction::GetParameter( float progress ) const
+{
+  // x(t) is monotonic as the x coordinates of the control points are between 0 and 1; find the interval of the samples
+  unsigned int interval = 0u;
+  while( ( interval < SAMPLE_COUNT - 2u ) && ( mSamples[ interval + 1u ] <= progress ) )
+  {
+    ++interval;
+  }
+
+  // Interpolate within the interval for a first estimate
+  const float intervalStart = static_cast<float>( interval ) * SAMPLE_STEP;
+  const float sampleDelta = mSamples[ interval + 1u ] - mSamples[ interval ];
+  float t = intervalStart;
+  if( sampleDelta > 0.0f )
+  {
+    t += ( progress - mSamples[ interval ] ) / sampleDelta * SAMPLE_STEP;
+  }
+
+  // Newton-Raphson iterations converge quickly where the curve is steep enough
+  bool converged = false;
+  if( EvaluateCubicBezierSlope( mControlPoints.x, mControlPoints.z, t ) >= NEWTON_MIN_SLOPE )
+  {
+    for( unsigned int i = 0; i < NEWTON_ITERATIONS; ++i )
+    {
+      const float slope = EvaluateCubicBezierSlope( mControlPoints.x, mControlPoints.z, t );
+      if( slope < NEWTON_MIN_SLOPE )
+      {
+        break;
+      }
+      t -= ( EvaluateCubicBezier( mControlPoints.x, mControlPoints.z, t ) - progress ) / slope;
+    }
+    converged = ( t >= intervalStart ) && ( t <= intervalStart + SAMPLE_STEP ) &&
+                ( fabsf( EvaluateCubicBezier( mControlPoints.x, mControlPoints.z, t ) - progress ) <= NEWTON_PRECISION );
+  }
+
+  if( !converged )
+  {
+    // The curve is almost flat; bisect the interval
+    float lowerBound = intervalStart;
+    float upperBound = intervalStart + SAMPLE_STEP;
+    for( unsigned int i = 0; i < BISECTION_MAX_ITERATIONS; ++i )
+    {
+      t = ( lowerBound + upperBound ) * 0.5f;
+      const float error = EvaluateCubicBezier( mControlPoints.x, mControlPoints.z, t ) - progress;
+      if( fabsf( error ) <= BISECTION_PRECISION )
+      {
+        break;
+      }
+
+      if( error > 0.0f )
+      {
+        upperBound = t;
+      }
+      else
+      {
+        lowerBound = t;
+      }
+    }
+  }
+
+  // The estimate may overshoot at the ends of the curve
+  if( t < 0.0f )
+  {
+    t = 0.0f;
+  }
+  else if( t > 1.0f )
+  {
+    t = 1.0f;
+  }
+
+  return t;
+}
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
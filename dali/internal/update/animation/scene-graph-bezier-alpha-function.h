@@ -0,0 +1,124 @@
+#ifndef __DALI_INTERNAL_SCENE_GRAPH_BEZIER_ALPHA_FUNCTION_H__
+#define __DALI_INTERNAL_SCENE_GRAPH_BEZIER_ALPHA_FUNCTION_H__
+
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/math/vector4.h>
+#include <dali/public-api/object/ref-object.h>
+#include <dali/public-api/common/intrusive-ptr.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+class BezierAlphaFunction;
+typedef IntrusivePtr< BezierAlphaFunction > BezierAlphaFunctionPtr;
+
+/**
+ * A bezier alpha function compiled into a table of samples of the curve.
+ *
+ * The curve goes from (0,0) to (1,1); its control points are (x1,y1) and (x2,y2).
+ * To evaluate it at a progress p, the parameter t such as x(t) = p is estimated from the table,
+ * refined with a few Newton-Raphson iterations, then y(t) is returned.
+ *
+ * The objects are immutable once created, and shared between the animators using the same control points.
+ * They are created in the event thread, and read in the update thread.
+ */
+class BezierAlphaFunction : public RefObject
+{
+public:
+
+  static const unsigned int SAMPLE_COUNT = 11u; ///< The number of samples of x(t), at regular intervals of t
+
+  /**
+   * Retrieve the alpha function of a bezier curve, creating it if no animator is using the same curve yet.
+   * @note This must be called from the event thread only.
+   * @param[in] controlPoints The control points of the curve, (x1,y1,x2,y2).
+   * @return The alpha function.
+   */
+  static BezierAlphaFunctionPtr Get( const Vector4& controlPoints );
+
+  /**
+   * Retrieve the number of alpha functions which may be shared.
+   * The ones no animator uses any more are dropped by the next call to Get().
+   * @return The number of alpha functions.
+   */
+  static unsigned int GetSharedCount();
+
+  /**
+   * Evaluate the curve.
+   * @param[in] progress The progress of the animation, between 0 and 1.
+   * @return The alpha value.
+   */
+  float Evaluate( float progress ) const;
+
+  /**
+   * Retrieve the control points of the curve.
+   * @return The control points, (x1,y1,x2,y2).
+   */
+  const Vector4& GetControlPoints() const
+  {
+    return mControlPoints;
+  }
+
+private:
+
+  /**
+   * Constructor; samples the curve.
+   * @param[in] controlPoints The control points of the curve.
+   */
+  BezierAlphaFunction( const Vector4& controlPoints );
+
+  /**
+   * Destructor
+   */
+  virtual ~BezierAlphaFunction();
+
+  // Undefined
+  BezierAlphaFunction( const BezierAlphaFunction& );
+
+  // Undefined
+  BezierAlphaFunction& operator=( const BezierAlphaFunction& rhs );
+
+  /**
+   * Find the parameter t of the curve for which x(t) is the given progress.
+   * @param[in] progress The progress, between 0 and 1.
+   * @return The parameter t.
+   */
+  float GetParameter( float progress ) const;
+
+private:
+
+  Vector4 mControlPoints;             ///< (x1,y1,x2,y2)
+  float mSamples[ SAMPLE_COUNT ];     ///< x(t) for t = i / ( SAMPLE_COUNT - 1 )
+  bool mLinear;                       ///< Whether the curve is the line y = x
+};
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_SCENE_GRAPH_BEZIER_ALPHA_FUNCTION_H__
@@ -36,6 +36,7 @@ ConstraintBase::ConstraintBase( PropertyOwnerContainer& ownerSet )
 : mRemoveAction( Dali::Constraint::DEFAULT_REMOVE_ACTION ),
   mFirstApply( true ),
   mDisconnected( true ),
+  mSkipUnchanged( false ),
   mObservedOwners( ownerSet )
 {
 #ifdef DEBUG_ENABLED
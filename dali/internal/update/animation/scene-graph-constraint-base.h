@@ -91,6 +91,25 @@ public:
     return mRemoveAction;
   }
 
+  /**
+   * Set whether the constraint reuses its previous output, instead of calling the constraint function,
+   * when the values of its inputs and of the target property have not changed since the previous frame.
+   * @param[in] skip True to skip the evaluation of unchanged constraints.
+   */
+  void SetSkipUnchanged( bool skip )
+  {
+    mSkipUnchanged = skip;
+  }
+
+  /**
+   * Query whether the evaluation of the constraint is skipped when nothing has changed.
+   * @return True if the evaluation of unchanged constraints is skipped.
+   */
+  bool GetSkipUnchanged() const
+  {
+    return mSkipUnchanged;
+  }
+
   /**
    * Constrain the associated scene object.
    * @param[in] updateBufferIndex The current update buffer index.
@@ -201,8 +220,9 @@ protected:
 
   RemoveAction mRemoveAction;
 
-  bool mFirstApply   : 1;
-  bool mDisconnected : 1;
+  bool mFirstApply    : 1;
+  bool mDisconnected  : 1;
+  bool mSkipUnchanged : 1;
 
 private:
 
@@ -227,6 +247,17 @@ inline void  SetRemoveActionMessage( EventThreadServices& eventThreadServices, c
   new (slot) LocalType( &constraint, &ConstraintBase::SetRemoveAction, removeAction );
 }
 
+inline void SetSkipUnchangedMessage( EventThreadServices& eventThreadServices, const ConstraintBase& constraint, bool skip )
+{
+  typedef MessageValue1< ConstraintBase, bool > LocalType;
+
+  // Reserve some memory inside the message queue
+  unsigned int* slot = eventThreadServices.ReserveMessageSlot( sizeof( LocalType ) );
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &constraint, &ConstraintBase::SetSkipUnchanged, skip );
+}
+
 } // namespace SceneGraph
 
 } // namespace Internal
@@ -18,6 +18,9 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <cstring>
+
 // INTERNAL INCLUDES
 #include <dali/public-api/common/dali-common.h>
 #include <dali/public-api/signals/callback.h>
@@ -86,7 +89,34 @@ public:
     if ( mFunc->InputsInitialized() )
     {
       PropertyType current = mTargetProperty.Get( updateBufferIndex );
-      mFunc->Apply( updateBufferIndex, current );
+
+      bool skip( false );
+      if ( mSkipUnchanged )
+      {
+        // The input values are compared every frame, to keep them up to date
+        const bool inputsChanged = mFunc->InputValuesChanged( updateBufferIndex );
+        skip = !inputsChanged && ( 0 == memcmp( &current, &mPreviousTargetValue, sizeof( PropertyType ) ) );
+        if ( !skip )
+        {
+          mPreviousTargetValue = current;
+        }
+      }
+
+      if ( skip )
+      {
+        current = mPreviousOutput;
+        INCREASE_COUNTER(PerformanceMonitor::CONSTRAINTS_SKIPPED);
+      }
+      else
+      {
+        mFunc->Apply( updateBufferIndex, current );
+        if ( mSkipUnchanged )
+        {
+          // Kept together with the values it was computed from
+          mPreviousOutput = current;
+        }
+        INCREASE_COUNTER(PerformanceMonitor::CONSTRAINTS_APPLIED);
+      }
 
       // Optionally bake the final value
       if ( Dali::Constraint::Bake == mRemoveAction )
@@ -97,8 +127,6 @@ public:
       {
         mTargetProperty.Set( updateBufferIndex, current );
       }
-
-      INCREASE_COUNTER(PerformanceMonitor::CONSTRAINTS_APPLIED);
     }
     else
     {
@@ -116,7 +144,9 @@ private:
               ConstraintFunctionPtr func )
   : ConstraintBase( ownerContainer ),
     mTargetProperty( &targetProperty ),
-    mFunc( func )
+    mFunc( func ),
+    mPreviousTargetValue(),
+    mPreviousOutput()
   {
   }
 
@@ -141,6 +171,9 @@ protected:
   PropertyAccessorType mTargetProperty; ///< Raw-pointer to the target property. Not owned.
 
   ConstraintFunctionPtr mFunc;
+
+  PropertyType mPreviousTargetValue; ///< The value of the target property before the last evaluation
+  PropertyType mPreviousOutput;      ///< The output of the last evaluation, reused when nothing has changed
 };
 
 } // namespace SceneGraph
@@ -2097,104 +2097,6 @@ private:
 
 } // namespace SceneGraph
 
-// Messages for AnimatableProperty<T>
-
-template <class T>
-void BakeMessage( EventThreadServices& eventThreadServices,
-                  const SceneGraph::AnimatableProperty<T>& property,
-                  typename ParameterType< T >::PassingType newValue )
-{
-  typedef MessageDoubleBuffered1< SceneGraph::AnimatableProperty<T>, T > LocalType;
-
-  // Reserve some memory inside the message queue
-  unsigned int* slot = eventThreadServices.ReserveMessageSlot( sizeof( LocalType ) );
-
-  // Construct message in the message queue memory; note that delete should not be called on the return value
-  new (slot) LocalType( &property,
-                        &SceneGraph::AnimatableProperty<T>::Bake,
-                        newValue );
-}
-
-template <class T>
-void BakeRelativeMessage( EventThreadServices& eventThreadServices,
-                          const SceneGraph::AnimatableProperty<T>& property,
-                          const T& delta )
-{
-  typedef MessageDoubleBuffered1< SceneGraph::AnimatableProperty<T>, const T& > LocalType;
-
-  // Reserve some memory inside the message queue
-  unsigned int* slot = eventThreadServices.ReserveMessageSlot( sizeof( LocalType ) );
-
-  // Construct message in the message queue memory; note that delete should not be called on the return value
-  new (slot) LocalType( &property,
-                        &SceneGraph::AnimatableProperty<T>::BakeRelative,
-                         delta );
-}
-
-template <class T>
-void SetXComponentMessage( EventThreadServices& eventThreadServices,
-                           const SceneGraph::AnimatableProperty<T>& property,
-                           typename ParameterType< float >::PassingType newValue )
-{
-  typedef MessageDoubleBuffered1< SceneGraph::AnimatableProperty<T>, float > LocalType;
-
-  // Reserve some memory inside the message queue
-  unsigned int* slot = eventThreadServices.ReserveMessageSlot( sizeof( LocalType ) );
-
-  // Construct message in the message queue memory; note that delete should not be called on the return value
-  new (slot) LocalType( &property,
-                        &SceneGraph::AnimatableProperty<T>::BakeX,
-                        newValue );
-}
-
-template <class T>
-void SetYComponentMessage( EventThreadServices& eventThreadServices,
-                           const SceneGraph::AnimatableProperty<T>& property,
-                           typename ParameterType< float >::PassingType newValue )
-{
-  typedef MessageDoubleBuffered1< SceneGraph::AnimatableProperty<T>, float > LocalType;
-
-  // Reserve some memory inside the message queue
-  unsigned int* slot = eventThreadServices.ReserveMessageSlot( sizeof( LocalType ) );
-
-  // Construct message in the message queue memory; note that delete should not be called on the return value
-  new (slot) LocalType( &property,
-                        &SceneGraph::AnimatableProperty<T>::BakeY,
-                        newValue );
-}
-
-template <class T>
-void SetZComponentMessage( EventThreadServices& eventThreadServices,
-                           const SceneGraph::AnimatableProperty<T>& property,
-                           typename ParameterType< float >::PassingType newValue )
-{
-  typedef MessageDoubleBuffered1< SceneGraph::AnimatableProperty<T>, float > LocalType;
-
-  // Reserve some memory inside the message queue
-  unsigned int* slot = eventThreadServices.ReserveMessageSlot( sizeof( LocalType ) );
-
-  // Construct message in the message queue memory; note that delete should not be called on the return value
-  new (slot) LocalType( &property,
-                        &SceneGraph::AnimatableProperty<T>::BakeZ,
-                        newValue );
-}
-
-template <class T>
-void SetWComponentMessage( EventThreadServices& eventThreadServices,
-                           const SceneGraph::AnimatableProperty<T>& property,
-                           typename ParameterType< float >::PassingType newValue )
-{
-  typedef MessageDoubleBuffered1< SceneGraph::AnimatableProperty<T>, float > LocalType;
-
-  // Reserve some memory inside the message queue
-  unsigned int* slot = eventThreadServices.ReserveMessageSlot( sizeof( LocalType ) );
-
-  // Construct message in the message queue memory; note that delete should not be called on the return value
-  new (slot) LocalType( &property,
-                        &SceneGraph::AnimatableProperty<T>::BakeW,
-                        newValue );
-}
-
 } // namespace Internal
 
 } // namespace Dali
@@ -20,6 +20,7 @@
 
 // INTERNAL INCLUDES
 
+#include <dali/internal/common/message-key.h>
 #include <dali/internal/event/common/event-thread-services.h>
 #include <dali/internal/event/common/property-input-impl.h>
 #include <dali/internal/update/common/property-owner.h>
@@ -88,8 +89,10 @@ public:
                     MemberFunction member,
                     typename ParameterType< P >::PassingType value )
   {
-    // Reserve some memory inside the message queue
-    unsigned int* slot = eventThreadServices.ReserveMessageSlot( sizeof( AnimatablePropertyMessage ) );
+    // Reserve some memory inside the message queue; a previous message baking another value may be coalesced
+    unsigned int* slot = ( member == &AnimatableProperty<P>::Bake ) ?
+                         eventThreadServices.ReserveMessageSlot( sizeof( AnimatablePropertyMessage ), MessageKey( property, member ) ) :
+                         eventThreadServices.ReserveMessageSlot( sizeof( AnimatablePropertyMessage ) );
 
     // Construct message in the message queue memory; note that delete should not be called on the return value
     new (slot) AnimatablePropertyMessage( sceneObject, property, member, value );
@@ -108,6 +111,7 @@ public:
   virtual void Process( BufferIndex updateBufferIndex )
   {
     (mProperty->*mMemberFunction)( updateBufferIndex, mParam );
+    mSceneObject->RequestReset();
   }
 
 private:
@@ -158,7 +162,7 @@ public:
    * @param[in] eventThreadServices The service object used for sending messages to the scene graph
    * @param[in] sceneObject The property owner scene object
    * @param[in] property The property to bake.
-   * @param[in] member The member function of the object.
+   * @param[in] member The member function of the object; it must not depend on the current value.
    * @param[in] value The new value of the X,Y,Z or W component.
    */
   static void Send( EventThreadServices& eventThreadServices,
@@ -167,8 +171,8 @@ public:
                     MemberFunction member,
                     float value )
   {
-    // Reserve some memory inside the message queue
-    unsigned int* slot = eventThreadServices.ReserveMessageSlot( sizeof( AnimatablePropertyComponentMessage ) );
+    // Reserve some memory inside the message queue; a previous message baking the same component may be coalesced
+    unsigned int* slot = eventThreadServices.ReserveMessageSlot( sizeof( AnimatablePropertyComponentMessage ), MessageKey( property, member ) );
 
     // Construct message in the message queue memory; note that delete should not be called on the return value
     new (slot) AnimatablePropertyComponentMessage( sceneObject, property, member, value );
@@ -187,6 +191,7 @@ public:
   virtual void Process( BufferIndex updateBufferIndex )
   {
     (mProperty->*mMemberFunction)( updateBufferIndex, mParam );
+    mSceneObject->RequestReset();
   }
 
 private:
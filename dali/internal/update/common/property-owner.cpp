@@ -24,6 +24,7 @@
 // INTERNAL INCLUDES
 #include <dali/public-api/common/dali-common.h>
 #include <dali/internal/update/animation/scene-graph-constraint-base.h>
+#include <dali/internal/update/common/property-reset-list.h>
 
 namespace Dali
 {
@@ -42,6 +43,11 @@ PropertyOwner* PropertyOwner::New()
 PropertyOwner::~PropertyOwner()
 {
   Destroy();
+
+  if( INVALID_RESET_INDEX != mResetIndex )
+  {
+    mResetList->Remove( *this );
+  }
 }
 
 void PropertyOwner::AddObserver(Observer& observer)
@@ -115,6 +121,8 @@ void PropertyOwner::InstallCustomProperty(PropertyBase* property)
   DALI_ASSERT_DEBUG( NULL != property );
 
   mCustomProperties.PushBack( property );
+
+  RequestReset();
 }
 
 void PropertyOwner::ResetToBaseValues( BufferIndex updateBufferIndex )
@@ -130,6 +138,19 @@ void PropertyOwner::ResetToBaseValues( BufferIndex updateBufferIndex )
   ResetDefaultProperties( updateBufferIndex );
 }
 
+void PropertyOwner::SetResetList( PropertyResetList& resetList )
+{
+  DALI_ASSERT_DEBUG( NULL == mResetList );
+
+  mResetList = &resetList;
+  RequestReset();
+}
+
+void PropertyOwner::AddToResetList()
+{
+  mResetList->Add( *this );
+}
+
 ConstraintOwnerContainer& PropertyOwner::GetConstraints()
 {
   return mConstraints;
@@ -158,6 +179,9 @@ void PropertyOwner::RemoveConstraint( ConstraintBase* constraint )
 }
 
 PropertyOwner::PropertyOwner()
+: mResetList( NULL ),
+  mResetIndex( INVALID_RESET_INDEX ),
+  mResetCount( 0u )
 {
 }
 
@@ -40,6 +40,7 @@ namespace SceneGraph
 {
 
 class PropertyOwner;
+class PropertyResetList;
 
 typedef OwnerContainer< PropertyBase* > OwnedPropertyContainer;
 typedef OwnedPropertyContainer::Iterator  OwnedPropertyIter;
@@ -161,6 +162,26 @@ public:
    */
   void ResetToBaseValues( BufferIndex updateBufferIndex );
 
+  /**
+   * Set the list in which the object is added when its properties have to be reset.
+   * The object is added straight away, to reset the initial values of its properties.
+   * @param[in] resetList The reset list, which must outlive the object or detach it.
+   */
+  void SetResetList( PropertyResetList& resetList );
+
+  /**
+   * Request the properties to be reset to their base values in the next two updates,
+   * i.e. until both buffers have been reset. This is called whenever a property is written.
+   */
+  void RequestReset()
+  {
+    mResetCount = 2u;
+    if( mResetList && ( INVALID_RESET_INDEX == mResetIndex ) )
+    {
+      AddToResetList();
+    }
+  }
+
   // Constraints
 
   /**
@@ -228,6 +249,11 @@ private:
    */
   virtual void ResetDefaultProperties( BufferIndex updateBufferIndex ) {}
 
+  /**
+   * Add the object to its reset list.
+   */
+  void AddToResetList();
+
 protected:
 
   OwnedPropertyContainer mCustomProperties; ///< Properties provided with InstallCustomProperty()
@@ -242,6 +268,13 @@ private:
   ObserverContainer mObservers; ///< Container of observer raw-pointers (not owned)
 
   ConstraintOwnerContainer mConstraints; ///< Container of owned constraints
+
+  friend class PropertyResetList;
+  static const unsigned int INVALID_RESET_INDEX = 0xFFFFFFFFu;
+
+  PropertyResetList* mResetList;  ///< The list to join when the properties have to be reset, not owned. NULL if the object is reset by its owner
+  unsigned int mResetIndex;       ///< The position in the reset list, or INVALID_RESET_INDEX
+  unsigned int mResetCount;       ///< The number of resets still required
 };
 
 } // namespace SceneGraph
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/update/common/property-reset-list.h>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-common.h>
+#include <dali/internal/update/common/property-owner.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+PropertyResetList::PropertyResetList()
+: mOwners()
+{
+}
+
+PropertyResetList::~PropertyResetList()
+{
+  for( Dali::Vector< PropertyOwner* >::Iterator iter = mOwners.Begin(), endIter = mOwners.End(); iter != endIter; ++iter )
+  {
+    (*iter)->mResetList = NULL;
+    (*iter)->mResetIndex = PropertyOwner::INVALID_RESET_INDEX;
+  }
+}
+
+void PropertyResetList::Add( PropertyOwner& owner )
+{
+  DALI_ASSERT_DEBUG( PropertyOwner::INVALID_RESET_INDEX == owner.mResetIndex );
+
+  owner.mResetIndex = mOwners.Count();
+  mOwners.PushBack( &owner );
+}
+
+void PropertyResetList::Remove( PropertyOwner& owner )
+{
+  const unsigned int index = owner.mResetIndex;
+  DALI_ASSERT_DEBUG( index < mOwners.Count() && mOwners[index] == &owner );
+
+  // Move the last owner into the slot; the order of the resets does not matter
+  PropertyOwner* last = mOwners[ mOwners.Count() - 1u ];
+  mOwners[index] = last;
+  last->mResetIndex = index;
+  mOwners.Resize( mOwners.Count() - 1u );
+
+  owner.mResetIndex = PropertyOwner::INVALID_RESET_INDEX;
+}
+
+void PropertyResetList::ResetToBaseValues( BufferIndex updateBufferIndex )
+{
+  unsigned int index = 0u;
+  while( index < mOwners.Count() )
+  {
+    PropertyOwner& owner = *mOwners[index];
+    owner.ResetToBaseValues( updateBufferIndex );
+
+    if( 0u == --owner.mResetCount )
+    {
+      // Another owner is moved into this slot; visit it before moving on
+      Remove( owner );
+    }
+    else
+    {
+      ++index;
+    }
+  }
+}
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,103 @@
+#ifndef __DALI_INTERNAL_SCENE_GRAPH_PROPERTY_RESET_LIST_H__
+#define __DALI_INTERNAL_SCENE_GRAPH_PROPERTY_RESET_LIST_H__
+
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/internal/update/common/scene-graph-buffers.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+class PropertyOwner;
+
+/**
+ * The property owners whose animatable properties have to be reset to their base values.
+ *
+ * An owner is added when one of its properties is written (by a message, an animator or a constraint),
+ * and stays in the list until its properties have been reset in both buffers; the owners which have
+ * not changed are not visited each frame.
+ */
+class PropertyResetList
+{
+public:
+
+  /**
+   * Constructor.
+   */
+  PropertyResetList();
+
+  /**
+   * Destructor; the owners still in the list are detached from it.
+   */
+  ~PropertyResetList();
+
+  /**
+   * Add an owner; it must not be in the list already.
+   * @param[in] owner The owner to add.
+   */
+  void Add( PropertyOwner& owner );
+
+  /**
+   * Remove an owner; it must be in the list.
+   * @param[in] owner The owner to remove.
+   */
+  void Remove( PropertyOwner& owner );
+
+  /**
+   * Reset the properties of the owners in the list to their base values.
+   * The owners which have been reset in both buffers since they were last written are removed.
+   * @param[in] updateBufferIndex The buffer to reset.
+   */
+  void ResetToBaseValues( BufferIndex updateBufferIndex );
+
+  /**
+   * @return The number of owners in the list.
+   */
+  unsigned int Count() const
+  {
+    return mOwners.Count();
+  }
+
+private:
+
+  // Undefined
+  PropertyResetList( const PropertyResetList& );
+
+  // Undefined
+  PropertyResetList& operator=( const PropertyResetList& rhs );
+
+private:
+
+  Dali::Vector< PropertyOwner* > mOwners; ///< The owners to reset, not owned
+};
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_SCENE_GRAPH_PROPERTY_RESET_LIST_H__
@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/update/manager/damage-tracker.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/actors/layer.h>
+#include <dali/internal/common/math.h>
+#include <dali/internal/update/nodes/scene-graph-layer.h>
+#include <dali/internal/update/rendering/scene-graph-renderer.h>
+#include <dali/internal/update/render-tasks/scene-graph-camera.h>
+#include <dali/internal/render/common/render-instruction.h>
+#include <dali/internal/render/shaders/scene-graph-shader.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+namespace
+{
+
+const size_t MAXIMUM_DAMAGED_RECTS( 8u ); ///< Above this number the damaged rectangles are merged into one
+
+/**
+ * Checks whether any custom property of an object changed in the last two frames
+ * @param[in] owner The object
+ * @return True if a custom property is not clean
+ */
+bool HasCustomPropertyChanged( const PropertyOwner& owner )
+{
+  const OwnedPropertyContainer& properties = owner.GetCustomProperties();
+  for( OwnedPropertyContainer::ConstIterator iter = properties.Begin(), endIter = properties.End(); iter != endIter; ++iter )
+  {
+    if( !(*iter)->IsClean() )
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Merges the overlapping rectangles; when too many are left, they are merged into their bounding box
+ * @param[in,out] rects The rectangles
+ */
+void MergeDamagedRects( std::vector< Rect<int> >& rects )
+{
+  bool merged( true );
+  while( merged && rects.size() > 1u )
+  {
+    merged = false;
+    for( size_t i(0); i < rects.size() && !merged; ++i )
+    {
+      for( size_t j(i + 1u); j < rects.size(); ++j )
+      {
+        if( rects[i].Intersects( rects[j] ) || rects[i].Contains( rects[j] ) || rects[j].Contains( rects[i] ) )
+        {
+          MergeRect( rects[i], rects[j] );
+          rects.erase( rects.begin() + j );
+          merged = true;
+          break;
+        }
+      }
+    }
+  }
+
+  if( rects.size() > MAXIMUM_DAMAGED_RECTS )
+  {
+    for( size_t i(1); i < rects.size(); ++i )
+    {
+      MergeRect( rects[0], rects[i] );
+    }
+    rects.resize( 1u );
+  }
+}
+
+} // unnamed namespace
+
+DamageTracker::DamageTracker()
+: mItems(),
+  mPreviousItems(),
+  mDamage(),
+  mViewport(),
+  mPreviousViewport(),
+  mPreviousClearColor(),
+  mPreviousClearEnabled( false ),
+  mHasPreviousFrame( false )
+{
+}
+
+DamageTracker::~DamageTracker()
+{
+}
+
+void DamageTracker::Update( BufferIndex updateBufferIndex,
+                            SortedLayerPointers& sortedLayers,
+                            const Matrix& viewMatrix,
+                            Camera& camera,
+                            const Rect<int>& surfaceRect,
+                            RenderInstruction& instruction )
+{
+  // Same viewport as the render thread, the lower-left corner is (0,0)
+  if( instruction.mIsViewportSet )
+  {
+    const int y = ( surfaceRect.height - instruction.mViewport.height ) - instruction.mViewport.y;
+    mViewport.Set( instruction.mViewport.x, y, instruction.mViewport.width, instruction.mViewport.height );
+  }
+  else
+  {
+    mViewport = surfaceRect;
+  }
+
+  mDamage.clear();
+  mItems.clear();
+
+  Matrix viewProjection( false );
+  Matrix::Multiply( viewProjection, viewMatrix, camera.GetProjectionMatrix( updateBufferIndex ) );
+
+  const unsigned int layerCount( sortedLayers.size() );
+  for( unsigned int layerIndex(0); layerIndex < layerCount; ++layerIndex )
+  {
+    Layer& layer = *sortedLayers[ layerIndex ];
+    const RenderableContainer* containers[] = { &layer.stencilRenderables, &layer.colorRenderables, &layer.overlayRenderables };
+    for( unsigned int i(0); i < sizeof( containers ) / sizeof( containers[0] ); ++i )
+    {
+      const RenderableContainer& renderables = *containers[i];
+      for( RenderableContainer::ConstIterator iter = renderables.Begin(), endIter = renderables.End(); iter != endIter; ++iter )
+      {
+        AddItem( updateBufferIndex, layer, layerIndex, *iter->mNode, *iter->mRenderer, viewProjection );
+      }
+    }
+  }
+
+  std::sort( mItems.begin(), mItems.end(), CompareItems );
+
+  if( !mHasPreviousFrame ||
+      mViewport != mPreviousViewport ||
+      instruction.mIsClearColorSet != mPreviousClearEnabled ||
+      ( instruction.mIsClearColorSet && instruction.mClearColor != mPreviousClearColor ) )
+  {
+    // Everything drawn in the viewport changed, including the area of the surface it no longer covers
+    AddDamage( mViewport, surfaceRect );
+    if( mHasPreviousFrame )
+    {
+      AddDamage( mPreviousViewport, surfaceRect );
+    }
+  }
+  else
+  {
+    // Both lists are sorted, walk them together to find the added, removed and changed items
+    ItemContainer::const_iterator current = mItems.begin();
+    ItemContainer::const_iterator previous = mPreviousItems.begin();
+    while( current != mItems.end() || previous != mPreviousItems.end() )
+    {
+      if( previous == mPreviousItems.end() || ( current != mItems.end() && CompareItems( *current, *previous ) ) )
+      {
+        // Added
+        AddDamage( current->rect, mViewport );
+        ++current;
+      }
+      else if( current == mItems.end() || CompareItems( *previous, *current ) )
+      {
+        // Removed
+        AddDamage( previous->rect, mViewport );
+        ++previous;
+      }
+      else
+      {
+        // The matrix catches the transforms which keep the rectangle, e.g. a flip or a move in depth
+        if( current->changed ||
+            current->rect != previous->rect ||
+            memcmp( current->modelViewProjection.AsFloat(), previous->modelViewProjection.AsFloat(), sizeof( float ) * 16u ) != 0 ||
+            current->color != previous->color ||
+            current->layer != previous->layer ||
+            current->depthIndex != previous->depthIndex )
+        {
+          AddDamage( current->rect, mViewport );
+          AddDamage( previous->rect, mViewport );
+        }
+        ++current;
+        ++previous;
+      }
+    }
+  }
+
+  MergeDamagedRects( mDamage );
+  instruction.mDamagedRects.insert( instruction.mDamagedRects.end(), mDamage.begin(), mDamage.end() );
+  instruction.mIsDamageTracked = true;
+
+  mItems.swap( mPreviousItems );
+  mPreviousViewport = mViewport;
+  mPreviousClearColor = instruction.mClearColor;
+  mPreviousClearEnabled = instruction.mIsClearColorSet;
+  mHasPreviousFrame = true;
+}
+
+void DamageTracker::Reset()
+{
+  mItems.clear();
+  mPreviousItems.clear();
+  mHasPreviousFrame = false;
+}
+
+void DamageTracker::AddItem( BufferIndex updateBufferIndex,
+                             const Layer& layer,
+                             unsigned int layerIndex,
+                             Node& node,
+                             Renderer& renderer,
+                             const Matrix& viewProjection )
+{
+  Item item;
+  item.node = &node;
+  item.renderer = &renderer;
+  item.color = node.GetWorldColor( updateBufferIndex );
+  item.layer = layerIndex;
+  item.depthIndex = renderer.GetDepthIndex() + static_cast<int>( node.GetDepth() ) * Dali::Layer::TREE_DEPTH_MULTIPLIER;
+  item.changed = renderer.HasChanged() ||
+                 ( node.GetDirtyFlags() != NothingFlag ) ||
+                 HasCustomPropertyChanged( node ) ||
+                 HasCustomPropertyChanged( renderer ) ||
+                 HasCustomPropertyChanged( renderer.GetShader() );
+
+  Matrix world( false );
+  Vector3 size;
+  node.GetWorldMatrixAndSize( world, size );
+  Matrix::Multiply( item.modelViewProjection, world, viewProjection );
+  const Matrix& modelViewProjection = item.modelViewProjection;
+
+  item.rect = mViewport;
+  if( !renderer.GetShader().HintEnabled( Dali::Shader::Hint::MODIFIES_GEOMETRY ) )
+  {
+
+    // Project the corners of the box of the node; fall back to the whole viewport if a corner is behind the camera
+    float left( 0.0f ), right( 0.0f ), bottom( 0.0f ), top( 0.0f );
+    bool projected( true );
+    for( unsigned int corner(0); corner < 8u && projected; ++corner )
+    {
+      const Vector4 position = modelViewProjection * Vector4( ( corner & 1u ) ? size.x * 0.5f : size.x * -0.5f,
+                                                              ( corner & 2u ) ? size.y * 0.5f : size.y * -0.5f,
+                                                              ( corner & 4u ) ? size.z * 0.5f : size.z * -0.5f,
+                                                              1.0f );
+      if( position.w <= Math::MACHINE_EPSILON_1000 )
+      {
+        projected = false;
+        break;
+      }
+
+      const float x = mViewport.x + ( position.x / position.w + 1.0f ) * 0.5f * mViewport.width;
+      const float y = mViewport.y + ( position.y / position.w + 1.0f ) * 0.5f * mViewport.height;
+      if( corner == 0u )
+      {
+        left = right = x;
+        bottom = top = y;
+      }
+      else
+      {
+        left = std::min( left, x );
+        right = std::max( right, x );
+        bottom = std::min( bottom, y );
+        top = std::max( top, y );
+      }
+    }
+
+    if( projected )
+    {
+      // One more pixel around the rectangle for anti-aliased and rounded edges
+      const int x = static_cast<int>( floorf( left ) ) - 1;
+      const int y = static_cast<int>( floorf( bottom ) ) - 1;
+      item.rect.Set( x, y, static_cast<int>( ceilf( right ) ) + 1 - x, static_cast<int>( ceilf( top ) ) + 1 - y );
+    }
+  }
+
+  if( layer.IsClipping() )
+  {
+    IntersectRect( item.rect, layer.GetClippingBox() );
+  }
+
+  mItems.push_back( item );
+}
+
+void DamageTracker::AddDamage( const Rect<int>& rect, const Rect<int>& clip )
+{
+  Rect<int> damage( rect );
+  IntersectRect( damage, clip );
+  if( damage.width > 0 && damage.height > 0 )
+  {
+    mDamage.push_back( damage );
+  }
+}
+
+bool DamageTracker::CompareItems( const Item& lhs, const Item& rhs )
+{
+  if( lhs.node != rhs.node )
+  {
+    return lhs.node < rhs.node;
+  }
+  return lhs.renderer < rhs.renderer;
+}
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
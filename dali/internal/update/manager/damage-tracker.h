@@ -0,0 +1,158 @@
+#ifndef __DALI_INTERNAL_SCENE_GRAPH_DAMAGE_TRACKER_H__
+#define __DALI_INTERNAL_SCENE_GRAPH_DAMAGE_TRACKER_H__
+
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/vector-wrapper.h>
+#include <dali/public-api/math/matrix.h>
+#include <dali/public-api/math/rect.h>
+#include <dali/public-api/math/vector4.h>
+#include <dali/internal/common/buffer-index.h>
+#include <dali/internal/update/manager/sorted-layers.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+class Camera;
+class Layer;
+class Node;
+class Renderer;
+class RenderInstruction;
+
+/**
+ * Finds the area of the viewport of an on-screen render task which changed since the previous frame.
+ *
+ * The screen rectangle, model-view-projection matrix, world color and drawing order of every renderer
+ * of the task are kept from one frame to the next. A renderer is damaged when one of them changed, when its node, shader or renderer
+ * properties changed, or when it has been added or removed; both its previous and current rectangles
+ * are then damaged.
+ */
+class DamageTracker
+{
+public:
+
+  /**
+   * Constructor
+   */
+  DamageTracker();
+
+  /**
+   * Destructor
+   */
+  ~DamageTracker();
+
+  /**
+   * Computes the rectangles of the viewport damaged since the previous call and adds them to the instruction.
+   * @pre The layers hold the renderables of the render task and the instruction has been prepared
+   * @param[in] updateBufferIndex The current update buffer index.
+   * @param[in] sortedLayers The layers in depth order.
+   * @param[in] viewMatrix The view matrix of the render task.
+   * @param[in] camera The camera of the render task.
+   * @param[in] surfaceRect The rectangle of the default surface.
+   * @param[in,out] instruction The render instruction of the render task.
+   */
+  void Update( BufferIndex updateBufferIndex,
+               SortedLayerPointers& sortedLayers,
+               const Matrix& viewMatrix,
+               Camera& camera,
+               const Rect<int>& surfaceRect,
+               RenderInstruction& instruction );
+
+  /**
+   * Forgets the previous frame; the whole viewport is damaged by the next Update().
+   */
+  void Reset();
+
+private:
+
+  /**
+   * The state of a renderer in a frame
+   */
+  struct Item
+  {
+    const Node* node;           ///< The node of the renderer, only used as a key
+    const Renderer* renderer;   ///< The renderer, only used as a key
+    Rect<int> rect;             ///< The rectangle covered by the renderer in GL window coordinates
+    Matrix modelViewProjection; ///< The model-view-projection matrix of the renderer, compared bit by bit
+    Vector4 color;              ///< The world color of the node
+    unsigned int layer;         ///< The index of the layer
+    int depthIndex;             ///< The depth index used to sort the renderer in the layer
+    bool changed;               ///< Whether the node, shader or renderer properties changed this frame
+  };
+
+  typedef std::vector< Item > ItemContainer;
+
+  /**
+   * Adds a renderable of a layer to the items of the current frame.
+   * @param[in] updateBufferIndex The current update buffer index.
+   * @param[in] layer The layer of the renderable.
+   * @param[in] layerIndex The index of the layer in depth order.
+   * @param[in] node The node of the renderable.
+   * @param[in] renderer The renderer of the renderable.
+   * @param[in] viewProjection The view-projection matrix of the render task.
+   */
+  void AddItem( BufferIndex updateBufferIndex,
+                const Layer& layer,
+                unsigned int layerIndex,
+                Node& node,
+                Renderer& renderer,
+                const Matrix& viewProjection );
+
+  /**
+   * Adds a damaged rectangle to the current frame.
+   * @param[in] rect The damaged rectangle.
+   * @param[in] clip The rectangle the damage is clipped to.
+   */
+  void AddDamage( const Rect<int>& rect, const Rect<int>& clip );
+
+  /**
+   * Comparison of the item keys, used to sort the items.
+   */
+  static bool CompareItems( const Item& lhs, const Item& rhs );
+
+  // Undefined
+  DamageTracker( const DamageTracker& );
+
+  // Undefined
+  DamageTracker& operator=( const DamageTracker& );
+
+private:
+
+  ItemContainer mItems;             ///< The items of the current frame, sorted by key
+  ItemContainer mPreviousItems;     ///< The items of the previous frame, sorted by key
+  std::vector< Rect<int> > mDamage; ///< The damaged rectangles of the current frame
+  Rect<int> mViewport;              ///< The viewport of the current frame, in GL window coordinates
+  Rect<int> mPreviousViewport;      ///< The viewport of the previous frame
+  Vector4 mPreviousClearColor;      ///< The clear color of the previous frame
+  bool mPreviousClearEnabled;       ///< Whether the viewport was cleared in the previous frame
+  bool mHasPreviousFrame;           ///< Whether there is a previous frame to compare with
+};
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_SCENE_GRAPH_DAMAGE_TRACKER_H__
@@ -32,6 +32,7 @@ namespace Internal
 namespace SceneGraph
 {
 class UpdateManager;
+class PropertyResetList;
 
 /**
  * ObjectOwnerContainer is an object which owns SceneGraph Objects.
@@ -55,6 +56,7 @@ public:
    **/
   ObjectOwnerContainer( SceneGraphBuffers& sceneGraphBuffers, DiscardQueue& discardQueue )
   : mSceneController( NULL ),
+    mResetList( NULL ),
     mSceneGraphBuffers( sceneGraphBuffers ),
     mDiscardQueue( discardQueue )
   {
@@ -70,6 +72,16 @@ public:
     mSceneController = &sceneController;
   }
 
+  /**
+   * @brief Set the list in which the objects are added when their properties have to be reset
+   *
+   * @param[in] resetList The PropertyResetList
+   **/
+  void SetResetList( PropertyResetList& resetList )
+  {
+    mResetList = &resetList;
+  }
+
   /**
    * @brief Add an object to the owner
    *
@@ -81,6 +93,11 @@ public:
 
     mObjectContainer.PushBack( pointer );
 
+    if( mResetList )
+    {
+      pointer->SetResetList( *mResetList );
+    }
+
     pointer->ConnectToSceneGraph(*mSceneController, mSceneGraphBuffers.GetUpdateBufferIndex() );
   }
 
@@ -103,20 +120,6 @@ public:
     pointer->DisconnectFromSceneGraph(*mSceneController, mSceneGraphBuffers.GetUpdateBufferIndex() );
   }
 
-  /**
-   * @brief Method to call ResetToBaseValues on all the objects owned.
-   *
-   * @param[in] bufferIndex Buffer index for double buffered values.
-   **/
-  void ResetToBaseValues( BufferIndex bufferIndex )
-  {
-    for ( Iterator iter = mObjectContainer.Begin(); iter != mObjectContainer.End(); ++iter)
-    {
-      Type* object = (*iter);
-      object->ResetToBaseValues( bufferIndex );
-    }
-  }
-
   /**
    * @brief Method to call ConstrainObjects on all the objects owned.
    *
@@ -138,6 +141,7 @@ public:
 
 private:
   SceneController* mSceneController;      ///< SceneController used to send messages
+  PropertyResetList* mResetList;          ///< The list of the objects whose properties have to be reset, not owned
   ObjectContainer mObjectContainer;       ///< Container for the objects owned
   SceneGraphBuffers& mSceneGraphBuffers;  ///< Reference to a SceneGraphBuffers to get the indexBuffer
   DiscardQueue& mDiscardQueue;            ///< Discard queue used for removed objects
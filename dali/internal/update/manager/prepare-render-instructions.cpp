@@ -18,6 +18,10 @@
 // CLASS HEADER
 #include <dali/internal/update/manager/prepare-render-instructions.h>
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstring>
+
 // INTERNAL INCLUDES
 #include <dali/public-api/shader-effects/shader-effect.h>
 #include <dali/public-api/actors/layer.h>
@@ -25,6 +29,7 @@
 #include <dali/internal/event/actors/layer-impl.h> // for the default sorting function
 #include <dali/internal/update/nodes/scene-graph-layer.h>
 #include <dali/internal/update/manager/sorted-layers.h>
+#include <dali/internal/update/manager/transform-manager.h>
 #include <dali/internal/update/render-tasks/scene-graph-render-task.h>
 #include <dali/internal/update/rendering/scene-graph-texture-set.h>
 #include <dali/internal/update/resources/resource-manager-declarations.h>
@@ -57,7 +62,7 @@ namespace SceneGraph
  * @param renderList to add the item to
  * @param renderable Node-Renderer pair
  * @param viewMatrix used to calculate modelview matrix for the item
- * @param camera The camera used to render
+ * @param visibility The visibility of the bounding spheres, see TransformManager::CullBoundingSpheres()
  * @param isLayer3d Whether we are processing a 3D layer or not
  * @param cull Whether frustum culling is enabled or not
  */
@@ -65,16 +70,14 @@ inline void AddRendererToRenderList( BufferIndex updateBufferIndex,
                                      RenderList& renderList,
                                      Renderable& renderable,
                                      const Matrix& viewMatrix,
-                                     SceneGraph::Camera& camera,
+                                     const Dali::Vector<uint32_t>& visibility,
                                      bool isLayer3d,
                                      bool cull )
 {
   bool inside( true );
   if ( cull && !renderable.mRenderer->GetShader().HintEnabled( Dali::Shader::Hint::MODIFIES_GEOMETRY ) )
   {
-    const Vector4& boundingSphere = renderable.mNode->GetBoundingSphere();
-    inside = (boundingSphere.w > Math::MACHINE_EPSILON_1000) &&
-             (camera.CheckSphereInFrustum( updateBufferIndex, Vector3(boundingSphere), boundingSphere.w ) );
+    inside = renderable.mNode->IsBoundingSphereVisible( visibility );
   }
 
   if ( inside )
@@ -110,7 +113,7 @@ inline void AddRendererToRenderList( BufferIndex updateBufferIndex,
  * @param renderers to render
  * NodeRendererContainer Node-Renderer pairs
  * @param viewMatrix used to calculate modelview matrix for the items
- * @param camera The camera used to render
+ * @param visibility The visibility of the bounding spheres, see TransformManager::CullBoundingSpheres()
  * @param isLayer3d Whether we are processing a 3D layer or not
  * @param cull Whether frustum culling is enabled or not
  */
@@ -118,7 +121,7 @@ inline void AddRenderersToRenderList( BufferIndex updateBufferIndex,
                                       RenderList& renderList,
                                       RenderableContainer& renderers,
                                       const Matrix& viewMatrix,
-                                      SceneGraph::Camera& camera,
+                                      const Dali::Vector<uint32_t>& visibility,
                                       bool isLayer3d,
                                       bool cull)
 {
@@ -127,7 +130,7 @@ inline void AddRenderersToRenderList( BufferIndex updateBufferIndex,
   unsigned int rendererCount( renderers.Size() );
   for( unsigned int i(0); i<rendererCount; ++i )
   {
-    AddRendererToRenderList( updateBufferIndex, renderList, renderers[i], viewMatrix, camera, isLayer3d, cull );
+    AddRendererToRenderList( updateBufferIndex, renderList, renderers[i], viewMatrix, visibility, isLayer3d, cull );
   }
 }
 
@@ -170,75 +173,120 @@ inline bool TryReuseCachedRenderers( Layer& layer,
   return retValue;
 }
 
+namespace
+{
+
+const unsigned int KEY_WORD_COUNT = 3u;
+const unsigned int KEY_BYTE_COUNT = KEY_WORD_COUNT * 8u;
+const unsigned int RADIX = 256u;
+
 /**
- * Function which sorts render items by depth index then by instance
- * ptrs of shader/texture/geometry.
- * @param lhs item
- * @param rhs item
- * @return true if left item is greater than right
+ * Maps a float to an unsigned integer with the same order
+ * @param[in] value The float
+ * @return The integer
  */
-bool CompareItems( const RendererWithSortAttributes& lhs, const RendererWithSortAttributes& rhs )
+inline uint32_t GetOrderedBits( float value )
+{
+  union
+  {
+    float floatValue;
+    uint32_t bits;
+  } converter;
+  converter.floatValue = value;
+
+  // Negative floats are in the reverse order of their bits
+  return ( converter.bits & 0x80000000u ) ? ~converter.bits : ( converter.bits | 0x80000000u );
+}
+
+} // unnamed namespace
+
+void SetSortKey( const RendererWithSortAttributes& attributes, bool layer3D, RenderItemSortKey& sortKey )
 {
-  if( lhs.renderItem->mDepthIndex == rhs.renderItem->mDepthIndex )
+  uint32_t header;
+  if( layer3D )
   {
-    if( lhs.shader == rhs.shader )
+    // The opaque items first, sorted by shader, texture then geometry;
+    // then the transparent ones from back to front, sorted by shader, texture then geometry when at the same z
+    if( attributes.renderItem->mIsOpaque )
     {
-      if( lhs.textureResourceId == rhs.textureResourceId )
-      {
-        return lhs.geometry < rhs.geometry;
-      }
-      return lhs.textureResourceId < rhs.textureResourceId;
+      header = 0u;
+    }
+    else
+    {
+      header = 0x80000000u | ( ~GetOrderedBits( attributes.zValue ) >> 1u );
     }
-    return lhs.shader < rhs.shader;
   }
-  return lhs.renderItem->mDepthIndex < rhs.renderItem->mDepthIndex;
+  else
+  {
+    // Sorted by depth index, then by shader, texture then geometry
+    header = static_cast< uint32_t >( attributes.renderItem->mDepthIndex ) ^ 0x80000000u;
+  }
+
+  const uint64_t shader = reinterpret_cast< uintptr_t >( attributes.shader );
+  sortKey.key[0] = ( static_cast< uint64_t >( header ) << 32u ) | ( shader >> 32u );
+  sortKey.key[1] = ( shader << 32u ) | static_cast< uint32_t >( attributes.textureResourceId );
+  sortKey.key[2] = reinterpret_cast< uintptr_t >( attributes.geometry );
+  sortKey.renderItem = attributes.renderItem;
 }
-/**
- * Function which sorts the render items by Z function, then
- * by instance ptrs of shader/texture/geometry.
- * @param lhs item
- * @param rhs item
- * @return true if left item is greater than right
- */
-bool CompareItems3D( const RendererWithSortAttributes& lhs, const RendererWithSortAttributes& rhs )
+
+void SortRenderItemKeys( RenderItemSortKeyContainer& keys, RenderItemSortKeyContainer& buffer )
 {
-  bool lhsIsOpaque = lhs.renderItem->mIsOpaque;
-  if( lhsIsOpaque ==  rhs.renderItem->mIsOpaque )
+  const size_t count = keys.size();
+  if( count < 2u )
   {
-    if( lhsIsOpaque )
+    return;
+  }
+  DALI_ASSERT_DEBUG( buffer.size() >= count );
+
+  // Count the values of every byte of the keys in a single pass; the digits are numbered from the least significant
+  unsigned int histograms[ KEY_BYTE_COUNT ][ RADIX ];
+  memset( histograms, 0, sizeof( histograms ) );
+  for( size_t index = 0; index < count; ++index )
+  {
+    const uint64_t* key = keys[ index ].key;
+    for( unsigned int word = 0; word < KEY_WORD_COUNT; ++word )
     {
-      //If both RenderItems are opaque, sort using shader, then texture then geometry
-      if( lhs.shader == rhs.shader )
+      uint64_t value = key[ KEY_WORD_COUNT - 1u - word ];
+      unsigned int* histogram = histograms[ word * 8u ];
+      for( unsigned int byte = 0; byte < 8u; ++byte, histogram += RADIX, value >>= 8u )
       {
-        if( lhs.textureResourceId == rhs.textureResourceId )
-        {
-          return lhs.geometry < rhs.geometry;
-        }
-        return lhs.textureResourceId < rhs.textureResourceId;
+        ++histogram[ value & 0xFFu ];
       }
-      return lhs.shader < rhs.shader;
     }
-    else
+  }
+
+  RenderItemSortKey* source = &keys[0];
+  RenderItemSortKey* destination = &buffer[0];
+  for( unsigned int digit = 0; digit < KEY_BYTE_COUNT; ++digit )
+  {
+    const unsigned int word = KEY_WORD_COUNT - 1u - digit / 8u;
+    const unsigned int shift = ( digit % 8u ) * 8u;
+
+    // Skip the bytes which are the same in every key, e.g. the high bytes of the pointers
+    unsigned int* histogram = histograms[ digit ];
+    if( histogram[ ( source[0].key[ word ] >> shift ) & 0xFFu ] == count )
     {
-      //If both RenderItems are transparent, sort using z,then shader, then texture, then geometry
-      if( Equals(lhs.zValue, rhs.zValue) )
-      {
-        if( lhs.shader == rhs.shader )
-        {
-          if( lhs.textureResourceId == rhs.textureResourceId )
-          {
-            return lhs.geometry < rhs.geometry;
-          }
-          return lhs.textureResourceId < rhs.textureResourceId;
-        }
-        return lhs.shader < rhs.shader;
-      }
-      return lhs.zValue > rhs.zValue;
+      continue;
+    }
+
+    unsigned int offset = 0u;
+    for( unsigned int value = 0; value < RADIX; ++value )
+    {
+      const unsigned int valueCount = histogram[ value ];
+      histogram[ value ] = offset;
+      offset += valueCount;
+    }
+
+    for( size_t index = 0; index < count; ++index )
+    {
+      destination[ histogram[ ( source[ index ].key[ word ] >> shift ) & 0xFFu ]++ ] = source[ index ];
     }
+    std::swap( source, destination );
   }
-  else
+
+  if( source != &keys[0] )
   {
-    return lhsIsOpaque;
+    keys.swap( buffer );
   }
 }
 
@@ -252,23 +300,14 @@ bool CompareItems3D( const RendererWithSortAttributes& lhs, const RendererWithSo
 inline void SortRenderItems( BufferIndex bufferIndex, RenderList& renderList, Layer& layer, RendererSortingHelper& sortingHelper )
 {
   const size_t renderableCount = renderList.Count();
-  // reserve space if needed
-  const unsigned int oldcapacity = sortingHelper.size();
-  if( oldcapacity < renderableCount )
-  {
-    sortingHelper.reserve( renderableCount );
-    // add real objects (reserve does not construct objects)
-    sortingHelper.insert( sortingHelper.begin() + oldcapacity,
-                          (renderableCount - oldcapacity),
-                          RendererWithSortAttributes() );
-  }
-  else
-  {
-    // clear extra elements from helper, does not decrease capability
-    sortingHelper.resize( renderableCount );
-  }
+  // resize does not decrease the capacity
+  sortingHelper.keys.resize( renderableCount );
+  sortingHelper.buffer.resize( renderableCount );
 
-  // calculate the sorting value, once per item by calling the layers sort function
+  const bool layer3D = ( layer.GetBehavior() == Dali::Layer::LAYER_3D );
+  RendererWithSortAttributes attributes;
+
+  // calculate the sorting key, once per item by calling the layers sort function
   // Using an if and two for-loops rather than if inside for as its better for branch prediction
   if( layer.UsesDefaultSortFunction() )
   {
@@ -276,13 +315,14 @@ inline void SortRenderItems( BufferIndex bufferIndex, RenderList& renderList, La
     {
       RenderItem& item = renderList.GetItem( index );
 
-      item.mRenderer->SetSortAttributes( bufferIndex, sortingHelper[ index ] );
+      item.mRenderer->SetSortAttributes( bufferIndex, attributes );
 
       // the default sorting function should get inlined here
-      sortingHelper[ index ].zValue = Internal::Layer::ZValue( item.mModelViewMatrix.GetTranslation3() ) - item.mDepthIndex;
+      attributes.zValue = Internal::Layer::ZValue( item.mModelViewMatrix.GetTranslation3() ) - item.mDepthIndex;
 
-      // keep the renderitem pointer in the helper so we can quickly reorder items after sort
-      sortingHelper[ index ].renderItem = &item;
+      // keep the renderitem pointer in the key so we can quickly reorder items after sort
+      attributes.renderItem = &item;
+      SetSortKey( attributes, layer3D, sortingHelper.keys[ index ] );
     }
   }
   else
@@ -292,32 +332,25 @@ inline void SortRenderItems( BufferIndex bufferIndex, RenderList& renderList, La
     {
       RenderItem& item = renderList.GetItem( index );
 
-      item.mRenderer->SetSortAttributes( bufferIndex, sortingHelper[ index ] );
-      sortingHelper[ index ].zValue = (*sortFunction)( item.mModelViewMatrix.GetTranslation3() ) - item.mDepthIndex;
+      item.mRenderer->SetSortAttributes( bufferIndex, attributes );
+      attributes.zValue = (*sortFunction)( item.mModelViewMatrix.GetTranslation3() ) - item.mDepthIndex;
 
-      // keep the renderitem pointer in the helper so we can quickly reorder items after sort
-      sortingHelper[ index ].renderItem = &item;
+      // keep the renderitem pointer in the key so we can quickly reorder items after sort
+      attributes.renderItem = &item;
+      SetSortKey( attributes, layer3D, sortingHelper.keys[ index ] );
     }
   }
 
-  if( layer.GetBehavior() ==  Dali::Layer::LAYER_3D)
-  {
-    // sort the renderers back to front, Z Axis point from near plane to far plane
-    std::stable_sort( sortingHelper.begin(), sortingHelper.end(), CompareItems3D );
-  }
-  else
-  {
-    // sort the renderers based on DepthIndex
-    std::stable_sort( sortingHelper.begin(), sortingHelper.end(), CompareItems );
-  }
+  // sort the renderers back to front for 3D layers (Z Axis point from near plane to far plane), otherwise based on DepthIndex
+  SortRenderItemKeys( sortingHelper.keys, sortingHelper.buffer );
 
   // reorder/repopulate the renderitems in renderlist to correct order based on sortinghelper
   DALI_LOG_INFO( gRenderListLogFilter, Debug::Verbose, "Sorted Transparent List:\n");
   RenderItemContainer::Iterator renderListIter = renderList.GetContainer().Begin();
   for( unsigned int index = 0; index < renderableCount; ++index, ++renderListIter )
   {
-    *renderListIter = sortingHelper[ index ].renderItem;
-    DALI_LOG_INFO( gRenderListLogFilter, Debug::Verbose, "  sortedList[%d] = %p\n", index, sortingHelper[ index ].renderItem->mRenderer);
+    *renderListIter = sortingHelper.keys[ index ].renderItem;
+    DALI_LOG_INFO( gRenderListLogFilter, Debug::Verbose, "  sortedList[%d] = %p\n", index, sortingHelper.keys[ index ].renderItem->mRenderer);
   }
 }
 
@@ -326,7 +359,7 @@ inline void SortRenderItems( BufferIndex bufferIndex, RenderList& renderList, La
  * @param updateBufferIndex to use
  * @param layer to get the renderers from
  * @param viewmatrix for the camera from rendertask
- * @param camera to use the view frustum
+ * @param visibility The visibility of the bounding spheres
  * @param stencilRenderablesExist is true if there are stencil renderers on this layer
  * @param instruction to fill in
  * @param sortingHelper to use for sorting the renderitems (to avoid reallocating)
@@ -336,7 +369,7 @@ inline void SortRenderItems( BufferIndex bufferIndex, RenderList& renderList, La
 inline void AddColorRenderers( BufferIndex updateBufferIndex,
                                Layer& layer,
                                const Matrix& viewMatrix,
-                               SceneGraph::Camera& camera,
+                               const Dali::Vector<uint32_t>& visibility,
                                bool stencilRenderablesExist,
                                RenderInstruction& instruction,
                                RendererSortingHelper& sortingHelper,
@@ -357,7 +390,7 @@ inline void AddColorRenderers( BufferIndex updateBufferIndex,
     }
   }
 
-  AddRenderersToRenderList( updateBufferIndex, renderList, layer.colorRenderables, viewMatrix, camera, layer.GetBehavior() == Dali::Layer::LAYER_3D, cull );
+  AddRenderersToRenderList( updateBufferIndex, renderList, layer.colorRenderables, viewMatrix, visibility, layer.GetBehavior() == Dali::Layer::LAYER_3D, cull );
   SortRenderItems( updateBufferIndex, renderList, layer, sortingHelper );
 
   // Setup the render flags for stencil.
@@ -374,7 +407,7 @@ inline void AddColorRenderers( BufferIndex updateBufferIndex,
  * @param updateBufferIndex to use
  * @param layer to get the renderers from
  * @param viewmatrix for the camera from rendertask
- * @param camera to use
+ * @param visibility The visibility of the bounding spheres
  * @param stencilRenderablesExist is true if there are stencil renderers on this layer
  * @param instruction to fill in
  * @param tryReuseRenderList whether to try to reuse the cached items from the instruction
@@ -383,7 +416,7 @@ inline void AddColorRenderers( BufferIndex updateBufferIndex,
 inline void AddOverlayRenderers( BufferIndex updateBufferIndex,
                                  Layer& layer,
                                  const Matrix& viewMatrix,
-                                 SceneGraph::Camera& camera,
+                                 const Dali::Vector<uint32_t>& visibility,
                                  bool stencilRenderablesExist,
                                  RenderInstruction& instruction,
                                  RendererSortingHelper& sortingHelper,
@@ -410,7 +443,7 @@ inline void AddOverlayRenderers( BufferIndex updateBufferIndex,
       return;
     }
   }
-  AddRenderersToRenderList( updateBufferIndex, overlayRenderList, layer.overlayRenderables, viewMatrix, camera, layer.GetBehavior() == Dali::Layer::LAYER_3D, cull );
+  AddRenderersToRenderList( updateBufferIndex, overlayRenderList, layer.overlayRenderables, viewMatrix, visibility, layer.GetBehavior() == Dali::Layer::LAYER_3D, cull );
   SortRenderItems( updateBufferIndex, overlayRenderList, layer, sortingHelper );
 }
 
@@ -419,7 +452,7 @@ inline void AddOverlayRenderers( BufferIndex updateBufferIndex,
  * @param updateBufferIndex to use
  * @param layer to get the renderers from
  * @param viewmatrix for the camera from rendertask
- * @param camera to use
+ * @param visibility The visibility of the bounding spheres
  * @param instruction to fill in
  * @param tryReuseRenderList whether to try to reuse the cached items from the instruction
  * @param cull Whether frustum culling is enabled or not
@@ -427,7 +460,7 @@ inline void AddOverlayRenderers( BufferIndex updateBufferIndex,
 inline void AddStencilRenderers( BufferIndex updateBufferIndex,
                                  Layer& layer,
                                  const Matrix& viewMatrix,
-                                 SceneGraph::Camera& camera,
+                                 const Dali::Vector<uint32_t>& visibility,
                                  RenderInstruction& instruction,
                                  bool tryReuseRenderList,
                                  bool cull )
@@ -449,14 +482,16 @@ inline void AddStencilRenderers( BufferIndex updateBufferIndex,
       return;
     }
   }
-  AddRenderersToRenderList( updateBufferIndex, stencilRenderList, layer.stencilRenderables, viewMatrix, camera, layer.GetBehavior() == Dali::Layer::LAYER_3D, cull );
+  AddRenderersToRenderList( updateBufferIndex, stencilRenderList, layer.stencilRenderables, viewMatrix, visibility, layer.GetBehavior() == Dali::Layer::LAYER_3D, cull );
 }
 
 void PrepareRenderInstruction( BufferIndex updateBufferIndex,
                                SortedLayerPointers& sortedLayers,
                                RenderTask& renderTask,
                                RendererSortingHelper& sortingHelper,
+                               TransformManager& transformManager,
                                bool cull,
+                               const Rect<int>* surfaceRect,
                                RenderInstructionContainer& instructions )
 {
   // Retrieve the RenderInstruction buffer from the RenderInstructionContainer
@@ -468,6 +503,14 @@ void PrepareRenderInstruction( BufferIndex updateBufferIndex,
   const Matrix& viewMatrix = renderTask.GetViewMatrix( updateBufferIndex );
   SceneGraph::Camera& camera = renderTask.GetCamera();
 
+  if( cull )
+  {
+    // Test every bounding sphere at once rather than one renderer at a time
+    Vec4 planes[ 6 ];
+    camera.GetFrustumPlanes( updateBufferIndex, planes );
+    transformManager.CullBoundingSpheres( planes, Math::MACHINE_EPSILON_1000, sortingHelper.visibility );
+  }
+
   const SortedLayersIter endIter = sortedLayers.end();
   for ( SortedLayersIter iter = sortedLayers.begin(); iter != endIter; ++iter )
   {
@@ -482,7 +525,7 @@ void PrepareRenderInstruction( BufferIndex updateBufferIndex,
     if( stencilRenderablesExist &&
         ( colorRenderablesExist || overlayRenderablesExist ) )
     {
-      AddStencilRenderers( updateBufferIndex, layer, viewMatrix, camera, instruction, tryReuseRenderList, cull );
+      AddStencilRenderers( updateBufferIndex, layer, viewMatrix, sortingHelper.visibility, instruction, tryReuseRenderList, cull );
     }
 
     if ( colorRenderablesExist )
@@ -490,7 +533,7 @@ void PrepareRenderInstruction( BufferIndex updateBufferIndex,
       AddColorRenderers( updateBufferIndex,
                          layer,
                          viewMatrix,
-                         camera,
+                         sortingHelper.visibility,
                          stencilRenderablesExist,
                          instruction,
                          sortingHelper,
@@ -500,11 +543,20 @@ void PrepareRenderInstruction( BufferIndex updateBufferIndex,
 
     if ( overlayRenderablesExist )
     {
-      AddOverlayRenderers( updateBufferIndex, layer, viewMatrix, camera, stencilRenderablesExist,
+      AddOverlayRenderers( updateBufferIndex, layer, viewMatrix, sortingHelper.visibility, stencilRenderablesExist,
                            instruction, sortingHelper, tryReuseRenderList, cull );
     }
   }
 
+  if( surfaceRect )
+  {
+    renderTask.GetDamageTracker().Update( updateBufferIndex, sortedLayers, viewMatrix, camera, *surfaceRect, instruction );
+  }
+  else
+  {
+    renderTask.GetDamageTracker().Reset();
+  }
+
   // inform the render instruction that all renderers have been added and this frame is complete
   instruction.UpdateCompleted();
 }
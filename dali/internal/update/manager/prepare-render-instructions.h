@@ -18,8 +18,13 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <stdint.h>
+
 // INTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
 #include <dali/internal/common/buffer-index.h>
+#include <dali/public-api/math/rect.h>
 #include <dali/internal/update/manager/sorted-layers.h>
 #include <dali/integration-api/resource-declarations.h>
 
@@ -38,6 +43,7 @@ namespace SceneGraph
 {
 class RenderTracker;
 struct RenderItem;
+class TransformManager;
 class Shader;
 
 /**
@@ -62,7 +68,46 @@ struct RendererWithSortAttributes
   float                         zValue;           ///< The zValue of the given renderer (either distance from camera, or a custom calculated value)
 };
 
-typedef std::vector< RendererWithSortAttributes > RendererSortingHelper;
+/**
+ * The key used to sort a render item, packed so that the items are sorted by comparing integers.
+ * The 192 bits of the key, from the most significant, are:
+ *  - For a 2D layer, the depth index (32 bits).
+ *  - For a 3D layer, 0 for opaque items or 1 for transparent ones (1 bit), then the z value
+ *    in decreasing order for the transparent items (31 bits).
+ *  - Then the shader (64 bits), the first texture resource id (32 bits) and the geometry (64 bits).
+ */
+struct RenderItemSortKey
+{
+  uint64_t    key[3];       ///< The packed key, the most significant word first
+  RenderItem* renderItem;   ///< The render item that is being sorted
+};
+
+typedef std::vector< RenderItemSortKey > RenderItemSortKeyContainer;
+
+/**
+ * The containers used to sort and cull the render items, kept to avoid reallocating them every frame.
+ */
+struct RendererSortingHelper
+{
+  RenderItemSortKeyContainer keys;    ///< The keys of the items to sort
+  RenderItemSortKeyContainer buffer;  ///< The buffer the radix sort alternates with
+  Dali::Vector< uint32_t > visibility; ///< The visibility of the bounding spheres for the current render task
+};
+
+/**
+ * Packs the attributes of a render item into a sort key.
+ * @param[in] attributes The sort attributes of the render item.
+ * @param[in] layer3D Whether the layer is a 3D layer.
+ * @param[out] sortKey The key.
+ */
+void SetSortKey( const RendererWithSortAttributes& attributes, bool layer3D, RenderItemSortKey& sortKey );
+
+/**
+ * Sorts the keys with a stable LSD radix sort; the bytes which are the same in every key are skipped.
+ * @param[in,out] keys The keys to sort.
+ * @param[in] buffer A buffer of the same size as the keys.
+ */
+void SortRenderItemKeys( RenderItemSortKeyContainer& keys, RenderItemSortKeyContainer& buffer );
 
 class RenderTask;
 class RenderInstructionContainer;
@@ -81,14 +126,18 @@ class RenderInstructionContainer;
  * @param[in] sortedLayers The layers containing lists of opaque/transparent renderables.
  * @param[in] renderTask The rendering task information.
  * @param[in] sortingHelper to avoid allocating containers for sorting every frame
+ * @param[in] transformManager The transform manager, whose bounding spheres are culled
  * @param[in] cull Whether frustum culling is enabled or not
+ * @param[in] surfaceRect The rectangle of the default surface, to track the areas damaged by an on-screen task. NULL if not tracked.
  * @param[out] instructions The rendering instructions for the next frame.
  */
 void PrepareRenderInstruction( BufferIndex updateBufferIndex,
                                SortedLayerPointers& sortedLayers,
                                RenderTask& renderTask,
                                RendererSortingHelper& sortingHelper,
+                               TransformManager& transformManager,
                                bool cull,
+                               const Rect<int>* surfaceRect,
                                RenderInstructionContainer& instructions );
 
 } // namespace SceneGraph
@@ -184,6 +184,8 @@ void ProcessRenderTasks( BufferIndex updateBufferIndex,
                          Layer& rootNode,
                          SortedLayerPointers& sortedLayers,
                          RendererSortingHelper& sortingHelper,
+                         TransformManager& transformManager,
+                         const Rect<int>* surfaceRect,
                          RenderInstructionContainer& instructions )
 {
   RenderTaskList::RenderTaskContainer& taskContainer = renderTasks.GetTasks();
@@ -257,7 +259,9 @@ void ProcessRenderTasks( BufferIndex updateBufferIndex,
                                 sortedLayers,
                                 renderTask,
                                 sortingHelper,
+                                transformManager,
                                 renderTask.GetCullMode(),
+                                NULL,
                                 instructions );
     }
     else
@@ -282,6 +286,7 @@ void ProcessRenderTasks( BufferIndex updateBufferIndex,
     if ( !renderTask.ReadyToRender( updateBufferIndex ) )
     {
       // Skip to next task
+      renderTask.GetDamageTracker().Reset();
       continue;
     }
 
@@ -291,6 +296,7 @@ void ProcessRenderTasks( BufferIndex updateBufferIndex,
     // Check that the source node is not exclusive to another task
     if ( ! CheckExclusivity( *sourceNode, renderTask ) )
     {
+      renderTask.GetDamageTracker().Reset();
       continue;
     }
 
@@ -298,6 +304,7 @@ void ProcessRenderTasks( BufferIndex updateBufferIndex,
     if( !layer )
     {
       // Skip to next task as no layer
+      renderTask.GetDamageTracker().Reset();
       continue;
     }
 
@@ -320,9 +327,16 @@ void ProcessRenderTasks( BufferIndex updateBufferIndex,
                                 sortedLayers,
                                 renderTask,
                                 sortingHelper,
+                                transformManager,
                                 renderTask.GetCullMode(),
+                                surfaceRect,
                                 instructions );
     }
+    else
+    {
+      // The next frame rendered by the task is compared with an empty one
+      renderTask.GetDamageTracker().Reset();
+    }
 
     renderTask.SetResourcesFinished( resourcesFinished );
   }
@@ -41,6 +41,8 @@ class RenderTaskList;
  * @param[in] rootNode The root node of the scene-graph.
  * @param[in] sortedLayers The layers containing lists of opaque/transparent renderables.
  * @param[in] sortingHelper Helper container for sorting transparent renderables.
+ * @param[in] transformManager The transform manager, used to cull the bounding spheres.
+ * @param[in] surfaceRect The rectangle of the default surface, to track the areas damaged by the on-screen tasks. NULL if not tracked.
  * @param[out] instructions The instructions for rendering the next frame.
  */
 void ProcessRenderTasks( BufferIndex updateBufferIndex,
@@ -48,6 +50,8 @@ void ProcessRenderTasks( BufferIndex updateBufferIndex,
                          Layer& rootNode,
                          SortedLayerPointers& sortedLayers,
                          RendererSortingHelper& sortingHelper,
+                         TransformManager& transformManager,
+                         const Rect<int>* surfaceRect,
                          RenderInstructionContainer& instructions );
 
 } // namespace SceneGraph
@@ -20,12 +20,15 @@
 
 //EXTERNAL INCLUDES
 #include <algorithm>
+#include <cmath>
 #include <cstring>
 
 //INTERNAL INCLUDES
 #include <dali/public-api/common/constants.h>
 #include <dali/public-api/common/compile-time-assert.h>
 #include <dali/internal/common/math.h>
+#include <dali/internal/common/thread-pool.h>
+#include <dali/internal/render/common/performance-monitor.h>
 
 namespace Dali
 {
@@ -46,11 +49,42 @@ static const float gDefaultTransformComponentStaticData[] = { 0.5f, 0.5f, 0.5f,
 
 DALI_COMPILE_TIME_ASSERT( sizeof(gDefaultTransformComponentAnimatableData) == sizeof(TransformComponentAnimatable) );
 DALI_COMPILE_TIME_ASSERT( sizeof(gDefaultTransformComponentStaticData) == sizeof(TransformComponentStatic) );
+
+//Minimum number of world matrices computed at once by a thread of the pool
+const unsigned int WORLD_MATRIX_CHUNK_SIZE = 128u;
 }
 
+/**
+ * Computes the world matrices of a range of components of the same depth
+ */
+class TransformManager::WorldMatrixTask : public ThreadPool::Task
+{
+public:
+
+  WorldMatrixTask( TransformManager& manager, unsigned int offset )
+  : mManager( manager ),
+    mOffset( offset )
+  {
+  }
+
+  virtual void Process( unsigned int begin, unsigned int end )
+  {
+    mManager.UpdateWorldMatrices( mOffset + begin, mOffset + end );
+  }
+
+private:
+
+  TransformManager& mManager;
+  unsigned int mOffset;
+};
+
 TransformManager::TransformManager()
 :mComponentCount(0),
- mReorder(false)
+ mThreadPool(NULL),
+ mSkippedMatrixCount(0),
+ mSubtreeSpheresToPublish(0u),
+ mReorder(false),
+ mSubtreeBoundsDirty(false)
 {}
 
 TransformManager::~TransformManager()
@@ -73,10 +107,14 @@ TransformId TransformManager::CreateTransform()
     mWorld.PushBack(Matrix::IDENTITY);
     mLocal.PushBack(Matrix::IDENTITY);
     mBoundingSpheres.PushBack( Vector4(0.0f,0.0f,0.0f,0.0f) );
+    mSubtreeBoundingSpheres.PushBack( Vector4(0.0f,0.0f,0.0f,0.0f) );
+    mUnbounded.PushBack(false);
     mTxComponentAnimatableBaseValue.PushBack(TransformComponentAnimatable());
     mSizeBase.PushBack(Vector3(0.0f,0.0f,0.0f));
-    mComponentDirty.PushBack(false);
+    mComponentDirty.PushBack(true);
     mLocalMatrixDirty.PushBack(false);
+    mWorldMatrixDirty.PushBack(false);
+    mSubtreeSphereDirty.PushBack(false);
   }
   else
   {
@@ -91,9 +129,13 @@ TransformId TransformManager::CreateTransform()
     mLocal[mComponentCount].SetIdentity();
     mWorld[mComponentCount].SetIdentity();
     mBoundingSpheres[mComponentCount] = Vector4(0.0f,0.0f,0.0f,0.0f);
+    mSubtreeBoundingSpheres[mComponentCount] = Vector4(0.0f,0.0f,0.0f,0.0f);
+    mUnbounded[mComponentCount] = false;
     mSizeBase[mComponentCount] = Vector3(0.0f,0.0f,0.0f);
-    mComponentDirty[mComponentCount] = false;
+    mComponentDirty[mComponentCount] = true;
     mLocalMatrixDirty[mComponentCount] = false;
+    mWorldMatrixDirty[mComponentCount] = false;
+    mSubtreeSphereDirty[mComponentCount] = false;
   }
 
   mComponentCount++;
@@ -116,7 +158,11 @@ void TransformManager::RemoveTransform(TransformId id)
   mSizeBase[index] = mSizeBase[mComponentCount];
   mComponentDirty[index] = mComponentDirty[mComponentCount];
   mLocalMatrixDirty[index] = mLocalMatrixDirty[mComponentCount];
+  mWorldMatrixDirty[index] = mWorldMatrixDirty[mComponentCount];
+  mSubtreeSphereDirty[index] = mSubtreeSphereDirty[mComponentCount];
   mBoundingSpheres[index] = mBoundingSpheres[mComponentCount];
+  mSubtreeBoundingSpheres[index] = mSubtreeBoundingSpheres[mComponentCount];
+  mUnbounded[index] = mUnbounded[mComponentCount];
 
   TransformId lastItemId = mComponentId[mComponentCount];
   mIds[ lastItemId ] = index;
@@ -194,28 +240,57 @@ void TransformManager::ResetToBaseValue()
 {
   if( mComponentCount )
   {
+    //Components whose animated values differ from the base values have to be recomputed in the next Update
+    for( unsigned int i(0); i<mComponentCount; ++i )
+    {
+      if( !mComponentDirty[i] &&
+          ( memcmp( &mSize[i], &mSizeBase[i], sizeof(Vector3) ) != 0 ||
+            memcmp( &mTxComponentAnimatable[i], &mTxComponentAnimatableBaseValue[i], sizeof(TransformComponentAnimatable) ) != 0 ) )
+      {
+        mComponentDirty[i] = true;
+      }
+    }
+
     memcpy( &mTxComponentAnimatable[0], &mTxComponentAnimatableBaseValue[0], sizeof(TransformComponentAnimatable)*mComponentCount );
     memcpy( &mSize[0], &mSizeBase[0], sizeof(Vector3)*mComponentCount );
     memset( &mLocalMatrixDirty[0], false, sizeof(bool)*mComponentCount );
   }
 }
 
+void TransformManager::SetThreadPool( ThreadPool* threadPool )
+{
+  mThreadPool = threadPool;
+}
+
 void TransformManager::Update()
 {
+  bool reordered( false );
   if( mReorder )
   {
     //If some transform component has change its parent or has been removed since last update
     //we need to reorder the vectors
     ReorderComponents();
     mReorder = false;
+    reordered = true;
   }
 
-  //Iterate through all components to compute its world matrix
+  if( mComposeIndices.Count() < mComponentCount )
+  {
+    mComposeComponents.Resize( mComponentCount );
+    mComposeIndices.Resize( mComponentCount );
+  }
+
+  //First pass: find out which local and world matrices have to be recomputed. Components are ordered by depth
+  //so the parent of a component has always been processed before the component itself. The local matrices
+  //which fully depend on the component are queued to be composed in a batch
   Vector3 anchorPosition;
-  Vector3 localPosition;
   Vector3 half( 0.5f,0.5f,0.5f );
+  unsigned int composeCount( 0u );
+  mSkippedMatrixCount = 0u;
   for( unsigned int i(0); i<mComponentCount; ++i )
   {
+    mWorldMatrixDirty[i] = false;
+
     if( DALI_LIKELY( mInheritanceMode[i] != DONT_INHERIT_TRANSFORM && mParent[i] != INVALID_TRANSFORM_ID ) )
     {
       const unsigned int& parentIndex = mIds[mParent[i] ];
@@ -228,12 +303,107 @@ void TransformManager::Update()
 
           anchorPosition = ( half - mTxComponentStatic[i].mAnchorPoint ) * mSize[i] * mTxComponentAnimatable[i].mScale;
           anchorPosition *= mTxComponentAnimatable[i].mOrientation;
-          localPosition = mTxComponentAnimatable[i].mPosition + anchorPosition + ( mTxComponentStatic[i].mParentOrigin - half ) *  mSize[parentIndex];
-          mLocal[i].SetTransformComponents( mTxComponentAnimatable[i].mScale,mTxComponentAnimatable[i].mOrientation, localPosition );
+
+          TransformComponentAnimatable& compose = mComposeComponents[composeCount];
+          compose.mScale = mTxComponentAnimatable[i].mScale;
+          compose.mOrientation = mTxComponentAnimatable[i].mOrientation;
+          compose.mPosition = mTxComponentAnimatable[i].mPosition + anchorPosition + ( mTxComponentStatic[i].mParentOrigin - half ) *  mSize[parentIndex];
+          mComposeIndices[composeCount++] = i;
         }
 
+        mWorldMatrixDirty[i] = mLocalMatrixDirty[i] || mWorldMatrixDirty[parentIndex];
+      }
+      else if( mComponentDirty[i] || mWorldMatrixDirty[parentIndex] )
+      {
+        //Some components are not inherited, local matrix depends on the parent's world matrix
+        mLocalMatrixDirty[i] = true;
+        mWorldMatrixDirty[i] = true;
+      }
+    }
+    else if( mComponentDirty[i] )  //Component has no parent or doesn't inherit transform
+    {
+      anchorPosition = ( half - mTxComponentStatic[i].mAnchorPoint ) * mSize[i] * mTxComponentAnimatable[i].mScale;
+      anchorPosition *= mTxComponentAnimatable[i].mOrientation;
+
+      TransformComponentAnimatable& compose = mComposeComponents[composeCount];
+      compose.mScale = mTxComponentAnimatable[i].mScale;
+      compose.mOrientation = mTxComponentAnimatable[i].mOrientation;
+      compose.mPosition = mTxComponentAnimatable[i].mPosition + anchorPosition;
+      mComposeIndices[composeCount++] = i;
+
+      mLocalMatrixDirty[i] = true;
+      mWorldMatrixDirty[i] = true;
+    }
+
+    mComponentDirty[i] = false;
+    if( !mWorldMatrixDirty[i] )
+    {
+      //Neither the component nor its parent changed, world matrix and bounding sphere are still valid
+      ++mSkippedMatrixCount;
+    }
+  }
+
+  //Second pass: compose the queued local matrices
+  if( composeCount )
+  {
+    ComposeTransforms( reinterpret_cast<Mat4*>( mLocal.Begin() ),
+                       mComposeIndices.Begin(),
+                       reinterpret_cast<const float*>( mComposeComponents.Begin() ),
+                       composeCount );
+  }
+
+  //Third pass: compute the world matrices and bounding spheres. The world matrices of the components of
+  //a same depth only depend on the world matrices of the previous depth, so each depth can be split across
+  //the threads of the pool
+  if( mThreadPool && !mLevelOffsets.Empty() )
+  {
+    const unsigned int levelCount = mLevelOffsets.Count();
+    for( unsigned int level(0); level<levelCount; ++level )
+    {
+      //Components created since the last reorder have no parent, they are computed with the last level
+      const unsigned int begin = mLevelOffsets[level];
+      const unsigned int end = ( level + 1u < levelCount ) ? mLevelOffsets[level + 1u] : mComponentCount;
+      if( begin < end )
+      {
+        WorldMatrixTask task( *this, begin );
+        mThreadPool->Process( task, end - begin, WORLD_MATRIX_CHUNK_SIZE );
+      }
+    }
+  }
+  else
+  {
+    UpdateWorldMatrices( 0u, mComponentCount );
+  }
+
+  //Fourth pass: refit the sub-tree bounding spheres of the components which moved and of their ancestors
+  if( reordered || mSubtreeBoundsDirty || mSkippedMatrixCount < mComponentCount )
+  {
+    UpdateSubtreeBoundingSpheres( reordered );
+    mSubtreeBoundsDirty = false;
+    mSubtreeSpheresToPublish = 2u;
+  }
+
+  INCREASE_BY( PerformanceMonitor::MATRICES_SKIPPED, mSkippedMatrixCount );
+}
+
+void TransformManager::UpdateWorldMatrices( unsigned int begin, unsigned int end )
+{
+  Vector3 anchorPosition;
+  Vector3 half( 0.5f,0.5f,0.5f );
+  for( unsigned int i(begin); i<end; ++i )
+  {
+    if( !mWorldMatrixDirty[i] )
+    {
+      continue;
+    }
+
+    if( DALI_LIKELY( mInheritanceMode[i] != DONT_INHERIT_TRANSFORM && mParent[i] != INVALID_TRANSFORM_ID ) )
+    {
+      const unsigned int& parentIndex = mIds[mParent[i] ];
+      if( DALI_LIKELY( mInheritanceMode[i] == INHERIT_ALL ) )
+      {
         //Update the world matrix
-        Matrix::Multiply( mWorld[i], mLocal[i], mWorld[parentIndex]);
+        MultiplyMatrices( mWorld[i].AsFloat(), mLocal[i].AsFloat(), mWorld[parentIndex].AsFloat() );
       }
       else
       {
@@ -269,22 +439,15 @@ void TransformManager::Update()
         {
           anchorPosition = ( half - mTxComponentStatic[i].mAnchorPoint ) * mSize[i] * mTxComponentAnimatable[i].mScale;
           anchorPosition *= mTxComponentAnimatable[i].mOrientation;
-          localPosition = mTxComponentAnimatable[i].mPosition + anchorPosition + ( mTxComponentStatic[i].mParentOrigin - half ) *  mSize[parentIndex];
+          Vector3 localPosition = mTxComponentAnimatable[i].mPosition + anchorPosition + ( mTxComponentStatic[i].mParentOrigin - half ) *  mSize[parentIndex];
           mLocal[i].SetTransformComponents( localScale, localOrientation, localPosition );
           Matrix::Multiply( mWorld[i], mLocal[i], parentMatrix );
         }
-
-        mLocalMatrixDirty[i] = true;
       }
     }
     else  //Component has no parent or doesn't inherit transform
     {
-      anchorPosition = ( half - mTxComponentStatic[i].mAnchorPoint ) * mSize[i] * mTxComponentAnimatable[i].mScale;
-      anchorPosition *= mTxComponentAnimatable[i].mOrientation;
-      localPosition = mTxComponentAnimatable[i].mPosition + anchorPosition;
-      mLocal[i].SetTransformComponents( mTxComponentAnimatable[i].mScale, mTxComponentAnimatable[i].mOrientation, localPosition );
       mWorld[i] = mLocal[i];
-      mLocalMatrixDirty[i] = true;
     }
 
     //Update the bounding sphere
@@ -294,8 +457,102 @@ void TransformManager::Update()
 
     mBoundingSpheres[i] = mWorld[i].GetTranslation();
     mBoundingSpheres[i].w = Length( centerToEdgeWorldSpace );
+  }
+}
 
-    mComponentDirty[i] = false;
+void TransformManager::UpdateSubtreeBoundingSpheres( bool all )
+{
+  //Components are ordered by depth, so iterating backwards the dirty flag of a component reaches its
+  //parent before the parent is visited. The spheres of the dirty components are reset to the sphere
+  //containing their own XY rectangle
+  for( unsigned int i(mComponentCount); i-- > 0u; )
+  {
+    if( !all && !mWorldMatrixDirty[i] && !mSubtreeSphereDirty[i] )
+    {
+      continue;
+    }
+
+    mSubtreeSphereDirty[i] = true;
+    if( mParent[i] != INVALID_TRANSFORM_ID )
+    {
+      mSubtreeSphereDirty[ mIds[mParent[i]] ] = true;
+    }
+
+    const float* world = mWorld[i].AsFloat();
+    const float halfWidth = mSize[i].width * 0.5f;
+    const float halfHeight = mSize[i].height * 0.5f;
+    const float xAxisLength = sqrtf( world[0] * world[0] + world[1] * world[1] + world[2] * world[2] );
+    const float yAxisLength = sqrtf( world[4] * world[4] + world[5] * world[5] + world[6] * world[6] );
+
+    mSubtreeBoundingSpheres[i] = Vector4( world[12], world[13], world[14], mUnbounded[i] ? -1.0f : halfWidth * xAxisLength + halfHeight * yAxisLength );
+  }
+
+  //Iterating backwards again every descendant of a component has been merged into its sphere before
+  //the component is merged into its parent's sphere. The spheres of the clean components are kept
+  for( unsigned int i(mComponentCount); i-- > 0u; )
+  {
+    //All the children of the component have been visited
+    mSubtreeSphereDirty[i] = false;
+
+    if( mParent[i] == INVALID_TRANSFORM_ID )
+    {
+      continue;
+    }
+
+    const unsigned int parentIndex( mIds[mParent[i]] );
+    if( !mSubtreeSphereDirty[parentIndex] )
+    {
+      continue;
+    }
+
+    Vector4& parentSphere = mSubtreeBoundingSpheres[ parentIndex ];
+    const Vector4& sphere = mSubtreeBoundingSpheres[i];
+    if( parentSphere.w < 0.0f )
+    {
+      //Already unbounded
+      continue;
+    }
+
+    if( sphere.w < 0.0f )
+    {
+      parentSphere.w = -1.0f;
+      continue;
+    }
+
+    if( sphere.w <= 0.0f )
+    {
+      //Nothing with a size in the sub-tree
+      continue;
+    }
+
+    if( parentSphere.w <= 0.0f )
+    {
+      parentSphere = sphere;
+      continue;
+    }
+
+    Vector3 centerToCenter( sphere.x - parentSphere.x, sphere.y - parentSphere.y, sphere.z - parentSphere.z );
+    const float distance = centerToCenter.Length();
+    if( distance + sphere.w <= parentSphere.w )
+    {
+      //Child sphere already inside the parent sphere
+      continue;
+    }
+
+    if( distance + parentSphere.w <= sphere.w )
+    {
+      //Parent sphere inside the child sphere
+      parentSphere = sphere;
+      continue;
+    }
+
+    //Smallest sphere containing both spheres
+    const float radius = ( distance + parentSphere.w + sphere.w ) * 0.5f;
+    centerToCenter *= ( radius - parentSphere.w ) / distance;
+    parentSphere.x += centerToCenter.x;
+    parentSphere.y += centerToCenter.y;
+    parentSphere.z += centerToCenter.z;
+    parentSphere.w = radius;
   }
 }
 
@@ -310,8 +567,14 @@ void TransformManager::SwapComponents( unsigned int i, unsigned int j )
   std::swap( mTxComponentAnimatableBaseValue[i], mTxComponentAnimatableBaseValue[j] );
   std::swap( mSizeBase[i], mSizeBase[j] );
   std::swap( mLocal[i], mLocal[j] );
+  std::swap( mWorld[i], mWorld[j] );
   std::swap( mComponentDirty[i], mComponentDirty[j] );
+  std::swap( mLocalMatrixDirty[i], mLocalMatrixDirty[j] );
+  std::swap( mWorldMatrixDirty[i], mWorldMatrixDirty[j] );
+  std::swap( mSubtreeSphereDirty[i], mSubtreeSphereDirty[j] );
   std::swap( mBoundingSpheres[i], mBoundingSpheres[j] );
+  std::swap( mSubtreeBoundingSpheres[i], mSubtreeBoundingSpheres[j] );
+  std::swap( mUnbounded[i], mUnbounded[j] );
 
   mIds[ mComponentId[i] ] = i;
   mIds[ mComponentId[j] ] = j;
@@ -336,6 +599,16 @@ void TransformManager::ReorderComponents()
   }
 
   std::sort( mOrderedComponents.Begin(), mOrderedComponents.End());
+
+  mLevelOffsets.Clear();
+  for( size_t i(0); i<mComponentCount; ++i )
+  {
+    if( i == 0u || mOrderedComponents[i].level != mOrderedComponents[i-1].level )
+    {
+      mLevelOffsets.PushBack( i );
+    }
+  }
+
   for( size_t i(0); i<mComponentCount-1; ++i )
   {
     SwapComponents( mIds[mOrderedComponents[i].id], i);
@@ -837,6 +1110,64 @@ const Vector4& TransformManager::GetBoundingSphere( TransformId id ) const
   return mBoundingSpheres[ mIds[id] ];
 }
 
+const Vector4& TransformManager::GetSubtreeBoundingSphere( TransformId id ) const
+{
+  return mSubtreeBoundingSpheres[ mIds[id] ];
+}
+
+Vector4 TransformManager::GetSubtreeBoundingSphere( TransformId id, BufferIndex bufferIndex ) const
+{
+  const Vector<Vector4>& spheres = mPublishedSubtreeBoundingSpheres[bufferIndex];
+  if( id < spheres.Count() )
+  {
+    return spheres[id];
+  }
+
+  return Vector4( 0.0f, 0.0f, 0.0f, -1.0f );
+}
+
+void TransformManager::PublishSubtreeBoundingSpheres( BufferIndex bufferIndex )
+{
+  if( mSubtreeSpheresToPublish == 0u )
+  {
+    //This buffer already has the last refit
+    return;
+  }
+  --mSubtreeSpheresToPublish;
+
+  Vector<Vector4>& spheres = mPublishedSubtreeBoundingSpheres[bufferIndex];
+  for( unsigned int i(0); i<mComponentCount; ++i )
+  {
+    const TransformId id( mComponentId[i] );
+    if( id >= spheres.Count() )
+    {
+      //Ids which aren't used yet are unbounded
+      spheres.Resize( id + 1u, Vector4( 0.0f, 0.0f, 0.0f, -1.0f ) );
+    }
+    spheres[id] = mSubtreeBoundingSpheres[i];
+  }
+}
+
+void TransformManager::CullBoundingSpheres( const Vec4* planes, float minRadius, Vector<uint32_t>& visibility ) const
+{
+  visibility.Resize( ( mComponentCount + 31u ) / 32u );
+  if( mComponentCount > 0u )
+  {
+    CullSpheres( visibility.Begin(), reinterpret_cast<const Vec4*>( mBoundingSpheres.Begin() ), mComponentCount, planes, minRadius );
+  }
+}
+
+void TransformManager::SetUnbounded( TransformId id, bool unbounded )
+{
+  unsigned int index( mIds[id] );
+  if( mUnbounded[index] != unbounded )
+  {
+    mUnbounded[index] = unbounded;
+    mSubtreeSphereDirty[index] = true;
+    mSubtreeBoundsDirty = true;
+  }
+}
+
 void TransformManager::GetWorldMatrixAndSize( TransformId id, Matrix& worldMatrix, Vector3& size ) const
 {
   unsigned int index = mIds[id];
@@ -24,6 +24,8 @@
 #include <dali/public-api/math/matrix.h>
 #include <dali/public-api/math/quaternion.h>
 #include <dali/public-api/math/vector3.h>
+#include <dali/internal/common/buffer-index.h>
+#include <dali/internal/common/math.h>
 #include <dali/internal/update/manager/free-list.h>
 
 namespace Dali
@@ -32,6 +34,8 @@ namespace Dali
 namespace Internal
 {
 
+class ThreadPool;
+
 namespace SceneGraph
 {
 
@@ -187,10 +191,26 @@ public:
   void SetInheritOrientation( TransformId id, bool inherit );
 
   /**
-   * Recomputes all world transform matrices
+   * Recomputes the world transform matrices of the components which changed, or whose
+   * parent's world matrix changed, since the last Update. Clean sub-trees are skipped
    */
   void Update();
 
+  /**
+   * Gets the number of world matrices which didn't need to be recomputed in the last Update
+   * @return The number of components skipped in the last Update
+   */
+  unsigned int GetSkippedMatrixCount() const
+  {
+    return mSkippedMatrixCount;
+  }
+
+  /**
+   * Sets the thread pool used to compute the world matrices of the components of a same depth in parallel
+   * @param[in] threadPool The thread pool, or NULL to compute every world matrix on the update thread
+   */
+  void SetThreadPool( ThreadPool* threadPool );
+
   /**
    * Resets all the animatable properties to its base value
    */
@@ -331,6 +351,59 @@ public:
    */
   const Vector4& GetBoundingSphere( TransformId id ) const;
 
+  /**
+   * Get the bounding sphere, in world coordinates, of a component and all its descendants.
+   * Unlike GetBoundingSphere(), the sphere contains the whole XY rectangle of every component, whatever its scale,
+   * so a ray missing it can't hit any component of the sub-tree. Unbounded sub-trees have a negative radius
+   * @param[in] id Id of the transform component
+   * @return The world space bounding sphere of the sub-tree. xyz is the center and w is the radius
+   */
+  const Vector4& GetSubtreeBoundingSphere( TransformId id ) const;
+
+  /**
+   * Get the sub-tree bounding sphere of a component as published for the event thread with PublishSubtreeBoundingSpheres().
+   * The spheres of the update thread are reordered and rewritten every frame, so they can't be read from the event thread
+   * @param[in] id Id of the transform component
+   * @param[in] bufferIndex The buffer to read from
+   * @return The world space bounding sphere of the sub-tree, with a negative radius if it hasn't been published yet
+   */
+  Vector4 GetSubtreeBoundingSphere( TransformId id, BufferIndex bufferIndex ) const;
+
+  /**
+   * Copies the sub-tree bounding spheres into a buffer indexed by component id, so the event thread can read them while
+   * the next frame is updated. The copy is only made while the buffer is behind the last refit of the spheres
+   * @param[in] bufferIndex The buffer to write to
+   */
+  void PublishSubtreeBoundingSpheres( BufferIndex bufferIndex );
+
+  /**
+   * Tests the bounding spheres of all the components against the planes of a frustum, four at a time
+   * @param[in] planes The six planes of the frustum; xyz is the normal and w is the distance
+   * @param[in] minRadius The radius under which a component is considered not visible
+   * @param[out] visibility One bit per component, read with IsBoundingSphereVisible()
+   */
+  void CullBoundingSpheres( const Vec4* planes, float minRadius, Vector<uint32_t>& visibility ) const;
+
+  /**
+   * Checks whether the bounding sphere of a component was found visible by CullBoundingSpheres()
+   * @param[in] visibility The result of CullBoundingSpheres(), computed after the last update of the bounding spheres
+   * @param[in] id Id of the transform component
+   * @return True if the bounding sphere of the component is in the frustum
+   */
+  bool IsBoundingSphereVisible( const Vector<uint32_t>& visibility, TransformId id ) const
+  {
+    const unsigned int index( mIds[id] );
+    return ( visibility[ index / 32u ] & ( 1u << ( index % 32u ) ) ) != 0u;
+  }
+
+  /**
+   * Sets whether the sub-tree of a component must be treated as unbounded, e.g. because it has to be
+   * traversed even if a ray doesn't hit any of its components
+   * @param[in] id Id of the transform component
+   * @param[in] unbounded True if the sub-tree of the component is unbounded
+   */
+  void SetUnbounded( TransformId id, bool unbounded );
+
   /**
    * Get the world matrix and size of a given component
    * @param[in] id Id of the transform component
@@ -350,6 +423,8 @@ private:
     unsigned int level;
   };
 
+  class WorldMatrixTask;
+
   /**
    * Swaps two components in the vectors
    * @param[in] i Index of a component
@@ -363,6 +438,20 @@ private:
    */
   void ReorderComponents();
 
+  /**
+   * Computes the world matrices and bounding spheres of the components in the range [begin, end)
+   * @param[in] begin Index of the first component
+   * @param[in] end Index one past the last component
+   */
+  void UpdateWorldMatrices( unsigned int begin, unsigned int end );
+
+  /**
+   * Refits the bounding spheres of the sub-trees which changed, merging the components from the deepest level up.
+   * Only the components whose world matrix changed or which were marked dirty, and their ancestors, are refitted
+   * @param[in] all True if the spheres of all the components have to be refitted, e.g. after a reorder
+   */
+  void UpdateSubtreeBoundingSpheres( bool all );
+
   unsigned int mComponentCount;                                ///< Total number of components
   FreeList mIds;                                               ///< FreeList of Ids
   Vector<TransformComponentAnimatable> mTxComponentAnimatable; ///< Animatable part of the components
@@ -374,12 +463,24 @@ private:
   Vector<Matrix> mWorld;                                       ///< Local to world transform of the components
   Vector<Matrix> mLocal;                                       ///< Local to parent space transform of the components
   Vector<Vector4> mBoundingSpheres;                            ///< Bounding spheres. xyz is the center and w is the radius
+  Vector<Vector4> mSubtreeBoundingSpheres;                     ///< Bounding spheres of the sub-trees. A negative radius means unbounded
+  Vector<bool> mUnbounded;                                     ///< True if the sub-tree of the component is unbounded
+  Vector<Vector4> mPublishedSubtreeBoundingSpheres[2];         ///< Bounding spheres of the sub-trees indexed by component id, double buffered for the event thread
   Vector<TransformComponentAnimatable> mTxComponentAnimatableBaseValue;  ///< Base values for the animatable part of the components
   Vector<Vector3> mSizeBase;                                             ///< Base value for the size of the components
   Vector<bool> mComponentDirty;    ///< 1u if some of the parts of the component has changed in this frame, 0 otherwise
   Vector<bool> mLocalMatrixDirty;  ///< 1u if the local matrix has been updated in this frame, 0 otherwise
+  Vector<bool> mWorldMatrixDirty;  ///< 1u if the world matrix has been updated in this frame, 0 otherwise
+  Vector<bool> mSubtreeSphereDirty;  ///< 1u if the sub-tree bounding sphere has to be refitted in the next Update, 0 otherwise
   Vector<SOrderItem> mOrderedComponents;   ///< Used to reorder components when hierarchy changes
+  Vector<unsigned int> mLevelOffsets;      ///< Index of the first component of each depth level, after the last reorder
+  Vector<TransformComponentAnimatable> mComposeComponents;  ///< Scale, orientation and local position of the local matrices to compose in the next batch
+  Vector<unsigned int> mComposeIndices;                     ///< Indices of the local matrices to compose in the next batch
+  ThreadPool* mThreadPool;                 ///< Thread pool used to compute the world matrices, not owned. May be NULL
+  unsigned int mSkippedMatrixCount;        ///< Number of world matrices not recomputed in the last Update
+  unsigned int mSubtreeSpheresToPublish;   ///< Number of buffers which haven't received the last refit of the sub-tree bounding spheres
   bool mReorder;                           ///< Flag to determine if the components have to reordered in the next Update
+  bool mSubtreeBoundsDirty;                ///< Flag to determine if some sub-tree bounding sphere has to be refitted even if no world matrix changed
 };
 
 } //namespace SceneGraph
@@ -60,6 +60,11 @@ Debug::Filter* gUpdateFilter = Debug::Filter::New(Debug::Concise, false, "LOG_UP
 void ConstrainPropertyOwner( PropertyOwner& propertyOwner, BufferIndex updateBufferIndex )
 {
   ConstraintOwnerContainer& constraints = propertyOwner.GetConstraints();
+  if( !constraints.Empty() )
+  {
+    // The constrained properties have to be reset in the next updates
+    propertyOwner.RequestReset();
+  }
 
   const ConstraintIter endIter = constraints.End();
   for( ConstraintIter iter = constraints.Begin(); iter != endIter; ++iter )
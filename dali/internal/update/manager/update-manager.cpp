@@ -27,6 +27,7 @@
 #include <dali/integration-api/core.h>
 #include <dali/integration-api/render-controller.h>
 #include <dali/internal/common/shader-data.h>
+#include <dali/internal/common/thread-pool.h>
 #include <dali/integration-api/debug.h>
 
 #include <dali/internal/common/core-impl.h>
@@ -40,6 +41,7 @@
 #include <dali/internal/update/animation/scene-graph-animator.h>
 #include <dali/internal/update/animation/scene-graph-animation.h>
 #include <dali/internal/update/common/discard-queue.h>
+#include <dali/internal/update/common/property-reset-list.h>
 #include <dali/internal/update/common/scene-graph-buffers.h>
 #include <dali/internal/update/common/texture-cache-dispatcher.h>
 #include <dali/internal/update/controllers/render-message-dispatcher.h>
@@ -60,6 +62,8 @@
 #include <dali/internal/update/resources/resource-manager.h>
 
 #include <dali/internal/render/common/render-instruction-container.h>
+#include <dali/internal/render/common/render-instruction.h>
+#include <dali/internal/render/common/performance-monitor.h>
 #include <dali/internal/render/common/render-manager.h>
 #include <dali/internal/render/queue/render-queue.h>
 #include <dali/internal/render/gl-resources/texture-cache.h>
@@ -118,6 +122,41 @@ typedef OwnerContainer< TextureSet* >          TextureSetContainer;
 typedef TextureSetContainer::Iterator          TextureSetIter;
 typedef TextureSetContainer::ConstIterator     TextureSetConstIter;
 
+namespace
+{
+
+// Minimum number of renderers prepared at once by a thread of the pool
+const unsigned int RENDERER_CHUNK_SIZE = 64u;
+
+/**
+ * Collects the uniform maps of a range of renderers
+ */
+class PrepareUniformMapTask : public ThreadPool::Task
+{
+public:
+
+  PrepareUniformMapTask( const OwnerContainer<Renderer*>& renderers, BufferIndex bufferIndex )
+  : mRenderers( renderers ),
+    mBufferIndex( bufferIndex )
+  {
+  }
+
+  virtual void Process( unsigned int begin, unsigned int end )
+  {
+    for( unsigned int i(begin); i<end; ++i )
+    {
+      mRenderers[i]->PrepareUniformMap( mBufferIndex );
+    }
+  }
+
+private:
+
+  const OwnerContainer<Renderer*>& mRenderers;
+  BufferIndex mBufferIndex;
+};
+
+} // unnamed namespace
+
 /**
  * Structure to contain UpdateManager internal data
  */
@@ -131,10 +170,12 @@ struct UpdateManager::Impl
         RenderController& renderController,
         RenderManager& renderManager,
         RenderQueue& renderQueue,
-        SceneGraphBuffers& sceneGraphBuffers )
+        SceneGraphBuffers& sceneGraphBuffers,
+        unsigned int workerThreadCount )
   : renderMessageDispatcher( renderManager, renderQueue, sceneGraphBuffers ),
     notificationManager( notificationManager ),
     transformManager(),
+    propertyResetList(),
     animationFinishedNotifier( animationFinishedNotifier ),
     propertyNotifier( propertyNotifier ),
     shaderSaver( NULL ),
@@ -159,11 +200,21 @@ struct UpdateManager::Impl
     previousUpdateScene( false ),
     frameCounter( 0 ),
     renderSortingHelper(),
-    renderTaskWaiting( false )
+    renderTaskWaiting( false ),
+    threadPool( NULL ),
+    surfaceRect(),
+    partialUpdateEnabled( false )
   {
     sceneController = new SceneControllerImpl( renderMessageDispatcher, renderQueue, discardQueue );
 
+    if( workerThreadCount > 0u )
+    {
+      threadPool = new ThreadPool( workerThreadCount );
+      transformManager.SetThreadPool( threadPool );
+    }
+
     renderers.SetSceneController( *sceneController );
+    renderers.SetResetList( propertyResetList );
 
     // create first 'dummy' node
     nodes.PushBack(0u);
@@ -211,12 +262,14 @@ struct UpdateManager::Impl
     }
 
     delete sceneController;
+    delete threadPool;
   }
 
   SceneGraphBuffers                   sceneGraphBuffers;             ///< Used to keep track of which buffers are being written or read
   RenderMessageDispatcher             renderMessageDispatcher;       ///< Used for passing messages to the render-thread
   NotificationManager&                notificationManager;           ///< Queues notification messages for the event-thread.
   TransformManager                    transformManager;              ///< Used to update the transformation matrices of the nodes
+  PropertyResetList                   propertyResetList;             ///< The property owners whose properties have to be reset in the next update
   CompleteNotificationInterface&      animationFinishedNotifier;     ///< Provides notification to applications when animations are finished.
   PropertyNotifier&                   propertyNotifier;              ///< Provides notification to applications when properties are modified.
   ShaderSaver*                        shaderSaver;                   ///< Saves shader binaries.
@@ -268,6 +321,11 @@ struct UpdateManager::Impl
 
   GestureContainer                    gestures;                      ///< A container of owned gesture detectors
   bool                                renderTaskWaiting;             ///< A REFRESH_ONCE render task is waiting to be rendered
+
+  ThreadPool*                         threadPool;                    ///< Worker threads helping the update thread, owned. NULL when updating on the update thread only
+
+  Rect<int>                           surfaceRect;                   ///< The rectangle of the default surface
+  bool                                partialUpdateEnabled;          ///< Whether the areas damaged by the on-screen render tasks are tracked
 };
 
 UpdateManager::UpdateManager( NotificationManager& notificationManager,
@@ -278,7 +336,8 @@ UpdateManager::UpdateManager( NotificationManager& notificationManager,
                               RenderController& controller,
                               RenderManager& renderManager,
                               RenderQueue& renderQueue,
-                              TextureCacheDispatcher& textureCacheDispatcher )
+                              TextureCacheDispatcher& textureCacheDispatcher,
+                              unsigned int workerThreadCount )
   : mImpl(NULL)
 {
   mImpl = new Impl( notificationManager,
@@ -289,7 +348,8 @@ UpdateManager::UpdateManager( NotificationManager& notificationManager,
                     controller,
                     renderManager,
                     renderQueue,
-                    mSceneGraphBuffers );
+                    mSceneGraphBuffers,
+                    workerThreadCount );
 
   textureCacheDispatcher.SetBufferIndices( &mSceneGraphBuffers );
 }
@@ -309,12 +369,14 @@ void UpdateManager::InstallRoot( SceneGraph::Layer* layer, bool systemLevel )
     DALI_ASSERT_DEBUG( mImpl->root == NULL && "Root Node already installed" );
     mImpl->root = layer;
     mImpl->root->CreateTransform( &mImpl->transformManager);
+    mImpl->root->SetResetList( mImpl->propertyResetList );
   }
   else
   {
     DALI_ASSERT_DEBUG( mImpl->systemLevelRoot == NULL && "System-level Root Node already installed" );
     mImpl->systemLevelRoot = layer;
     mImpl->systemLevelRoot->CreateTransform( &mImpl->transformManager);
+    mImpl->systemLevelRoot->SetResetList( mImpl->propertyResetList );
   }
 
   layer->SetRoot(true);
@@ -333,6 +395,7 @@ void UpdateManager::AddNode( Node* node )
     {
       mImpl->nodes.Insert((iter+1), node);
       node->CreateTransform( &mImpl->transformManager);
+      node->SetResetList( mImpl->propertyResetList );
       break;
     }
   }
@@ -409,6 +472,7 @@ void UpdateManager::AddObject( PropertyOwner* object )
   DALI_ASSERT_DEBUG( NULL != object );
 
   mImpl->customObjects.PushBack( object );
+  object->SetResetList( mImpl->propertyResetList );
 }
 
 void UpdateManager::RemoveObject( PropertyOwner* object )
@@ -527,6 +591,7 @@ void UpdateManager::AddShader( Shader* shader )
   }
 
   mImpl->shaders.PushBack( shader );
+  shader->SetResetList( mImpl->propertyResetList );
 }
 
 void UpdateManager::RemoveShader( Shader* shader )
@@ -645,6 +710,26 @@ unsigned int* UpdateManager::ReserveMessageSlot( std::size_t size, bool updateSc
   return mImpl->messageQueue.ReserveMessageSlot( size, updateScene );
 }
 
+unsigned int* UpdateManager::ReserveMessageSlot( std::size_t size, const MessageKey& key )
+{
+  return mImpl->messageQueue.ReserveMessageSlot( size, key );
+}
+
+void UpdateManager::SetMessageCoalescingEnabled( bool enabled )
+{
+  mImpl->messageQueue.SetCoalescingEnabled( enabled );
+}
+
+unsigned int UpdateManager::GetElidedMessageCount() const
+{
+  return mImpl->messageQueue.GetElidedMessageCount();
+}
+
+std::size_t UpdateManager::GetElidedMessageBytes() const
+{
+  return mImpl->messageQueue.GetElidedMessageBytes();
+}
+
 void UpdateManager::EventProcessingStarted()
 {
   mImpl->messageQueue.EventProcessingStarted();
@@ -662,23 +747,8 @@ void UpdateManager::ResetProperties( BufferIndex bufferIndex )
 
   // Animated properties have to be reset to their original value each frame
 
-  // Reset root properties
-  if ( mImpl->root )
-  {
-    mImpl->root->ResetToBaseValues( bufferIndex );
-  }
-  if ( mImpl->systemLevelRoot )
-  {
-    mImpl->systemLevelRoot->ResetToBaseValues( bufferIndex );
-  }
-
-  // Reset all the nodes
-  Vector<Node*>::Iterator iter = mImpl->nodes.Begin()+1;
-  Vector<Node*>::Iterator endIter = mImpl->nodes.End();
-  for(;iter != endIter; ++iter)
-  {
-    (*iter)->ResetToBaseValues( bufferIndex );
-  }
+  // Reset the properties written in the previous two updates; the other objects are untouched
+  mImpl->propertyResetList.ResetToBaseValues( bufferIndex );
 
   // Reset system-level render-task list properties to base values
   const RenderTaskList::RenderTaskContainer& systemLevelTasks = mImpl->systemLevelTaskList.GetTasks();
@@ -695,20 +765,6 @@ void UpdateManager::ResetProperties( BufferIndex bufferIndex )
   {
     (*iter)->ResetToBaseValues( bufferIndex );
   }
-
-  // Reset custom object properties to base values
-  for (OwnerContainer<PropertyOwner*>::Iterator iter = mImpl->customObjects.Begin(); iter != mImpl->customObjects.End(); ++iter)
-  {
-    (*iter)->ResetToBaseValues( bufferIndex );
-  }
-
-  mImpl->renderers.ResetToBaseValues( bufferIndex );
-
-  // Reset animatable shader properties to base values
-  for (ShaderIter iter = mImpl->shaders.Begin(); iter != mImpl->shaders.End(); ++iter)
-  {
-    (*iter)->ResetToBaseValues( bufferIndex );
-  }
 }
 
 bool UpdateManager::ProcessGestures( BufferIndex bufferIndex, unsigned int lastVSyncTimeMilliseconds, unsigned int nextVSyncTimeMilliseconds )
@@ -862,12 +918,32 @@ void UpdateManager::UpdateRenderers( BufferIndex bufferIndex )
 {
   const OwnerContainer<Renderer*>& rendererContainer( mImpl->renderers.GetObjectContainer() );
   unsigned int rendererCount( rendererContainer.Size() );
+  if( !mImpl->threadPool )
+  {
+    for( unsigned int i(0); i<rendererCount; ++i )
+    {
+      //Apply constraints
+      ConstrainPropertyOwner( *rendererContainer[i], bufferIndex );
+
+      rendererContainer[i]->PrepareRender( bufferIndex );
+    }
+    return;
+  }
+
+  //Constraints may read any property of the scene so they are applied first, on the update thread
   for( unsigned int i(0); i<rendererCount; ++i )
   {
-    //Apply constraints
     ConstrainPropertyOwner( *rendererContainer[i], bufferIndex );
+  }
+
+  //Collecting the uniform maps only modifies each renderer, it is split across the threads of the pool
+  PrepareUniformMapTask task( rendererContainer, bufferIndex );
+  mImpl->threadPool->Process( task, rendererCount, RENDERER_CHUNK_SIZE );
 
-    rendererContainer[i]->PrepareRender( bufferIndex );
+  //Messages are written to the render queue in the same order as the single threaded update
+  for( unsigned int i(0); i<rendererCount; ++i )
+  {
+    rendererContainer[i]->SendPendingMessages( bufferIndex );
   }
 }
 
@@ -902,6 +978,8 @@ unsigned int UpdateManager::Update( float elapsedSeconds,
 {
   const BufferIndex bufferIndex = mSceneGraphBuffers.GetUpdateBufferIndex();
 
+  PERF_MONITOR_NEXT_FRAME();
+
   //Clear nodes/resources which were previously discarded
   mImpl->discardQueue.Clear( bufferIndex );
 
@@ -924,8 +1002,10 @@ unsigned int UpdateManager::Update( float elapsedSeconds,
   if( updateScene || mImpl->previousUpdateScene )
   {
     //Reset properties from the previous update
+    PERF_MONITOR_START( PerformanceMonitor::RESET_PROPERTIES );
     ResetProperties( bufferIndex );
     mImpl->transformManager.ResetToBaseValue();
+    PERF_MONITOR_END( PerformanceMonitor::RESET_PROPERTIES );
   }
 
   //Process the queued scene messages
@@ -943,10 +1023,14 @@ unsigned int UpdateManager::Update( float elapsedSeconds,
   if( updateScene || mImpl->previousUpdateScene )
   {
     //Animate
+    PERF_MONITOR_START( PerformanceMonitor::ANIMATE_NODES );
     Animate( bufferIndex, elapsedSeconds );
+    PERF_MONITOR_END( PerformanceMonitor::ANIMATE_NODES );
 
     //Constraint custom objects
+    PERF_MONITOR_START( PerformanceMonitor::APPLY_CONSTRAINTS );
     ConstrainCustomObjects( bufferIndex );
+    PERF_MONITOR_END( PerformanceMonitor::APPLY_CONSTRAINTS );
 
     //Prepare texture sets and apply constraints to them
     PrepareTextureSets( bufferIndex );
@@ -964,17 +1048,24 @@ unsigned int UpdateManager::Update( float elapsedSeconds,
 
     //Update node hierarchy, apply constraints and perform sorting / culling.
     //This will populate each Layer with a list of renderers which are ready.
+    PERF_MONITOR_START( PerformanceMonitor::UPDATE_NODES );
     UpdateNodes( bufferIndex );
+    PERF_MONITOR_END( PerformanceMonitor::UPDATE_NODES );
 
     //Apply constraints to RenderTasks, shaders
+    PERF_MONITOR_START( PerformanceMonitor::APPLY_CONSTRAINTS );
     ConstrainRenderTasks( bufferIndex );
     ConstrainShaders( bufferIndex );
+    PERF_MONITOR_END( PerformanceMonitor::APPLY_CONSTRAINTS );
 
     //Update renderers and apply constraints
+    PERF_MONITOR_START( PerformanceMonitor::PREPARE_RENDERABLES );
     UpdateRenderers( bufferIndex );
+    PERF_MONITOR_END( PerformanceMonitor::PREPARE_RENDERABLES );
 
     //Update the trnasformations of all the nodes
     mImpl->transformManager.Update();
+    mImpl->transformManager.PublishSubtreeBoundingSpheres( bufferIndex );
 
     //Process Property Notifications
     ProcessPropertyNotifications( bufferIndex );
@@ -984,13 +1075,18 @@ unsigned int UpdateManager::Update( float elapsedSeconds,
     mImpl->renderInstructions.ResetAndReserve( bufferIndex,
                                                mImpl->taskList.GetTasks().Count() + mImpl->systemLevelTaskList.GetTasks().Count() );
 
+    PERF_MONITOR_START( PerformanceMonitor::PROCESS_RENDER_TASKS );
     if ( NULL != mImpl->root )
     {
+      const Rect<int>* surfaceRect = mImpl->partialUpdateEnabled ? &mImpl->surfaceRect : NULL;
+
       ProcessRenderTasks(  bufferIndex,
                            mImpl->taskList,
                            *mImpl->root,
                            mImpl->sortedLayers,
                            mImpl->renderSortingHelper,
+                           mImpl->transformManager,
+                           surfaceRect,
                            mImpl->renderInstructions );
 
       // Process the system-level RenderTasks last
@@ -1001,9 +1097,21 @@ unsigned int UpdateManager::Update( float elapsedSeconds,
                              *mImpl->systemLevelRoot,
                              mImpl->systemLevelSortedLayers,
                              mImpl->renderSortingHelper,
+                             mImpl->transformManager,
+                             surfaceRect,
                              mImpl->renderInstructions );
       }
     }
+    PERF_MONITOR_END( PerformanceMonitor::PROCESS_RENDER_TASKS );
+  }
+  else if( mImpl->partialUpdateEnabled )
+  {
+    // The instructions of this buffer are reused as they are, but nothing changed since the previous frame
+    const size_t count = mImpl->renderInstructions.Count( bufferIndex );
+    for( size_t i = 0; i < count; ++i )
+    {
+      mImpl->renderInstructions.At( bufferIndex, i ).mDamagedRects.clear();
+    }
   }
 
   // check the countdown and notify (note, at the moment this is only done for normal tasks, not for systemlevel tasks)
@@ -1101,6 +1209,8 @@ void UpdateManager::SetBackgroundColor( const Vector4& color )
 
 void UpdateManager::SetDefaultSurfaceRect( const Rect<int>& rect )
 {
+  mImpl->surfaceRect = rect;
+
   typedef MessageValue1< RenderManager, Rect<int> > DerivedType;
 
   // Reserve some memory inside the render queue
@@ -1110,6 +1220,30 @@ void UpdateManager::SetDefaultSurfaceRect( const Rect<int>& rect )
   new (slot) DerivedType( &mImpl->renderManager,  &RenderManager::SetDefaultSurfaceRect, rect );
 }
 
+void UpdateManager::SetPartialUpdateEnabled( bool enabled )
+{
+  mImpl->partialUpdateEnabled = enabled;
+
+  typedef MessageValue1< RenderManager, bool > DerivedType;
+
+  // Reserve some memory inside the render queue
+  unsigned int* slot = mImpl->renderQueue.ReserveMessageSlot( mSceneGraphBuffers.GetUpdateBufferIndex(), sizeof( DerivedType ) );
+
+  // Construct message in the render queue memory; note that delete should not be called on the return value
+  new (slot) DerivedType( &mImpl->renderManager, &RenderManager::SetPartialUpdateEnabled, enabled );
+}
+
+void UpdateManager::SetTextureUploadBudget( std::size_t bytesPerFrame, unsigned int microsecondsPerFrame )
+{
+  typedef MessageValue2< RenderManager, std::size_t, unsigned int > DerivedType;
+
+  // Reserve some memory inside the render queue
+  unsigned int* slot = mImpl->renderQueue.ReserveMessageSlot( mSceneGraphBuffers.GetUpdateBufferIndex(), sizeof( DerivedType ) );
+
+  // Construct message in the render queue memory; note that delete should not be called on the return value
+  new (slot) DerivedType( &mImpl->renderManager, &RenderManager::SetTextureUploadBudget, bytesPerFrame, microsecondsPerFrame );
+}
+
 void UpdateManager::KeepRendering( float durationSeconds )
 {
   mImpl->keepRenderingSeconds = std::max( mImpl->keepRenderingSeconds, durationSeconds );
@@ -1221,6 +1355,28 @@ void UpdateManager::SetPropertyBufferData( Render::PropertyBuffer* propertyBuffe
   new (slot) DerivedType( &mImpl->renderManager, &RenderManager::SetPropertyBufferData, propertyBuffer, data, size );
 }
 
+void UpdateManager::SetPropertyBufferDataRange( Render::PropertyBuffer* propertyBuffer, Dali::Vector<char>* data, size_t offset )
+{
+  typedef MessageValue3< RenderManager, Render::PropertyBuffer*, Dali::Vector<char>*, size_t > DerivedType;
+
+  // Reserve some memory inside the render queue
+  unsigned int* slot = mImpl->renderQueue.ReserveMessageSlot( mSceneGraphBuffers.GetUpdateBufferIndex(), sizeof( DerivedType ) );
+
+  // Construct message in the render queue memory; note that delete should not be called on the return value
+  new (slot) DerivedType( &mImpl->renderManager, &RenderManager::SetPropertyBufferDataRange, propertyBuffer, data, offset );
+}
+
+void UpdateManager::SetPropertyBufferUsage( Render::PropertyBuffer* propertyBuffer, GpuBuffer::Usage usage )
+{
+  typedef MessageValue2< RenderManager, Render::PropertyBuffer*, GpuBuffer::Usage > DerivedType;
+
+  // Reserve some memory inside the render queue
+  unsigned int* slot = mImpl->renderQueue.ReserveMessageSlot( mSceneGraphBuffers.GetUpdateBufferIndex(), sizeof( DerivedType ) );
+
+  // Construct message in the render queue memory; note that delete should not be called on the return value
+  new (slot) DerivedType( &mImpl->renderManager, &RenderManager::SetPropertyBufferUsage, propertyBuffer, usage );
+}
+
 void UpdateManager::AddGeometry( Render::Geometry* geometry )
 {
   typedef MessageValue1< RenderManager, Render::Geometry* > DerivedType;
@@ -66,6 +66,8 @@ class FrameBuffer;
 // value types used by messages
 template <> struct ParameterType< PropertyNotification::NotifyMode >
 : public BasicType< PropertyNotification::NotifyMode > {};
+template <> struct ParameterType< GpuBuffer::Usage >
+: public BasicType< GpuBuffer::Usage > {};
 
 namespace SceneGraph
 {
@@ -104,6 +106,7 @@ public:
    * @param[in] renderManager This is responsible for rendering the results of each "update".
    * @param[in] renderQueue Used to queue messages for the next render.
    * @param[in] textureCacheDispatcher Used for sending messages to texture cache.
+   * @param[in] workerThreadCount The number of threads helping the update thread; 0 to update on the update thread only.
    */
   UpdateManager( NotificationManager& notificationManager,
                  CompleteNotificationInterface& animationFinishedNotifier,
@@ -113,7 +116,8 @@ public:
                  Integration::RenderController& controller,
                  RenderManager& renderManager,
                  RenderQueue& renderQueue,
-                 TextureCacheDispatcher& textureCacheDispatcher );
+                 TextureCacheDispatcher& textureCacheDispatcher,
+                 unsigned int workerThreadCount = 0u );
 
   /**
    * Destructor.
@@ -344,6 +348,33 @@ public:
    */
   unsigned int* ReserveMessageSlot( std::size_t size, bool updateScene = true );
 
+  /**
+   * Reserve space for a message which sets a property to an absolute value; this must then be initialized by the caller.
+   * @post Calling this method may invalidate any previously returned slots.
+   * @param[in] size The message size with respect to the size of type "char".
+   * @param[in] key Identifies the property and how it is set.
+   * @return A pointer to the first char allocated for the message.
+   */
+  unsigned int* ReserveMessageSlot( std::size_t size, const MessageKey& key );
+
+  /**
+   * Enable or disable the coalescing of the messages setting the same property, until the next flush.
+   * @param[in] enabled True to process only the last of these messages.
+   */
+  void SetMessageCoalescingEnabled( bool enabled );
+
+  /**
+   * Query the number of messages which were not processed, due to coalescing.
+   * @return The number of messages.
+   */
+  unsigned int GetElidedMessageCount() const;
+
+  /**
+   * Query the size of the messages which were not processed, due to coalescing.
+   * @return The size with respect to the size of type "char".
+   */
+  std::size_t GetElidedMessageBytes() const;
+
   /**
    * @return the current event-buffer index.
    */
@@ -431,6 +462,23 @@ public:
    */
   void SetPropertyBufferData(Render::PropertyBuffer* propertyBuffer, Dali::Vector<char>* data, size_t size);
 
+  /**
+   * Sets a range of the data of an existing property buffer
+   * @param[in] propertyBuffer The property buffer.
+   * @param[in] data The new data of the range
+   * @param[in] offset The offset of the range in bytes
+   * @post Sends a message to RenderManager to set the new data to the property buffer.
+   */
+  void SetPropertyBufferDataRange(Render::PropertyBuffer* propertyBuffer, Dali::Vector<char>* data, size_t offset);
+
+  /**
+   * Sets how the data of an existing property buffer is updated
+   * @param[in] propertyBuffer The property buffer.
+   * @param[in] usage The usage of the GPU buffer
+   * @post Sends a message to RenderManager to set the usage of the property buffer.
+   */
+  void SetPropertyBufferUsage(Render::PropertyBuffer* propertyBuffer, GpuBuffer::Usage usage);
+
   /**
    * Adds a geometry to the RenderManager
    * @param[in] geometry The geometry to add
@@ -548,6 +596,20 @@ public:
    */
   void SetDefaultSurfaceRect( const Rect<int>& rect );
 
+  /**
+   * Enable or disable partial updates; when enabled, the areas damaged by the on-screen render tasks
+   * are tracked and only these areas are cleared and rendered.
+   * @param[in] enabled True to enable partial updates.
+   */
+  void SetPartialUpdateEnabled( bool enabled );
+
+  /**
+   * Set the budget of the texture uploads in each frame.
+   * @param[in] bytesPerFrame The number of bytes uploaded in a frame, or 0 for no limit
+   * @param[in] microsecondsPerFrame The time spent uploading in a frame, or 0 for no limit
+   */
+  void SetTextureUploadBudget( std::size_t bytesPerFrame, unsigned int microsecondsPerFrame );
+
   /**
    * @copydoc Dali::Stage::KeepRendering()
    */
@@ -910,6 +972,28 @@ inline void SetDefaultSurfaceRectMessage( UpdateManager& manager, const Rect<int
   new (slot) LocalType( &manager, &UpdateManager::SetDefaultSurfaceRect, rect );
 }
 
+inline void SetPartialUpdateEnabledMessage( UpdateManager& manager, bool enabled )
+{
+  typedef MessageValue1< UpdateManager, bool > LocalType;
+
+  // Reserve some memory inside the message queue
+  unsigned int* slot = manager.ReserveMessageSlot( sizeof( LocalType ) );
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &manager, &UpdateManager::SetPartialUpdateEnabled, enabled );
+}
+
+inline void SetTextureUploadBudgetMessage( UpdateManager& manager, std::size_t bytesPerFrame, unsigned int microsecondsPerFrame )
+{
+  typedef MessageValue2< UpdateManager, std::size_t, unsigned int > LocalType;
+
+  // Reserve some memory inside the message queue
+  unsigned int* slot = manager.ReserveMessageSlot( sizeof( LocalType ) );
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &manager, &UpdateManager::SetTextureUploadBudget, bytesPerFrame, microsecondsPerFrame );
+}
+
 inline void KeepRenderingMessage( UpdateManager& manager, float durationSeconds )
 {
   typedef MessageValue1< UpdateManager, float > LocalType;
@@ -1094,6 +1178,28 @@ inline void SetPropertyBufferData( UpdateManager& manager, Render::PropertyBuffe
   new (slot) LocalType( &manager, &UpdateManager::SetPropertyBufferData, &propertyBuffer, data, size );
 }
 
+inline void SetPropertyBufferDataRange( UpdateManager& manager, Render::PropertyBuffer& propertyBuffer, Vector<char>* data, size_t offset )
+{
+  typedef MessageValue3< UpdateManager, Render::PropertyBuffer*, Vector<char>*, size_t  > LocalType;
+
+  // Reserve some memory inside the message queue
+  unsigned int* slot = manager.ReserveMessageSlot( sizeof( LocalType ) );
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &manager, &UpdateManager::SetPropertyBufferDataRange, &propertyBuffer, data, offset );
+}
+
+inline void SetPropertyBufferUsage( UpdateManager& manager, Render::PropertyBuffer& propertyBuffer, GpuBuffer::Usage usage )
+{
+  typedef MessageValue2< UpdateManager, Render::PropertyBuffer*, GpuBuffer::Usage  > LocalType;
+
+  // Reserve some memory inside the message queue
+  unsigned int* slot = manager.ReserveMessageSlot( sizeof( LocalType ) );
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &manager, &UpdateManager::SetPropertyBufferUsage, &propertyBuffer, usage );
+}
+
 inline void AddGeometry( UpdateManager& manager, Render::Geometry& geometry )
 {
   typedef MessageValue1< UpdateManager, Render::Geometry*  > LocalType;
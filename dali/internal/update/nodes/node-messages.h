@@ -21,6 +21,7 @@
 // INTERNAL INCLUDES
 #include <dali/internal/common/buffer-index.h>
 #include <dali/internal/common/message.h>
+#include <dali/internal/common/message-key.h>
 #include <dali/internal/update/nodes/node.h>
 #include <dali/internal/update/manager/update-manager.h>
 
@@ -86,8 +87,10 @@ public:
                     MemberFunction member,
                     typename ParameterType< P >::PassingType value )
   {
-    // Reserve some memory inside the message queue
-    unsigned int* slot = eventThreadServices.ReserveMessageSlot( sizeof( NodePropertyMessage ) );
+    // Reserve some memory inside the message queue; a previous message baking another value may be coalesced
+    unsigned int* slot = ( member == &AnimatableProperty<P>::Bake ) ?
+                         eventThreadServices.ReserveMessageSlot( sizeof( NodePropertyMessage ), MessageKey( property, member ) ) :
+                         eventThreadServices.ReserveMessageSlot( sizeof( NodePropertyMessage ) );
 
     // Construct message in the message queue memory; note that delete should not be called on the return value
     new (slot) NodePropertyMessage( eventThreadServices.GetUpdateManager(), node, property, member, value );
@@ -106,6 +109,7 @@ public:
   virtual void Process( BufferIndex updateBufferIndex )
   {
     (mProperty->*mMemberFunction)( updateBufferIndex, mParam );
+    mNode->RequestReset();
   }
 
 private:
@@ -158,7 +162,7 @@ public:
    * @param[in] eventThreadServices The object used to send messages to the scene graph
    * @param[in] node The node.
    * @param[in] property The property to bake.
-   * @param[in] member The member function of the object.
+   * @param[in] member The member function of the object; it must not depend on the current value.
    * @param[in] value The new value of the X,Y,Z or W component.
    */
   static void Send( EventThreadServices& eventThreadServices,
@@ -167,8 +171,8 @@ public:
                     MemberFunction member,
                     float value )
   {
-    // Reserve some memory inside the message queue
-    unsigned int* slot = eventThreadServices.ReserveMessageSlot( sizeof( NodePropertyComponentMessage ) );
+    // Reserve some memory inside the message queue; a previous message baking the same component may be coalesced
+    unsigned int* slot = eventThreadServices.ReserveMessageSlot( sizeof( NodePropertyComponentMessage ), MessageKey( property, member ) );
 
     // Construct message in the message queue memory; note that delete should not be called on the return value
     new (slot) NodePropertyComponentMessage( eventThreadServices.GetUpdateManager(), node, property, member, value );
@@ -187,6 +191,7 @@ public:
   virtual void Process( BufferIndex updateBufferIndex )
   {
     (mProperty->*mMemberFunction)( updateBufferIndex, mParam );
+    mNode->RequestReset();
   }
 
 private:
@@ -246,8 +251,10 @@ public:
                     MemberFunction member,
                     const P& value )
   {
-    // Reserve some memory inside the message queue
-    unsigned int* slot = eventThreadServices.ReserveMessageSlot( sizeof( NodeTransformPropertyMessage ) );
+    // Reserve some memory inside the message queue; a previous message baking another value may be coalesced
+    unsigned int* slot = ( member == &TransformManagerPropertyHandler<P>::Bake ) ?
+                         eventThreadServices.ReserveMessageSlot( sizeof( NodeTransformPropertyMessage ), MessageKey( property, member ) ) :
+                         eventThreadServices.ReserveMessageSlot( sizeof( NodeTransformPropertyMessage ) );
 
     // Construct message in the message queue memory; note that delete should not be called on the return value
     new (slot) NodeTransformPropertyMessage( eventThreadServices.GetUpdateManager(), node, property, member, value );
@@ -316,7 +323,7 @@ public:
    * @param[in] eventThreadServices The object used to send messages to the scene graph
    * @param[in] node The node.
    * @param[in] property The property to bake.
-   * @param[in] member The member function of the object.
+   * @param[in] member The member function of the object; it must not depend on the current value.
    * @param[in] value The new value of the X,Y,Z or W component.
    */
   static void Send( EventThreadServices& eventThreadServices,
@@ -325,8 +332,8 @@ public:
                     MemberFunction member,
                     float value )
   {
-    // Reserve some memory inside the message queue
-    unsigned int* slot = eventThreadServices.ReserveMessageSlot( sizeof( NodeTransformComponentMessage ) );
+    // Reserve some memory inside the message queue; a previous message baking the same component may be coalesced
+    unsigned int* slot = eventThreadServices.ReserveMessageSlot( sizeof( NodeTransformComponentMessage ), MessageKey( property, member ) );
 
     // Construct message in the message queue memory; note that delete should not be called on the return value
     new (slot) NodeTransformComponentMessage( eventThreadServices.GetUpdateManager(), node, property, member, value );
@@ -116,6 +116,11 @@ void Node::CreateTransform( SceneGraph::TransformManager* transformManager )
   mWorldScale.Initialize( transformManager, mTransformId );
   mWorldOrientation.Initialize( transformManager, mTransformId );
   mWorldMatrix.Initialize( transformManager, mTransformId );
+
+  if( mDrawMode == DrawMode::STENCIL )
+  {
+    transformManager->SetUnbounded( mTransformId, true );
+  }
 }
 
 void Node::SetRoot(bool isRoot)
@@ -162,7 +162,7 @@ public:
     //in the next update as world transform is not computed if node has no renderers
     if( rendererCount == 0 )
     {
-      mDirtyFlags |= TransformFlag;
+      SetDirtyFlag( TransformFlag );
     }
 
     mRenderer.PushBack( renderer );
@@ -274,6 +274,7 @@ public:
   void SetDirtyFlag(NodePropertyFlags flag)
   {
     mDirtyFlags |= flag;
+    RequestReset();
   }
 
   /**
@@ -282,6 +283,7 @@ public:
   void SetAllDirtyFlags()
   {
     mDirtyFlags = AllFlags;
+    RequestReset();
   }
 
   /**
@@ -588,6 +590,37 @@ public:
     return Vector4::ZERO;
   }
 
+  /**
+   * Check whether the bounding sphere of the node is in the frustum
+   * @param[in] visibility The result of TransformManager::CullBoundingSpheres()
+   * @return True if the node has a transform and its bounding sphere is visible
+   */
+  bool IsBoundingSphereVisible( const Dali::Vector<uint32_t>& visibility ) const
+  {
+    if( mTransformId != INVALID_TRANSFORM_ID )
+    {
+      return mTransformManager->IsBoundingSphereVisible( visibility, mTransformId );
+    }
+
+    return false;
+  }
+
+  /**
+   * Retrieve the bounding sphere of the node and all its descendants, as published for the event thread;
+   * see TransformManager::GetSubtreeBoundingSphere()
+   * @param[in] bufferIndex The buffer to read from
+   * @return A vector4 describing the bounding sphere. XYZ is the center and W is the radius, negative if unbounded
+   */
+  Vector4 GetSubtreeBoundingSphere( BufferIndex bufferIndex ) const
+  {
+    if( mTransformId != INVALID_TRANSFORM_ID )
+    {
+      return mTransformManager->GetSubtreeBoundingSphere( mTransformId, bufferIndex );
+    }
+
+    return Vector4( 0.0f, 0.0f, 0.0f, -1.0f );
+  }
+
   /**
    * Retrieve world matrix and size of the node
    * @param[out] The local to world matrix of the node
@@ -647,6 +680,12 @@ public:
   void SetDrawMode( const DrawMode::Type& drawMode )
   {
     mDrawMode = drawMode;
+
+    if( mTransformId != INVALID_TRANSFORM_ID )
+    {
+      // Stencils have to be hit-tested whether the ray hits them or not
+      mTransformManager->SetUnbounded( mTransformId, drawMode == DrawMode::STENCIL );
+    }
   }
 
   /**
@@ -18,16 +18,17 @@
 // CLASS HEADER
 #include <dali/internal/update/queue/update-message-queue.h>
 
+// EXTERNAL INCLUDES
+#include <new>
+#include <vector>
+
 // INTERNAL INCLUDES
-#include <dali/public-api/common/vector-wrapper.h>
-#include <dali/devel-api/threading/mutex.h>
 #include <dali/integration-api/render-controller.h>
 #include <dali/internal/common/message.h>
-#include <dali/internal/common/message-buffer.h>
+#include <dali/internal/common/message-key.h>
+#include <dali/internal/common/message-ring.h>
 #include <dali/internal/render/common/performance-monitor.h>
 
-using std::vector;
-
 using Dali::Integration::RenderController;
 using Dali::Internal::SceneGraph::SceneGraphBuffers;
 
@@ -41,75 +42,182 @@ namespace // unnamed namespace
 {
 
 // A message to set Actor::SIZE is 72 bytes on 32bit device
-// A buffer of size 32768 would store (32768 - 4) / (72 + 4) = 431 of those messages
-static const std::size_t INITIAL_BUFFER_SIZE =  32768;
-static const std::size_t MAX_BUFFER_CAPACITY = 73728; // Avoid keeping buffers which exceed this
-static const std::size_t MAX_FREE_BUFFER_COUNT = 3; // Allow this number of buffers to be recycled
+// A segment of size 32768 would store (32768 - 8) / (72 + 4) = 431 of those messages
+static const std::size_t SEGMENT_SIZE = 32768;
 
-// A queue of message buffers
-typedef vector< MessageBuffer* > MessageBufferQueue;
-typedef MessageBufferQueue::iterator MessageBufferIter;
+/**
+ * Replaces a message which is not processed, as a later message sets the same property.
+ */
+class ElidedMessage : public MessageBase
+{
+public:
 
-typedef Dali::Mutex MessageQueueMutex;
+  /**
+   * @copydoc MessageBase::Process
+   */
+  virtual void Process( BufferIndex /*bufferIndex*/ )
+  {
+  }
+};
 
-} // unnamed namespace
+const unsigned int COALESCIBLE_MESSAGE_INDEX_SIZE = 256u; ///< The initial number of entries of the index, a power of two
 
-namespace Update
+/**
+ * A message which may be coalesced
+ */
+struct CoalescibleMessage
 {
+  CoalescibleMessage()
+  : key(),
+    slot( NULL ),
+    size( 0u ),
+    generation( 0u )
+  {
+  }
+
+  MessageKey key;           ///< The key of the message
+  unsigned int* slot;       ///< The memory of the message
+  unsigned int size;        ///< The size of the message with respect to the size of type 'char'
+  unsigned int generation;  ///< The generation of the index the entry was added in; the entry is free if it differs
+};
 
 /**
- * Private MessageQueue data
+ * The last message of each key, in a hash table with open addressing.
+ * The index is cleared after every other message, so clearing only starts a new generation of entries; it only
+ * allocates memory when more keyed messages than ever are sent in a row.
  */
-struct MessageQueue::Impl
+class CoalescibleMessageIndex
 {
-  Impl( RenderController& controller, const SceneGraphBuffers& buffers )
-  : renderController(controller),
-    sceneGraphBuffers(buffers),
-    processingEvents(false),
-    queueWasEmpty(true),
-    sceneUpdateFlag( false ),
-    sceneUpdate( 0 ),
-    currentMessageBuffer(NULL)
+public:
+
+  /**
+   * Constructor
+   */
+  CoalescibleMessageIndex()
+  : mEntries( COALESCIBLE_MESSAGE_INDEX_SIZE ),
+    mCount( 0u ),
+    mGeneration( 1u )
   {
   }
 
-  ~Impl()
+  /**
+   * Remove all the entries
+   */
+  void Clear()
   {
-    // Delete the current buffer
-    delete currentMessageBuffer;
+    if( mCount > 0u )
+    {
+      mCount = 0u;
+      if( ++mGeneration == 0u )
+      {
+        // Wrapped around; the entries of the old generations must not be taken for new ones
+        for( std::vector< CoalescibleMessage >::iterator iter = mEntries.begin(); iter != mEntries.end(); ++iter )
+        {
+          iter->generation = 0u;
+        }
+        mGeneration = 1u;
+      }
+    }
+  }
 
-    // Delete the unprocessed buffers
-    const MessageBufferIter processQueueEndIter = processQueue.end();
-    for ( MessageBufferIter iter = processQueue.begin(); iter != processQueueEndIter; ++iter )
+  /**
+   * Find the entry of a key, adding it if needed.
+   * @param[in] key The key of the message
+   * @return The entry of the key; the slot is NULL if it was just added.
+   */
+  CoalescibleMessage& Find( const MessageKey& key )
+  {
+    // Kept at most three quarters full
+    if( ( mCount + 1u ) * 4u > mEntries.size() * 3u )
     {
-      MessageBuffer* unprocessedBuffer = *iter;
-      DeleteBufferContents( unprocessedBuffer );
-      delete unprocessedBuffer;
+      Grow();
     }
 
-    // Delete the recycled buffers
-    const MessageBufferIter recycleQueueEndIter = recycleQueue.end();
-    for ( MessageBufferIter iter = recycleQueue.begin(); iter != recycleQueueEndIter; ++iter )
+    CoalescibleMessage& entry = mEntries[ FindIndex( key ) ];
+    if( entry.generation != mGeneration )
     {
-      MessageBuffer* recycledBuffer = *iter;
-      DeleteBufferContents( recycledBuffer );
-      delete recycledBuffer;
+      entry.key = key;
+      entry.slot = NULL;
+      entry.size = 0u;
+      entry.generation = mGeneration;
+      ++mCount;
     }
+    return entry;
+  }
+
+private:
 
-    const MessageBufferIter freeQueueEndIter = freeQueue.end();
-    for ( MessageBufferIter iter = freeQueue.begin(); iter != freeQueueEndIter; ++iter )
+  /**
+   * Find the index of the entry of a key, or of the free entry where it would be added.
+   */
+  std::size_t FindIndex( const MessageKey& key ) const
+  {
+    const std::size_t mask = mEntries.size() - 1u;
+    std::size_t index = key.GetHash() & mask;
+    while( mEntries[index].generation == mGeneration && !( mEntries[index].key == key ) )
     {
-      MessageBuffer* freeBuffer = *iter;
-      DeleteBufferContents( freeBuffer );
-      delete freeBuffer;
+      index = ( index + 1u ) & mask;
     }
+    return index;
+  }
+
+  /**
+   * Double the number of entries, and add the entries of the current generation again.
+   */
+  void Grow()
+  {
+    std::vector< CoalescibleMessage > entries( mEntries.size() * 2u );
+    entries.swap( mEntries );
+
+    for( std::vector< CoalescibleMessage >::const_iterator iter = entries.begin(); iter != entries.end(); ++iter )
+    {
+      if( iter->generation == mGeneration )
+      {
+        mEntries[ FindIndex( iter->key ) ] = *iter;
+      }
+    }
+  }
+
+private:
+
+  std::vector< CoalescibleMessage > mEntries;  ///< The entries, a power of two of them
+  unsigned int mCount;                          ///< The number of entries of the current generation
+  unsigned int mGeneration;                     ///< The current generation, never 0
+};
+
+} // unnamed namespace
+
+namespace Update
+{
+
+/**
+ * Private MessageQueue data
+ */
+struct MessageQueue::Impl
+{
+  Impl( RenderController& controller, const SceneGraphBuffers& buffers )
+  : renderController(controller),
+    sceneGraphBuffers(buffers),
+    processingEvents(false),
+    queueWasEmpty(true),
+    sceneUpdateFlag( false ),
+    sceneUpdate( 0 ),
+    messageRing( SEGMENT_SIZE ),
+    coalescingEnabled( false ),
+    coalescibleMessages(),
+    elidedMessageCount( 0u ),
+    elidedMessageBytes( 0u )
+  {
   }
 
-  void DeleteBufferContents( MessageBuffer* buffer )
+  ~Impl()
   {
-    for( MessageBuffer::Iterator iter = buffer->Begin(); iter.IsValid(); iter.Next() )
+    // Delete the unprocessed messages, including the ones which were not flushed
+    messageRing.Publish();
+    messageRing.AcquireMessages();
+    while( unsigned int* slot = messageRing.ReadMessage() )
     {
-      MessageBase* message = reinterpret_cast< MessageBase* >( iter.Get() );
+      MessageBase* message = reinterpret_cast< MessageBase* >( slot );
 
       // Call virtual destructor explictly; since delete will not be called after placement new
       message->~MessageBase();
@@ -122,14 +230,14 @@ struct MessageQueue::Impl
   bool                     processingEvents;     ///< Whether messages queued will be flushed by core
   bool                     queueWasEmpty;        ///< Flag whether the queue was empty during the Update()
   bool                     sceneUpdateFlag;      ///< true when there is a new message that requires a scene-graph node tree update
-  int                      sceneUpdate;          ///< Non zero when there is a message in the queue requiring a scene-graph node tree update
+  volatile int             sceneUpdate;          ///< Non zero when there is a message in the queue requiring a scene-graph node tree update
 
-  MessageQueueMutex        queueMutex;           ///< queueMutex must be locked whilst accessing processQueue or recycleQueue
-  MessageBufferQueue       processQueue;         ///< to process in the next update
-  MessageBufferQueue       recycleQueue;         ///< to recycle MessageBuffers after the messages have been processed
+  MessageRing              messageRing;          ///< written by the event-thread and read by the update-thread, without locking
 
-  MessageBuffer*           currentMessageBuffer; ///< can be used without locking
-  MessageBufferQueue       freeQueue;            ///< buffers from the recycleQueue; can be used without locking
+  bool                        coalescingEnabled;   ///< Whether only the last message setting a property is processed
+  CoalescibleMessageIndex     coalescibleMessages; ///< The last message setting each property since the last flush or other message
+  unsigned int                elidedMessageCount;  ///< The number of messages which were not processed
+  std::size_t                 elidedMessageBytes;  ///< The size of the messages which were not processed
 };
 
 MessageQueue::MessageQueue( Integration::RenderController& controller, const SceneGraph::SceneGraphBuffers& buffers )
@@ -157,79 +265,81 @@ unsigned int* MessageQueue::ReserveMessageSlot( unsigned int requestedSize, bool
     mImpl->sceneUpdateFlag = true;
   }
 
-  if ( !mImpl->currentMessageBuffer )
+  // The order of the property messages must be kept with respect to the other messages, e.g. to connect a node
+  mImpl->coalescibleMessages.Clear();
+
+  // If we are inside Core::ProcessEvents(), core will automatically flush the queue.
+  // If we are outside, then we have to request a call to Core::ProcessEvents() on idle.
+  if ( false == mImpl->processingEvents )
   {
-    const MessageBufferIter endIter = mImpl->freeQueue.end();
+    mImpl->renderController.RequestProcessEventsOnIdle();
+  }
 
-    // Find the largest recycled buffer from freeQueue
-    MessageBufferIter nextBuffer = endIter;
-    for ( MessageBufferIter iter = mImpl->freeQueue.begin(); iter != endIter; ++iter )
-    {
-      if ( endIter == nextBuffer ||
-           (*nextBuffer)->GetCapacity() < (*iter)->GetCapacity() )
-      {
-        nextBuffer = iter;
-      }
-    }
+  return mImpl->messageRing.ReserveMessageSlot( requestedSize );
+}
 
-    if ( endIter != nextBuffer )
-    {
-      // Reuse a recycled buffer from freeQueue
-      mImpl->currentMessageBuffer = *nextBuffer;
-      mImpl->freeQueue.erase( nextBuffer );
-    }
-    else
-    {
-      mImpl->currentMessageBuffer = new MessageBuffer( INITIAL_BUFFER_SIZE );
-    }
+unsigned int* MessageQueue::ReserveMessageSlot( unsigned int requestedSize, const MessageKey& key )
+{
+  if( !mImpl->coalescingEnabled )
+  {
+    return ReserveMessageSlot( requestedSize, true );
   }
 
-  // If we are inside Core::ProcessEvents(), core will automatically flush the queue.
-  // If we are outside, then we have to request a call to Core::ProcessEvents() on idle.
+  mImpl->sceneUpdateFlag = true;
+
   if ( false == mImpl->processingEvents )
   {
     mImpl->renderController.RequestProcessEventsOnIdle();
   }
 
-  return mImpl->currentMessageBuffer->ReserveMessageSlot( requestedSize );
+  unsigned int* slot = mImpl->messageRing.ReserveMessageSlot( requestedSize );
+
+  CoalescibleMessage& previous = mImpl->coalescibleMessages.Find( key );
+  if( previous.slot )
+  {
+    // The previous message is replaced in place, as the messages reserved afterwards must not move
+    MessageBase* message = reinterpret_cast< MessageBase* >( previous.slot );
+    message->~MessageBase();
+    new ( previous.slot ) ElidedMessage();
+
+    ++mImpl->elidedMessageCount;
+    mImpl->elidedMessageBytes += previous.size;
+  }
+  previous.slot = slot;
+  previous.size = requestedSize;
+
+  return slot;
 }
 
-bool MessageQueue::FlushQueue()
+void MessageQueue::SetCoalescingEnabled( bool enabled )
 {
-  const bool messagesToProcess = ( NULL != mImpl->currentMessageBuffer );
+  mImpl->coalescingEnabled = enabled;
+  mImpl->coalescibleMessages.Clear();
+}
 
-  // If there're messages to flush
-  if ( messagesToProcess )
-  {
-    // queueMutex must be locked whilst accessing processQueue or recycleQueue
-    MessageQueueMutex::ScopedLock lock( mImpl->queueMutex );
+unsigned int MessageQueue::GetElidedMessageCount() const
+{
+  return mImpl->elidedMessageCount;
+}
 
-    mImpl->processQueue.push_back( mImpl->currentMessageBuffer );
-    mImpl->currentMessageBuffer = NULL;
+std::size_t MessageQueue::GetElidedMessageBytes() const
+{
+  return mImpl->elidedMessageBytes;
+}
 
-    // Grab any recycled MessageBuffers
-    while ( !mImpl->recycleQueue.empty() )
-    {
-      MessageBuffer* recycled = mImpl->recycleQueue.back();
-      mImpl->recycleQueue.pop_back();
+bool MessageQueue::FlushQueue()
+{
+  // The flushed messages may be processed at any time
+  mImpl->coalescibleMessages.Clear();
 
-      // Guard against excessive message buffer growth
-      if ( MAX_FREE_BUFFER_COUNT < mImpl->freeQueue.size() ||
-           MAX_BUFFER_CAPACITY   < recycled->GetCapacity() )
-      {
-        delete recycled;
-      }
-      else
-      {
-        mImpl->freeQueue.push_back( recycled );
-      }
-    }
+  // If there're messages to flush, they become visible to the update-thread
+  const bool messagesToProcess = mImpl->messageRing.Publish();
 
-    if( mImpl->sceneUpdateFlag )
-    {
-      mImpl->sceneUpdate |= 2;
-      mImpl->sceneUpdateFlag = false;
-    }
+  // The flag is set after publishing, so the messages are there when the update-thread sees it
+  if( messagesToProcess && mImpl->sceneUpdateFlag )
+  {
+    __sync_fetch_and_or( &mImpl->sceneUpdate, 2 );
+    mImpl->sceneUpdateFlag = false;
   }
 
   mImpl->processingEvents = false;
@@ -241,34 +351,31 @@ void MessageQueue::ProcessMessages( BufferIndex updateBufferIndex )
 {
   PERF_MONITOR_START(PerformanceMonitor::PROCESS_MESSAGES);
 
-  // queueMutex must be locked whilst accessing queue
-  MessageQueueMutex::ScopedLock lock( mImpl->queueMutex );
+  // Only the messages flushed so far are processed
+  const bool messagesToProcess = mImpl->messageRing.AcquireMessages();
 
-  const MessageBufferIter processQueueEndIter = mImpl->processQueue.end();
-  for ( MessageBufferIter iter = mImpl->processQueue.begin(); iter != processQueueEndIter ; ++iter )
+  while( unsigned int* slot = mImpl->messageRing.ReadMessage() )
   {
-    MessageBuffer* buffer = *iter;
-
-    for( MessageBuffer::Iterator iter = buffer->Begin(); iter.IsValid(); iter.Next() )
-    {
-      MessageBase* message = reinterpret_cast< MessageBase* >( iter.Get() );
+    MessageBase* message = reinterpret_cast< MessageBase* >( slot );
 
-      message->Process( updateBufferIndex  );
+    message->Process( updateBufferIndex  );
 
-      // Call virtual destructor explictly; since delete will not be called after placement new
-      message->~MessageBase();
-    }
-    buffer->Reset();
-
-    // Pass back for use in the event-thread
-    mImpl->recycleQueue.push_back( buffer );
+    // Call virtual destructor explictly; since delete will not be called after placement new
+    message->~MessageBase();
   }
 
-  mImpl->sceneUpdate >>= 1;
+  // Pass the memory back for use in the event-thread
+  mImpl->messageRing.ReleaseMessages();
 
-  mImpl->queueWasEmpty = mImpl->processQueue.empty(); // Flag whether we processed anything
+  // The event-thread may set the flag meanwhile
+  int sceneUpdate;
+  do
+  {
+    sceneUpdate = mImpl->sceneUpdate;
+  }
+  while( !__sync_bool_compare_and_swap( &mImpl->sceneUpdate, sceneUpdate, sceneUpdate >> 1 ) );
 
-  mImpl->processQueue.clear();
+  mImpl->queueWasEmpty = !messagesToProcess; // Flag whether we processed anything
 
   PERF_MONITOR_END(PerformanceMonitor::PROCESS_MESSAGES);
 }
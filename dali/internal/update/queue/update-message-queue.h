@@ -18,6 +18,9 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <cstddef>
+
 // INTERNAL INCLUDES
 #include <dali/internal/common/buffer-index.h>
 #include <dali/internal/update/common/scene-graph-buffers.h>
@@ -33,6 +36,7 @@ class RenderController;
 namespace Internal
 {
 class MessageBase;
+class MessageKey;
 
 namespace SceneGraph
 {
@@ -76,6 +80,35 @@ public:
    */
   unsigned int* ReserveMessageSlot( unsigned int size, bool updateScene );
 
+  /**
+   * Reserve space for a message which sets a property to an absolute value.
+   * When coalescing is enabled, the previous message with the same key is not processed, unless
+   * the queue has been flushed, or another kind of message has been reserved, since then.
+   * The message requires an update of the scene-graph node tree.
+   * @param[in] size the message size with respect to the size of type 'char'
+   * @param[in] key Identifies the property and how it is set
+   * @return A pointer to the first char allocated for the message
+   */
+  unsigned int* ReserveMessageSlot( unsigned int size, const MessageKey& key );
+
+  /**
+   * Enable or disable the coalescing of the messages setting the same property.
+   * @param[in] enabled True to process only the last of these messages; false by default.
+   */
+  void SetCoalescingEnabled( bool enabled );
+
+  /**
+   * Query the number of messages which were not processed, due to coalescing.
+   * @return The number of messages.
+   */
+  unsigned int GetElidedMessageCount() const;
+
+  /**
+   * Query the size of the messages which were not processed, due to coalescing.
+   * @return The size with respect to the size of type 'char'.
+   */
+  std::size_t GetElidedMessageBytes() const;
+
   /**
    * Flushes the message queue
    * @return true if there are messages to process
@@ -452,6 +452,18 @@ bool Camera::CheckSphereInFrustum( BufferIndex bufferIndex, const Vector3& origi
   return true;
 }
 
+void Camera::GetFrustumPlanes( BufferIndex bufferIndex, Vec4* planes ) const
+{
+  const FrustumPlanes& frustum = mFrustum[ bufferIndex ];
+  for ( uint32_t i = 0; i < 6; ++i )
+  {
+    planes[ i ][ 0 ] = frustum.mPlanes[ i ].mNormal.x;
+    planes[ i ][ 1 ] = frustum.mPlanes[ i ].mNormal.y;
+    planes[ i ][ 2 ] = frustum.mPlanes[ i ].mNormal.z;
+    planes[ i ][ 3 ] = frustum.mPlanes[ i ].mDistance;
+  }
+}
+
 bool Camera::CheckAABBInFrustum( BufferIndex bufferIndex, const Vector3& origin, const Vector3& halfExtents )
 {
   const FrustumPlanes& planes = mFrustum[ bufferIndex ];
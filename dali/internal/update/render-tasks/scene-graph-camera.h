@@ -21,6 +21,7 @@
 // INTERNAL INCLUDES
 #include <dali/public-api/math/rect.h>
 #include <dali/public-api/actors/camera-actor.h>
+#include <dali/internal/common/math.h>
 #include <dali/internal/common/message.h>
 #include <dali/internal/event/common/event-thread-services.h>
 #include <dali/internal/update/common/double-buffered.h>
@@ -176,6 +177,14 @@ public:
    */
   bool CheckSphereInFrustum( BufferIndex bufferIndex, const Vector3& origin, float radius );
 
+  /**
+   * @brief Retrieves the planes of the view frustum, e.g. to test many spheres at once with CullSpheres().
+   *
+   * @param[in] bufferIndex The buffer to read from.
+   * @param[out] planes The six planes; xyz is the normal and w is the distance.
+   */
+  void GetFrustumPlanes( BufferIndex bufferIndex, Vec4* planes ) const;
+
   /**
    * @brief Check to see if a bounding box lies within the view frustum.
    *
@@ -498,6 +498,11 @@ void RenderTask::SetSyncRequired( bool requiresSync )
   mRequiresSync = requiresSync;
 }
 
+DamageTracker& RenderTask::GetDamageTracker()
+{
+  return mDamageTracker;
+}
+
 void RenderTask::ResetDefaultProperties( BufferIndex updateBufferIndex )
 {
   // Reset default properties
@@ -532,7 +537,8 @@ RenderTask::RenderTask()
   mFrameCounter( 0u ),
   mRenderedOnceCounter( 0u ),
   mTargetIsNativeFramebuffer( false ),
-  mRequiresSync( false )
+  mRequiresSync( false ),
+  mDamageTracker()
 {
 }
 
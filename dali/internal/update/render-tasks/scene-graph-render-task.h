@@ -26,6 +26,7 @@
 #include <dali/internal/event/common/event-thread-services.h>
 #include <dali/internal/update/common/property-owner.h>
 #include <dali/internal/update/common/animatable-property.h>
+#include <dali/internal/update/manager/damage-tracker.h>
 #include <dali/internal/render/renderers/render-frame-buffer.h>
 
 namespace Dali
@@ -348,6 +349,12 @@ public:
    */
   void SetSyncRequired( bool requiresSync );
 
+  /**
+   * Retrieve the tracker of the areas damaged by this render task when rendering on-screen.
+   * @return The damage tracker
+   */
+  DamageTracker& GetDamageTracker();
+
 private:
 
   /**
@@ -398,6 +405,8 @@ private:
   bool mTargetIsNativeFramebuffer; ///< Tells if our target is a native framebuffer
   bool mRequiresSync;              ///< Whether sync is needed to track the render
 
+  DamageTracker mDamageTracker;    ///< Tracks the areas which changed since the previous frame, for partial updates
+
 };
 
 // Messages for RenderTask
@@ -146,6 +146,7 @@ Renderer::Renderer()
   mResourcesReady( false ),
   mFinishedResourceAcquisition( false ),
   mPremultipledAlphaEnabled( false ),
+  mChanged( false ),
   mDepthIndex( 0 )
 {
   mUniformMapChanged[0] = false;
@@ -177,6 +178,13 @@ void Renderer::operator delete( void* ptr )
 
 void Renderer::PrepareRender( BufferIndex updateBufferIndex )
 {
+  PrepareUniformMap( updateBufferIndex );
+  SendPendingMessages( updateBufferIndex );
+}
+
+void Renderer::PrepareUniformMap( BufferIndex updateBufferIndex )
+{
+  mChanged = ( mResendFlag != 0 ) || ( mRegenerateUniformMap > UNIFORM_MAP_READY );
   mResourcesReady = false;
   mFinishedResourceAcquisition = false;
 
@@ -230,7 +238,10 @@ void Renderer::PrepareRender( BufferIndex updateBufferIndex )
     mUniformMapChanged[updateBufferIndex] = true;
     mRegenerateUniformMap--;
   }
+}
 
+void Renderer::SendPendingMessages( BufferIndex updateBufferIndex )
+{
   if( mResendFlag != 0 )
   {
     if( mResendFlag & RESEND_DATA_PROVIDER )
@@ -245,6 +245,29 @@ public:
    */
   void PrepareRender( BufferIndex updateBufferIndex );
 
+  /**
+   * First part of PrepareRender(); updates the resource status and collects the uniform map.
+   * Only modifies this renderer so it can be called for different renderers concurrently.
+   * @param[in] updateBufferIndex The current update buffer index.
+   */
+  void PrepareUniformMap( BufferIndex updateBufferIndex );
+
+  /**
+   * Second part of PrepareRender(); sends the changes made since the last frame to the render thread renderer.
+   * Writes to the render queue so it must only be called from the update thread.
+   * @param[in] updateBufferIndex The current update buffer index.
+   */
+  void SendPendingMessages( BufferIndex updateBufferIndex );
+
+  /**
+   * Query whether the data sent to the render thread renderer has changed in the last PrepareRender().
+   * @return True if the renderer, its shader, geometry or textures have changed
+   */
+  bool HasChanged() const
+  {
+    return mChanged;
+  }
+
   /*
    * Retrieve the Render thread renderer
    * @return The associated render thread renderer
@@ -387,6 +410,7 @@ private:
   bool                         mResourcesReady;                   ///< Set during the Update algorithm; true if the renderer has resources ready for the current frame.
   bool                         mFinishedResourceAcquisition;      ///< Set during DoPrepareResources; true if ready & all resource acquisition has finished (successfully or otherwise)
   bool                         mPremultipledAlphaEnabled:1;       ///< Flag indicating whether the Pre-multiplied Alpha Blending is required
+  bool                         mChanged:1;                        ///< Set during PrepareRender; true if data has to be sent to the render thread renderer this frame
 
 public:
 
@@ -69,6 +69,7 @@ typedef NotifyQueue::iterator                   NotifyQueueIter;
 
 typedef Dali::Vector<TextureMetadata>           TextureMetadataCache;
 typedef TextureMetadataCache::Iterator          TextureMetadataIter;
+typedef Dali::Vector<unsigned int>              TextureMetadataIndices;
 
 static inline bool RemoveId( LiveRequestContainer& container, ResourceId id )
 {
@@ -101,6 +102,72 @@ struct ResourceManager::ResourceManagerImpl
   {
   }
 
+  /**
+   * Find the metadata of a texture in constant time.
+   * @param[in] id The resource id of the texture.
+   * @return The metadata, or NULL if there is none.
+   */
+  TextureMetadata* FindTextureMetadata( ResourceId id )
+  {
+    if( id < mTextureMetadataIndices.Count() )
+    {
+      const unsigned int index = mTextureMetadataIndices[ id ];
+      if( 0u != index )
+      {
+        return &mTextureMetadata[ index - 1u ];
+      }
+    }
+    return NULL;
+  }
+
+  /**
+   * Add the metadata of a texture, replacing the previous metadata of the same texture.
+   * @param[in] metadata The metadata.
+   */
+  void AddTextureMetadata( const TextureMetadata& metadata )
+  {
+    const ResourceId id = metadata.GetId();
+    TextureMetadata* existing = FindTextureMetadata( id );
+    if( existing )
+    {
+      *existing = metadata;
+      return;
+    }
+
+    if( id >= mTextureMetadataIndices.Count() )
+    {
+      if( id >= mTextureMetadataIndices.Capacity() )
+      {
+        // The ids are allocated in sequence; grow geometrically
+        mTextureMetadataIndices.Reserve( ( id + 1u ) * 2u );
+      }
+      mTextureMetadataIndices.Resize( id + 1u, 0u );
+    }
+
+    mTextureMetadata.PushBack( metadata );
+    mTextureMetadataIndices[ id ] = mTextureMetadata.Count();
+  }
+
+  /**
+   * Remove the metadata of a texture; the last metadata takes its place.
+   * @param[in] id The resource id of the texture.
+   */
+  void RemoveTextureMetadata( ResourceId id )
+  {
+    TextureMetadata* metadata = FindTextureMetadata( id );
+    if( metadata )
+    {
+      TextureMetadata& last = mTextureMetadata[ mTextureMetadata.Count() - 1u ];
+      if( metadata != &last )
+      {
+        *metadata = last;
+        mTextureMetadataIndices[ last.GetId() ] = mTextureMetadataIndices[ id ];
+      }
+      mTextureMetadata.Erase( mTextureMetadata.End() - 1u );
+      mTextureMetadataIndices[ id ] = 0u;
+    }
+  }
+
   PlatformAbstraction&        mPlatformAbstraction;
   NotificationManager&        mNotificationManager;
   ResourceClient*             mResourceClient; // (needs to be a ptr - it's not instantiated yet)
@@ -135,6 +202,7 @@ struct ResourceManager::ResourceManagerImpl
    * This is the resource cache; metadata of the textures
    */
   TextureMetadataCache mTextureMetadata;
+  TextureMetadataIndices mTextureMetadataIndices; ///< Index + 1 of the metadata of each resource id, or zero
 };
 
 ResourceManager::ResourceManager( PlatformAbstraction& platformAbstraction,
@@ -259,7 +327,7 @@ void ResourceManager::HandleAddBitmapImageRequest( ResourceId id, BitmapPtr bitm
   DALI_LOG_INFO(Debug::Filter::gResource, Debug::General, "ResourceManager: HandleAddBitmapImageRequest(id:%u)\n", id);
 
   mImpl->oldCompleteRequests.insert(id);
-  mImpl->mTextureMetadata.PushBack( TextureMetadata::New( id, bitmap.Get() ) );
+  mImpl->AddTextureMetadata( TextureMetadata::New( id, bitmap.Get() ) );
   mImpl->mTextureCacheDispatcher.DispatchCreateTextureForBitmap( id, bitmap.Get() );
 }
 
@@ -270,7 +338,7 @@ void ResourceManager::HandleAddNativeImageRequest(ResourceId id, NativeImageInte
 
   mImpl->oldCompleteRequests.insert(id);
 
-  mImpl->mTextureMetadata.PushBack( TextureMetadata::New( id, nativeImage ) );
+  mImpl->AddTextureMetadata( TextureMetadata::New( id, nativeImage ) );
   mImpl->mTextureCacheDispatcher.DispatchCreateTextureForNativeImage( id, nativeImage );
 }
 
@@ -283,7 +351,7 @@ void ResourceManager::HandleAddFrameBufferImageRequest( ResourceId id, unsigned
 
   TextureMetadata bitmapMetadata = TextureMetadata::New( id, width, height, Pixel::HasAlpha(pixelFormat) );
   bitmapMetadata.SetIsFramebuffer(true);
-  mImpl->mTextureMetadata.PushBack( bitmapMetadata );
+  mImpl->AddTextureMetadata( bitmapMetadata );
 
   mImpl->mTextureCacheDispatcher.DispatchCreateTextureForFrameBuffer( id, width, height, pixelFormat, bufferFormat );
 }
@@ -298,7 +366,7 @@ void ResourceManager::HandleAddFrameBufferImageRequest( ResourceId id, NativeIma
   TextureMetadata bitmapMetadata = TextureMetadata::New(id, nativeImage);
   bitmapMetadata.SetIsNativeImage(true);
   bitmapMetadata.SetIsFramebuffer(true);
-  mImpl->mTextureMetadata.PushBack( bitmapMetadata );
+  mImpl->AddTextureMetadata( bitmapMetadata );
 
   mImpl->mTextureCacheDispatcher.DispatchCreateTextureForFrameBuffer( id, nativeImage );
 }
@@ -310,7 +378,7 @@ void ResourceManager::HandleAllocateTextureRequest( ResourceId id, unsigned int
   mImpl->oldCompleteRequests.insert(id);
   // atlas needs metadata as well
   TextureMetadata bitmapMetadata = TextureMetadata::New( id, width, height, Pixel::HasAlpha(pixelFormat) );
-  mImpl->mTextureMetadata.PushBack( bitmapMetadata );
+  mImpl->AddTextureMetadata( bitmapMetadata );
 
   mImpl->mTextureCacheDispatcher.DispatchCreateTexture( id, width, height, pixelFormat, true /* true = clear the texture */ );
 }
@@ -429,20 +497,7 @@ void ResourceManager::HandleDiscardResourceRequest( ResourceId deadId, ResourceT
        typeId == ResourceTargetImage )
     {
       // remove the meta data
-
-      TextureMetadataCache::Iterator iter = mImpl->mTextureMetadata.Begin();
-      const TextureMetadataCache::Iterator end = mImpl->mTextureMetadata.End();
-      for( ; iter != end; ++iter )
-      {
-        if( (*iter).GetId() == deadId )
-        {
-          break;
-        }
-      }
-      if( iter != end )
-      {
-        mImpl->mTextureMetadata.Erase( iter );
-      }
+      mImpl->RemoveTextureMetadata( deadId );
 
       // destroy the texture
       mImpl->mTextureCacheDispatcher.DispatchDiscardTexture( deadId );
@@ -539,17 +594,11 @@ bool ResourceManager::HasFrameBufferBeenRenderedTo( ResourceId id ) const
 
 bool ResourceManager::GetTextureMetadata( ResourceId id, TextureMetadata*& metadata ) const
 {
-  if( id > 0 )
+  TextureMetadata* found = mImpl->FindTextureMetadata( id );
+  if( found )
   {
-    const size_t count = mImpl->mTextureMetadata.Count();
-    for( size_t index = 0; index < count; ++index )
-    {
-      if( id == mImpl->mTextureMetadata[ index ].GetId() )
-      {
-        metadata = &mImpl->mTextureMetadata[ index ];
-        return true;
-      }
-    }
+    metadata = found;
+    return true;
   }
 
   return false;
@@ -601,24 +650,16 @@ void ResourceManager::LoadResponse( ResourceId id, ResourceTypeId type, Resource
         UpdateImageTicket (id, attrs);
 
         // Check for reloaded bitmap
-        TextureMetadataCache::Iterator iter = mImpl->mTextureMetadata.Begin();
-        const TextureMetadataCache::Iterator end = mImpl->mTextureMetadata.End();
-        for( ; iter != end; ++iter )
-        {
-          if( (*iter).GetId() == id )
-          {
-            break;
-          }
-        }
-        if( iter != end )
+        TextureMetadata* metadata = mImpl->FindTextureMetadata( id );
+        if( metadata )
         {
-          iter->Update( bitmap );
+          metadata->Update( bitmap );
           mImpl->mTextureCacheDispatcher.DispatchUpdateTexture( id, bitmap );
         }
         else
         {
           mImpl->mTextureCacheDispatcher.DispatchCreateTextureForBitmap( id, bitmap );
-          mImpl->mTextureMetadata.PushBack( TextureMetadata::New( id, bitmap ) );
+          mImpl->AddTextureMetadata( TextureMetadata::New( id, bitmap ) );
         }
 
         break;
@@ -630,7 +671,7 @@ void ResourceManager::LoadResponse( ResourceId id, ResourceTypeId type, Resource
 
         ImageAttributes attrs = ImageAttributes::New(nativeImg->GetWidth(), nativeImg->GetHeight());
 
-        mImpl->mTextureMetadata.PushBack( TextureMetadata::New( id, nativeImg ) );
+        mImpl->AddTextureMetadata( TextureMetadata::New( id, nativeImg ) );
         mImpl->mTextureCacheDispatcher.DispatchCreateTextureForNativeImage( id, nativeImg );
 
         UpdateImageTicket (id, attrs);